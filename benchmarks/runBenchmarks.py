@@ -306,10 +306,15 @@ class Benchmark:
         else:
             submissionCommand += ["-t", "spot,profile.mpi"]
         
-        submissionCommand = map( str, submissionCommand )
+        # Pin the number of OpenMP threads of each rank to the requested threads per task.
+        env = dict( os.environ )
+        if self.threadsPerTask is not None:
+            env[ "OMP_NUM_THREADS" ] = str( self.threadsPerTask )
+
+        submissionCommand = list( map( str, submissionCommand ) )
         with open( self.outputFile, "w" ) as outputFile:
             outputFile.write( "{}\n\n".format( " ".join( submissionCommand ) ) )
-            self.process = subprocess.Popen( submissionCommand, cwd=self.outputDir, stdout=outputFile, stderr=subprocess.STDOUT )
+            self.process = subprocess.Popen( submissionCommand, cwd=self.outputDir, env=env, stdout=outputFile, stderr=subprocess.STDOUT )
 
         self.status = Status.SUBMITTED
 
@@ -113,15 +113,33 @@ bool MpiWrapper::initialized()
 #endif
 }
 
-int MpiWrapper::init( int * argc, char * * * argv )
+int MpiWrapper::init( int * argc, char * * * argv, bool const threadMultiple )
 {
 #ifdef GEOSX_USE_MPI
-  return MPI_Init( argc, argv );
+  if( !threadMultiple )
+  {
+    return MPI_Init( argc, argv );
+  }
+  // the library may provide a lower level, which is checked with isThreadMultiple() by the components that need it
+  int provided = MPI_THREAD_SINGLE;
+  return MPI_Init_thread( argc, argv, MPI_THREAD_MULTIPLE, &provided );
 #else
+  GEOSX_UNUSED_VAR( argc, argv, threadMultiple );
   return 0;
 #endif
 }
 
+bool MpiWrapper::isThreadMultiple()
+{
+#ifdef GEOSX_USE_MPI
+  int provided = MPI_THREAD_SINGLE;
+  MPI_CHECK_ERROR( MPI_Query_thread( &provided ) );
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif
+}
+
 void MpiWrapper::finalize()
 {
 #ifdef GEOSX_USE_MPI
@@ -287,6 +305,22 @@ int MpiWrapper::waitAll( int count, MPI_Request array_of_requests[], MPI_Status
   return 0;
 }
 
+int MpiWrapper::startAll( int count, MPI_Request array_of_requests[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#endif
+  return 0;
+}
+
+int MpiWrapper::requestFree( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#endif
+  return 0;
+}
+
 double MpiWrapper::wtime( void )
 {
 #ifdef GEOSX_USE_MPI
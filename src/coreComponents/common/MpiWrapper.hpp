@@ -157,7 +157,21 @@ public:
 
   static bool initialized();
 
-  static int init( int * argc, char * * * argv );
+  /**
+   * @brief Initialize MPI.
+   * @param argc the number of command line arguments
+   * @param argv the command line arguments
+   * @param threadMultiple whether to request MPI_THREAD_MULTIPLE support, only needed by components
+   *   communicating from a background thread
+   * @return the MPI error code
+   */
+  static int init( int * argc, char * * * argv, bool const threadMultiple = false );
+
+  /**
+   * @brief Check whether MPI may be called concurrently from multiple threads.
+   * @return true if MPI was initialized with MPI_THREAD_MULTIPLE support
+   */
+  static bool isThreadMultiple();
 
   static void finalize();
 
@@ -214,6 +228,10 @@ public:
 
   static int waitAll( int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[] );
 
+  static int startAll( int count, MPI_Request array_of_requests[] );
+
+  static int requestFree( MPI_Request * request );
+
   static double wtime( void );
 
 
@@ -332,6 +350,42 @@ public:
                          int * displacements,
                          MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoall.
+   * @tparam T The type of the values to exchange
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] count The number of values sent to (and received from) each process.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoall().
+   */
+  template< typename T >
+  static int allToAll( T const * sendbuf,
+                       int count,
+                       T * recvbuf,
+                       MPI_Comm comm );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoallv.
+   * @tparam T The type of the values to exchange
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] sendcounts The number of values sent to each process.
+   * @param[in] sdispls The offset of the values sent to each process in \p sendbuf.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] recvcounts The number of values received from each process.
+   * @param[in] rdispls The offset of the values received from each process in \p recvbuf.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoallv().
+   */
+  template< typename T >
+  static int allToAllv( T const * sendbuf,
+                        int const * sendcounts,
+                        int const * sdispls,
+                        T * recvbuf,
+                        int const * recvcounts,
+                        int const * rdispls,
+                        MPI_Comm comm );
+
   /**
    * @brief Convenience function for MPI_Allgather.
    * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
@@ -486,6 +540,42 @@ public:
                     MPI_Comm comm,
                     MPI_Request * request );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Send_init()
+   * @param[in] buf The pointer to the buffer that contains the data to be sent.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] dest The rank of the destination process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request, to be started with startAll().
+   * @return
+   */
+  template< typename T >
+  static int sendInit( T const * const buf,
+                       int count,
+                       int dest,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Recv_init()
+   * @param[out] buf The pointer to the buffer that receives the data.
+   * @param[in] count The number of elements in \p buf
+   * @param[in] source The rank of the source process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages
+   * @param[in] comm The handle to the MPI_Comm
+   * @param[out] request Pointer to the persistent MPI_Request, to be started with startAll().
+   * @return
+   */
+  template< typename T >
+  static int recvInit( T * const buf,
+                       int count,
+                       int source,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
   /**
    * @brief Compute exclusive prefix sum and full sum
    * @tparam T type of local (rank) value
@@ -677,6 +767,41 @@ int MpiWrapper::allgatherv( T_SEND const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::allToAll( T const * const sendbuf,
+                          int count,
+                          T * const recvbuf,
+                          MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Alltoall( sendbuf, count, internal::getMpiType< T >(),
+                       recvbuf, count, internal::getMpiType< T >(),
+                       comm );
+#else
+  std::copy( sendbuf, sendbuf + count, recvbuf );
+  return 0;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::allToAllv( T const * const sendbuf,
+                           int const * sendcounts,
+                           int const * sdispls,
+                           T * const recvbuf,
+                           int const * MPI_PARAM( recvcounts ),
+                           int const * rdispls,
+                           MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Alltoallv( sendbuf, sendcounts, sdispls, internal::getMpiType< T >(),
+                        recvbuf, recvcounts, rdispls, internal::getMpiType< T >(),
+                        comm );
+#else
+  std::copy( sendbuf + sdispls[0], sendbuf + sdispls[0] + sendcounts[0], recvbuf + rdispls[0] );
+  return 0;
+#endif
+}
+
 
 template< typename T >
 void MpiWrapper::allGather( T const myValue, array1d< T > & allValues, MPI_Comm MPI_PARAM( comm ) )
@@ -964,6 +1089,38 @@ int MpiWrapper::iSend( T const * const buf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::sendInit( T const * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( dest ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Send_init( buf, count, internal::getMpiType< T >(), dest, tag, comm, request );
+#else
+  GEOSX_ERROR( "Persistent requests are not supported without MPI" );
+  return 1;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::recvInit( T * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( source ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Recv_init( buf, count, internal::getMpiType< T >(), source, tag, comm, request );
+#else
+  GEOSX_ERROR( "Persistent requests are not supported without MPI" );
+  return 1;
+#endif
+}
+
 template< typename U, typename T >
 U MpiWrapper::prefixSum( T const value, MPI_Comm comm )
 {
@@ -27,6 +27,8 @@
 #endif
 
 // System includes
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 
 #if defined( GEOSX_USE_MKL )
@@ -109,7 +111,12 @@ void setupMPI( int argc, char * argv[] )
 {
   if( !MpiWrapper::initialized() )
   {
-    MpiWrapper::init( &argc, &argv );
+    // the command line is parsed after MPI is initialized, so only look for the thread support option here
+    bool const threadMultiple = std::any_of( argv, argv + argc, []( char const * const arg )
+    {
+      return std::strcmp( arg, "--mpi-thread-multiple" ) == 0;
+    } );
+    MpiWrapper::init( &argc, &argv, threadMultiple );
   }
 
   MPI_COMM_GEOSX = MpiWrapper::commDup( MPI_COMM_WORLD );
@@ -116,6 +116,29 @@ public:
   }
 
 private:
+
+  /// The batched updates reuse the plastic return mapping
+  friend struct SmallStrainBatchUpdate< DruckerPragerUpdates >;
+
+  /**
+   * @brief Plastic corrector, for a trial stress lying outside of the yield surface.
+   * @param[in] k the element index
+   * @param[in] q the quadrature point index
+   * @param[in] trialP the mean stress of the trial stress
+   * @param[in] trialQ the von Mises stress of the trial stress
+   * @param[in] deviator the unit deviator of the trial stress
+   * @param[out] stress the returned stress, also saved as the new stress
+   * @param[out] stiffness the consistent tangent stiffness
+   */
+  GEOSX_HOST_DEVICE
+  void plasticReturnMapping( localIndex const k,
+                             localIndex const q,
+                             real64 const trialP,
+                             real64 const trialQ,
+                             real64 const ( &deviator )[6],
+                             real64 ( &stress )[6],
+                             real64 ( &stiffness )[6][6] ) const;
+
   /// A reference to the ArrayView holding the friction angle for each element.
   arrayView1d< real64 const > const m_friction;
 
@@ -173,6 +196,20 @@ void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
 
   // else, plasticity (trial stress point lies outside yield surface)
 
+  plasticReturnMapping( k, q, trialP, trialQ, deviator, stress, stiffness );
+}
+
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void DruckerPragerUpdates::plasticReturnMapping( localIndex const k,
+                                                 localIndex const q,
+                                                 real64 const trialP,
+                                                 real64 const trialQ,
+                                                 real64 const ( &deviator )[6],
+                                                 real64 ( & stress )[6],
+                                                 real64 ( & stiffness )[6][6] ) const
+{
   // the return mapping can in general be written as a newton iteration.
   // here we have a linear problem, so the algorithm will converge in one
   // iteration, but this is a template for more general models with either
@@ -303,6 +340,104 @@ void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
 }
 
 
+/**
+ * @brief Batched updates of the Drucker-Prager model.
+ *
+ * The elastic predictor and the yield check are vectorized over the tile, and
+ * only the material points lying outside of the yield surface go through the
+ * (scalar) plastic return mapping.
+ */
+template<>
+struct SmallStrainBatchUpdate< DruckerPragerUpdates >
+{
+  /**
+   * @copydoc SmallStrainBatchUpdate::smallStrainUpdate_StressOnly
+   *
+   * As the point-wise version, the stress-only update is the elastic one.
+   */
+  template< int BATCH_SIZE >
+  GEOSX_HOST_DEVICE
+  static void smallStrainUpdate_StressOnly( DruckerPragerUpdates const & update,
+                                            SmallStrainBatch< BATCH_SIZE > & batch )
+  {
+    SmallStrainBatchUpdate< ElasticIsotropicUpdates >::smallStrainUpdate_StressOnly( update, batch );
+  }
+
+  /**
+   * @copydoc SmallStrainBatchUpdate::smallStrainUpdate
+   */
+  template< int BATCH_SIZE >
+  GEOSX_HOST_DEVICE
+  static void smallStrainUpdate( DruckerPragerUpdates const & update,
+                                 SmallStrainBatch< BATCH_SIZE > & batch,
+                                 real64 ( & stiffness )[6][6][BATCH_SIZE] )
+  {
+    // elastic predictor for the whole tile
+
+    SmallStrainBatchUpdate< ElasticIsotropicUpdates >::smallStrainUpdate( update, batch, stiffness );
+
+    if( update.m_disableInelasticity )
+    {
+      return;
+    }
+
+    // stress invariants and yield function, using old hardening variable state
+
+    real64 trialP[ BATCH_SIZE ];
+    real64 trialQ[ BATCH_SIZE ];
+    real64 yield[ BATCH_SIZE ];
+    for( int p = 0; p < BATCH_SIZE; ++p )
+    {
+      // same operations as twoInvariant::stressDecomposition
+      trialP[ p ] = ( batch.stress[ 0 ][ p ] + batch.stress[ 1 ][ p ] + batch.stress[ 2 ][ p ] ) / 3;
+
+      real64 devStress = 0;
+      for( int i = 0; i < 3; ++i )
+      {
+        real64 const deviator = batch.stress[ i ][ p ] - trialP[ p ];
+        devStress += deviator * deviator;
+        devStress += 2 * batch.stress[ i+3 ][ p ] * batch.stress[ i+3 ][ p ];
+      }
+      trialQ[ p ] = sqrt( devStress ) * sqrt( 3./2. );
+
+      localIndex const k = batch.k[ p ];
+      yield[ p ] = trialQ[ p ] + update.m_friction[ k ] * trialP[ p ] - update.m_oldCohesion[ k ][ batch.q[ p ] ];
+    }
+
+    // plastic corrector, only for the points lying outside of the yield surface
+
+    for( int p = 0; p < batch.numPoints; ++p )
+    {
+      if( yield[ p ] < 1e-9 )
+      {
+        continue;
+      }
+
+      real64 stress[6];
+      batch.getStress( p, stress );
+
+      real64 deviator[6];
+      twoInvariant::stressDecomposition( stress,
+                                         trialP[ p ],
+                                         trialQ[ p ],
+                                         deviator );
+
+      real64 pointStiffness[6][6];
+      update.plasticReturnMapping( batch.k[ p ], batch.q[ p ], trialP[ p ], trialQ[ p ], deviator, stress, pointStiffness );
+
+      for( int i = 0; i < 6; ++i )
+      {
+        batch.stress[ i ][ p ] = stress[ i ];
+        for( int j = 0; j < 6; ++j )
+        {
+          stiffness[ i ][ j ][ p ] = pointStiffness[ i ][ j ];
+        }
+      }
+    }
+  }
+};
+
+
 
 /**
  * @class DruckerPrager
@@ -155,6 +155,9 @@ public:
 
 protected:
 
+  /// The batched updates read the moduli directly
+  friend struct SmallStrainBatchUpdate< ElasticIsotropicUpdates >;
+
   /// A reference to the ArrayView holding the bulk modulus for each element.
   arrayView1d< real64 const > const m_bulkModulus;
 
@@ -354,6 +357,108 @@ void ElasticIsotropicUpdates::smallStrainUpdate( localIndex const k,
  */
 
 
+/**
+ * @brief Vectorized batched updates of the elastic isotropic model.
+ *
+ * The moduli and the old stresses of the tile are gathered first, the stresses are then
+ * computed with loops over the material points only, and finally stored back.
+ */
+template<>
+struct SmallStrainBatchUpdate< ElasticIsotropicUpdates >
+{
+  /**
+   * @copydoc SmallStrainBatchUpdate::smallStrainUpdate_StressOnly
+   */
+  template< int BATCH_SIZE >
+  GEOSX_HOST_DEVICE
+  static void smallStrainUpdate_StressOnly( ElasticIsotropicUpdates const & update,
+                                            SmallStrainBatch< BATCH_SIZE > & batch )
+  {
+    batch.pad();
+
+    real64 shearModulus[ BATCH_SIZE ];
+    real64 lambda[ BATCH_SIZE ];
+    for( int p = 0; p < BATCH_SIZE; ++p )
+    {
+      localIndex const k = batch.k[ p ];
+      shearModulus[ p ] = update.m_shearModulus[ k ];
+      lambda[ p ] = conversions::bulkModAndShearMod::toFirstLame( update.m_bulkModulus[ k ], shearModulus[ p ] );
+    }
+
+    real64 oldStress[ 6 ][ BATCH_SIZE ];
+    for( int p = 0; p < BATCH_SIZE; ++p )
+    {
+      for( int i = 0; i < 6; ++i )
+      {
+        oldStress[ i ][ p ] = update.m_oldStress( batch.k[ p ], batch.q[ p ], i );
+      }
+    }
+
+    // same operations as the point-wise update: incremental stress first, then old stress
+    for( int p = 0; p < BATCH_SIZE; ++p )
+    {
+      real64 const twoG = 2 * shearModulus[ p ];
+      real64 const vol = lambda[ p ] * ( batch.strainIncrement[ 0 ][ p ] + batch.strainIncrement[ 1 ][ p ] + batch.strainIncrement[ 2 ][ p ] );
+
+      batch.stress[ 0 ][ p ] = ( vol + twoG * batch.strainIncrement[ 0 ][ p ] ) + oldStress[ 0 ][ p ];
+      batch.stress[ 1 ][ p ] = ( vol + twoG * batch.strainIncrement[ 1 ][ p ] ) + oldStress[ 1 ][ p ];
+      batch.stress[ 2 ][ p ] = ( vol + twoG * batch.strainIncrement[ 2 ][ p ] ) + oldStress[ 2 ][ p ];
+
+      batch.stress[ 3 ][ p ] = shearModulus[ p ] * batch.strainIncrement[ 3 ][ p ] + oldStress[ 3 ][ p ];
+      batch.stress[ 4 ][ p ] = shearModulus[ p ] * batch.strainIncrement[ 4 ][ p ] + oldStress[ 4 ][ p ];
+      batch.stress[ 5 ][ p ] = shearModulus[ p ] * batch.strainIncrement[ 5 ][ p ] + oldStress[ 5 ][ p ];
+    }
+
+    for( int p = 0; p < batch.numPoints; ++p )
+    {
+      for( int i = 0; i < 6; ++i )
+      {
+        update.m_newStress( batch.k[ p ], batch.q[ p ], i ) = batch.stress[ i ][ p ];
+      }
+    }
+  }
+
+  /**
+   * @copydoc SmallStrainBatchUpdate::smallStrainUpdate
+   */
+  template< int BATCH_SIZE >
+  GEOSX_HOST_DEVICE
+  static void smallStrainUpdate( ElasticIsotropicUpdates const & update,
+                                 SmallStrainBatch< BATCH_SIZE > & batch,
+                                 real64 ( & stiffness )[6][6][BATCH_SIZE] )
+  {
+    smallStrainUpdate_StressOnly( update, batch );
+
+    for( int i = 0; i < 6; ++i )
+    {
+      for( int j = 0; j < 6; ++j )
+      {
+        for( int p = 0; p < BATCH_SIZE; ++p )
+        {
+          stiffness[ i ][ j ][ p ] = 0;
+        }
+      }
+    }
+
+    for( int p = 0; p < BATCH_SIZE; ++p )
+    {
+      localIndex const k = batch.k[ p ];
+      real64 const G = update.m_shearModulus[ k ];
+      real64 const lambda = conversions::bulkModAndShearMod::toFirstLame( update.m_bulkModulus[ k ], G );
+
+      for( int i = 0; i < 3; ++i )
+      {
+        for( int j = 0; j < 3; ++j )
+        {
+          stiffness[ i ][ j ][ p ] = lambda;
+        }
+        stiffness[ i ][ i ][ p ] = lambda + 2*G;
+        stiffness[ i+3 ][ i+3 ][ p ] = G;
+      }
+    }
+  }
+};
+
 /**
  * @class ElasticIsotropic
  *
@@ -581,6 +581,205 @@ public:
 };
 
 
+/**
+ * @struct SmallStrainBatch
+ * @brief Tile of material points updated together by the batched small strain updates.
+ * @tparam BATCH_SIZE number of material points of the tile, typically the SIMD width (4 or 8)
+ *
+ * The tensors are stored as structures of arrays, the material point being the fastest
+ * index, so that the loops over the points of the tile can be vectorized. A tile may be
+ * partially filled: the batched updates compute the unused points as copies of the first
+ * one, but only store the state of the first numPoints points.
+ */
+template< int BATCH_SIZE >
+struct SmallStrainBatch
+{
+  /// Number of material points of the tile
+  static constexpr int batchSize = BATCH_SIZE;
+
+  /// Number of material points in use
+  int numPoints = 0;
+
+  /// Element index of the material points
+  localIndex k[ BATCH_SIZE ];
+
+  /// Quadrature point index of the material points
+  localIndex q[ BATCH_SIZE ];
+
+  /// Strain increments in Voigt notation
+  real64 strainIncrement[ 6 ][ BATCH_SIZE ];
+
+  /// New stresses in Voigt notation
+  real64 stress[ 6 ][ BATCH_SIZE ];
+
+  /**
+   * @brief Append a material point to the tile.
+   * @param[in] kIndex Element index.
+   * @param[in] qIndex Quadrature point index.
+   * @param[in] increment Strain increment in Voigt notation.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void addPoint( localIndex const kIndex,
+                 localIndex const qIndex,
+                 real64 const ( &increment )[6] )
+  {
+    GEOSX_ASSERT( numPoints < BATCH_SIZE );
+    k[ numPoints ] = kIndex;
+    q[ numPoints ] = qIndex;
+    for( int i = 0; i < 6; ++i )
+    {
+      strainIncrement[ i ][ numPoints ] = increment[ i ];
+    }
+    ++numPoints;
+  }
+
+  /**
+   * @brief Fill the unused material points with copies of the first one.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void pad()
+  {
+    GEOSX_ASSERT( numPoints > 0 );
+    for( int p = numPoints; p < BATCH_SIZE; ++p )
+    {
+      k[ p ] = k[ 0 ];
+      q[ p ] = q[ 0 ];
+      for( int i = 0; i < 6; ++i )
+      {
+        strainIncrement[ i ][ p ] = strainIncrement[ i ][ 0 ];
+      }
+    }
+  }
+
+  /**
+   * @brief Copy the stress of a material point out of the tile.
+   * @param[in] p Index of the material point in the tile.
+   * @param[out] pointStress Stress in Voigt notation.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void getStress( int const p,
+                  real64 ( & pointStress )[6] ) const
+  {
+    for( int i = 0; i < 6; ++i )
+    {
+      pointStress[ i ] = stress[ i ][ p ];
+    }
+  }
+};
+
+/**
+ * @struct SmallStrainBatchUpdate
+ * @brief Batched small strain updates of a solid model kernel wrapper.
+ * @tparam UPDATE_TYPE the kernel wrapper type of the solid model
+ *
+ * This generic version updates the material points of the tile one after the other with the
+ * point-wise updates of the model. Models with a vectorized implementation specialize this
+ * structure for their exact kernel wrapper type, so that derived models are not silently
+ * handled by the implementation of their base class.
+ */
+template< typename UPDATE_TYPE >
+struct SmallStrainBatchUpdate
+{
+  /**
+   * @brief Batched small strain update, returning only stress.
+   * @tparam BATCH_SIZE number of material points of the tile
+   * @param[in] update the kernel wrapper of the model
+   * @param[inout] batch the tile, holding the strain increments on input and the stresses on output
+   */
+  template< int BATCH_SIZE >
+  GEOSX_HOST_DEVICE
+  static void smallStrainUpdate_StressOnly( UPDATE_TYPE const & update,
+                                            SmallStrainBatch< BATCH_SIZE > & batch )
+  {
+    for( int p = 0; p < batch.numPoints; ++p )
+    {
+      real64 strainIncrement[6];
+      real64 stress[6];
+      for( int i = 0; i < 6; ++i )
+      {
+        strainIncrement[ i ] = batch.strainIncrement[ i ][ p ];
+      }
+      update.smallStrainUpdate_StressOnly( batch.k[ p ], batch.q[ p ], strainIncrement, stress );
+      for( int i = 0; i < 6; ++i )
+      {
+        batch.stress[ i ][ p ] = stress[ i ];
+      }
+    }
+  }
+
+  /**
+   * @brief Batched small strain update, returning stress and stiffness.
+   * @tparam BATCH_SIZE number of material points of the tile
+   * @param[in] update the kernel wrapper of the model
+   * @param[inout] batch the tile, holding the strain increments on input and the stresses on output
+   * @param[out] stiffness the tangent stiffnesses of the material points
+   */
+  template< int BATCH_SIZE >
+  GEOSX_HOST_DEVICE
+  static void smallStrainUpdate( UPDATE_TYPE const & update,
+                                 SmallStrainBatch< BATCH_SIZE > & batch,
+                                 real64 ( & stiffness )[6][6][BATCH_SIZE] )
+  {
+    for( int p = 0; p < batch.numPoints; ++p )
+    {
+      real64 strainIncrement[6];
+      real64 stress[6];
+      real64 pointStiffness[6][6];
+      for( int i = 0; i < 6; ++i )
+      {
+        strainIncrement[ i ] = batch.strainIncrement[ i ][ p ];
+      }
+      update.smallStrainUpdate( batch.k[ p ], batch.q[ p ], strainIncrement, stress, pointStiffness );
+      for( int i = 0; i < 6; ++i )
+      {
+        batch.stress[ i ][ p ] = stress[ i ];
+        for( int j = 0; j < 6; ++j )
+        {
+          stiffness[ i ][ j ][ p ] = pointStiffness[ i ][ j ];
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Batched small strain update of a tile of material points, returning only stress.
+ * @tparam UPDATE_TYPE the kernel wrapper type of the solid model
+ * @tparam BATCH_SIZE number of material points of the tile
+ * @param[in] update the kernel wrapper of the model
+ * @param[inout] batch the tile, holding the strain increments on input and the stresses on output
+ */
+template< typename UPDATE_TYPE, int BATCH_SIZE >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void smallStrainUpdateBatch_StressOnly( UPDATE_TYPE const & update,
+                                        SmallStrainBatch< BATCH_SIZE > & batch )
+{
+  SmallStrainBatchUpdate< UPDATE_TYPE >::smallStrainUpdate_StressOnly( update, batch );
+}
+
+/**
+ * @brief Batched small strain update of a tile of material points, returning stress and stiffness.
+ * @tparam UPDATE_TYPE the kernel wrapper type of the solid model
+ * @tparam BATCH_SIZE number of material points of the tile
+ * @param[in] update the kernel wrapper of the model
+ * @param[inout] batch the tile, holding the strain increments on input and the stresses on output
+ * @param[out] stiffness the tangent stiffnesses of the material points
+ */
+template< typename UPDATE_TYPE, int BATCH_SIZE >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void smallStrainUpdateBatch( UPDATE_TYPE const & update,
+                             SmallStrainBatch< BATCH_SIZE > & batch,
+                             real64 ( & stiffness )[6][6][BATCH_SIZE] )
+{
+  SmallStrainBatchUpdate< UPDATE_TYPE >::smallStrainUpdate( update, batch, stiffness );
+}
+
+
 /**
  * @class SolidBase
  * This class serves as the base class for solid constitutive models.
@@ -158,6 +158,131 @@ TEST( DruckerPragerTests, testDruckerPragerHost )
 }
 
 
+TEST( DruckerPragerTests, testDruckerPragerBatched )
+{
+  // two identical models, one updated point by point and one tile by tile
+  conduit::Node node;
+  dataRepository::Group rootGroup( "root", node );
+  ConstitutiveManager constitutiveManager( "constitutive", &rootGroup );
+
+  string const inputStream =
+    "<Constitutive>"
+    "   <DruckerPrager"
+    "      name=\"pointwise\" "
+    "      defaultDensity=\"2700\" "
+    "      defaultBulkModulus=\"1000.0\" "
+    "      defaultShearModulus=\"1000.0\" "
+    "      defaultFrictionAngle=\"30.0\" "
+    "      defaultDilationAngle=\"15.0\" "
+    "      defaultHardeningRate=\"-2000.0\" "
+    "      defaultCohesion=\"1\"/>"
+    "   <DruckerPrager"
+    "      name=\"batched\" "
+    "      defaultDensity=\"2700\" "
+    "      defaultBulkModulus=\"1000.0\" "
+    "      defaultShearModulus=\"1000.0\" "
+    "      defaultFrictionAngle=\"30.0\" "
+    "      defaultDilationAngle=\"15.0\" "
+    "      defaultHardeningRate=\"-2000.0\" "
+    "      defaultCohesion=\"1\"/>"
+    "</Constitutive>";
+
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( inputStream.c_str(),
+                                                             inputStream.size() );
+  if( !xmlResult )
+  {
+    GEOSX_LOG_RANK_0( "XML parsed with errors!" );
+    GEOSX_LOG_RANK_0( "Error description: " << xmlResult.description());
+    GEOSX_LOG_RANK_0( "Error offset: " << xmlResult.offset );
+  }
+
+  xmlWrapper::xmlNode xmlConstitutiveNode = xmlDocument.child( "Constitutive" );
+  constitutiveManager.processInputFileRecursive( xmlConstitutiveNode );
+  constitutiveManager.postProcessInputRecursive();
+
+  // 6 material points, i.e. a full tile and a partial one
+  localIndex constexpr numElem = 2;
+  localIndex constexpr numQuad = 3;
+  localIndex constexpr numPoints = numElem * numQuad;
+  int constexpr batchSize = 4;
+
+  dataRepository::Group disc( "discretization", &rootGroup );
+  disc.resize( numElem );
+
+  DruckerPrager & pointwise = constitutiveManager.getConstitutiveRelation< DruckerPrager >( "pointwise" );
+  DruckerPrager & batched = constitutiveManager.getConstitutiveRelation< DruckerPrager >( "batched" );
+  pointwise.allocateConstitutiveData( disc, numQuad );
+  batched.allocateConstitutiveData( disc, numQuad );
+
+  DruckerPrager::KernelWrapper const pointwiseUpdates = pointwise.createKernelUpdates();
+  DruckerPrager::KernelWrapper const batchedUpdates = batched.createKernelUpdates();
+
+  // uniaxial compression with a rate growing with the point index: the first
+  // points remain elastic while the last ones go through the plastic corrector
+
+  for( localIndex loadstep=0; loadstep < 20; ++loadstep )
+  {
+    real64 pointStiffness[numPoints][6][6];
+    for( localIndex point = 0; point < numPoints; ++point )
+    {
+      real64 strainIncrement[6] = { };
+      strainIncrement[0] = -1e-5 * ( 1 + 2 * point );
+      real64 stress[6] = { };
+      pointwiseUpdates.smallStrainUpdate( point / numQuad, point % numQuad, strainIncrement, stress, pointStiffness[point] );
+    }
+
+    SmallStrainBatch< batchSize > batch;
+    real64 batchStiffness[6][6][batchSize];
+    for( localIndex point = 0; point < numPoints; ++point )
+    {
+      real64 strainIncrement[6] = { };
+      strainIncrement[0] = -1e-5 * ( 1 + 2 * point );
+      batch.addPoint( point / numQuad, point % numQuad, strainIncrement );
+
+      if( batch.numPoints == batchSize || point == numPoints - 1 )
+      {
+        smallStrainUpdateBatch( batchedUpdates, batch, batchStiffness );
+        for( int p = 0; p < batch.numPoints; ++p )
+        {
+          localIndex const tilePoint = batch.k[p] * numQuad + batch.q[p];
+          for( int i = 0; i < 6; ++i )
+          {
+            for( int j = 0; j < 6; ++j )
+            {
+              EXPECT_DOUBLE_EQ( batchStiffness[i][j][p], pointStiffness[tilePoint][i][j] );
+            }
+          }
+        }
+        batch.numPoints = 0;
+      }
+    }
+
+    for( localIndex point = 0; point < numPoints; ++point )
+    {
+      for( int i = 0; i < 6; ++i )
+      {
+        EXPECT_DOUBLE_EQ( batchedUpdates.m_newStress( point / numQuad, point % numQuad, i ),
+                          pointwiseUpdates.m_newStress( point / numQuad, point % numQuad, i ) );
+      }
+    }
+
+    pointwise.saveConvergedState();
+    batched.saveConvergedState();
+  }
+
+  // the last point went through the plastic corrector, the first one did not
+
+  real64 stress[6];
+  for( int i = 0; i < 6; ++i )
+  {
+    stress[i] = pointwiseUpdates.m_newStress( 0, 0, i );
+  }
+  EXPECT_NEAR( stress[0], -20 * 1e-5 * ( 1000.0 + 4.0 / 3.0 * 1000.0 ), 1e-12 );
+  EXPECT_GT( pointwiseUpdates.m_newStress( numElem - 1, numQuad - 1, 0 ), -20 * 11e-5 * ( 1000.0 + 4.0 / 3.0 * 1000.0 ) );
+}
+
+
 
 template< typename POLICY >
 void testDruckerPragerExtendedDriver()
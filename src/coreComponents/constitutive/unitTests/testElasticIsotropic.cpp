@@ -208,3 +208,119 @@ TEST( ElasticIsotropicTests, testStateUpdatePoint )
     EXPECT_DOUBLE_EQ( stress( 0, 0, 5 ), 0 );
   }
 }
+
+TEST( ElasticIsotropicTests, testBatchedSmallStrainUpdate )
+{
+  conduit::Node node;
+  dataRepository::Group rootGroup( "root", node );
+  ConstitutiveManager constitutiveManager( "constitutive", &rootGroup );
+
+  string const inputStream =
+    "<Constitutive>"
+    "   <ElasticIsotropic"
+    "      name=\"pointwise\" "
+    "      defaultDensity=\"2700\" "
+    "      defaultBulkModulus=\"2e10\" "
+    "      defaultShearModulus=\"1e10\"/>"
+    "   <ElasticIsotropic"
+    "      name=\"batched\" "
+    "      defaultDensity=\"2700\" "
+    "      defaultBulkModulus=\"2e10\" "
+    "      defaultShearModulus=\"1e10\"/>"
+    "</Constitutive>";
+
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.load_buffer( inputStream.c_str(), inputStream.size() );
+  if( !xmlResult )
+  {
+    GEOSX_LOG_RANK_0( "XML parsed with errors!" );
+    GEOSX_LOG_RANK_0( "Error description: " << xmlResult.description());
+    GEOSX_LOG_RANK_0( "Error offset: " << xmlResult.offset );
+  }
+
+  xmlWrapper::xmlNode xmlConstitutiveNode = xmlDocument.child( "Constitutive" );
+  constitutiveManager.processInputFileRecursive( xmlConstitutiveNode );
+  constitutiveManager.postProcessInputRecursive();
+
+  // 6 material points, i.e. a full tile and a partial one
+  localIndex constexpr numElems = 3;
+  localIndex constexpr numQuadraturePoints = 2;
+  int constexpr batchSize = 4;
+
+  dataRepository::Group disc( "discretization", &rootGroup );
+  disc.resize( numElems );
+
+  ElasticIsotropic & pointwise = constitutiveManager.getConstitutiveRelation< ElasticIsotropic >( "pointwise" );
+  ElasticIsotropic & batched = constitutiveManager.getConstitutiveRelation< ElasticIsotropic >( "batched" );
+  pointwise.allocateConstitutiveData( disc, numQuadraturePoints );
+  batched.allocateConstitutiveData( disc, numQuadraturePoints );
+
+  ElasticIsotropic::KernelWrapper const pointwiseUpdates = pointwise.createKernelUpdates();
+  ElasticIsotropic::KernelWrapper const batchedUpdates = batched.createKernelUpdates();
+
+  auto strainIncrement = [] ( localIndex const k, localIndex const q, int const step, real64 ( & increment )[6] )
+  {
+    for( int i = 0; i < 6; ++i )
+    {
+      increment[i] = 1e-4 * ( ( 7 * k + 3 * q + 5 * i + step ) % 11 - 5 );
+    }
+  };
+
+  // two steps, so that the second one starts from a non-zero old stress
+  for( int step = 0; step < 2; ++step )
+  {
+    real64 pointStiffness[numElems][numQuadraturePoints][6][6];
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      for( localIndex q = 0; q < numQuadraturePoints; ++q )
+      {
+        real64 increment[6];
+        real64 stress[6];
+        strainIncrement( k, q, step, increment );
+        pointwiseUpdates.smallStrainUpdate( k, q, increment, stress, pointStiffness[k][q] );
+      }
+    }
+
+    SmallStrainBatch< batchSize > batch;
+    real64 batchStiffness[6][6][batchSize];
+    localIndex const numPoints = numElems * numQuadraturePoints;
+    for( localIndex point = 0; point < numPoints; ++point )
+    {
+      real64 increment[6];
+      strainIncrement( point / numQuadraturePoints, point % numQuadraturePoints, step, increment );
+      batch.addPoint( point / numQuadraturePoints, point % numQuadraturePoints, increment );
+
+      if( batch.numPoints == batchSize || point == numPoints - 1 )
+      {
+        smallStrainUpdateBatch( batchedUpdates, batch, batchStiffness );
+        for( int p = 0; p < batch.numPoints; ++p )
+        {
+          for( int i = 0; i < 6; ++i )
+          {
+            for( int j = 0; j < 6; ++j )
+            {
+              EXPECT_DOUBLE_EQ( batchStiffness[i][j][p], pointStiffness[ batch.k[p] ][ batch.q[p] ][i][j] );
+            }
+          }
+        }
+        batch.numPoints = 0;
+      }
+    }
+
+    arrayView3d< real64 const, solid::STRESS_USD > const pointwiseStress = pointwise.getStress();
+    arrayView3d< real64 const, solid::STRESS_USD > const batchedStress = batched.getStress();
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      for( localIndex q = 0; q < numQuadraturePoints; ++q )
+      {
+        for( int i = 0; i < 6; ++i )
+        {
+          EXPECT_DOUBLE_EQ( batchedStress( k, q, i ), pointwiseStress( k, q, i ) );
+        }
+      }
+    }
+
+    pointwise.saveConvergedState();
+    batched.saveConvergedState();
+  }
+}
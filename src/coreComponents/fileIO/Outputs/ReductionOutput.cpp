@@ -0,0 +1,549 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ReductionOutput.cpp
+ */
+
+#include "ReductionOutput.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "mesh/DomainPartition.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+arrayView1d< real64 const > getScalarField( ElementSubRegionBase const & subRegion,
+                                            string const & fieldName )
+{
+  GEOSX_THROW_IF( !subRegion.hasWrapper( fieldName ),
+                  GEOSX_FMT( "Reduction output: field {} is not registered on {}", fieldName, subRegion.getName() ),
+                  InputError );
+  WrapperBase const & wrapper = subRegion.getWrapperBase( fieldName );
+  GEOSX_THROW_IF( wrapper.getTypeId() != typeid( array1d< real64 > ),
+                  GEOSX_FMT( "Reduction output: field {} is not a scalar real64 element field", fieldName ),
+                  InputError );
+  return Wrapper< array1d< real64 > >::cast( wrapper ).reference().toViewConst();
+}
+
+/**
+ * @brief Keep the header of a statistics file and its lines written up to a given time.
+ * @param[in] fileName the name of the statistics file
+ * @param[in] lastTime the time of the last lines to keep
+ * @return false if the file could not be read, in which case it is left untouched
+ */
+bool keepStatisticsUpTo( string const & fileName,
+                         real64 const lastTime )
+{
+  std::ifstream in( fileName );
+  string header;
+  if( !in || !std::getline( in, header ) )
+  {
+    return false;
+  }
+  std::vector< string > lines;
+  for( string line; std::getline( in, line ); )
+  {
+    // the times are written in their shortest exact representation, so that they can be compared exactly
+    if( !line.empty() && std::stod( line.substr( 0, line.find( ',' ) ) ) <= lastTime )
+    {
+      lines.emplace_back( std::move( line ) );
+    }
+  }
+  in.close();
+
+  std::ofstream out( fileName, std::ios::out );
+  out << header << std::endl;
+  for( string const & line : lines )
+  {
+    out << line << std::endl;
+  }
+  return true;
+}
+
+GEOSX_HOST_DEVICE
+inline localIndex histogramBin( real64 const value,
+                                real64 const minValue,
+                                real64 const maxValue,
+                                localIndex const numBins )
+{
+  if( maxValue <= minValue )
+  {
+    return 0;
+  }
+  localIndex const bin = static_cast< localIndex >( ( value - minValue ) / ( maxValue - minValue ) * numBins );
+  return LvArray::math::min( LvArray::math::max( bin, localIndex( 0 ) ), numBins - 1 );
+}
+
+}
+
+ReductionOutput::ReductionOutput( string const & name,
+                                  Group * const parent ):
+  OutputBase( name, parent ),
+  m_fieldNames(),
+  m_regionNames(),
+  m_histogramBins( 0 ),
+  m_coarseGridDimensions(),
+  m_sampleStride( 0 ),
+  m_lastWriteTime( -1.0 ),
+  m_statisticsFiles()
+{
+  registerWrapper( viewKeysStruct::fieldNamesString, &m_fieldNames ).
+    setInputFlag( InputFlags::REQUIRED ).
+    setDescription( "Names of the scalar element fields to reduce" );
+
+  registerWrapper( viewKeysStruct::regionNamesString, &m_regionNames ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Names of the regions to reduce. If this attribute is not specified, all the cell regions are reduced" );
+
+  registerWrapper( viewKeysStruct::histogramBinsString, &m_histogramBins ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of bins of the histogram of each field between its min and max values. No histogram is computed if equal to 0" );
+
+  registerWrapper( viewKeysStruct::coarseGridDimensionsString, &m_coarseGridDimensions ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of cells in each direction of the coarse Cartesian grid spanning the reduced regions, "
+                    "on which the fields are averaged and written. No coarse field is written if this attribute is not specified" );
+
+  registerWrapper( viewKeysStruct::sampleStrideString, &m_sampleStride ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Stride of the cells sampled at each output: the center and the field values of the cells whose global index "
+                    "is a multiple of the stride are written to a csv file. No cell is sampled if equal to 0" );
+
+  registerWrapper( viewKeysStruct::lastWriteTimeString, &m_lastWriteTime ).
+    setApplyDefaultValue( -1.0 ).
+    setInputFlag( InputFlags::FALSE ).
+    setRestartFlags( RestartFlags::WRITE_AND_READ ).
+    setDescription( "Time of the last reductions written, on restart the statistics written after this time are removed" );
+}
+
+ReductionOutput::~ReductionOutput()
+{}
+
+void ReductionOutput::postProcessInput()
+{
+  GEOSX_THROW_IF( m_histogramBins < 0,
+                  GEOSX_FMT( "{}: {} must be non-negative", getName(), viewKeysStruct::histogramBinsString ),
+                  InputError );
+  GEOSX_THROW_IF( m_sampleStride < 0,
+                  GEOSX_FMT( "{}: {} must be non-negative", getName(), viewKeysStruct::sampleStrideString ),
+                  InputError );
+  GEOSX_THROW_IF( !m_coarseGridDimensions.empty() && m_coarseGridDimensions.size() != 3,
+                  GEOSX_FMT( "{}: {} must contain three values", getName(), viewKeysStruct::coarseGridDimensionsString ),
+                  InputError );
+  for( integer const n : m_coarseGridDimensions )
+  {
+    GEOSX_THROW_IF( n <= 0,
+                    GEOSX_FMT( "{}: {} must be positive", getName(), viewKeysStruct::coarseGridDimensionsString ),
+                    InputError );
+  }
+}
+
+bool ReductionOutput::execute( real64 const time_n,
+                               real64 const GEOSX_UNUSED_PARAM( dt ),
+                               integer const cycleNumber,
+                               integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                               real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                               DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  domain.forMeshBodies( [&]( MeshBody const & meshBody )
+  {
+    ElementRegionManager const & elemManager = meshBody.getBaseDiscretization().getElemManager();
+
+    std::vector< string > regionNames( m_regionNames.begin(), m_regionNames.end() );
+    if( regionNames.empty() )
+    {
+      elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & region )
+      {
+        regionNames.emplace_back( region.getName() );
+      } );
+    }
+
+    string const filePrefix = joinPath( getOutputDirectory(), GEOSX_FMT( "{}_{}", getName(), meshBody.getName() ) );
+    for( string const & regionName : regionNames )
+    {
+      writeRegionStatistics( time_n, elemManager, regionName, filePrefix );
+    }
+    if( !m_coarseGridDimensions.empty() )
+    {
+      writeCoarseFields( cycleNumber, elemManager, regionNames, filePrefix );
+    }
+    if( m_sampleStride > 0 )
+    {
+      writeSampledCells( cycleNumber, elemManager, regionNames, filePrefix );
+    }
+  } );
+
+  m_lastWriteTime = time_n;
+  return false;
+}
+
+void ReductionOutput::writeRegionStatistics( real64 const time,
+                                             ElementRegionManager const & elemManager,
+                                             string const & regionName,
+                                             string const & filePrefix )
+{
+  ElementRegionBase const & region = elemManager.getRegion( regionName );
+  localIndex const numFields = m_fieldNames.size();
+  localIndex const numBins = m_histogramBins;
+
+  // Step 1: compute the local min/max and volume-weighted sums, the last sum entry is the region volume
+  array1d< real64 > localMin( numFields );
+  array1d< real64 > localMax( numFields );
+  array1d< real64 > localSum( numFields + 1 );
+  localMin.setValues< serialPolicy >( LvArray::NumericLimits< real64 >::max );
+  localMax.setValues< serialPolicy >( -LvArray::NumericLimits< real64 >::max );
+
+  region.forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< real64 const > const volume = subRegion.getElementVolume();
+
+    RAJA::ReduceSum< parallelDeviceReduce, real64 > subRegionVolume( 0.0 );
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        subRegionVolume += volume[ei];
+      }
+    } );
+    localSum[numFields] += subRegionVolume.get();
+
+    for( localIndex f = 0; f < numFields; ++f )
+    {
+      arrayView1d< real64 const > const field = getScalarField( subRegion, m_fieldNames[f] );
+
+      RAJA::ReduceMin< parallelDeviceReduce, real64 > subRegionMin( LvArray::NumericLimits< real64 >::max );
+      RAJA::ReduceMax< parallelDeviceReduce, real64 > subRegionMax( -LvArray::NumericLimits< real64 >::max );
+      RAJA::ReduceSum< parallelDeviceReduce, real64 > subRegionSum( 0.0 );
+
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        if( ghostRank[ei] >= 0 )
+        {
+          return;
+        }
+        subRegionMin.min( field[ei] );
+        subRegionMax.max( field[ei] );
+        subRegionSum += volume[ei] * field[ei];
+      } );
+
+      localMin[f] = LvArray::math::min( localMin[f], subRegionMin.get() );
+      localMax[f] = LvArray::math::max( localMax[f], subRegionMax.get() );
+      localSum[f] += subRegionSum.get();
+    }
+  } );
+
+  // Step 2: synchronize the results over the MPI ranks, batching all the fields in one reduction per operation
+  array1d< real64 > globalMin( numFields );
+  array1d< real64 > globalMax( numFields );
+  array1d< real64 > globalSum( numFields + 1 );
+  MpiWrapper::allReduce( localMin.data(), globalMin.data(), LvArray::integerConversion< int >( numFields ), MPI_MIN, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( localMax.data(), globalMax.data(), LvArray::integerConversion< int >( numFields ), MPI_MAX, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( localSum.data(), globalSum.data(), LvArray::integerConversion< int >( numFields + 1 ), MPI_SUM, MPI_COMM_GEOSX );
+
+  // Step 3: count the values in each bin between the global min and max
+  array2d< globalIndex > localCounts( numFields, numBins );
+  array2d< globalIndex > globalCounts( numFields, numBins );
+  if( numBins > 0 )
+  {
+    region.forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+    {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView2d< globalIndex > const counts = localCounts.toView();
+
+      for( localIndex f = 0; f < numFields; ++f )
+      {
+        arrayView1d< real64 const > const field = getScalarField( subRegion, m_fieldNames[f] );
+        real64 const minValue = globalMin[f];
+        real64 const maxValue = globalMax[f];
+
+        forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+        {
+          if( ghostRank[ei] >= 0 )
+          {
+            return;
+          }
+          localIndex const bin = histogramBin( field[ei], minValue, maxValue, numBins );
+          RAJA::atomicAdd< parallelDeviceAtomic >( &counts[f][bin], globalIndex( 1 ) );
+        } );
+      }
+    } );
+    localCounts.move( LvArray::MemorySpace::host, false );
+    MpiWrapper::allReduce( localCounts.data(), globalCounts.data(), LvArray::integerConversion< int >( localCounts.size() ), MPI_SUM, MPI_COMM_GEOSX );
+  }
+
+  // Step 4: append one line per field to the statistics file
+  if( MpiWrapper::commRank() == 0 )
+  {
+    string const fileName = filePrefix + "_statistics.csv";
+    bool newFile = m_statisticsFiles.insert( fileName ).second;
+    if( newFile && m_lastWriteTime >= 0.0 )
+    {
+      // restarting: resume the existing file, without the lines written after the restart time
+      newFile = !keepStatisticsUpTo( fileName, m_lastWriteTime );
+    }
+    std::ofstream f( fileName, newFile ? std::ios::out : std::ios::app );
+    if( newFile )
+    {
+      f << "time,region,field,min,average,max";
+      for( localIndex b = 0; b < numBins; ++b )
+      {
+        f << ",bin" << b;
+      }
+      f << std::endl;
+    }
+
+    real64 const regionVolume = globalSum[numFields];
+    for( localIndex i = 0; i < numFields; ++i )
+    {
+      real64 const average = regionVolume > 0.0 ? globalSum[i] / regionVolume : 0.0;
+      f << GEOSX_FMT( "{}", time ) << "," << regionName << "," << m_fieldNames[i] << ","
+        << globalMin[i] << "," << average << "," << globalMax[i];
+      for( localIndex b = 0; b < numBins; ++b )
+      {
+        f << "," << globalCounts[i][b];
+      }
+      f << std::endl;
+    }
+    f.close();
+  }
+}
+
+void ReductionOutput::writeCoarseFields( integer const cycleNumber,
+                                         ElementRegionManager const & elemManager,
+                                         std::vector< string > const & regionNames,
+                                         string const & filePrefix ) const
+{
+  localIndex const numFields = m_fieldNames.size();
+  localIndex const dims[3] = { m_coarseGridDimensions[0], m_coarseGridDimensions[1], m_coarseGridDimensions[2] };
+  localIndex const numCoarseCells = dims[0] * dims[1] * dims[2];
+
+  // Step 1: compute the bounding box of the element centers
+  real64 localBox[6] = { LvArray::NumericLimits< real64 >::max,
+                         LvArray::NumericLimits< real64 >::max,
+                         LvArray::NumericLimits< real64 >::max,
+                         LvArray::NumericLimits< real64 >::max,
+                         LvArray::NumericLimits< real64 >::max,
+                         LvArray::NumericLimits< real64 >::max };
+  elemManager.forElementSubRegions( regionNames, [&]( localIndex const,
+                                                      ElementSubRegionBase const & subRegion )
+  {
+    arrayView2d< real64 const > const center = subRegion.getElementCenter();
+    for( integer d = 0; d < 3; ++d )
+    {
+      RAJA::ReduceMin< parallelDeviceReduce, real64 > subRegionMin( LvArray::NumericLimits< real64 >::max );
+      RAJA::ReduceMax< parallelDeviceReduce, real64 > subRegionMax( -LvArray::NumericLimits< real64 >::max );
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        subRegionMin.min( center[ei][d] );
+        subRegionMax.max( center[ei][d] );
+      } );
+      // the max is stored negated so that the whole box is reduced with a single MPI_MIN
+      localBox[d] = LvArray::math::min( localBox[d], subRegionMin.get() );
+      localBox[d+3] = LvArray::math::min( localBox[d+3], -subRegionMax.get() );
+    }
+  } );
+  real64 globalBox[6];
+  MpiWrapper::allReduce( localBox, globalBox, 6, MPI_MIN, MPI_COMM_GEOSX );
+
+  real64 origin[3];
+  real64 spacing[3];
+  for( integer d = 0; d < 3; ++d )
+  {
+    origin[d] = globalBox[d];
+    real64 const length = -globalBox[d+3] - globalBox[d];
+    spacing[d] = length > 0.0 ? length / dims[d] : 1.0;
+  }
+
+  // Step 2: accumulate the volume-weighted field values in the coarse cells, the last column is the volume
+  array2d< real64 > localSums( numCoarseCells, numFields + 1 );
+  elemManager.forElementSubRegions( regionNames, [&]( localIndex const,
+                                                      ElementSubRegionBase const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< real64 const > const volume = subRegion.getElementVolume();
+    arrayView2d< real64 const > const center = subRegion.getElementCenter();
+    arrayView2d< real64 > const sums = localSums.toView();
+
+    array1d< localIndex > coarseIndex( subRegion.size() );
+    arrayView1d< localIndex > const coarseIndexView = coarseIndex.toView();
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      localIndex ijk[3];
+      for( integer d = 0; d < 3; ++d )
+      {
+        ijk[d] = static_cast< localIndex >( ( center[ei][d] - origin[d] ) / spacing[d] );
+        ijk[d] = LvArray::math::min( LvArray::math::max( ijk[d], localIndex( 0 ) ), dims[d] - 1 );
+      }
+      coarseIndexView[ei] = ( ijk[2] * dims[1] + ijk[1] ) * dims[0] + ijk[0];
+      if( ghostRank[ei] < 0 )
+      {
+        RAJA::atomicAdd< parallelDeviceAtomic >( &sums[coarseIndexView[ei]][numFields], volume[ei] );
+      }
+    } );
+
+    for( localIndex f = 0; f < numFields; ++f )
+    {
+      arrayView1d< real64 const > const field = getScalarField( subRegion, m_fieldNames[f] );
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        if( ghostRank[ei] < 0 )
+        {
+          RAJA::atomicAdd< parallelDeviceAtomic >( &sums[coarseIndexView[ei]][f], volume[ei] * field[ei] );
+        }
+      } );
+    }
+  } );
+
+  localSums.move( LvArray::MemorySpace::host, false );
+  array2d< real64 > globalSums( numCoarseCells, numFields + 1 );
+  MpiWrapper::allReduce( localSums.data(), globalSums.data(), LvArray::integerConversion< int >( localSums.size() ), MPI_SUM, MPI_COMM_GEOSX );
+
+  // Step 3: write the coarse grid as a legacy vtk structured points file
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ofstream f( GEOSX_FMT( "{}_{:09}.vtk", filePrefix, cycleNumber ) );
+    f << "# vtk DataFile Version 3.0" << std::endl;
+    f << getName() << " cycle " << cycleNumber << std::endl;
+    f << "ASCII" << std::endl;
+    f << "DATASET STRUCTURED_POINTS" << std::endl;
+    f << "DIMENSIONS " << dims[0] + 1 << " " << dims[1] + 1 << " " << dims[2] + 1 << std::endl;
+    f << "ORIGIN " << origin[0] << " " << origin[1] << " " << origin[2] << std::endl;
+    f << "SPACING " << spacing[0] << " " << spacing[1] << " " << spacing[2] << std::endl;
+    f << "CELL_DATA " << numCoarseCells << std::endl;
+
+    f << "SCALARS volume double 1" << std::endl << "LOOKUP_TABLE default" << std::endl;
+    for( localIndex ic = 0; ic < numCoarseCells; ++ic )
+    {
+      f << globalSums[ic][numFields] << std::endl;
+    }
+    for( localIndex i = 0; i < numFields; ++i )
+    {
+      f << "SCALARS " << m_fieldNames[i] << " double 1" << std::endl << "LOOKUP_TABLE default" << std::endl;
+      for( localIndex ic = 0; ic < numCoarseCells; ++ic )
+      {
+        real64 const coarseVolume = globalSums[ic][numFields];
+        f << ( coarseVolume > 0.0 ? globalSums[ic][i] / coarseVolume : 0.0 ) << std::endl;
+      }
+    }
+    f.close();
+  }
+}
+
+void ReductionOutput::writeSampledCells( integer const cycleNumber,
+                                         ElementRegionManager const & elemManager,
+                                         std::vector< string > const & regionNames,
+                                         string const & filePrefix ) const
+{
+  localIndex const numFields = m_fieldNames.size();
+  // region index, global index, center and field values of each sampled cell
+  localIndex const numColumns = 5 + numFields;
+
+  // Step 1: pack the sampled cells owned by this rank
+  std::vector< real64 > localSamples;
+  for( std::size_t r = 0; r < regionNames.size(); ++r )
+  {
+    elemManager.getRegion( regionNames[r] ).forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+    {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+      arrayView2d< real64 const > const center = subRegion.getElementCenter();
+      std::vector< arrayView1d< real64 const > > fields;
+      for( localIndex f = 0; f < numFields; ++f )
+      {
+        fields.emplace_back( getScalarField( subRegion, m_fieldNames[f] ) );
+        fields.back().move( LvArray::MemorySpace::host, false );
+      }
+      center.move( LvArray::MemorySpace::host, false );
+
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        if( ghostRank[ei] >= 0 || localToGlobal[ei] % m_sampleStride != 0 )
+        {
+          continue;
+        }
+        localSamples.insert( localSamples.end(), { real64( r ), real64( localToGlobal[ei] ), center[ei][0], center[ei][1], center[ei][2] } );
+        for( localIndex f = 0; f < numFields; ++f )
+        {
+          localSamples.emplace_back( fields[f][ei] );
+        }
+      }
+    } );
+  }
+
+  // Step 2: gather the samples on rank 0
+  int const rank = MpiWrapper::commRank();
+  int const numRanks = MpiWrapper::commSize();
+  int const localSize = LvArray::integerConversion< int >( localSamples.size() );
+  std::vector< int > sizes( numRanks );
+  MpiWrapper::gather( &localSize, 1, sizes.data(), 1, 0, MPI_COMM_GEOSX );
+
+  std::vector< int > offsets( numRanks + 1, 0 );
+  for( int i = 0; i < numRanks; ++i )
+  {
+    offsets[i+1] = offsets[i] + sizes[i];
+  }
+  std::vector< real64 > samples( rank == 0 ? offsets[numRanks] : 0 );
+  MpiWrapper::gatherv( localSamples.data(), localSize, samples.data(), sizes.data(), offsets.data(), 0, MPI_COMM_GEOSX );
+
+  // Step 3: write the samples sorted by region and global index, so that the file does not depend on the partitioning
+  if( rank == 0 )
+  {
+    localIndex const numSamples = LvArray::integerConversion< localIndex >( samples.size() ) / numColumns;
+    std::vector< localIndex > order( numSamples );
+    std::iota( order.begin(), order.end(), 0 );
+    std::sort( order.begin(), order.end(), [&]( localIndex const a, localIndex const b )
+    {
+      return std::make_pair( samples[a * numColumns], samples[a * numColumns + 1] ) <
+             std::make_pair( samples[b * numColumns], samples[b * numColumns + 1] );
+    } );
+
+    std::ofstream f( GEOSX_FMT( "{}_samples_{:09}.csv", filePrefix, cycleNumber ) );
+    f << "region,globalIndex,x,y,z";
+    for( localIndex i = 0; i < numFields; ++i )
+    {
+      f << "," << m_fieldNames[i];
+    }
+    f << std::endl;
+    for( localIndex const s : order )
+    {
+      real64 const * const sample = &samples[s * numColumns];
+      f << regionNames[static_cast< std::size_t >( sample[0] )] << "," << static_cast< globalIndex >( sample[1] );
+      for( localIndex c = 2; c < numColumns; ++c )
+      {
+        f << "," << sample[c];
+      }
+      f << std::endl;
+    }
+    f.close();
+  }
+}
+
+
+REGISTER_CATALOG_ENTRY( OutputBase, ReductionOutput, string const &, Group * const )
+} /* namespace geosx */
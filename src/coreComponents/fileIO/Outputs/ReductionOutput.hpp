@@ -0,0 +1,156 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ReductionOutput.hpp
+ */
+
+#ifndef GEOSX_FILEIO_OUTPUTS_REDUCTIONOUTPUT_HPP_
+#define GEOSX_FILEIO_OUTPUTS_REDUCTIONOUTPUT_HPP_
+
+#include "OutputBase.hpp"
+
+#include <set>
+
+
+namespace geosx
+{
+
+class ElementRegionManager;
+
+/**
+ * @class ReductionOutput
+ *
+ * A class computing in-situ reductions of element fields (region min/average/max, histograms,
+ * coarse-block averages and a regular sample of the cells) and writing only the reduced data
+ * instead of the full-resolution fields.
+ */
+class ReductionOutput : public OutputBase
+{
+public:
+  /// @copydoc geosx::dataRepository::Group::Group(string const & name, Group * const parent)
+  ReductionOutput( string const & name,
+                   Group * const parent );
+
+  /// Destructor
+  virtual ~ReductionOutput() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string catalogName() { return "Reduction"; }
+
+  virtual void postProcessInput() override;
+
+  /**
+   * @brief Computes the reductions and writes them out.
+   * @copydoc EventBase::execute()
+   */
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**
+   * @brief Write one final set of reductions as the code exits
+   * @copydoc ExecutableGroup::cleanup()
+   */
+  virtual void cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override
+  {
+    execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+  }
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto fieldNamesString = "fieldNames";
+    static constexpr auto regionNamesString = "regionNames";
+    static constexpr auto histogramBinsString = "histogramBins";
+    static constexpr auto coarseGridDimensionsString = "coarseGridDimensions";
+    static constexpr auto sampleStrideString = "sampleStride";
+    static constexpr auto lastWriteTimeString = "lastWriteTime";
+  } reductionOutputViewKeys;
+  /// @endcond
+
+private:
+
+  /**
+   * @brief Compute the min/average/max (and histogram) of the fields in a region and append them to the statistics file.
+   * @param[in] time the current time
+   * @param[in] elemManager the element region manager
+   * @param[in] regionName the name of the region to reduce
+   * @param[in] filePrefix the prefix of the output files of this mesh level
+   */
+  void writeRegionStatistics( real64 const time,
+                              ElementRegionManager const & elemManager,
+                              string const & regionName,
+                              string const & filePrefix );
+
+  /**
+   * @brief Compute the volume-weighted average of the fields on a coarse Cartesian grid and write it as a legacy vtk file.
+   * @param[in] cycleNumber the current cycle number
+   * @param[in] elemManager the element region manager
+   * @param[in] regionNames the names of the regions to reduce
+   * @param[in] filePrefix the prefix of the output files of this mesh level
+   */
+  void writeCoarseFields( integer const cycleNumber,
+                          ElementRegionManager const & elemManager,
+                          std::vector< string > const & regionNames,
+                          string const & filePrefix ) const;
+
+  /**
+   * @brief Gather the center and the field values of one cell out of m_sampleStride on rank 0 and write them as a csv file.
+   * @param[in] cycleNumber the current cycle number
+   * @param[in] elemManager the element region manager
+   * @param[in] regionNames the names of the regions to sample
+   * @param[in] filePrefix the prefix of the output files of this mesh level
+   */
+  void writeSampledCells( integer const cycleNumber,
+                          ElementRegionManager const & elemManager,
+                          std::vector< string > const & regionNames,
+                          string const & filePrefix ) const;
+
+  /// names of the element fields to reduce
+  array1d< string > m_fieldNames;
+
+  /// names of the regions to reduce, all the cell regions if empty
+  array1d< string > m_regionNames;
+
+  /// number of histogram bins, no histogram if zero
+  integer m_histogramBins;
+
+  /// number of coarse cells in each direction, no coarse output if empty
+  array1d< integer > m_coarseGridDimensions;
+
+  /// the cells whose global index is a multiple of this stride are sampled, no sampled output if zero
+  integer m_sampleStride;
+
+  /// time of the last reductions written, negative if none, used on restart to resume the statistics files
+  real64 m_lastWriteTime;
+
+  /// names of the statistics files that have already been created during this run
+  std::set< string > m_statisticsFiles;
+};
+
+
+} /* namespace geosx */
+
+#endif /* GEOSX_FILEIO_OUTPUTS_REDUCTIONOUTPUT_HPP_ */
@@ -29,7 +29,11 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
-  m_io( )
+  m_io( ),
+  m_asyncWrite( 0 ),
+  m_writeComm( MPI_COMM_NULL ),
+  m_pendingWrite( ),
+  m_pendingRecordCount( 0 )
 {
   registerWrapper( viewKeys::timeHistoryOutputTargetString(), &m_collectorPaths ).
     setInputFlag( InputFlags::REQUIRED ).
@@ -51,6 +55,45 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "The current history record to be written, on restart from an earlier time allows use to remove invalid future history." );
 
+  registerWrapper( viewKeys::timeHistoryAsyncWriteString(), &m_asyncWrite ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to write the collected time history in a background thread while collection continues. "
+                    "Requires a thread-safe HDF5 library and MPI initialized with MPI_THREAD_MULTIPLE support (--mpi-thread-multiple), "
+                    "otherwise writes are synchronous." );
+}
+
+TimeHistoryOutput::~TimeHistoryOutput()
+{
+  waitForPendingWrite();
+  // only set when the communicator has been duplicated for the background writes
+  if( m_writeComm != MPI_COMM_NULL )
+  {
+    MpiWrapper::commFree( m_writeComm );
+  }
+}
+
+/**
+ * @brief Check whether the MPI and HDF5 libraries allow the file writes to run in a background thread.
+ * @return true if the time history can be written asynchronously
+ */
+static bool isAsyncWriteSupported()
+{
+  hbool_t threadSafe = 0;
+  H5is_library_threadsafe( &threadSafe );
+  return threadSafe && MpiWrapper::isThreadMultiple();
+}
+
+void TimeHistoryOutput::waitForPendingWrite()
+{
+  if( m_pendingWrite.valid() )
+  {
+    GEOSX_MARK_SCOPE( waitForPendingWrite );
+    m_pendingWrite.get();
+    // the records are only accounted for once they are in the file, so that a restart never refers to missing rows
+    m_recordCount += m_pendingRecordCount;
+    m_pendingRecordCount = 0;
+  }
 }
 
 void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector )
@@ -58,6 +101,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
   GEOSX_ASSERT( m_io.empty() );
 
   bool const freshInit = ( m_recordCount == 0 );
+  MPI_Comm const writeComm = ( m_writeComm == MPI_COMM_NULL ) ? MPI_COMM_GEOSX : m_writeComm;
 
   string const outputDirectory = getOutputDirectory();
   string const outputFile = joinPath( outputDirectory, m_filename );
@@ -73,7 +117,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
         metadata.setName( prefix + metadata.getName() );
       }
 
-      m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount ) );
+      m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount, 1, 2, writeComm ) );
       hc.registerBufferProvider( collectorIdx, [this, idx = m_io.size() - 1]( localIndex count )
       {
         m_io[idx]->updateCollectingCount( count );
@@ -121,6 +165,20 @@ void TimeHistoryOutput::initializePostInitialConditionsPostSubGroups()
     HDFFile( outputFile, (m_recordCount == 0), true, MPI_COMM_GEOSX );
   }
 
+  if( m_asyncWrite && !isAsyncWriteSupported() )
+  {
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "{} `{}`: MPI_THREAD_MULTIPLE (--mpi-thread-multiple) or thread-safe HDF5 is not available, `{}` is ignored.",
+                                 catalogName(), getName(), viewKeys::timeHistoryAsyncWriteString() ) );
+    m_asyncWrite = 0;
+  }
+
+  // background writes use their own communicator so that their collectives never match those of the solvers,
+  // synchronous writes use MPI_COMM_GEOSX directly
+  if( m_asyncWrite && m_writeComm == MPI_COMM_NULL )
+  {
+    m_writeComm = MpiWrapper::commDup( MPI_COMM_GEOSX );
+  }
+
   DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
   for( auto collectorPath : m_collectorPaths )
   {
@@ -137,6 +195,7 @@ void TimeHistoryOutput::setFileName( string const & root )
 
 void TimeHistoryOutput::reinit()
 {
+  waitForPendingWrite();
   m_recordCount = 0;
   m_io.clear();
   initializePostInitialConditionsPostSubGroups();
@@ -151,11 +210,32 @@ bool TimeHistoryOutput::execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
 {
   GEOSX_MARK_FUNCTION;
   localIndex newBuffered = m_io.front()->getBufferedCount( );
-  for( auto & th_io : m_io )
+  if( m_asyncWrite )
+  {
+    // the staging buffers of the previous write must be released before being filled again
+    waitForPendingWrite();
+    for( auto & th_io : m_io )
+    {
+      th_io->stage( );
+    }
+    m_pendingRecordCount = newBuffered;
+    // the writes are collective, all ranks perform them in the same order within the single background task
+    m_pendingWrite = std::async( std::launch::async, [this]()
+    {
+      for( auto & th_io : m_io )
+      {
+        th_io->writeStaged( );
+      }
+    } );
+  }
+  else
   {
-    th_io->write( );
+    for( auto & th_io : m_io )
+    {
+      th_io->write( );
+    }
+    m_recordCount += newBuffered;
   }
-  m_recordCount += newBuffered;
   return false;
 }
 
@@ -166,6 +246,7 @@ void TimeHistoryOutput::cleanup( real64 const time_n,
                                  DomainPartition & domain )
 {
   execute( time_n, 0.0, cycleNumber, eventCounter, eventProgress, domain );
+  waitForPendingWrite();
   // remove any unused trailing space reserved to write additional histories
   for( auto & th_io : m_io )
   {
@@ -26,6 +26,8 @@
 
 #include "LvArray/src/Array.hpp" // just for collector
 
+#include <future>
+
 namespace geosx
 {
 
@@ -42,8 +44,7 @@ public:
                      Group * const parent );
 
   /// Destructor
-  virtual ~TimeHistoryOutput() override
-  { }
+  virtual ~TimeHistoryOutput() override;
 
   /**
    * @brief Catalog name interface
@@ -97,11 +98,13 @@ public:
     static constexpr char const * timeHistoryOutputFilenameString() { return "filename"; }
     static constexpr char const * timeHistoryOutputFormatString() { return "format"; }
     static constexpr char const * timeHistoryRestartString() { return "restart"; }
+    static constexpr char const * timeHistoryAsyncWriteString() { return "asyncWrite"; }
 
     dataRepository::ViewKey timeHistoryOutputTarget = { "sources" };
     dataRepository::ViewKey timeHistoryOutputFilename = { "filename" };
     dataRepository::ViewKey timeHistoryOutputFormat = { "format" };
     dataRepository::ViewKey timeHistoryRestart = { "restart" };
+    dataRepository::ViewKey timeHistoryAsyncWrite = { "asyncWrite" };
   } timeHistoryOutputViewKeys;
   /// @endcond
 
@@ -122,6 +125,11 @@ private:
    */
   void initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector );
 
+  /**
+   * @brief Block until the write launched in the background by the previous execute() (if any) has completed.
+   */
+  void waitForPendingWrite();
+
   /// The paths of the collectors to collect history from.
   string_array m_collectorPaths;
   /// The file format of the time history file.
@@ -132,6 +140,14 @@ private:
   integer m_recordCount;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
+  /// Whether the file writes are performed by a background thread while collection goes on.
+  integer m_asyncWrite;
+  /// The communicator duplicated for the background writes, MPI_COMM_NULL if the writes are synchronous.
+  MPI_Comm m_writeComm;
+  /// The write currently running in the background.
+  std::future< void > m_pendingWrite;
+  /// The number of records being written in the background, not yet counted in m_recordCount.
+  integer m_pendingRecordCount;
 };
 }
 
@@ -49,6 +49,19 @@ public:
    */
   virtual void write() = 0;
 
+  /**
+   * @brief Move the buffered history data into a staging area, leaving the internal buffer
+   *   empty and ready to collect further history states.
+   * @note Only one set of staged data may be pending: writeStaged() must complete before the next call.
+   */
+  virtual void stage() = 0;
+
+  /**
+   * @brief Write the staged history data to the output target.
+   * @note This may be called from a thread other than the one collecting into the internal buffer.
+   */
+  virtual void writeStaged() = 0;
+
   /**
    * @brief Ensure the repressentation of the data in the output target is dense and terse.
    * @note Typically the file will be oversized to receive data writes without constant resizing.
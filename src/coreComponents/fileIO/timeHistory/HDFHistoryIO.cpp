@@ -93,6 +93,8 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
   m_bufferedCount( 0 ),
   m_bufferHead( nullptr ),
   m_dataBuffer( 0 ),
+  m_stagedCount( 0 ),
+  m_stagedBuffer( 0 ),
   m_filename( filename ),
   m_overallocMultiple( overallocMultiple ),
   m_globalIdxOffset( 0 ),
@@ -107,10 +109,12 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
   m_rank( LvArray::integerConversion< hsize_t >( rank )),
   m_dims( rank ),
   m_localIdxCounts_buffered( ),
+  m_localIdxCounts_staged( ),
   m_name( name ),
   m_comm( comm ),
   m_subcomm( MPI_COMM_NULL ),
-  m_sizeChanged( true )
+  m_sizeChanged( true ),
+  m_stagedSizeChanged( false )
 {
   for( hsize_t dd = 0; dd < m_rank; ++dd )
   {
@@ -118,6 +122,7 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
     m_typeCount *= m_dims[dd];
   }
   m_dataBuffer.resize( initAlloc * m_typeSize * m_typeCount );
+  m_stagedBuffer.resize( m_dataBuffer.size() );
   m_bufferHead = &m_dataBuffer[0];
 }
 
@@ -238,29 +243,48 @@ void HDFHistoryIO::init( bool existsOkay )
 }
 
 void HDFHistoryIO::write()
+{
+  stage();
+  writeStaged();
+}
+
+void HDFHistoryIO::stage()
+{
+  GEOSX_ASSERT_EQ( m_stagedCount, 0 );
+  // swap rather than copy the buffers, both keep their capacity from one write to the next
+  m_dataBuffer.swap( m_stagedBuffer );
+  m_localIdxCounts_buffered.swap( m_localIdxCounts_staged );
+  m_localIdxCounts_buffered.clear( );
+  m_stagedCount = m_bufferedCount;
+  m_stagedSizeChanged = m_sizeChanged;
+  m_sizeChanged = false;
+  emptyBuffer( );
+}
+
+void HDFHistoryIO::writeStaged()
 {
   // check if the size has changed on any process in the primary comm
   int anyChanged = false;
-  MpiWrapper::allReduce( &m_sizeChanged, &anyChanged, 1, MPI_LOR, m_comm );
-  m_sizeChanged = anyChanged;
+  MpiWrapper::allReduce( &m_stagedSizeChanged, &anyChanged, 1, MPI_LOR, m_comm );
+  m_stagedSizeChanged = anyChanged;
 
   // this will set the first dim large enough to hold all the rows we're about to write
-  resizeFileIfNeeded( m_bufferedCount );
-  if( m_bufferedCount > 0 )
+  resizeFileIfNeeded( m_stagedCount );
+  if( m_stagedCount > 0 )
   {
     buffer_unit_type * dataBuffer = nullptr;
-    if( m_dataBuffer.size() > 0 )
+    if( m_stagedBuffer.size() > 0 )
     {
-      dataBuffer = &m_dataBuffer[0];
+      dataBuffer = &m_stagedBuffer[0];
     }
-    for( localIndex row = 0; row < m_bufferedCount; ++row )
+    for( localIndex row = 0; row < m_stagedCount; ++row )
     {
       // if the size changed at all, update the partitioning and dataset extent before each row is to be written
       //  to ensure the correct mpi ranks participate and that there is enough room to write the largest row during execution
-      if( m_sizeChanged )
+      if( m_stagedSizeChanged )
       {
         // since the highwater might change (the max # of indices / 2nd dimension) when updating the partitioning
-        setupPartition( m_localIdxCounts_buffered[ row ] );
+        setupPartition( m_localIdxCounts_staged[ row ] );
         // keep the write limit the same (will only change in resizeFileIfNeeded call above)
         updateDatasetExtent( m_writeLimit );
       }
@@ -279,7 +303,7 @@ void HDFHistoryIO::write()
 
         std::vector< hsize_t > bufferedCounts( m_rank+1 );
         bufferedCounts[0] = LvArray::integerConversion< hsize_t >( 1 );
-        bufferedCounts[1] = LvArray::integerConversion< hsize_t >( m_localIdxCounts_buffered[ row ] );
+        bufferedCounts[1] = LvArray::integerConversion< hsize_t >( m_localIdxCounts_staged[ row ] );
         for( hsize_t dd = 2; dd < m_rank+1; ++dd )
         {
           bufferedCounts[dd] = m_dims[dd-1];
@@ -294,7 +318,7 @@ void HDFHistoryIO::write()
         // forward the data buffer pointer to the start of the next row
         if( dataBuffer )
         {
-          hsize_t rowsize = m_localIdxCounts_buffered[ row ] * m_typeSize;
+          hsize_t rowsize = m_localIdxCounts_staged[ row ] * m_typeSize;
           for( hsize_t ii = 1; ii < m_rank; ++ii )
           {
             rowsize *= m_dims[ii];
@@ -311,9 +335,9 @@ void HDFHistoryIO::write()
       m_writeHead++;
     }
   }
-  m_sizeChanged = false;
-  m_localIdxCounts_buffered.clear( );
-  emptyBuffer( );
+  m_stagedSizeChanged = false;
+  m_localIdxCounts_staged.clear( );
+  m_stagedCount = 0;
 }
 
 void HDFHistoryIO::compressInFile()
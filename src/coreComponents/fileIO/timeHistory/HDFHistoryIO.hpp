@@ -91,6 +91,12 @@ public:
   /// @copydoc geosx::BufferedHistoryIO::write
   virtual void write( ) override;
 
+  /// @copydoc geosx::BufferedHistoryIO::stage
+  virtual void stage( ) override;
+
+  /// @copydoc geosx::BufferedHistoryIO::writeStaged
+  virtual void writeStaged( ) override;
+
   /// @copydoc geosx::BufferedHistoryIO::compressInFile
   virtual void compressInFile( ) override;
 
@@ -141,6 +147,10 @@ private:
   buffer_unit_type * m_bufferHead;
   /// The data buffer containing the history info
   buffer_type m_dataBuffer;
+  /// The number of records in the staging buffer
+  localIndex m_stagedCount;
+  /// The staging buffer containing the history info waiting to be written to file
+  buffer_type m_stagedBuffer;
 
   // file io params
   /// The filename to write to
@@ -173,8 +183,10 @@ private:
   hsize_t m_rank;
   /// The dimensions of the data set
   std::vector< hsize_t > m_dims;
-  ///
+  /// The local index count of each buffered record
   std::vector< globalIndex > m_localIdxCounts_buffered;
+  /// The local index count of each staged record
+  std::vector< globalIndex > m_localIdxCounts_staged;
   /// The name of the data set
   string m_name;
   /// The communicator across which the data set is distributed
@@ -184,6 +196,8 @@ private:
   MPI_Comm m_subcomm;
   /// Whether the size of the collected data has changed between writes to file
   int m_sizeChanged;
+  /// Whether the size of the collected data has changed in the staged records
+  int m_stagedSizeChanged;
 };
 
 }
@@ -0,0 +1,132 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file HDFReceiverTraces.cpp
+ */
+
+#include "HDFReceiverTraces.hpp"
+
+#include "HDFFile.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+#include <hdf5.h>
+
+namespace geosx
+{
+
+/**
+ * @brief Abort with an explicit message if an HDF5 call failed.
+ * @tparam T the return type of the HDF5 call, either an identifier or a status
+ * @param status the value returned by the HDF5 call, negative on failure
+ * @param action the description of what the call was meant to do
+ * @param name the name of the dataset being written
+ */
+template< typename T >
+static void checkHDFStatus( T const status, char const * const action, string const & name )
+{
+  GEOSX_ERROR_IF( status < 0, GEOSX_FMT( "Failed to {} while writing the receiver traces `{}`", action, name ) );
+}
+
+void writeHDFReceiverTraces( string const & filename,
+                             string const & name,
+                             real64 const dtSample,
+                             arrayView2d< real32 const > const & traces,
+                             arrayView1d< localIndex const > const & receiverIsLocal,
+                             MPI_Comm comm )
+{
+  traces.move( LvArray::MemorySpace::host, false );
+  receiverIsLocal.move( LvArray::MemorySpace::host, false );
+
+  localIndex const numSamples = traces.size( 0 );
+  localIndex const numReceivers = traces.size( 1 );
+
+  // transpose the local traces into a buffer where each trace is contiguous
+  std::vector< localIndex > localReceivers;
+  for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+  {
+    if( receiverIsLocal[ircv] == 1 )
+    {
+      localReceivers.emplace_back( ircv );
+    }
+  }
+  localIndex const numLocalReceivers = LvArray::integerConversion< localIndex >( localReceivers.size() );
+  std::vector< real32 > buffer( numLocalReceivers * numSamples );
+  forAll< parallelHostPolicy >( numLocalReceivers, [&]( localIndex const i )
+  {
+    for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+    {
+      buffer[i * numSamples + iSample] = traces[iSample][localReceivers[i]];
+    }
+  } );
+
+  HDFFile target( filename, false, true, comm );
+
+  hsize_t const fileDims[2] = { LvArray::integerConversion< hsize_t >( numReceivers ),
+                                LvArray::integerConversion< hsize_t >( numSamples ) };
+  if( target.hasDataset( name ) )
+  {
+    checkHDFStatus( H5Ldelete( target, name.c_str(), H5P_DEFAULT ), "delete the previous dataset", name );
+  }
+  hid_t const filespace = H5Screate_simple( 2, fileDims, nullptr );
+  checkHDFStatus( filespace, "create the file dataspace", name );
+  hid_t const dataset = H5Dcreate( target, name.c_str(), H5T_NATIVE_FLOAT, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  checkHDFStatus( dataset, "create the dataset", name );
+
+  // select the rows of the local receivers, merging runs of consecutive receivers into a single block
+  checkHDFStatus( H5Sselect_none( filespace ), "reset the file selection", name );
+  for( localIndex i = 0; i < numLocalReceivers; )
+  {
+    localIndex j = i + 1;
+    while( j < numLocalReceivers && localReceivers[j] == localReceivers[j-1] + 1 )
+    {
+      ++j;
+    }
+    hsize_t const offset[2] = { LvArray::integerConversion< hsize_t >( localReceivers[i] ), 0 };
+    hsize_t const count[2] = { LvArray::integerConversion< hsize_t >( j - i ), fileDims[1] };
+    checkHDFStatus( H5Sselect_hyperslab( filespace, H5S_SELECT_OR, offset, nullptr, count, nullptr ), "select the local receivers", name );
+    i = j;
+  }
+
+  hsize_t const memDims[2] = { LvArray::integerConversion< hsize_t >( numLocalReceivers ), fileDims[1] };
+  hid_t const memspace = H5Screate_simple( 2, memDims, nullptr );
+  checkHDFStatus( memspace, "create the memory dataspace", name );
+  if( numLocalReceivers == 0 )
+  {
+    checkHDFStatus( H5Sselect_none( memspace ), "reset the memory selection", name );
+  }
+
+  hid_t const dxplId = H5Pcreate( H5P_DATASET_XFER );
+  checkHDFStatus( dxplId, "create the transfer property list", name );
+#ifdef GEOSX_USE_MPI
+  checkHDFStatus( H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE ), "request a collective transfer", name );
+#endif
+  checkHDFStatus( H5Dwrite( dataset, H5T_NATIVE_FLOAT, memspace, filespace, dxplId, buffer.data() ), "write the traces", name );
+
+  // the sampling interval is needed to reconstruct the time axis of the traces
+  hid_t const attrSpace = H5Screate( H5S_SCALAR );
+  checkHDFStatus( attrSpace, "create the attribute dataspace", name );
+  hid_t const attr = H5Acreate( dataset, "dt", H5T_NATIVE_DOUBLE, attrSpace, H5P_DEFAULT, H5P_DEFAULT );
+  checkHDFStatus( attr, "create the sampling interval attribute", name );
+  checkHDFStatus( H5Awrite( attr, H5T_NATIVE_DOUBLE, &dtSample ), "write the sampling interval attribute", name );
+
+  H5Aclose( attr );
+  H5Sclose( attrSpace );
+  H5Pclose( dxplId );
+  H5Sclose( memspace );
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+}
+
+}
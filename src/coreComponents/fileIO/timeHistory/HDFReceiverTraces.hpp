@@ -0,0 +1,49 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file HDFReceiverTraces.hpp
+ */
+
+#ifndef GEOSX_FILEIO_TIMEHISTORY_HDFRECEIVERTRACES_HPP_
+#define GEOSX_FILEIO_TIMEHISTORY_HDFRECEIVERTRACES_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Collectively write the traces recorded at a set of receivers to a dataset of an HDF5 file.
+ * @param[in] filename The filename (without extension) of the target file, created if it does not exist.
+ * @param[in] name The name of the dataset, replaced if it already exists in the file.
+ * @param[in] dtSample The time interval between two consecutive samples, stored as an attribute of the dataset.
+ * @param[in] traces The trace values, one row per time sample and one column per receiver (global numbering).
+ * @param[in] receiverIsLocal Flag for each receiver, only the traces of the receivers with a nonzero flag are written by this rank.
+ * @param[in] comm A communicator where every rank will participate in writing to the output file.
+ * @details The dataset has one row per receiver so that each trace is contiguous in the file. All the traces
+ *   owned by a rank are transposed into a single buffer and written in one collective operation, with
+ *   consecutive receivers coalesced into contiguous blocks.
+ */
+void writeHDFReceiverTraces( string const & filename,
+                             string const & name,
+                             real64 const dtSample,
+                             arrayView2d< real32 const > const & traces,
+                             arrayView1d< localIndex const > const & receiverIsLocal,
+                             MPI_Comm comm = MPI_COMM_GEOSX );
+
+}
+
+#endif
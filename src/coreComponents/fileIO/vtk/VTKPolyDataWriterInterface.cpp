@@ -177,24 +177,50 @@ static std::vector< int > getVtkConnectivity( ElementType const elementType )
 }
 
 /**
- * @brief Gets the vertices coordinates as a VTK Object for @p nodeManager
+ * @brief Fills a VTK Object with the vertices coordinates of @p nodeManager
  * @param[in] nodeManager the NodeManager associated with the domain being written
- * @return a VTK object storing all nodes of the mesh
+ * @param[in] nodeIndices list of local node indices to write
+ * @param[out] points the VTK object storing the nodes of the mesh, resized if needed
  */
-static vtkSmartPointer< vtkPoints >
-getVtkPoints( NodeManager const & nodeManager,
-              arrayView1d< localIndex const > const & nodeIndices )
+static void
+fillVtkPoints( NodeManager const & nodeManager,
+               arrayView1d< localIndex const > const & nodeIndices,
+               vtkPoints * const points )
 {
   localIndex const numNodes = LvArray::integerConversion< localIndex >( nodeIndices.size() );
-  auto points = vtkSmartPointer< vtkPoints >::New();
   points->SetNumberOfPoints( numNodes );
   auto const coord = nodeManager.referencePosition().toViewConst();
-  forAll< parallelHostPolicy >( numNodes, [=, pts = points.GetPointer()]( localIndex const k )
+  forAll< parallelHostPolicy >( numNodes, [=]( localIndex const k )
   {
     localIndex const v = nodeIndices[k];
-    pts->SetPoint( k, coord[v][0], coord[v][1], coord[v][2] );
+    points->SetPoint( k, coord[v][0], coord[v][1], coord[v][2] );
   } );
-  return points;
+  points->Modified();
+}
+
+/**
+ * @brief Checks whether the nodes of a cached geometry are still at the recorded positions
+ * @param[in] nodeManager the NodeManager associated with the domain being written
+ * @param[in] nodeIndices list of local node indices of the geometry
+ * @param[in] positions the positions of the nodes when the geometry was built
+ * @return true if none of the nodes has moved
+ */
+static bool
+nodesUnmoved( NodeManager const & nodeManager,
+              arrayView1d< localIndex const > const & nodeIndices,
+              arrayView2d< real64 const > const & positions )
+{
+  auto const coord = nodeManager.referencePosition().toViewConst();
+  RAJA::ReduceSum< parallelHostReduce, localIndex > numMoved( 0 );
+  forAll< parallelHostPolicy >( nodeIndices.size(), [=]( localIndex const k )
+  {
+    localIndex const v = nodeIndices[k];
+    if( coord[v][0] != positions[k][0] || coord[v][1] != positions[k][1] || coord[v][2] != positions[k][2] )
+    {
+      numMoved += 1;
+    }
+  } );
+  return numMoved.get() == 0;
 }
 
 struct ElementData
@@ -845,6 +871,48 @@ void VTKPolyDataWriterInterface::writeElementFields( ElementRegionBase const & r
   }
 }
 
+VTKPolyDataWriterInterface::CellGeometry const &
+VTKPolyDataWriterInterface::getCellGeometry( CellElementRegion const & region,
+                                             NodeManager const & nodeManager ) const
+{
+  CellGeometry & geometry = m_cellGeometry[ region.getPath() ];
+
+  localIndex const numNodes = nodeManager.size();
+  localIndex const numElems = region.getNumberOfElements< CellElementSubRegion >();
+  if( geometry.numNodes != numNodes || geometry.numElems != numElems )
+  {
+    // The topology changed since the last output step: rebuild the connectivity
+    CellData VTKCells = getVtkCells( region, numNodes );
+    geometry.numNodes = numNodes;
+    geometry.numElems = numElems;
+    geometry.cellTypes = std::move( VTKCells.cellTypes );
+    geometry.cells = VTKCells.cells;
+    geometry.nodes = std::move( VTKCells.nodes );
+    geometry.points = vtkSmartPointer< vtkPoints >::New();
+    geometry.positions.clear();
+  }
+  else if( nodesUnmoved( nodeManager, geometry.nodes.toViewConst(), geometry.positions.toViewConst() ) )
+  {
+    return geometry;
+  }
+
+  // The connectivity is kept, only the coordinates of the nodes are refreshed
+  fillVtkPoints( nodeManager, geometry.nodes.toViewConst(), geometry.points.GetPointer() );
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const coord = nodeManager.referencePosition();
+  arrayView1d< localIndex const > const nodeIndices = geometry.nodes.toViewConst();
+  geometry.positions.resize( nodeIndices.size(), 3 );
+  arrayView2d< real64 > const positions = geometry.positions.toView();
+  forAll< parallelHostPolicy >( nodeIndices.size(), [=]( localIndex const k )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      positions[k][i] = coord[nodeIndices[k]][i];
+    }
+  } );
+  return geometry;
+}
+
 void VTKPolyDataWriterInterface::writeCellElementRegions( real64 const time,
                                                           ElementRegionManager const & elemManager,
                                                           NodeManager const & nodeManager,
@@ -852,16 +920,15 @@ void VTKPolyDataWriterInterface::writeCellElementRegions( real64 const time,
 {
   elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & region )
   {
-    CellData VTKCells = getVtkCells( region, nodeManager.size() );
-    vtkSmartPointer< vtkPoints > const VTKPoints = getVtkPoints( nodeManager, VTKCells.nodes );
+    CellGeometry const & geometry = getCellGeometry( region, nodeManager );
 
     auto const ug = vtkSmartPointer< vtkUnstructuredGrid >::New();
-    ug->SetCells( VTKCells.cellTypes.data(), VTKCells.cells );
-    ug->SetPoints( VTKPoints );
+    ug->SetCells( geometry.cellTypes.data(), geometry.cells );
+    ug->SetPoints( geometry.points );
 
     writeTimestamp( ug.GetPointer(), time );
     writeElementFields( region, ug->GetCellData() );
-    writeNodeFields( nodeManager, VTKCells.nodes, ug->GetPointData() );
+    writeNodeFields( nodeManager, geometry.nodes, ug->GetPointData() );
 
     string const regionDir = joinPath( path, region.getName() );
     writeUnstructuredGrid( regionDir, ug.GetPointer() );
@@ -1105,6 +1172,7 @@ void VTKPolyDataWriterInterface::write( real64 const time,
 void VTKPolyDataWriterInterface::clearData()
 {
   m_pvd.reinitData();
+  m_cellGeometry.clear();
 }
 
 bool VTKPolyDataWriterInterface::isFieldPlotEnabled( dataRepository::WrapperBase const & wrapper ) const
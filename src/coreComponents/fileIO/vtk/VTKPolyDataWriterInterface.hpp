@@ -22,6 +22,10 @@
 #include "fileIO/vtk/VTKVTMWriter.hpp"
 #include "codingUtilities/EnumStrings.hpp"
 
+#include <vtkSmartPointer.h>
+
+class vtkCellArray;
+class vtkPoints;
 class vtkUnstructuredGrid;
 class vtkPointData;
 class vtkCellData;
@@ -30,6 +34,7 @@ namespace geosx
 {
 
 class DomainPartition;
+class CellElementRegion;
 class ElementRegionBase;
 class EmbeddedSurfaceNodeManager;
 class ElementRegionManager;
@@ -172,7 +177,7 @@ public:
   void write( real64 time, integer cycle, DomainPartition const & domain );
 
   /**
-   * @brief Clears the datasets accumulated in the pvd writer
+   * @brief Clears the datasets accumulated in the pvd writer and the cached mesh geometry
    *
    */
   void clearData();
@@ -180,6 +185,39 @@ public:
 
 private:
 
+  /**
+   * @brief Geometry of a CellElementRegion kept in memory between output steps
+   */
+  struct CellGeometry
+  {
+    /// Number of local nodes in the NodeManager when the geometry was built
+    localIndex numNodes = -1;
+    /// Number of elements in the region when the geometry was built
+    localIndex numElems = -1;
+    /// VTK type of each cell
+    std::vector< int > cellTypes;
+    /// VTK cell connectivity (in terms of indices into @p points)
+    vtkSmartPointer< vtkCellArray > cells;
+    /// VTK vertices coordinates
+    vtkSmartPointer< vtkPoints > points;
+    /// Local indices of the nodes of the region, in the order in which they are stored in @p points
+    array1d< localIndex > nodes;
+    /// Reference positions of @p nodes when @p points was last filled
+    array2d< real64 > positions;
+  };
+
+  /**
+   * @brief Get the geometry of a CellElementRegion, rebuilding it only if the mesh changed
+   * @details The cell types and connectivity are rebuilt only when the number of nodes or
+   * elements changes. Otherwise only the points are refreshed, and only if a node of the
+   * region has moved since the previous output step.
+   * @param[in] region the CellElementRegion to be written
+   * @param[in] nodeManager the NodeManager containing the nodes of the region
+   * @return the cached geometry of the region
+   */
+  CellGeometry const & getCellGeometry( CellElementRegion const & region,
+                                        NodeManager const & nodeManager ) const;
+
   /**
    * @brief Check if plotting is enabled for this field
    * @param[in] wrapper the wrapper
@@ -303,6 +341,9 @@ private:
 
   /// Region output type, could be CELL, WELL, SURFACE, or ALL
   VTKRegionTypes m_outputRegionType;
+
+  /// Geometry of the CellElementRegions, indexed by region path, reused across output steps
+  mutable std::map< string, CellGeometry > m_cellGeometry;
 };
 
 } // namespace vtk
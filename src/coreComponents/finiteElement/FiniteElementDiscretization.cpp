@@ -27,7 +27,8 @@ using namespace finiteElement;
 
 
 FiniteElementDiscretization::FiniteElementDiscretization( string const & name, Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_geometricFactorsOption( GeometricFactorsOption::Full )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -47,6 +48,16 @@ FiniteElementDiscretization::FiniteElementDiscretization( string const & name, G
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
     setDescription( "Specifier to indicate whether to force the use of VEM" );
+
+  registerWrapper( viewKeyStruct::geometricFactorsString(), &m_geometricFactorsOption ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( GeometricFactorsOption::Full ).
+    setDescription( "Storage of the geometric factors precomputed for the kernels that do not compute them from the nodal "
+                    "coordinates: the shape function derivatives at each quadrature point (full), the inverse jacobian at each "
+                    "quadrature point, applied to the parent derivatives on the fly (inverseJacobian), or a single inverse "
+                    "jacobian per element in the subregions where all the elements are affine (affine). The jacobian "
+                    "determinants are stored at each quadrature point in all cases. Options are:\n* " +
+                    EnumStrings< GeometricFactorsOption >::concat( "\n* " ) );
 }
 
 FiniteElementDiscretization::~FiniteElementDiscretization()
@@ -58,6 +69,10 @@ void FiniteElementDiscretization::postProcessInput()
 //  GEOSX_ERROR_IF_NE_MSG( m_order, 1, "Higher order finite element spaces are currently not supported." );
   GEOSX_ERROR_IF_NE_MSG( m_formulation, "default", "Only standard element formulations are currently supported." );
   GEOSX_ERROR_IF_GT_MSG( m_useVem, 1, "The flag useVirtualElements can be either 0 or 1" );
+  GEOSX_THROW_IF( m_useVem == 1 && m_geometricFactorsOption != GeometricFactorsOption::Full,
+                  getName() << ": the virtual elements require " << viewKeyStruct::geometricFactorsString() << "=\"" <<
+                  EnumStrings< GeometricFactorsOption >::toString( GeometricFactorsOption::Full ) << "\"",
+                  InputError );
 }
 
 std::unique_ptr< FiniteElementBase >
@@ -177,6 +192,20 @@ FiniteElementDiscretization::factory( ElementType const parentElementShape ) con
     return {};
   }
 
+  if( m_order==5 )
+  {
+    switch( parentElementShape )
+    {
+      case ElementType::Hexahedron:
+        return std::make_unique< Q5_Hexahedron_Lagrange_GaussLobatto >();
+      default:
+      {
+        GEOSX_ERROR( "Element type " << parentElementShape << " does not have an associated element formulation." );
+      }
+    }
+    return {};
+  }
+
   GEOSX_ERROR( "Element type " << parentElementShape << " does not have an associated element formulation." );
   return {};
 }
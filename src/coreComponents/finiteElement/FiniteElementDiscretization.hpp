@@ -19,6 +19,7 @@
 #ifndef GEOSX_FINITEELEMENT_FINITEELEMENTDISCRETIZATION_HPP_
 #define GEOSX_FINITEELEMENT_FINITEELEMENTDISCRETIZATION_HPP_
 
+#include "codingUtilities/EnumStrings.hpp"
 #include "common/TimingMacros.hpp"
 #include "dataRepository/Group.hpp"
 #include "dataRepository/Wrapper.hpp"
@@ -49,6 +50,16 @@ public:
 
 
 
+  /**
+   * @brief Storage of the geometric factors used by the kernels that do not compute them from the nodal coordinates.
+   */
+  enum class GeometricFactorsOption : integer
+  {
+    Full,            ///< Shape function derivatives and jacobian determinant at each quadrature point
+    InverseJacobian, ///< Inverse jacobian and jacobian determinant at each quadrature point
+    Affine,          ///< Inverse jacobian once per element when all the elements of a subregion are affine
+  };
+
   FiniteElementDiscretization() = delete;
 
   explicit FiniteElementDiscretization( string const & name, Group * const parent );
@@ -63,12 +74,22 @@ public:
 
   ///@}
 
+  /**
+   * @brief Precompute the geometric factors of the elements of a subregion, stored as selected by geometricFactors.
+   * @tparam SUBREGION_TYPE The type of the subregion.
+   * @tparam FE_TYPE The type of the finite element.
+   * @param X The node positions.
+   * @param elementSubRegion The subregion.
+   * @param meshData The mesh data of the finite element.
+   * @param fe The finite element, whose views are set to the stored factors.
+   * @return The number of values stored for the subregion.
+   */
   template< typename SUBREGION_TYPE,
             typename FE_TYPE >
-  void calculateShapeFunctionGradients( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X,
-                                        SUBREGION_TYPE * const elementSubRegion,
-                                        typename FE_TYPE::template MeshData< SUBREGION_TYPE > meshData,
-                                        FE_TYPE & fe ) const;
+  localIndex calculateShapeFunctionGradients( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X,
+                                              SUBREGION_TYPE * const elementSubRegion,
+                                              typename FE_TYPE::template MeshData< SUBREGION_TYPE > meshData,
+                                              FE_TYPE & fe ) const;
 
 
   /**
@@ -83,6 +104,12 @@ public:
 
   int getOrder() const { return m_order; }
 
+  /**
+   * @brief Getter for the storage of the geometric factors.
+   * @return the storage option
+   */
+  GeometricFactorsOption getGeometricFactorsOption() const { return m_geometricFactorsOption; }
+
 private:
 
   struct viewKeyStruct
@@ -90,6 +117,7 @@ private:
     static constexpr char const * orderString() { return "order"; }
     static constexpr char const * formulationString() { return "formulation"; }
     static constexpr char const * useVemString() { return "useVirtualElements"; }
+    static constexpr char const * geometricFactorsString() { return "geometricFactors"; }
   };
 
   /// The order of the finite element basis
@@ -101,13 +129,21 @@ private:
   /// Optional parameter indicating if the class should use Virtual Elements.
   int m_useVem;
 
+  /// Storage of the precomputed geometric factors.
+  GeometricFactorsOption m_geometricFactorsOption;
+
   void postProcessInput() override final;
 
 };
 
+ENUM_STRINGS( FiniteElementDiscretization::GeometricFactorsOption,
+              "full",
+              "inverseJacobian",
+              "affine" );
+
 template< typename SUBREGION_TYPE,
           typename FE_TYPE >
-void
+localIndex
 FiniteElementDiscretization::
   calculateShapeFunctionGradients( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X,
                                    SUBREGION_TYPE * const elementSubRegion,
@@ -118,17 +154,34 @@ FiniteElementDiscretization::
 
   array4d< real64 > & dNdX = elementSubRegion->dNdX();
   array2d< real64 > & detJ = elementSubRegion->detJ();
+  array4d< real64 > & invJ = elementSubRegion->invJ();
+  array3d< real64 > & parentDNdXi = elementSubRegion->parentDNdXi();
   auto const & elemsToNodes = elementSubRegion->nodeList().toViewConst();
 
   constexpr localIndex numNodesPerElem = FE_TYPE::maxSupportPoints;
   constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
-  dNdX.resizeWithoutInitializationOrDestruction( elementSubRegion->size(), numQuadraturePointsPerElem, numNodesPerElem, 3 );
-  detJ.resize( elementSubRegion->size(), numQuadraturePointsPerElem );
+  localIndex const numElems = elementSubRegion->size();
+  bool const storeGradN = m_geometricFactorsOption == GeometricFactorsOption::Full;
 
-  finiteElement.setGradNView( dNdX.toViewConst() );
-  finiteElement.setDetJView( detJ.toViewConst() );
+  detJ.resize( numElems, numQuadraturePointsPerElem );
+  if( storeGradN )
+  {
+    dNdX.resizeWithoutInitializationOrDestruction( numElems, numQuadraturePointsPerElem, numNodesPerElem, 3 );
+    invJ.resize( numElems, 0, 3, 3 );
+    parentDNdXi.resize( 0, numNodesPerElem, 3 );
+  }
+  else
+  {
+    dNdX.resize( numElems, numQuadraturePointsPerElem, 0, 3 );
+    invJ.resizeWithoutInitializationOrDestruction( numElems, numQuadraturePointsPerElem, 3, 3 );
+    parentDNdXi.resize( numQuadraturePointsPerElem, numNodesPerElem, 3 );
+  }
+
+  // an element is affine when its inverse jacobian is the same at all the quadrature points, relative to its largest entry
+  real64 const affineTolerance = 1.0e-10;
+  bool allAffine = true;
 
-  for( localIndex k = 0; k < elementSubRegion->size(); ++k )
+  for( localIndex k = 0; k < numElems; ++k )
   {
     typename FE_TYPE::StackVariables feStack;
     finiteElement.template setup< FE_TYPE >( k, meshData, feStack );
@@ -143,20 +196,70 @@ FiniteElementDiscretization::
       }
     }
 
-
-
     for( localIndex q = 0; q < numQuadraturePointsPerElem; ++q )
     {
       real64 dNdXLocal[numNodesPerElem][3];
       detJ( k, q ) = finiteElement.calcGradN( q, xLocal, feStack, dNdXLocal );
 
-      for( localIndex b = 0; b < numSupportPoints; ++b )
+      if( storeGradN )
+      {
+        for( localIndex b = 0; b < numSupportPoints; ++b )
+        {
+          LvArray::tensorOps::copy< 3 >( dNdX[ k ][ q ][ b ], dNdXLocal[b] );
+        }
+        continue;
+      }
+
+      real64 invJLocal[3][3];
+      FE_TYPE::invJacobianTransformation( q, xLocal, invJLocal );
+      LvArray::tensorOps::copy< 3, 3 >( invJ[ k ][ q ], invJLocal );
+
+      real64 maxEntry = 0.0;
+      real64 maxDifference = 0.0;
+      for( int i = 0; i < 3; ++i )
+      {
+        for( int j = 0; j < 3; ++j )
+        {
+          maxEntry = LvArray::math::max( maxEntry, LvArray::math::abs( invJLocal[i][j] ) );
+          maxDifference = LvArray::math::max( maxDifference, LvArray::math::abs( invJLocal[i][j] - invJ[k][0][i][j] ) );
+        }
+      }
+      allAffine = allAffine && maxDifference <= affineTolerance * maxEntry;
+
+      // the parent gradients are the same for all the elements, dN/dXi = J^T dN/dX
+      if( k == 0 )
       {
-        LvArray::tensorOps::copy< 3 >( dNdX[ k ][ q ][ b ], dNdXLocal[b] );
+        real64 J[3][3];
+        LvArray::tensorOps::copy< 3, 3 >( J, invJLocal );
+        LvArray::tensorOps::invert< 3 >( J );
+        for( localIndex b = 0; b < numSupportPoints; ++b )
+        {
+          LvArray::tensorOps::Ri_eq_AjiBj< 3, 3 >( parentDNdXi[ q ][ b ], J, dNdXLocal[b] );
+        }
       }
     }
   }
 
+  if( storeGradN )
+  {
+    finiteElement.setGradNView( dNdX.toViewConst() );
+    finiteElement.setDetJView( detJ.toViewConst() );
+    return dNdX.size() + detJ.size();
+  }
+
+  if( m_geometricFactorsOption == GeometricFactorsOption::Affine && allAffine && numElems > 0 )
+  {
+    array4d< real64 > affineInvJ( numElems, 1, 3, 3 );
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      LvArray::tensorOps::copy< 3, 3 >( affineInvJ[ k ][ 0 ], invJ[ k ][ 0 ] );
+    }
+    invJ = std::move( affineInvJ );
+  }
+
+  finiteElement.setDetJView( detJ.toViewConst() );
+  finiteElement.setInvJView( invJ.toViewConst(), parentDNdXi.toViewConst() );
+  return invJ.size() + detJ.size() + parentDNdXi.size();
 }
 
 
@@ -45,6 +45,10 @@ class FiniteElementBase
 {
 public:
 
+  /// Whether the quadrature points coincide with the support points, which
+  /// derived formulations may redefine to enable sum-factorized kernels.
+  constexpr static bool collocatedQuadrature = false;
+
   /// Default Constructor
   FiniteElementBase() = default;
 
@@ -55,10 +59,14 @@ public:
   FiniteElementBase( FiniteElementBase const & source ):
 #ifdef CALC_FEM_SHAPE_IN_KERNEL
     m_viewGradN(),
-    m_viewDetJ()
+    m_viewDetJ(),
+    m_viewInvJ(),
+    m_viewParentGradN()
 #else
     m_viewGradN( source.m_viewGradN ),
-    m_viewDetJ( source.m_viewDetJ )
+    m_viewDetJ( source.m_viewDetJ ),
+    m_viewInvJ( source.m_viewInvJ ),
+    m_viewParentGradN( source.m_viewParentGradN )
 #endif
   {}
 
@@ -297,7 +305,8 @@ public:
    * @param gradN Return array of the shape function gradients.
    * @return The determinant of the Jacobian transformation matrix.
    *
-   * This function returns pre-calculated shape function gradients.
+   * This function returns pre-calculated shape function gradients, or applies the pre-calculated
+   * inverse jacobian to the parent gradients when only the inverse jacobians are stored.
    */
   template< typename LEAF >
   GEOSX_HOST_DEVICE
@@ -315,7 +324,8 @@ public:
    * @param gradN Return array of the shape function gradients.
    * @return The determinant of the Jacobian transformation matrix.
    *
-   * This function returns pre-calculated shape function gradients.
+   * This function returns pre-calculated shape function gradients, or applies the pre-calculated
+   * inverse jacobian to the parent gradients when only the inverse jacobians are stored.
    */
   template< typename LEAF >
   GEOSX_HOST_DEVICE
@@ -656,6 +666,27 @@ public:
     m_viewDetJ = source;
   }
 
+  /**
+   * @brief Sets the views of the inverse jacobians and of the parent gradients, used instead of m_viewGradN.
+   * @param invJ The inverse jacobians, with a second dimension of 1 for affine elements.
+   * @param parentGradN The shape function gradients with respect to the parent coordinates.
+   */
+  void setInvJView( arrayView4d< real64 const > const & invJ,
+                    arrayView3d< real64 const > const & parentGradN )
+  {
+    GEOSX_ERROR_IF( invJ.size( 1 ) != 1 && invJ.size( 1 ) != getNumQuadraturePoints(),
+                    "2nd-dimension of invJ array does not match 1 or the number of quadrature points" );
+    GEOSX_ERROR_IF_NE_MSG( parentGradN.size( 0 ),
+                           getNumQuadraturePoints(),
+                           "1st-dimension of parentGradN array does not match number of quadrature points" );
+    GEOSX_ERROR_IF_NE_MSG( parentGradN.size( 1 ),
+                           getMaxSupportPoints(),
+                           "2nd-dimension of parentGradN array does not match number of support points" );
+
+    m_viewInvJ = invJ;
+    m_viewParentGradN = parentGradN;
+  }
+
   /**
    * @brief Getter for m_viewGradN
    * @return A new arrayView copy of m_viewGradN.
@@ -682,6 +713,28 @@ protected:
   /// View to potentially hold pre-calculated weighted jacobian transformation
   /// determinants.
   arrayView2d< real64 const > m_viewDetJ;
+
+  /// View to potentially hold pre-calculated inverse jacobians, instead of m_viewGradN.
+  arrayView4d< real64 const > m_viewInvJ;
+
+  /// View to hold the shape function gradients in parent coordinates when m_viewInvJ is used.
+  arrayView3d< real64 const > m_viewParentGradN;
+
+private:
+
+  /**
+   * @brief Get the pre-calculated shape function gradients, or compute them from the pre-calculated inverse jacobian.
+   * @tparam LEAF Type of the derived finite element implementation.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param gradN Return array of the shape function gradients.
+   * @return The determinant of the Jacobian transformation matrix.
+   */
+  template< typename LEAF >
+  GEOSX_HOST_DEVICE
+  real64 getStoredGradN( localIndex const k,
+                         localIndex const q,
+                         real64 ( &gradN )[LEAF::maxSupportPoints][3] ) const;
 };
 
 /// @cond Doxygen_Suppress
@@ -751,10 +804,7 @@ real64 FiniteElementBase::getGradN( localIndex const k,
                                     real64 (& gradN)[LEAF::maxSupportPoints][3] ) const
 {
   GEOSX_UNUSED_VAR( X );
-
-  LvArray::tensorOps::copy< LEAF::maxSupportPoints, 3 >( gradN, m_viewGradN[ k ][ q ] );
-
-  return m_viewDetJ( k, q );
+  return getStoredGradN< LEAF >( k, q, gradN );
 }
 
 template< typename LEAF >
@@ -768,9 +818,31 @@ real64 FiniteElementBase::getGradN( localIndex const k,
 {
   GEOSX_UNUSED_VAR( X );
   GEOSX_UNUSED_VAR( stack );
+  return getStoredGradN< LEAF >( k, q, gradN );
+}
 
-  LvArray::tensorOps::copy< LEAF::maxSupportPoints, 3 >( gradN, m_viewGradN[ k ][ q ] );
-
+template< typename LEAF >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64 FiniteElementBase::getStoredGradN( localIndex const k,
+                                          localIndex const q,
+                                          real64 (& gradN)[LEAF::maxSupportPoints][3] ) const
+{
+  if( m_viewInvJ.size( 0 ) == 0 )
+  {
+    LvArray::tensorOps::copy< LEAF::maxSupportPoints, 3 >( gradN, m_viewGradN[ k ][ q ] );
+  }
+  else
+  {
+    // affine elements only store the inverse jacobian of the first quadrature point
+    localIndex const qJ = ( m_viewInvJ.size( 1 ) == 1 ) ? 0 : q;
+    real64 invJ[3][3];
+    LvArray::tensorOps::copy< 3, 3 >( invJ, m_viewInvJ[ k ][ qJ ] );
+    for( localIndex a = 0; a < LEAF::maxSupportPoints; ++a )
+    {
+      LvArray::tensorOps::Ri_eq_AjiBj< 3, 3 >( gradN[a], invJ, m_viewParentGradN[ q ][ a ] );
+    }
+  }
   return m_viewDetJ( k, q );
 }
 
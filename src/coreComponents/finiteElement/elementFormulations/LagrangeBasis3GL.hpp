@@ -81,6 +81,19 @@ public:
   }
 
 
+  /**
+   * @brief The weight of the Gauss-Lobatto quadrature rule collocated with
+   *   a support point.
+   * @param supportPointIndex The index of the support point
+   * @return The quadrature weight.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 weight( const localIndex supportPointIndex )
+  {
+    return ( supportPointIndex == 0 || supportPointIndex == 3 ) ? 1.0/6.0 : 5.0/6.0;
+  }
+
   /**
    * @brief The value of the basis function for a support point evaluated at a
    *   point along the axes.
@@ -38,7 +38,8 @@ namespace finiteElement
 class LagrangeBasis5GL
 {
 public:
-
+  /// The number of support points for the basis
+  constexpr static localIndex numSupportPoints = 6;
 
   /// sqrt(7)
   static constexpr real64 sqrt_7_ = 2.64575131106459059;
@@ -104,6 +105,42 @@ public:
     return result;
   }
 
+  /**
+   * @brief The weight of the Gauss-Lobatto quadrature rule collocated with
+   *   a support point.
+   * @param supportPointIndex The index of the support point
+   * @return The quadrature weight.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 weight( const localIndex supportPointIndex )
+  {
+    real64 result=0.0;
+
+    switch( supportPointIndex )
+    {
+      case 0:
+      case 5:
+        result = 1.0/15.0;
+        break;
+
+      case 1:
+      case 4:
+        result = (1.0/30.0)*(14.0-sqrt_7_);
+        break;
+
+      case 2:
+      case 3:
+        result = (1.0/30.0)*(14.0+sqrt_7_);
+        break;
+
+      default:
+        break;
+    }
+
+    return result;
+  }
+
   /**
    * @brief The value of the basis function for a support point evaluated at a
    *   point along the axes.
@@ -86,7 +86,7 @@ namespace finiteElement
  *                                                                 |_____________________________________|
  *
  */
-class Q3_Hexahedron_Lagrange_GaussLobatto final : public FiniteElementBase
+class Q3_Hexahedron_Lagrange_GaussLobatto : public FiniteElementBase
 {
 public:
 
@@ -102,6 +102,9 @@ public:
   /// The number of quadrature points per element.
   constexpr static localIndex numQuadraturePoints = 64;
 
+  /// The quadrature points coincide with the support points.
+  constexpr static bool collocatedQuadrature = true;
+
   /** @cond Doxygen_Suppress */
   USING_FINITEELEMENTBASE
   /** @endcond Doxygen_Suppress */
@@ -310,6 +313,47 @@ public:
 
 
 
+  /**
+   * @brief Calculate the weight of a quadrature point in the parent space.
+   * @param q Index of the quadrature point.
+   * @return The product of the 1d Gauss-Lobatto weights.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 quadratureWeight( localIndex const q );
+
+  /**
+   * @brief Calculate the gradient of a support field wrt the parent
+   *   coordinates at a quadrature point.
+   * @tparam NUM_COMPONENTS The number of components of the field.
+   * @param q The linear index of the quadrature point.
+   * @param var The support field.
+   * @param grad The parent gradient, grad[c][j] = d var_c / d xi_j.
+   *
+   * Since the quadrature points are the support points, the basis functions
+   * are zero at @p q except for the one of @p q itself, and only the support
+   * points on the three lines of the tensor grid crossing @p q contribute.
+   * Applied to the support coordinates, this gives the Jacobian transformation.
+   */
+  template< int NUM_COMPONENTS >
+  GEOSX_HOST_DEVICE
+  static void parentGradient( localIndex const q,
+                              real64 const (&var)[numNodes][NUM_COMPONENTS],
+                              real64 ( &grad )[NUM_COMPONENTS][3] );
+
+  /**
+   * @brief Add the transpose of parentGradient applied to a flux at a
+   *   quadrature point to a support field.
+   * @tparam NUM_COMPONENTS The number of components of the field.
+   * @param q The linear index of the quadrature point.
+   * @param flux The flux in the parent space, one row per component.
+   * @param var The support field, var[a][c] += sum_j dN_a/dxi_j flux[c][j].
+   */
+  template< int NUM_COMPONENTS >
+  GEOSX_HOST_DEVICE
+  static void plusParentGradientTranspose( localIndex const q,
+                                           real64 const (&flux)[NUM_COMPONENTS][3],
+                                           real64 ( &var )[numNodes][NUM_COMPONENTS] );
+
   /**
    * @brief Calculates the isoparametric "Jacobian" transformation
    *   matrix/mapping from the parent space to the physical space.
@@ -813,6 +857,82 @@ void Q3_Hexahedron_Lagrange_GaussLobatto::gradient( int const q,
   }, invJ, var, grad );
 }
 
+//*************************************************************************************************
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+Q3_Hexahedron_Lagrange_GaussLobatto::quadratureWeight( localIndex const q )
+{
+  int qa, qb, qc;
+  LagrangeBasis3GL::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  return LagrangeBasis3GL::weight( qa ) * LagrangeBasis3GL::weight( qb ) * LagrangeBasis3GL::weight( qc );
+}
+
+template< int NUM_COMPONENTS >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+Q3_Hexahedron_Lagrange_GaussLobatto::parentGradient( localIndex const q,
+                                                     real64 const (&var)[numNodes][NUM_COMPONENTS],
+                                                     real64 ( & grad )[NUM_COMPONENTS][3] )
+{
+  int qa, qb, qc;
+  LagrangeBasis3GL::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  for( int c = 0; c < NUM_COMPONENTS; ++c )
+  {
+    grad[c][0] = 0.0;
+    grad[c][1] = 0.0;
+    grad[c][2] = 0.0;
+  }
+
+  for( int a = 0; a < LagrangeBasis3GL::numSupportPoints; ++a )
+  {
+    real64 const dNdXi[3] = { LagrangeBasis3GL::gradient( a, LagrangeBasis3GL::parentSupportCoord( qa ) ),
+                              LagrangeBasis3GL::gradient( a, LagrangeBasis3GL::parentSupportCoord( qb ) ),
+                              LagrangeBasis3GL::gradient( a, LagrangeBasis3GL::parentSupportCoord( qc ) ) };
+    int const nodeIndex[3] = { LagrangeBasis3GL::TensorProduct3D::linearIndex( a, qb, qc ),
+                               LagrangeBasis3GL::TensorProduct3D::linearIndex( qa, a, qc ),
+                               LagrangeBasis3GL::TensorProduct3D::linearIndex( qa, qb, a ) };
+    for( int c = 0; c < NUM_COMPONENTS; ++c )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        grad[c][j] = grad[c][j] + dNdXi[j] * var[ nodeIndex[j] ][c];
+      }
+    }
+  }
+}
+
+template< int NUM_COMPONENTS >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+Q3_Hexahedron_Lagrange_GaussLobatto::plusParentGradientTranspose( localIndex const q,
+                                                                  real64 const (&flux)[NUM_COMPONENTS][3],
+                                                                  real64 ( & var )[numNodes][NUM_COMPONENTS] )
+{
+  int qa, qb, qc;
+  LagrangeBasis3GL::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  for( int a = 0; a < LagrangeBasis3GL::numSupportPoints; ++a )
+  {
+    real64 const dNdXi[3] = { LagrangeBasis3GL::gradient( a, LagrangeBasis3GL::parentSupportCoord( qa ) ),
+                              LagrangeBasis3GL::gradient( a, LagrangeBasis3GL::parentSupportCoord( qb ) ),
+                              LagrangeBasis3GL::gradient( a, LagrangeBasis3GL::parentSupportCoord( qc ) ) };
+    int const nodeIndex[3] = { LagrangeBasis3GL::TensorProduct3D::linearIndex( a, qb, qc ),
+                               LagrangeBasis3GL::TensorProduct3D::linearIndex( qa, a, qc ),
+                               LagrangeBasis3GL::TensorProduct3D::linearIndex( qa, qb, a ) };
+    for( int c = 0; c < NUM_COMPONENTS; ++c )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        var[ nodeIndex[j] ][c] = var[ nodeIndex[j] ][c] + dNdXi[j] * flux[c][j];
+      }
+    }
+  }
+}
+
 /// @endcond
 
 #if __GNUC__
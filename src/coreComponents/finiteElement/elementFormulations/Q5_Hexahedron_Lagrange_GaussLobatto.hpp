@@ -102,6 +102,9 @@ public:
   /// The number of quadrature points per element.
   constexpr static localIndex numQuadraturePoints = 216;
 
+  /// The quadrature points coincide with the support points.
+  constexpr static bool collocatedQuadrature = true;
+
   /** @cond Doxygen_Suppress */
   USING_FINITEELEMENTBASE
   /** @endcond Doxygen_Suppress */
@@ -270,6 +273,47 @@ public:
 
 
 
+  /**
+   * @brief Calculate the weight of a quadrature point in the parent space.
+   * @param q Index of the quadrature point.
+   * @return The product of the 1d Gauss-Lobatto weights.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 quadratureWeight( localIndex const q );
+
+  /**
+   * @brief Calculate the gradient of a support field wrt the parent
+   *   coordinates at a quadrature point.
+   * @tparam NUM_COMPONENTS The number of components of the field.
+   * @param q The linear index of the quadrature point.
+   * @param var The support field.
+   * @param grad The parent gradient, grad[c][j] = d var_c / d xi_j.
+   *
+   * Since the quadrature points are the support points, the basis functions
+   * are zero at @p q except for the one of @p q itself, and only the support
+   * points on the three lines of the tensor grid crossing @p q contribute.
+   * Applied to the support coordinates, this gives the Jacobian transformation.
+   */
+  template< int NUM_COMPONENTS >
+  GEOSX_HOST_DEVICE
+  static void parentGradient( localIndex const q,
+                              real64 const (&var)[numNodes][NUM_COMPONENTS],
+                              real64 ( &grad )[NUM_COMPONENTS][3] );
+
+  /**
+   * @brief Add the transpose of parentGradient applied to a flux at a
+   *   quadrature point to a support field.
+   * @tparam NUM_COMPONENTS The number of components of the field.
+   * @param q The linear index of the quadrature point.
+   * @param flux The flux in the parent space, one row per component.
+   * @param var The support field, var[a][c] += sum_j dN_a/dxi_j flux[c][j].
+   */
+  template< int NUM_COMPONENTS >
+  GEOSX_HOST_DEVICE
+  static void plusParentGradientTranspose( localIndex const q,
+                                           real64 const (&flux)[NUM_COMPONENTS][3],
+                                           real64 ( &var )[numNodes][NUM_COMPONENTS] );
+
   /**
    * @brief Calculates the isoparametric "Jacobian" transformation
    *   matrix/mapping from the parent space to the physical space.
@@ -605,6 +649,82 @@ void Q5_Hexahedron_Lagrange_GaussLobatto::gradient( int const q,
   }, invJ, var, grad );
 }
 
+//*************************************************************************************************
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+Q5_Hexahedron_Lagrange_GaussLobatto::quadratureWeight( localIndex const q )
+{
+  int qa, qb, qc;
+  LagrangeBasis5GL::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  return LagrangeBasis5GL::weight( qa ) * LagrangeBasis5GL::weight( qb ) * LagrangeBasis5GL::weight( qc );
+}
+
+template< int NUM_COMPONENTS >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+Q5_Hexahedron_Lagrange_GaussLobatto::parentGradient( localIndex const q,
+                                                     real64 const (&var)[numNodes][NUM_COMPONENTS],
+                                                     real64 ( & grad )[NUM_COMPONENTS][3] )
+{
+  int qa, qb, qc;
+  LagrangeBasis5GL::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  for( int c = 0; c < NUM_COMPONENTS; ++c )
+  {
+    grad[c][0] = 0.0;
+    grad[c][1] = 0.0;
+    grad[c][2] = 0.0;
+  }
+
+  for( int a = 0; a < LagrangeBasis5GL::numSupportPoints; ++a )
+  {
+    real64 const dNdXi[3] = { LagrangeBasis5GL::gradient( a, LagrangeBasis5GL::parentSupportCoord( qa ) ),
+                              LagrangeBasis5GL::gradient( a, LagrangeBasis5GL::parentSupportCoord( qb ) ),
+                              LagrangeBasis5GL::gradient( a, LagrangeBasis5GL::parentSupportCoord( qc ) ) };
+    int const nodeIndex[3] = { LagrangeBasis5GL::TensorProduct3D::linearIndex( a, qb, qc ),
+                               LagrangeBasis5GL::TensorProduct3D::linearIndex( qa, a, qc ),
+                               LagrangeBasis5GL::TensorProduct3D::linearIndex( qa, qb, a ) };
+    for( int c = 0; c < NUM_COMPONENTS; ++c )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        grad[c][j] = grad[c][j] + dNdXi[j] * var[ nodeIndex[j] ][c];
+      }
+    }
+  }
+}
+
+template< int NUM_COMPONENTS >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+Q5_Hexahedron_Lagrange_GaussLobatto::plusParentGradientTranspose( localIndex const q,
+                                                                  real64 const (&flux)[NUM_COMPONENTS][3],
+                                                                  real64 ( & var )[numNodes][NUM_COMPONENTS] )
+{
+  int qa, qb, qc;
+  LagrangeBasis5GL::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  for( int a = 0; a < LagrangeBasis5GL::numSupportPoints; ++a )
+  {
+    real64 const dNdXi[3] = { LagrangeBasis5GL::gradient( a, LagrangeBasis5GL::parentSupportCoord( qa ) ),
+                              LagrangeBasis5GL::gradient( a, LagrangeBasis5GL::parentSupportCoord( qb ) ),
+                              LagrangeBasis5GL::gradient( a, LagrangeBasis5GL::parentSupportCoord( qc ) ) };
+    int const nodeIndex[3] = { LagrangeBasis5GL::TensorProduct3D::linearIndex( a, qb, qc ),
+                               LagrangeBasis5GL::TensorProduct3D::linearIndex( qa, a, qc ),
+                               LagrangeBasis5GL::TensorProduct3D::linearIndex( qa, qb, a ) };
+    for( int c = 0; c < NUM_COMPONENTS; ++c )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        var[ nodeIndex[j] ][c] = var[ nodeIndex[j] ][c] + dNdXi[j] * flux[c][j];
+      }
+    }
+  }
+}
+
 /// @endcond
 
 #if __GNUC__
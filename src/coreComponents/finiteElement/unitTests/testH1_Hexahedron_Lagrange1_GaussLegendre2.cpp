@@ -182,6 +182,97 @@ TEST( FiniteElementShapeFunctions, testKernelHost )
   testKernelDriver< serialPolicy >();
 }
 
+/**
+ * @brief Compare the gradients computed from the stored inverse jacobians with calcGradN.
+ * @param X The coordinates of the support points of the element.
+ * @param numStoredJacobians The number of inverse jacobians stored, 1 for an affine element.
+ */
+void testStoredInverseJacobian( real64 const (&X)[8][3],
+                                localIndex const numStoredJacobians )
+{
+  using FE_TYPE = H1_Hexahedron_Lagrange1_GaussLegendre2;
+  constexpr int numNodes = 8;
+  constexpr int numQuadraturePoints = 8;
+
+  // the parent gradients are half the gradients on the unit cube, whose inverse jacobian is 2 I
+  real64 xUnit[numNodes][3];
+  for( int a = 0; a < numNodes; ++a )
+  {
+    xUnit[a][0] = a % 2;
+    xUnit[a][1] = ( a / 2 ) % 2;
+    xUnit[a][2] = a / 4;
+  }
+
+  array3d< real64 > parentGradN( numQuadraturePoints, numNodes, 3 );
+  array4d< real64 > invJ( 1, numStoredJacobians, 3, 3 );
+  array2d< real64 > detJ( 1, numQuadraturePoints );
+  for( int q = 0; q < numQuadraturePoints; ++q )
+  {
+    real64 gradN[numNodes][3];
+    FE_TYPE::calcGradN( q, xUnit, gradN );
+    for( int a = 0; a < numNodes; ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        parentGradN[q][a][i] = 0.5 * gradN[a][i];
+      }
+    }
+
+    detJ[0][q] = FE_TYPE::calcGradN( q, X, gradN );
+    if( q < numStoredJacobians )
+    {
+      real64 invJLocal[3][3];
+      FE_TYPE::invJacobianTransformation( q, X, invJLocal );
+      LvArray::tensorOps::copy< 3, 3 >( invJ[0][q], invJLocal );
+    }
+  }
+
+  FE_TYPE finiteElement;
+  finiteElement.setDetJView( detJ.toViewConst() );
+  finiteElement.setInvJView( invJ.toViewConst(), parentGradN.toViewConst() );
+
+  for( int q = 0; q < numQuadraturePoints; ++q )
+  {
+    real64 expectedGradN[numNodes][3];
+    real64 const expectedDetJ = FE_TYPE::calcGradN( q, X, expectedGradN );
+
+    real64 gradN[numNodes][3];
+    real64 const storedDetJ = finiteElement.getGradN< FE_TYPE >( 0, q, 0, gradN );
+
+    EXPECT_NEAR( storedDetJ, expectedDetJ, 1.0e-12 * LvArray::math::abs( expectedDetJ ) );
+    for( int a = 0; a < numNodes; ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        EXPECT_NEAR( gradN[a][i], expectedGradN[a][i], 1.0e-12 );
+      }
+    }
+  }
+}
+
+TEST( FiniteElementShapeFunctions, testStoredInverseJacobian )
+{
+  real64 xDistorted[8][3];
+  real64 xAffine[8][3];
+  for( int a = 0; a < 8; ++a )
+  {
+    real64 const x = a % 2;
+    real64 const y = ( a / 2 ) % 2;
+    real64 const z = a / 4;
+
+    xDistorted[a][0] = 2.0 * x + 0.2 * y * z;
+    xDistorted[a][1] = 1.5 * y + 0.1 * x * z;
+    xDistorted[a][2] = 0.5 * z + 0.3 * x * y;
+
+    xAffine[a][0] = 2.0 * x + 0.4 * y;
+    xAffine[a][1] = 1.5 * y + 0.2 * z;
+    xAffine[a][2] = 0.5 * z + 0.1 * x;
+  }
+
+  testStoredInverseJacobian( xDistorted, 8 );
+  testStoredInverseJacobian( xAffine, 1 );
+}
+
 
 
 using namespace geosx;
@@ -68,6 +68,11 @@ void CellElementStencilTPFA::addVectors( real64 const & transMultiplier,
                                          real64 const (&faceNormal)[3],
                                          real64 const (&cellToFaceVec)[2][3] )
 {
+  if( isAxisAligned() )
+  {
+    expandAxisAlignedConnections();
+  }
+
   localIndex const oldSize = m_faceNormal.size( 0 );
   localIndex const newSize = oldSize + 1;
   m_faceNormal.resize( newSize );
@@ -83,6 +88,79 @@ void CellElementStencilTPFA::addVectors( real64 const & transMultiplier,
   }
 }
 
+bool CellElementStencilTPFA::compressAxisAlignedConnections( real64 const tolerance )
+{
+  localIndex const numConnections = m_faceNormal.size( 0 );
+  if( numConnections == 0 || isAxisAligned() )
+  {
+    return isAxisAligned();
+  }
+
+  // A unit vector is along axis d if its component d is +/-1 and the others vanish
+  auto const getAxis = [tolerance]( auto const & vec ) -> integer
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      if( LvArray::math::abs( LvArray::math::abs( vec[d] ) - 1.0 ) <= tolerance &&
+          LvArray::math::abs( vec[(d+1)%3] ) <= tolerance &&
+          LvArray::math::abs( vec[(d+2)%3] ) <= tolerance )
+      {
+        return d;
+      }
+    }
+    return -1;
+  };
+
+  array1d< integer > axisDirection( numConnections );
+  RAJA::ReduceMin< parallelHostReduce, integer > minAxis( 0 );
+  forAll< parallelHostPolicy >( numConnections, [=,
+                                                 faceNormal = m_faceNormal.toViewConst(),
+                                                 cellToFaceVec = m_cellToFaceVec.toViewConst(),
+                                                 axisDirection = axisDirection.toView()]( localIndex const iconn )
+  {
+    integer const axis = getAxis( faceNormal[iconn] );
+    bool const isAligned = axis >= 0 &&
+                           getAxis( cellToFaceVec[iconn][0] ) == axis &&
+                           getAxis( cellToFaceVec[iconn][1] ) == axis;
+    axisDirection[iconn] = isAligned ? axis : -1;
+    minAxis.min( axisDirection[iconn] );
+  } );
+
+  if( minAxis.get() < 0 )
+  {
+    return false;
+  }
+
+  // Replace the vectors by empty arrays to release their memory
+  m_axisDirection = std::move( axisDirection );
+  m_faceNormal = array2d< real64 >( 0, 3 );
+  m_cellToFaceVec = array3d< real64 >( 0, 2, 3 );
+  return true;
+}
+
+void CellElementStencilTPFA::expandAxisAlignedConnections()
+{
+  localIndex const numConnections = m_axisDirection.size();
+  m_faceNormal.resize( numConnections );
+  m_cellToFaceVec.resize( numConnections );
+
+  // The signs are irrelevant for the weights, the normal is flipped towards each cell-to-face vector
+  forAll< parallelHostPolicy >( numConnections, [axisDirection = m_axisDirection.toViewConst(),
+                                                 faceNormal = m_faceNormal.toView(),
+                                                 cellToFaceVec = m_cellToFaceVec.toView()]( localIndex const iconn )
+  {
+    integer const axis = axisDirection[iconn];
+    for( integer d = 0; d < 3; ++d )
+    {
+      faceNormal[iconn][d] = d == axis ? 1.0 : 0.0;
+      cellToFaceVec[iconn][0][d] = d == axis ? 1.0 : 0.0;
+      cellToFaceVec[iconn][1][d] = d == axis ? -1.0 : 0.0;
+    }
+  } );
+
+  m_axisDirection.clear();
+}
+
 CellElementStencilTPFA::KernelWrapper
 CellElementStencilTPFA::createKernelWrapper() const
 {
@@ -92,7 +170,9 @@ CellElementStencilTPFA::createKernelWrapper() const
            m_weights,
            m_faceNormal,
            m_cellToFaceVec,
-           m_transMultiplier };
+           m_transMultiplier,
+           m_axisDirection,
+           m_numInteriorConnections };
 }
 
 CellElementStencilTPFAWrapper::
@@ -102,14 +182,20 @@ CellElementStencilTPFAWrapper::
                                  WeightContainerType const & weights,
                                  arrayView2d< real64 > const & faceNormal,
                                  arrayView3d< real64 > const & cellToFaceVec,
-                                 arrayView1d< real64 > const & transMultiplier )
+                                 arrayView1d< real64 > const & transMultiplier,
+                                 arrayView1d< integer const > const & axisDirection,
+                                 localIndex const numInteriorConnections )
   : StencilWrapperBase( elementRegionIndices,
                         elementSubRegionIndices,
                         elementIndices,
                         weights ),
   m_faceNormal( faceNormal ),
   m_cellToFaceVec( cellToFaceVec ),
-  m_transMultiplier( transMultiplier )
-{}
+  m_transMultiplier( transMultiplier ),
+  m_axisDirection( axisDirection ),
+  m_isAxisAligned( !axisDirection.empty() )
+{
+  m_numInteriorConnections = numInteriorConnections;
+}
 
 } /* namespace geosx */
@@ -44,6 +44,8 @@ public:
    * @param faceNormal Face normal vector
    * @param cellToFaceVec Cell center to face center vector
    * @param transMultiplier Transmissibility multiplier
+   * @param axisDirection Axis of each connection, empty unless all the connections are axis-aligned
+   * @param numInteriorConnections Number of connections touching no ghost element
    */
   CellElementStencilTPFAWrapper( IndexContainerType const & elementRegionIndices,
                                  IndexContainerType const & elementSubRegionIndices,
@@ -51,7 +53,9 @@ public:
                                  WeightContainerType const & weights,
                                  arrayView2d< real64 > const & faceNormal,
                                  arrayView3d< real64 > const & cellToFaceVec,
-                                 arrayView1d< real64 > const & transMultiplier );
+                                 arrayView1d< real64 > const & transMultiplier,
+                                 arrayView1d< integer const > const & axisDirection,
+                                 localIndex const numInteriorConnections );
 
   /**
    * @brief Compute weights and derivatives w.r.t to one variable.
@@ -121,6 +125,12 @@ private:
   arrayView2d< real64 > m_faceNormal;
   arrayView3d< real64 > m_cellToFaceVec;
   arrayView1d< real64 > m_transMultiplier;
+
+  /// Axis of each connection when the stencil is axis-aligned, empty otherwise
+  arrayView1d< integer const > m_axisDirection;
+
+  /// Whether the connections are axis-aligned, in which case m_faceNormal and m_cellToFaceVec are empty
+  bool m_isAxisAligned;
 };
 
 
@@ -155,6 +165,26 @@ public:
                    real64 const (&faceNormal)[3],
                    real64 const (&cellToFaceVec)[2][3] );
 
+  /**
+   * @brief Store the connections by axis if all of them are axis-aligned.
+   * @param[in] tolerance the tolerance on the components of the unit vectors
+   * @return true if the stencil has been compressed
+   *
+   * On Cartesian grids the face normal and the cell-to-face vectors of each connection are
+   * both along one axis, so the connection geometry reduces to the axis index and the
+   * half-transmissibilities to the stored weights times the diagonal coefficient component.
+   * The face normals and cell-to-face vectors are then released. Adding vectors to a
+   * compressed stencil restores them first.
+   */
+  bool compressAxisAlignedConnections( real64 const tolerance = 1e-12 );
+
+  /**
+   * @brief Tell whether the connections are stored by axis.
+   * @return true if compressAxisAlignedConnections succeeded and no vector has been added since
+   */
+  bool isAxisAligned() const
+  { return !m_axisDirection.empty(); }
+
   /**
    * @brief Return the stencil size.
    * @return the stencil size
@@ -179,6 +209,22 @@ public:
     return maxStencilSize;
   }
 
+  /**
+   * @brief Mark the connections added so far as interior connections.
+   *
+   * The connections are expected to be added interior first (touching no ghost element),
+   * and the remaining ones (touching a ghost element) afterwards.
+   */
+  void setInteriorConnections()
+  { m_numInteriorConnections = size(); }
+
+  /**
+   * @brief Give the number of interior connections.
+   * @return the number of connections, stored first, that touch no ghost element
+   */
+  localIndex numInteriorConnections() const
+  { return m_numInteriorConnections; }
+
   /// Type of kernel wrapper for in-kernel update
   using KernelWrapper = CellElementStencilTPFAWrapper;
 
@@ -190,9 +236,20 @@ public:
 
 private:
 
+  /**
+   * @brief Rebuild the face normals and cell-to-face vectors of a compressed stencil.
+   */
+  void expandAxisAlignedConnections();
+
   array2d< real64 > m_faceNormal;
   array3d< real64 > m_cellToFaceVec;
   array1d< real64 > m_transMultiplier;
+
+  /// Axis of each connection when the stencil is axis-aligned, empty otherwise
+  array1d< integer > m_axisDirection;
+
+  /// Number of connections touching no ghost element, stored first
+  localIndex m_numInteriorConnections = 0;
 };
 
 GEOSX_HOST_DEVICE
@@ -218,6 +275,13 @@ CellElementStencilTPFAWrapper::
 
     halfWeight[i] = m_weights[iconn][i];
 
+    // Axis-aligned connection: the conormal reduces to the diagonal coefficient component
+    if( m_isAxisAligned )
+    {
+      halfWeight[i] *= coefficient[er][esr][ei][0][m_axisDirection[iconn]];
+      continue;
+    }
+
     // Proper computation
     real64 faceNormal[3];
     LvArray::tensorOps::copy< 3 >( faceNormal, m_faceNormal[iconn] );
@@ -275,6 +339,12 @@ CellElementStencilTPFAWrapper::
   {
     halfWeight[i] = m_weights[iconn][i];
 
+    // Axis-aligned connection: the unit cell-to-face vector is along the face normal
+    if( m_isAxisAligned )
+    {
+      continue;
+    }
+
     // Proper computation
     real64 faceNormal[3];
 
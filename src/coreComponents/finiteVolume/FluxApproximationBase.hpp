@@ -172,6 +172,13 @@ public:
    */
   void setCoeffName( string const & name );
 
+  /**
+   * @brief Request the cell stencil to store the connections touching no ghost cell first.
+   *
+   * Must be called before the stencils are computed, during the initialization of the solvers.
+   */
+  void splitInteriorConnections() { m_splitInteriorConnections = true; }
+
 protected:
 
   virtual void initializePreSubGroups() override;
@@ -255,6 +262,9 @@ protected:
   /// length scale of the mesh body
   real64 m_lengthScale;
 
+  /// flag to store the connections touching no ghost cell first in the cell stencil
+  bool m_splitInteriorConnections;
+
 };
 
 template< typename TYPE >
@@ -122,6 +122,14 @@ public:
   typename TRAITS::WeightContainerViewConstType
   getWeights() const { return m_weights; }
 
+  /**
+   * @brief Give the number of interior connections.
+   * @return the number of connections, stored first in the stencil, that touch no ghost element
+   *
+   * The interior connections do not depend on the halo exchange and can be processed while it is in flight.
+   */
+  localIndex numInteriorConnections() const { return m_numInteriorConnections; }
+
 protected:
 
   /// The container for the element region indices for each point in each stencil
@@ -135,6 +143,9 @@ protected:
 
   /// The container for the weights for each point in each stencil
   typename TRAITS::WeightContainerViewConstType m_weights;
+
+  /// The number of connections touching no ghost element, zero if the stencil is not split
+  localIndex m_numInteriorConnections = 0;
 };
 
 
@@ -134,20 +134,45 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
 
   stencil.reserve( faceManager.size() );
 
+  localIndex const numFaces = faceManager.size();
   real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
 
-  forAll< serialPolicy >( faceManager.size(), [=, &stencil]( localIndex const kf )
+  // The face geometry is computed in parallel, the connections are then appended serially in face order.
+  // If requested (see splitInteriorConnections), the connections touching no ghost cell are added first,
+  // so that the solvers can assemble them while the halo exchange is in flight, and the ones touching
+  // a ghost cell in a second pass.
+  integer constexpr noConnection = 0;
+  integer constexpr interiorConnection = 1;
+  integer constexpr ghostedConnection = 2;
+
+  array1d< integer > connectionType( numFaces );
+  array2d< real64 > faceNormals( numFaces, 3 );
+  array3d< real64 > cellToFaceVecs( numFaces, 2, 3 );
+  array2d< real64 > weights( numFaces, 2 );
+
+  forAll< parallelHostPolicy >( numFaces, [=,
+                                           elemCenter = elemCenter.toNestedViewConst(),
+                                           elemGhostRank = elemGhostRank.toNestedViewConst(),
+                                           regionFilter = regionFilter.toViewConst(),
+                                           connectionType = connectionType.toView(),
+                                           faceNormals = faceNormals.toView(),
+                                           cellToFaceVecs = cellToFaceVecs.toView(),
+                                           weights = weights.toView()]( localIndex const kf )
   {
+    connectionType[kf] = noConnection;
+
     // Filter out boundary faces
     if( elemList[kf][0] < 0 || elemList[kf][1] < 0 || isZero( transMultiplier[kf] ) )
     {
       return;
     }
 
+    bool const isGhost0 = elemGhostRank[elemRegionList[kf][0]][elemSubRegionList[kf][0]][elemList[kf][0]] >= 0;
+    bool const isGhost1 = elemGhostRank[elemRegionList[kf][1]][elemSubRegionList[kf][1]][elemList[kf][1]] >= 0;
+
     // Filter out faces where neither cell is locally owned
-    if( elemGhostRank[elemRegionList[kf][0]][elemSubRegionList[kf][0]][elemList[kf][0]] >= 0 &&
-        elemGhostRank[elemRegionList[kf][1]][elemSubRegionList[kf][1]][elemList[kf][1]] >= 0 )
+    if( isGhost0 && isGhost1 )
     {
       return;
     }
@@ -158,7 +183,7 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       return;
     }
 
-    real64 faceCenter[ 3 ], faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
+    real64 faceCenter[ 3 ], faceNormal[ 3 ];
     real64 const faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf], X, faceCenter, faceNormal, areaTolerance );
 
     if( faceArea < areaTolerance )
@@ -166,12 +191,37 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       return;
     }
 
+    for( localIndex ke = 0; ke < 2; ++ke )
+    {
+      localIndex const er  = elemRegionList[kf][ke];
+      localIndex const esr = elemSubRegionList[kf][ke];
+      localIndex const ei  = elemList[kf][ke];
+
+      real64 cellToFaceVec[ 3 ];
+      LvArray::tensorOps::copy< 3 >( cellToFaceVec, faceCenter );
+      LvArray::tensorOps::subtract< 3 >( cellToFaceVec, elemCenter[er][esr][ei] );
+
+      real64 const c2fDistance = LvArray::tensorOps::normalize< 3 >( cellToFaceVec );
+
+      LvArray::tensorOps::copy< 3 >( cellToFaceVecs[kf][ke], cellToFaceVec );
+      weights[kf][ke] = faceArea / c2fDistance;
+    }
+    LvArray::tensorOps::copy< 3 >( faceNormals[kf], faceNormal );
+
+    connectionType[kf] = ( isGhost0 || isGhost1 ) ? ghostedConnection : interiorConnection;
+  } );
+
+  auto addConnection = [&]( localIndex const kf )
+  {
     stackArray1d< localIndex, 2 > regionIndex( 2 );
     stackArray1d< localIndex, 2 > subRegionIndex( 2 );
     stackArray1d< localIndex, 2 > elementIndex( 2 );
     stackArray1d< real64, 2 > stencilWeights( 2 );
     stackArray1d< globalIndex, 2 > stencilCellsGlobalIndex( 2 );
 
+    real64 faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
+    LvArray::tensorOps::copy< 3 >( faceNormal, faceNormals[kf] );
+
     for( localIndex ke = 0; ke < 2; ++ke )
     {
       localIndex const er  = elemRegionList[kf][ke];
@@ -182,13 +232,8 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       subRegionIndex[ke] = esr;
       elementIndex[ke] = ei;
       stencilCellsGlobalIndex[ke] = elemGlobalIndex[er][esr][ei];
-
-      LvArray::tensorOps::copy< 3 >( cellToFaceVec[ke], faceCenter );
-      LvArray::tensorOps::subtract< 3 >( cellToFaceVec[ke], elemCenter[er][esr][ei] );
-
-      real64 const c2fDistance = LvArray::tensorOps::normalize< 3 >( cellToFaceVec[ke] );
-
-      stencilWeights[ke] = faceArea / c2fDistance;
+      stencilWeights[ke] = weights[kf][ke];
+      LvArray::tensorOps::copy< 3 >( cellToFaceVec[ke], cellToFaceVecs[kf][ke] );
     }
 
     // Ensure elements are added to stencil in order of global indices
@@ -207,7 +252,46 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
                  kf );
 
     stencil.addVectors( transMultiplier[kf], faceNormal, cellToFaceVec );
-  } );
+  };
+
+  if( m_splitInteriorConnections )
+  {
+    for( localIndex kf = 0; kf < numFaces; ++kf )
+    {
+      if( connectionType[kf] == interiorConnection )
+      {
+        addConnection( kf );
+      }
+    }
+    stencil.setInteriorConnections();
+
+    for( localIndex kf = 0; kf < numFaces; ++kf )
+    {
+      if( connectionType[kf] == ghostedConnection )
+      {
+        addConnection( kf );
+      }
+    }
+  }
+  else
+  {
+    for( localIndex kf = 0; kf < numFaces; ++kf )
+    {
+      if( connectionType[kf] != noConnection )
+      {
+        addConnection( kf );
+      }
+    }
+  }
+
+  // On Cartesian grids the connection geometry reduces to an axis index
+  bool const isAxisAligned = stencil.compressAxisAlignedConnections() || stencil.size() == 0;
+  if( getLogLevel() >= 1 )
+  {
+    bool const allAxisAligned = MpiWrapper::min( isAxisAligned ? 1 : 0 ) == 1;
+    GEOSX_LOG_RANK_0( GEOSX_FMT( "{}: the cell stencil of mesh '{}' is {}axis-aligned",
+                                 getName(), mesh.getName(), allAxisAligned ? "" : "not " ) );
+  }
 }
 
 void TwoPointFluxApproximation::registerFractureStencil( Group & stencilGroup ) const
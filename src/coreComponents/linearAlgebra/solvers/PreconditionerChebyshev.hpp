@@ -0,0 +1,257 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
+
+#include "linearAlgebra/common/LinearOperator.hpp"
+#include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/Arnoldi.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Chebyshev polynomial preconditioner built on the Jacobi-scaled operator D^{-1} A.
+ * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ *
+ * The polynomial damps the error on the interval [ lambdaMax / eigenvalueRatio, lambdaMax ],
+ * where lambdaMax is estimated with a few Arnoldi iterations. Only applications of the operator
+ * and its diagonal are needed, so the preconditioner can be set up from a matrix-free operator.
+ */
+template< typename LAI >
+class PreconditionerChebyshev : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param degree the number of Chebyshev iterations, each one after the first applying the operator once
+   * @param eigenvalueRatio ratio between the largest and the smallest eigenvalue targeted by the polynomial
+   * @param numArnoldiIterations number of Arnoldi iterations used to estimate the largest eigenvalue
+   */
+  explicit PreconditionerChebyshev( integer const degree = 3,
+                                    real64 const eigenvalueRatio = 30.0,
+                                    integer const numArnoldiIterations = 10 )
+    : m_degree( degree ),
+    m_eigenvalueRatio( eigenvalueRatio ),
+    m_numArnoldiIterations( numArnoldiIterations )
+  {
+    GEOSX_ERROR_IF_LT_MSG( degree, 1, "The degree of the Chebyshev polynomial must be positive" );
+    GEOSX_ERROR_IF_LE_MSG( eigenvalueRatio, 1.0, "The eigenvalue ratio of the Chebyshev polynomial must be larger than 1" );
+  }
+
+  /**
+   * @brief Compute the preconditioner from a matrix.
+   * @param mat the matrix to precondition.
+   */
+  virtual void setup( Matrix const & mat ) override
+  {
+    Base::setup( mat );
+    Vector diagonal;
+    diagonal.create( mat.numLocalRows(), mat.comm() );
+    mat.extractDiagonal( diagonal );
+    setup( mat, diagonal );
+  }
+
+  /**
+   * @brief Compute the preconditioner from an operator and its diagonal.
+   * @param op the operator to precondition (must outlive the preconditioner)
+   * @param diagonal the diagonal of the operator
+   */
+  void setup( LinearOperator< Vector > const & op,
+              Vector const & diagonal )
+  {
+    GEOSX_LAI_ASSERT_EQ( op.numLocalRows(), op.numLocalCols() );
+    GEOSX_LAI_ASSERT_EQ( op.numLocalRows(), diagonal.localSize() );
+
+    m_operator = &op;
+
+    m_diagInv.create( op.numLocalRows(), op.comm() );
+    m_diagInv.copy( diagonal );
+    m_diagInv.reciprocal();
+
+    m_residual.create( op.numLocalRows(), op.comm() );
+    m_direction.create( op.numLocalRows(), op.comm() );
+    m_work.create( op.numLocalRows(), op.comm() );
+
+    // the estimate is slightly enlarged, since Arnoldi approaches the largest eigenvalue from below
+    m_lambdaMax = 1.1 * ArnoldiLargestEigenvalue( JacobiScaledOperator( *this ), m_numArnoldiIterations );
+    m_lambdaMin = m_lambdaMax / m_eigenvalueRatio;
+  }
+
+  /**
+   * @brief Clean up the preconditioner setup.
+   */
+  virtual void clear() override
+  {
+    Base::clear();
+    m_operator = nullptr;
+    m_diagInv.reset();
+    m_residual.reset();
+    m_direction.reset();
+    m_work.reset();
+  }
+
+  /**
+   * @brief Apply operator to a vector.
+   *
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override
+  {
+    GEOSX_LAI_ASSERT( m_operator != nullptr );
+    GEOSX_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+    GEOSX_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+    real64 const theta = 0.5 * ( m_lambdaMax + m_lambdaMin );
+    real64 const delta = 0.5 * ( m_lambdaMax - m_lambdaMin );
+    real64 const sigma = theta / delta;
+    real64 rho = 1.0 / sigma;
+
+    // first iterate from a zero initial guess
+    m_residual.copy( src );
+    m_diagInv.pointwiseProduct( m_residual, m_direction );
+    m_direction.scale( 1.0 / theta );
+    dst.copy( m_direction );
+
+    for( integer k = 1; k < m_degree; ++k )
+    {
+      m_operator->apply( m_direction, m_work );
+      m_residual.axpy( -1.0, m_work );
+
+      real64 const rhoNew = 1.0 / ( 2.0 * sigma - rho );
+      m_diagInv.pointwiseProduct( m_residual, m_work );
+      m_direction.axpby( 2.0 * rhoNew / delta, m_work, rhoNew * rho );
+      dst.axpy( 1.0, m_direction );
+      rho = rhoNew;
+    }
+  }
+
+  virtual globalIndex numGlobalRows() const override final
+  {
+    GEOSX_LAI_ASSERT( m_operator != nullptr );
+    return m_operator->numGlobalRows();
+  }
+
+  virtual globalIndex numGlobalCols() const override final
+  {
+    GEOSX_LAI_ASSERT( m_operator != nullptr );
+    return m_operator->numGlobalCols();
+  }
+
+  virtual localIndex numLocalRows() const override final
+  {
+    GEOSX_LAI_ASSERT( m_operator != nullptr );
+    return m_operator->numLocalRows();
+  }
+
+  virtual localIndex numLocalCols() const override final
+  {
+    GEOSX_LAI_ASSERT( m_operator != nullptr );
+    return m_operator->numLocalCols();
+  }
+
+  virtual MPI_Comm comm() const override final
+  {
+    GEOSX_LAI_ASSERT( m_operator != nullptr );
+    return m_operator->comm();
+  }
+
+  /**
+   * @return the estimate of the largest eigenvalue of D^{-1} A used by the polynomial
+   */
+  real64 largestEigenvalue() const
+  {
+    return m_lambdaMax;
+  }
+
+private:
+
+  /**
+   * @brief The operator D^{-1} A, only used to estimate its largest eigenvalue.
+   */
+  class JacobiScaledOperator : public LinearOperator< Vector >
+  {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param precond the preconditioner holding the operator and the inverse diagonal
+     */
+    explicit JacobiScaledOperator( PreconditionerChebyshev const & precond )
+      : m_precond( precond )
+    {}
+
+    virtual void apply( Vector const & src, Vector & dst ) const override
+    {
+      m_precond.m_operator->apply( src, m_precond.m_work );
+      m_precond.m_diagInv.pointwiseProduct( m_precond.m_work, dst );
+    }
+
+    virtual globalIndex numGlobalRows() const override { return m_precond.numGlobalRows(); }
+
+    virtual globalIndex numGlobalCols() const override { return m_precond.numGlobalCols(); }
+
+    virtual localIndex numLocalRows() const override { return m_precond.numLocalRows(); }
+
+    virtual localIndex numLocalCols() const override { return m_precond.numLocalCols(); }
+
+    virtual MPI_Comm comm() const override { return m_precond.comm(); }
+
+private:
+
+    /// The preconditioner being set up
+    PreconditionerChebyshev const & m_precond;
+  };
+
+  /// The degree of the polynomial
+  integer m_degree;
+
+  /// The ratio between the largest and the smallest targeted eigenvalues
+  real64 m_eigenvalueRatio;
+
+  /// The number of Arnoldi iterations used to estimate the largest eigenvalue
+  integer m_numArnoldiIterations;
+
+  /// The operator to precondition
+  LinearOperator< Vector > const * m_operator{};
+
+  /// The inverse of the diagonal of the operator
+  Vector m_diagInv;
+
+  /// Bounds of the targeted spectrum of D^{-1} A
+  real64 m_lambdaMax{};
+  real64 m_lambdaMin{};
+
+  /// Work vectors of the Chebyshev recurrence
+  mutable Vector m_residual;
+  mutable Vector m_direction;
+  mutable Vector m_work;
+};
+
+}
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
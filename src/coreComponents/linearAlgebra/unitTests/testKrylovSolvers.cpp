@@ -17,6 +17,7 @@
  */
 
 #include "common/DataTypes.hpp"
+#include "linearAlgebra/solvers/PreconditionerChebyshev.hpp"
 #include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
@@ -172,6 +173,75 @@ INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, KrylovSolverTest, PetscInterface, );
 
 ///////////////////////////////////////////////////////////////////////////////////////
 
+template< typename LAI >
+class KrylovSolverChebyshevTest : public KrylovSolverTestBase< typename LAI::ParallelMatrix,
+                                                               PreconditionerChebyshev< LAI >,
+                                                               typename LAI::ParallelVector >
+{
+public:
+
+  using Matrix = typename LAI::ParallelMatrix;
+  using Vector = typename LAI::ParallelVector;
+
+  using Base = KrylovSolverTestBase< typename LAI::ParallelMatrix,
+                                     PreconditionerChebyshev< LAI >,
+                                     typename LAI::ParallelVector >;
+
+  KrylovSolverChebyshevTest(): Base() {}
+
+protected:
+
+  void SetUp() override
+  {
+    // Compute matrix and preconditioner
+    globalIndex constexpr n = 100;
+    geosx::testing::compute2DLaplaceOperator( MPI_COMM_GEOSX, n, this->matrix );
+    this->precond.setup( this->matrix );
+
+    // Set up vectors
+    this->sol_true.create( this->matrix.numLocalCols(), MPI_COMM_GEOSX );
+    this->sol_comp.create( this->matrix.numLocalCols(), MPI_COMM_GEOSX );
+    this->rhs_true.create( this->matrix.numLocalRows(), MPI_COMM_GEOSX );
+
+    // The Jacobi-scaled Laplacian has its spectrum in ( 0, 2 ), the estimate must not fall far below
+    EXPECT_GT( this->precond.largestEigenvalue(), 1.5 );
+    EXPECT_LT( this->precond.largestEigenvalue(), 2.5 );
+
+    // Condition number for the Laplacian matrix estimate: 4 * n^2 / pi^2
+    this->cond_est = 1.5 * 4.0 * n * n / std::pow( M_PI, 2 );
+  }
+};
+
+TYPED_TEST_SUITE_P( KrylovSolverChebyshevTest );
+
+TYPED_TEST_P( KrylovSolverChebyshevTest, CG )
+{
+  this->test( params_CG() );
+}
+
+TYPED_TEST_P( KrylovSolverChebyshevTest, GMRES )
+{
+  this->test( params_GMRES() );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( KrylovSolverChebyshevTest,
+                             CG,
+                             GMRES );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverChebyshevTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, KrylovSolverChebyshevTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, KrylovSolverChebyshevTest, PetscInterface, );
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+
 template< typename LAI >
 class KrylovSolverBlockTest : public KrylovSolverTestBase< BlockOperatorWrapper< typename LAI::ParallelVector, typename LAI::ParallelMatrix >,
                                                            BlockOperatorWrapper< typename LAI::ParallelVector >,
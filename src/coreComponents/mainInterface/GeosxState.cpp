@@ -108,8 +108,8 @@ GeosxState::GeosxState( std::unique_ptr< CommandLineOptions > && commandLineOpti
   m_state( State::UNINITIALIZED ),
   m_commandLineOptions( std::move( commandLineOptions ) ),
   m_rootNode( std::make_unique< conduit::Node >() ),
-  m_problemManager( nullptr ),
   m_commTools( std::make_unique< CommunicationTools >() ),
+  m_problemManager( nullptr ),
 #if defined( GEOSX_USE_CALIPER )
   m_caliperManager( std::make_unique< cali::ConfigManager >() ),
 #endif
@@ -229,12 +229,12 @@ private:
   /// The root conduit node for the data repository.
   std::unique_ptr< conduit::Node > m_rootNode;
 
+  /// The CommunicationTools, declared before the ProblemManager so that it outlives the solvers
+  std::unique_ptr< CommunicationTools > m_commTools;
+
   /// The ProblemManager.
   std::unique_ptr< ProblemManager > m_problemManager;
 
-  /// The CommunicationTools.
-  std::unique_ptr< CommunicationTools > m_commTools;
-
 #if defined( GEOSX_USE_CALIPER )
   /// The Caliper ConfigManager.
   std::unique_ptr< cali::ConfigManager > m_caliperManager;
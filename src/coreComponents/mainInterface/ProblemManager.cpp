@@ -603,7 +603,26 @@ void ProblemManager::generateMesh()
 
   Group const & commandLine = this->getGroup< Group >( groupKeys.commandLine );
   integer const useNonblockingMPI = commandLine.getReference< integer >( viewKeys.useNonblockingMPI );
-  domain.setupCommunications( useNonblockingMPI );
+
+  // each mesh body only gets the ghost layers needed by the solvers targeting it
+  map< string, GhostingRequirements > ghostingRequirements;
+  m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+  {
+    GhostingRequirements const solverGhosting = solver.getGhostingRequirements( domain );
+    GEOSX_LOG_RANK_0_IF( solver.getLogLevel() >= 1,
+                         solver.getName() << ": " << solverGhosting.depth <<
+                         " ghost layer(s) of " << solverGhosting.adjacency << "-adjacent elements required" );
+    for( auto const & target : solver.getMeshTargets() )
+    {
+      string const & meshBodyName = target.first.first;
+      auto const inserted = ghostingRequirements.insert( { meshBodyName, solverGhosting } );
+      if( !inserted.second )
+      {
+        inserted.first->second.merge( solverGhosting );
+      }
+    }
+  } );
+  domain.setupCommunications( useNonblockingMPI, ghostingRequirements );
 
   domain.forMeshBodies( [&]( MeshBody & meshBody )
   {
@@ -804,6 +823,9 @@ map< std::tuple< string, string, string, string >, localIndex > ProblemManager::
       FiniteElementDiscretization const * const
       feDiscretization = feDiscretizationManager.getGroupPointer< FiniteElementDiscretization >( discretizationName );
 
+      // number of values stored for the geometric factors of the discretization on this rank
+      globalIndex numGeometricFactors = 0;
+
       solver->forDiscretizationOnMeshTargets( meshBodies,
                                               [&]( string const & meshBodyName,
                                                    MeshLevel & targetMeshLevel,
@@ -851,7 +873,8 @@ map< std::tuple< string, string, string, string >, localIndex > ProblemManager::
 
                   localIndex const numQuadraturePoints = FE_TYPE::numQuadraturePoints;
 
-                  feDiscretization->calculateShapeFunctionGradients< SUBREGION_TYPE, FE_TYPE >( X, &subRegion, meshData, finiteElement );
+                  numGeometricFactors +=
+                    feDiscretization->calculateShapeFunctionGradients< SUBREGION_TYPE, FE_TYPE >( X, &subRegion, meshData, finiteElement );
 
                   localIndex & numQuadraturePointsInList = regionQuadrature[ std::make_tuple( meshBodyName,
                                                                                               meshLevel.getName(),
@@ -877,6 +900,15 @@ map< std::tuple< string, string, string, string >, localIndex > ProblemManager::
           }
         }
       } );
+
+      // the footprint is summed over the ranks, only when it is reported
+      if( feDiscretization != nullptr && solver->getLogLevel() > 0 )
+      {
+        numGeometricFactors = MpiWrapper::sum( numGeometricFactors );
+        GEOSX_LOG_RANK_0( solver->getName() << ": geometric factors of " << discretizationName << " stored as "
+                                            << EnumStrings< FiniteElementDiscretization::GeometricFactorsOption >::toString( feDiscretization->getGeometricFactorsOption() )
+                                            << ", " << numGeometricFactors * sizeof( real64 ) / 1.0e6 << " MB" );
+      }
     } // if( solver!=nullptr )
   }
 
@@ -100,6 +100,7 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     TIMERS,
     TRACE_DATA_MIGRATION,
     PAUSE_FOR,
+    MPI_THREAD_MULTIPLE_SUPPORT,
   };
 
   const option::Descriptor usage[] =
@@ -119,6 +120,7 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     { TIMERS, 0, "t", "timers", Arg::nonEmpty, "\t-t, --timers, \t String specifying the type of timer output" },
     { TRACE_DATA_MIGRATION, 0, "", "trace-data-migration", Arg::None, "\t--trace-data-migration, \t Trace host-device data migration" },
     { PAUSE_FOR, 0, "", "pause-for", Arg::numeric, "\t--pause-for, \t Pause geosx for a given number of seconds before starting execution" },
+    { MPI_THREAD_MULTIPLE_SUPPORT, 0, "", "mpi-thread-multiple", Arg::None, "\t--mpi-thread-multiple, \t Initialize MPI with MPI_THREAD_MULTIPLE support, needed by asynchronous outputs" },
     { 0, 0, nullptr, nullptr, nullptr, nullptr }
   };
 
@@ -228,6 +230,11 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
         std::this_thread::sleep_for( std::chrono::seconds( duration ) );
       }
       break;
+      case MPI_THREAD_MULTIPLE_SUPPORT:
+      {
+        // MPI was already initialized accordingly by setupMPI, the provided level is given by MpiWrapper::isThreadMultiple
+      }
+      break;
     }
   }
 
@@ -40,6 +40,10 @@ CellElementSubRegion::CellElementSubRegion( string const & name, Group * const p
 
   registerWrapper( viewKeyStruct::detJString(), &m_detJ ).setSizedFromParent( 1 ).reference();
 
+  registerWrapper( viewKeyStruct::invJString(), &m_invJ ).setSizedFromParent( 1 ).reference().resizeDimension< 2, 3 >( 3, 3 );
+
+  registerWrapper( viewKeyStruct::parentDNdXiString(), &m_parentDNdXi ).reference().resizeDimension< 2 >( 3 );
+
   registerWrapper( viewKeyStruct::toEmbSurfString(), &m_toEmbeddedSurfaces ).setSizedFromParent( 1 );
 
   registerWrapper( viewKeyStruct::fracturedCellsString(), &m_fracturedCells ).setSizedFromParent( 1 );
@@ -74,7 +74,8 @@ void DomainPartition::initializationOrder( string_array & order )
   }
 }
 
-void DomainPartition::setupCommunications( bool use_nonblocking )
+void DomainPartition::setupCommunications( bool use_nonblocking,
+                                           map< string, GhostingRequirements > const & ghostingRequirements )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -183,7 +184,10 @@ void DomainPartition::setupCommunications( bool use_nonblocking )
     CommunicationTools::getInstance().findMatchedPartitionBoundaryObjects( nodeManager,
                                                                            m_neighbors );
 
-    CommunicationTools::getInstance().setupGhosts( meshLevel, m_neighbors, use_nonblocking );
+    auto const ghostingIt = ghostingRequirements.find( meshBody.getName() );
+    GhostingRequirements const ghosting = ghostingIt != ghostingRequirements.end() ? ghostingIt->second : GhostingRequirements();
+
+    CommunicationTools::getInstance().setupGhosts( meshLevel, m_neighbors, ghosting, use_nonblocking );
 
     faceManager.sortAllFaceNodes( nodeManager, meshLevel.getElemManager() );
     faceManager.computeGeometry( nodeManager );
@@ -90,8 +90,11 @@ public:
   /**
    * @brief Constructs the communications between this DomainPartition and its neighbors.
    * @param use_nonblocking If true complete the communications of each phase in the order they are received.
+   * @param ghostingRequirements The ghost layers to build, per mesh body name.
+   *                             The mesh bodies missing from the map get one layer of node-adjacent elements.
    */
-  void setupCommunications( bool use_nonblocking );
+  void setupCommunications( bool use_nonblocking,
+                            map< string, GhostingRequirements > const & ghostingRequirements = {} );
 
   /**
    * @brief Recursively builds neighbors if an MPI cartesian topology is used (i.e. not metis).
@@ -44,6 +44,10 @@ FaceElementSubRegion::FaceElementSubRegion( string const & name,
 
   registerWrapper( viewKeyStruct::detJString(), &m_detJ ).setSizedFromParent( 1 ).reference();
 
+  registerWrapper( viewKeyStruct::invJString(), &m_invJ ).setSizedFromParent( 1 ).reference().resizeDimension< 2, 3 >( 3, 3 );
+
+  registerWrapper( viewKeyStruct::parentDNdXiString(), &m_parentDNdXi ).reference().resizeDimension< 2 >( 3 );
+
   registerWrapper( viewKeyStruct::faceListString(), &m_toFacesRelation ).
     setDescription( "Map to the faces attached to each FaceElement." ).
     reference().resize( 0, 2 );
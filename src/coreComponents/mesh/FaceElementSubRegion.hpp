@@ -131,6 +131,10 @@ public:
     static constexpr char const * dNdXString() { return "dNdX"; }
     /// @return String key for the derivative of the jacobian.
     static constexpr char const * detJString() { return "detJ"; }
+    /// @return String key for the inverse of the jacobian, stored instead of the derivatives of the shape functions.
+    static constexpr char const * invJString() { return "invJ"; }
+    /// @return String key for the derivatives of the shape functions with respect to the parent coordinates.
+    static constexpr char const * parentDNdXiString() { return "parentDNdXi"; }
     /// @return String key to the map of edge local indices to the fracture connector local indices.
     static constexpr char const * edgesTofractureConnectorsEdgesString() { return "edgesToFractureConnectors"; }
     /// @return String key to the map of fracture connector local indices to edge local indices.
@@ -245,6 +249,30 @@ public:
   arrayView2d< real64 const > detJ() const
   { return m_detJ; }
 
+  /**
+   * @brief @return The array of inverse jacobians, at each quadrature point or once per affine element.
+   */
+  array4d< real64 > & invJ()
+  { return m_invJ; }
+
+  /**
+   * @brief @return The array of inverse jacobians, at each quadrature point or once per affine element.
+   */
+  arrayView4d< real64 const > invJ() const
+  { return m_invJ; }
+
+  /**
+   * @brief @return The array of shape function derivatives with respect to the parent coordinates.
+   */
+  array3d< real64 > & parentDNdXi()
+  { return m_parentDNdXi; }
+
+  /**
+   * @brief @return The array of shape function derivatives with respect to the parent coordinates.
+   */
+  arrayView3d< real64 const > parentDNdXi() const
+  { return m_parentDNdXi; }
+
 private:
 
   /**
@@ -264,6 +292,12 @@ private:
   /// The array of jacobian determinantes.
   array2d< real64 > m_detJ;
 
+  /// The array of inverse jacobians, empty unless the shape function derivatives are not stored.
+  array4d< real64 > m_invJ;
+
+  /// The array of shape function derivatives with respect to the parent coordinates at each quadrature point.
+  array3d< real64 > m_parentDNdXi;
+
   /// Element-to-face relation
   FaceMapType m_toFacesRelation;
 
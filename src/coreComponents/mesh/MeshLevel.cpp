@@ -401,7 +401,7 @@ MeshLevel::MeshLevel( string const & name,
 
 
       //Fill a temporary array which contains the Gauss-Lobatto points depending on the order
-      array1d< real64 > GaussLobattoPts( 4 );
+      array1d< real64 > GaussLobattoPts( order+1 );
 
       if( order==1 )
       {
@@ -500,11 +500,12 @@ void MeshLevel::initializePostInitialConditionsPostSubGroups()
 }
 
 void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const & seedNodeList,
+                                        arrayView1d< localIndex const > const & seedFaceList,
                                         localIndex_array & nodeAdjacencyList,
                                         localIndex_array & edgeAdjacencyList,
                                         localIndex_array & faceAdjacencyList,
                                         ElementRegionManager::ElementViewAccessor< ReferenceWrapper< localIndex_array > > & elementAdjacencyList,
-                                        integer const depth )
+                                        GhostingRequirements const & ghosting )
 {
   NodeManager const & nodeManager = getNodeManager();
 
@@ -514,6 +515,9 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
 
   FaceManager const & faceManager = this->getFaceManager();
   ArrayOfArraysView< localIndex const > const & faceToEdges = faceManager.edgeList().toViewConst();
+  arrayView2d< localIndex const > const faceToElementRegionList = faceManager.elementRegionList();
+  arrayView2d< localIndex const > const faceToElementSubRegionList = faceManager.elementSubRegionList();
+  arrayView2d< localIndex const > const faceToElementList = faceManager.elementList();
 
   ElementRegionManager const & elemManager = this->getElemManager();
 
@@ -528,17 +532,40 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
   }
 
   nodeAdjacencySet.insert( seedNodeList.begin(), seedNodeList.end() );
+  if( ghosting.adjacency == GhostingRequirements::Adjacency::face )
+  {
+    faceAdjacencySet.insert( seedFaceList.begin(), seedFaceList.end() );
+  }
 
-  for( integer d=0; d<depth; ++d )
+  for( integer d=0; d<ghosting.depth; ++d )
   {
-    for( localIndex const nodeIndex : nodeAdjacencySet )
+    if( ghosting.adjacency == GhostingRequirements::Adjacency::node )
     {
-      for( localIndex b=0; b<nodeToElementRegionList.sizeOfArray( nodeIndex ); ++b )
+      for( localIndex const nodeIndex : nodeAdjacencySet )
       {
-        localIndex const regionIndex = nodeToElementRegionList[nodeIndex][b];
-        localIndex const subRegionIndex = nodeToElementSubRegionList[nodeIndex][b];
-        localIndex const elementIndex = nodeToElementList[nodeIndex][b];
-        elementAdjacencySet[regionIndex][subRegionIndex].insert( elementIndex );
+        for( localIndex b=0; b<nodeToElementRegionList.sizeOfArray( nodeIndex ); ++b )
+        {
+          localIndex const regionIndex = nodeToElementRegionList[nodeIndex][b];
+          localIndex const subRegionIndex = nodeToElementSubRegionList[nodeIndex][b];
+          localIndex const elementIndex = nodeToElementList[nodeIndex][b];
+          elementAdjacencySet[regionIndex][subRegionIndex].insert( elementIndex );
+        }
+      }
+    }
+    else
+    {
+      for( localIndex const faceIndex : faceAdjacencySet )
+      {
+        for( localIndex b=0; b<faceToElementRegionList.size( 1 ); ++b )
+        {
+          localIndex const regionIndex = faceToElementRegionList[faceIndex][b];
+          if( regionIndex >= 0 )
+          {
+            localIndex const subRegionIndex = faceToElementSubRegionList[faceIndex][b];
+            localIndex const elementIndex = faceToElementList[faceIndex][b];
+            elementAdjacencySet[regionIndex][subRegionIndex].insert( elementIndex );
+          }
+        }
       }
     }
 
@@ -24,11 +24,50 @@
 #include "EdgeManager.hpp"
 #include "ElementRegionManager.hpp"
 #include "FaceManager.hpp"
+#include "codingUtilities/EnumStrings.hpp"
 
 namespace geosx
 {
 class ElementRegionManager;
 
+/**
+ * @struct GhostingRequirements
+ * @brief Description of the ghost layers a discretization needs on the partition boundaries.
+ */
+struct GhostingRequirements
+{
+  /**
+   * @enum Adjacency
+   * @brief The connectivity used to grow the ghost layers from the partition boundary.
+   */
+  enum class Adjacency : integer
+  {
+    face, ///< only the elements sharing a face with the previous layer are ghosted
+    node  ///< all the elements sharing a node with the previous layer are ghosted
+  };
+
+  /// connectivity used to grow the ghost layers
+  Adjacency adjacency = Adjacency::node;
+
+  /// number of ghost layers
+  integer depth = 1;
+
+  /**
+   * @brief Extend these requirements so that they also satisfy @p other.
+   * @param[in] other the requirements to merge in
+   */
+  void merge( GhostingRequirements const & other )
+  {
+    adjacency = std::max( adjacency, other.adjacency );
+    depth = std::max( depth, other.depth );
+  }
+};
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( GhostingRequirements::Adjacency,
+              "face",
+              "node" );
+
 /**
  * @class MeshLevel
  * @brief Class facilitating the representation of a multi-level discretization of a MeshBody.
@@ -83,18 +122,24 @@ public:
   /**
    * @brief Collects the nodes, edges, faces, and elements that are adjacent to a given list of nodes.
    * @param[in] seedNodeList the input nodes
+   * @param[in] seedFaceList the input faces, used to select the elements when the adjacency is Adjacency::face
    * @param[out] nodeAdjacencyList the nodes adjacent to the input nodes of seedNodeList
    * @param[out] edgeAdjacencyList the edges adjacent to the input nodes of seedNodeList
    * @param[out] faceAdjacencyList the faces adjacent to the input nodes of seedNodeList
    * @param[out] elementAdjacencyList the elements adjacent to the input nodes of seedNodeList
-   * @param[in] depth the depth of the search for adjacent quantities (first-order neighbors, neighbors of neighbors, etc)
+   * @param[in] ghosting the connectivity and depth of the search for adjacent quantities
+   *
+   * The nodes, faces and edges of every selected element are always collected, since they are needed to
+   * unpack the element on the receiving side. With Adjacency::face, the elements only touching the seeds
+   * through a node or an edge are left out.
    */
   void generateAdjacencyLists( arrayView1d< localIndex const > const & seedNodeList,
+                               arrayView1d< localIndex const > const & seedFaceList,
                                localIndex_array & nodeAdjacencyList,
                                localIndex_array & edgeAdjacencyList,
                                localIndex_array & faceAdjacencyList,
                                ElementRegionManager::ElementViewAccessor< ReferenceWrapper< localIndex_array > > & elementAdjacencyList,
-                               integer const depth );
+                               GhostingRequirements const & ghosting );
 
 
   virtual void initializePostInitialConditionsPostSubGroups() override;
@@ -247,6 +292,20 @@ public:
 
   ///@}
 
+  /**
+   * @brief Record that the number of objects of the mesh level, or the size of their fields, changed.
+   * @details The synchronization plans of CommunicationTools are rebuilt when this count differs from the
+   *          one they were created with. The count is compared locally, so this must be called on all ranks.
+   */
+  void modifiedSizes()
+  { ++getShallowParent().m_sizeModificationCount; }
+
+  /**
+   * @return the number of calls to modifiedSizes() on this mesh level, or on its source if it is a shallow copy
+   */
+  integer sizeModificationCount() const
+  { return getShallowParent().m_sizeModificationCount; }
+
 private:
 
   /// Manager for node data
@@ -267,6 +326,9 @@ private:
 
   MeshLevel * const m_shallowParent;
 
+  /// Number of changes of the sizes of the objects or of their fields
+  integer m_sizeModificationCount = 0;
+
 };
 
 } /* namespace geosx */
@@ -130,7 +130,7 @@ void CellBlockManager::buildToCellMap( localIndex const numObjects,
 {
   // Calculate the number of entries in each sub-array
   array1d< localIndex > counts( numObjects );
-  counts.setValues< serialPolicy >( overAlloc );
+  counts.setValues< parallelHostPolicy >( overAlloc );
 
   for( localIndex blockIndex = 0; blockIndex < numCellBlocks(); ++blockIndex )
   {
@@ -211,10 +211,10 @@ struct NodesAndElementOfFace
                          localIndex const faceNum ):
     n1( sortedNodes[1] ),
     n2( sortedNodes[2] ),
-    numNodes( static_cast< localIndex >( sortedNodes.size() ) ),
     cellIndex( cell ),
-    blockIndex( block ),
-    faceNumber( faceNum )
+    blockIndex( LvArray::integerConversion< std::int32_t >( block ) ),
+    numNodes( LvArray::integerConversion< std::int16_t >( sortedNodes.size() ) ),
+    faceNumber( LvArray::integerConversion< std::int16_t >( faceNum ) )
   {}
 
   /// Second highest node index in the face
@@ -223,9 +223,6 @@ struct NodesAndElementOfFace
   /// Third highest node index in the face
   localIndex n2;
 
-  /// Number of nodes in the face (saved here to simplify map resizing)
-  localIndex numNodes;
-
   /**
    * @brief Index of the cell to which this face belongs.
    *
@@ -237,10 +234,13 @@ struct NodesAndElementOfFace
   localIndex cellIndex;
 
   /// Cell block index of the cell to which this face belongs.
-  localIndex blockIndex;
+  std::int32_t blockIndex;
+
+  /// Number of nodes in the face (saved here to simplify map resizing)
+  std::int16_t numNodes;
 
   /// Face number within a cell
-  localIndex faceNumber;
+  std::int16_t faceNumber;
 
 private:
 
@@ -260,6 +260,10 @@ private:
   }
 };
 
+// One record is stored for each face of each cell: keeping it small bounds the temporary memory of buildFaceMaps.
+static_assert( sizeof( NodesAndElementOfFace ) <= 4 * sizeof( localIndex ),
+               "NodesAndElementOfFace should fit in four localIndex" );
+
 /**
  * @brief Fills the face to nodes map and face to element maps
  * @param [in] lowestNodeToFaces and array of size numNodes of arrays of NodesAndElementOfFace associated with each node.
@@ -299,7 +303,7 @@ void populateFaceMaps( Group const & cellBlocks,
       NodesAndElementOfFace const & f0 = *first;
       CellBlock const & cb = cellBlocks.getGroup< CellBlock >( f0.blockIndex );
       localIndex const numNodesInFace = cb.getFaceNodes( f0.cellIndex, f0.faceNumber, nodesInFace );
-      GEOSX_ASSERT_EQ( numNodesInFace, f0.numNodes );
+      GEOSX_ASSERT_EQ( numNodesInFace, LvArray::integerConversion< localIndex >( f0.numNodes ) );
 
       for( localIndex i = 0; i < numNodesInFace; ++i )
       {
@@ -544,13 +548,18 @@ void CellBlockManager::buildFaceMaps()
 {
   GEOSX_MARK_FUNCTION;
 
-  ArrayOfArrays< NodesAndElementOfFace > const lowestNodeToFaces =
-    createLowestNodeToFaces( m_numNodes, this->getCellBlocks() );
+  ArrayOfArrays< NodesAndElementOfFace > lowestNodeToFaces;
+  {
+    GEOSX_MARK_SCOPE( createLowestNodeToFaces );
+    lowestNodeToFaces = createLowestNodeToFaces( m_numNodes, this->getCellBlocks() );
+  }
 
   array1d< localIndex > const uniqueFaceOffsets =
     computeUniqueValueOffsets< parallelHostPolicy >( lowestNodeToFaces.toViewConst() );
   m_numFaces = uniqueFaceOffsets.back();
 
+  GEOSX_MARK_SCOPE( populateFaceMaps );
+
   resizeFaceMaps( lowestNodeToFaces.toViewConst(),
                   uniqueFaceOffsets,
                   m_faceToNodes,
@@ -691,7 +700,7 @@ void CellBlockManager::setNumNodes( localIndex numNodes )
   m_numNodes = numNodes;
   m_nodesPositions.resize( m_numNodes );
   m_nodeLocalToGlobal.resize( m_numNodes );
-  m_nodeLocalToGlobal.setValues< serialPolicy >( -1 );
+  m_nodeLocalToGlobal.setValues< parallelHostPolicy >( -1 );
 }
 
 array1d< globalIndex > CellBlockManager::getNodeLocalToGlobal() const
@@ -526,12 +526,17 @@ localIndex buildEdgeMaps( localIndex const numNodes,
 {
   GEOSX_MARK_FUNCTION;
 
-  ArrayOfArrays< EdgeBuilder > const edgesByLowestNode =
-    createEdgesByLowestNode( numNodes, faceToNodeMap );
+  ArrayOfArrays< EdgeBuilder > edgesByLowestNode;
+  {
+    GEOSX_MARK_SCOPE( createEdgesByLowestNode );
+    edgesByLowestNode = createEdgesByLowestNode( numNodes, faceToNodeMap );
+  }
 
   array1d< localIndex > const uniqueEdgeOffsets =
     computeUniqueValueOffsets< parallelHostPolicy >( edgesByLowestNode.toViewConst() );
 
+  GEOSX_MARK_SCOPE( populateEdgeMaps );
+
   resizeEdgeMaps( edgesByLowestNode.toViewConst(),
                   uniqueEdgeOffsets,
                   faceToNodeMap,
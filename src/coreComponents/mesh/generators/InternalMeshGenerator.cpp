@@ -30,7 +30,9 @@
 #include "common/DataTypes.hpp"
 #include "common/TimingMacros.hpp"
 
+#include <array>
 #include <cmath>
+#include <set>
 
 namespace geosx
 {
@@ -115,6 +117,13 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
     setInputFlag( InputFlags::OPTIONAL ).
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "A position tolerance to verify if a node belong to a nodeset" );
+
+  registerWrapper( viewKeyStruct::partitionMethodString(), &m_partitionMethod ).
+    setApplyDefaultValue( PartitionMethod::cartesian ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Domain decomposition of the mesh. Valid options:\n* " + EnumStrings< PartitionMethod >::concat( "\n* " ) + "\n"
+                    "The cartesian decomposition uses the x/y/z partition counts given on the command line, "
+                    "the bisection decomposition accepts any number of ranks (cartesian meshes only)" );
 }
 
 static int getNumElemPerBox( ElementType const elementType )
@@ -539,6 +548,146 @@ static void getElemToNodesRelationInBox( ElementType const elementType,
   }
 }
 
+/**
+ * @brief Find the element index box of a rank by recursive coordinate bisection of the structured index space.
+ * @param[in] numElems the number of elements in each direction
+ * @param[in] dim the number of dimensions of the mesh
+ * @param[in] numRanks the number of ranks sharing the index space
+ * @param[in] rank the rank whose box is computed
+ * @param[out] first the first element index of the box in each direction
+ * @param[out] last the last element index of the box in each direction
+ *
+ * At each level the longest direction of the box is cut, the two halves receiving a number of
+ * element layers proportional to their number of ranks. Every rank computes the same cuts,
+ * so the boxes of the other ranks are obtained without communication.
+ */
+static void bisectIndexSpace( int const (&numElems)[3],
+                              int const dim,
+                              int const numRanks,
+                              int const rank,
+                              int (& first)[3],
+                              int (& last)[3] )
+{
+  for( int i = 0; i < 3; ++i )
+  {
+    first[i] = 0;
+    last[i] = numElems[i] - 1;
+  }
+
+  int firstRank = 0;
+  int count = numRanks;
+  while( count > 1 )
+  {
+    int cutDir = 0;
+    for( int i = 1; i < dim; ++i )
+    {
+      if( last[i] - first[i] > last[cutDir] - first[cutDir] )
+      {
+        cutDir = i;
+      }
+    }
+
+    int const lowCount = count / 2;
+    int const length = last[cutDir] - first[cutDir] + 1;
+    int const lowLength = LvArray::integerConversion< int >( std::int64_t( length ) * lowCount / count );
+    if( rank < firstRank + lowCount )
+    {
+      last[cutDir] = first[cutDir] + lowLength - 1;
+      count = lowCount;
+    }
+    else
+    {
+      first[cutDir] += lowLength;
+      firstRank += lowCount;
+      count -= lowCount;
+    }
+  }
+}
+
+void InternalMeshGenerator::computeBisectionPartition( DomainPartition & domain,
+                                                       int (& firstElemIndexInPartition)[3],
+                                                       int (& lastElemIndexInPartition)[3] ) const
+{
+  GEOSX_THROW_IF( !isCartesian(),
+                  getName() << ": the " << EnumStrings< PartitionMethod >::toString( PartitionMethod::bisection ) <<
+                  " partition method is only available for cartesian meshes",
+                  InputError );
+
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+
+  // Every rank computes the boxes of all the ranks, which are identical everywhere
+  std::vector< std::array< int, 3 > > first( numRanks ), last( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    int firstIndex[3], lastIndex[3];
+    bisectIndexSpace( m_numElemsTotal, m_dim, numRanks, r, firstIndex, lastIndex );
+    for( int i = 0; i < 3; ++i )
+    {
+      first[r][i] = firstIndex[i];
+      last[r][i] = lastIndex[i];
+    }
+  }
+
+  for( int i = 0; i < 3; ++i )
+  {
+    firstElemIndexInPartition[i] = first[rank][i];
+    lastElemIndexInPartition[i] = last[rank][i];
+  }
+  for( int i = 0; i < m_dim; ++i )
+  {
+    GEOSX_THROW_IF( lastElemIndexInPartition[i] < firstElemIndexInPartition[i],
+                    getName() << ": too many ranks (" << numRanks << ") for " << m_numElemsTotal[i] <<
+                    " elements in direction " << i,
+                    InputError );
+  }
+
+  // Two ranks are neighbors when their boxes share at least one node
+  auto const touching = [&]( int const r0, int const r1 )
+  {
+    bool touch = true;
+    for( int i = 0; i < m_dim; ++i )
+    {
+      touch = touch && first[r1][i] <= last[r0][i] + 1 && first[r0][i] <= last[r1][i] + 1;
+    }
+    return touch;
+  };
+
+  std::set< int > & neighbors = domain.getMetisNeighborList();
+  for( int otherRank = 0; otherRank < numRanks; ++otherRank )
+  {
+    if( otherRank != rank && touching( rank, otherRank ) )
+    {
+      neighbors.insert( otherRank );
+    }
+  }
+
+  // The cartesian coordinates of the partition are not defined, so its color (used to order
+  // the parallel topology changes) is obtained from a greedy coloring of the rank graph
+  std::vector< int > colors( numRanks, -1 );
+  int numColors = 1;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    std::set< int > usedColors;
+    for( int otherRank = 0; otherRank < r; ++otherRank )
+    {
+      if( touching( r, otherRank ) )
+      {
+        usedColors.insert( colors[otherRank] );
+      }
+    }
+    colors[r] = 0;
+    while( usedColors.count( colors[r] ) > 0 )
+    {
+      ++colors[r];
+    }
+    numColors = std::max( numColors, colors[r] + 1 );
+  }
+
+  SpatialPartition & partition = dynamicCast< SpatialPartition & >( domain.getReference< PartitionBase >( keys::partitionManager ) );
+  partition.setColor( colors[rank], numColors );
+}
+
 /**
  * @param partition
  * @param domain
@@ -585,15 +734,16 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
     m_max[1] = m_vertices[1].back();
     m_max[2] = m_vertices[2].back();
 
-    partition.setSizes( m_min, m_max );
+    if( m_partitionMethod == PartitionMethod::cartesian )
+    {
+      partition.setSizes( m_min, m_max );
+    }
 
     real64 size[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_max );
     LvArray::tensorOps::subtract< 3 >( size, m_min );
     meshBody.setGlobalLengthScale( LvArray::tensorOps::l2Norm< 3 >( size ) );
   }
 
-  // Find elemCenters for even uniform element sizes
-  array1d< array1d< real64 > > elemCenterCoords( 3 );
   for( int i = 0; i < 3; ++i )
   {
     m_numElemsTotal[i] = 0;
@@ -601,45 +751,53 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
     {
       m_numElemsTotal[i] += m_nElems[i][block];
     }
-
-    elemCenterCoords[i].resize( m_numElemsTotal[i] );
-    array1d< real64 > elemCenterCoordsLocal( m_numElemsTotal[i] );
-    for( int k = 0; k < m_numElemsTotal[i]; ++k )
-    {
-      elemCenterCoordsLocal[k] = m_min[i] + ( m_max[i] - m_min[i] ) * ( k + 0.5 ) / m_numElemsTotal[i];
-    }
-    MpiWrapper::allReduce( elemCenterCoordsLocal.data(),
-                           elemCenterCoords[i].data(),
-                           m_numElemsTotal[i],
-                           MPI_MAX,
-                           MPI_COMM_GEOSX );
   }
 
+  // Element centers for even uniform element sizes, identical on all ranks
+  auto const elemCenterCoord = [&]( int const i, int const k )
+  {
+    return m_min[i] + ( m_max[i] - m_min[i] ) * ( k + 0.5 ) / m_numElemsTotal[i];
+  };
+
   // Find starting/ending index
   // Get the first and last indices in this partition each direction
   int firstElemIndexInPartition[3] = { -1, -1, -1 };
   int lastElemIndexInPartition[3] = { -2, -2, -2 };
 
-  for( int i = 0; i < 3; ++i )
+  if( m_partitionMethod == PartitionMethod::bisection )
   {
-    //    firstElemIndexInPartition[i] = -1;
-    //    lastElemIndexInPartition[i] = -2;
-    for( int k = 0; k < m_numElemsTotal[i]; ++k )
+    computeBisectionPartition( domain, firstElemIndexInPartition, lastElemIndexInPartition );
+
+    // The extent of the partition is the one of its corner nodes
+    int const lastNodeIndexInPartition[3] = { lastElemIndexInPartition[0] + 1,
+                                              lastElemIndexInPartition[1] + 1,
+                                              lastElemIndexInPartition[2] + 1 };
+    real64 partitionMin[3], partitionMax[3];
+    getNodePosition( firstElemIndexInPartition, m_trianglePattern, partitionMin );
+    getNodePosition( lastNodeIndexInPartition, m_trianglePattern, partitionMax );
+    partition.setBox( m_min, m_max, partitionMin, partitionMax );
+  }
+  else
+  {
+    for( int i = 0; i < 3; ++i )
     {
-      if( partition.isCoordInPartition( elemCenterCoords[i][k], i ) )
+      for( int k = 0; k < m_numElemsTotal[i]; ++k )
       {
-        firstElemIndexInPartition[i] = k;
-        break;
+        if( partition.isCoordInPartition( elemCenterCoord( i, k ), i ) )
+        {
+          firstElemIndexInPartition[i] = k;
+          break;
+        }
       }
-    }
 
-    if( firstElemIndexInPartition[i] > -1 )
-    {
-      for( int k = firstElemIndexInPartition[i]; k < m_numElemsTotal[i]; ++k )
+      if( firstElemIndexInPartition[i] > -1 )
       {
-        if( partition.isCoordInPartition( elemCenterCoords[i][k], i ) )
+        for( int k = firstElemIndexInPartition[i]; k < m_numElemsTotal[i]; ++k )
         {
-          lastElemIndexInPartition[i] = k;
+          if( partition.isCoordInPartition( elemCenterCoord( i, k ), i ) )
+          {
+            lastElemIndexInPartition[i] = k;
+          }
         }
       }
     }
@@ -732,7 +890,7 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
     numNodesInDir[i] = lastElemIndexInPartition[i] - firstElemIndexInPartition[i] + 2;
   }
   reduceNumNodesForPeriodicBoundary( partition, numNodesInDir );
-  numNodes = numNodesInDir[0] * numNodesInDir[1] * numNodesInDir[2];
+  numNodes = localIndex( numNodesInDir[0] ) * numNodesInDir[1] * numNodesInDir[2];
 
   cellBlockManager.setNumNodes( numNodes );
 
@@ -741,63 +899,68 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
   arrayView1d< globalIndex > const nodeLocalToGlobal = cellBlockManager.getNodeLocalToGlobal();
 
   {
-    localIndex localNodeIndex = 0;
-    for( int i = 0; i < numNodesInDir[0]; ++i )
+    // The node sets membership is evaluated in the threaded loop as a bit mask,
+    // the sorted sets are then filled in a single ordered pass.
+    SortedArray< localIndex > * const boundaryNodeSets[6] = { &xnegNodes, &xposNodes, &ynegNodes, &yposNodes, &znegNodes, &zposNodes };
+    array1d< integer > nodeSetMask( numNodes );
+
+    forAll< parallelHostPolicy >( numNodes, [&, nodeSetMask = nodeSetMask.toView()]( localIndex const localNodeIndex )
     {
-      for( int j = 0; j < numNodesInDir[1]; ++j )
-      {
-        for( int k = 0; k < numNodesInDir[2]; ++k )
-        {
-          int globalIJK[3] = { i, j, k };
+      int globalIJK[3] = { LvArray::integerConversion< int >( localNodeIndex / ( localIndex( numNodesInDir[1] ) * numNodesInDir[2] ) ),
+                           LvArray::integerConversion< int >( ( localNodeIndex / numNodesInDir[2] ) % numNodesInDir[1] ),
+                           LvArray::integerConversion< int >( localNodeIndex % numNodesInDir[2] ) };
 
-          for( int a = 0; a < m_dim; ++a )
-          {
-            globalIJK[a] += firstElemIndexInPartition[a];
-          }
+      for( int a = 0; a < m_dim; ++a )
+      {
+        globalIJK[a] += firstElemIndexInPartition[a];
+      }
 
-          getNodePosition( globalIJK, m_trianglePattern, X[localNodeIndex] );
+      getNodePosition( globalIJK, m_trianglePattern, X[localNodeIndex] );
 
-          // Alter global node map for radial mesh
-          setNodeGlobalIndicesOnPeriodicBoundary( partition, globalIJK );
+      // Alter global node map for radial mesh
+      setNodeGlobalIndicesOnPeriodicBoundary( partition, globalIJK );
 
-          nodeLocalToGlobal[localNodeIndex] = nodeGlobalIndex( globalIJK );
+      nodeLocalToGlobal[localNodeIndex] = nodeGlobalIndex( globalIJK );
 
-          // Cartesian-specific nodesets
-          if( isCartesian() )
-          {
-            if( isEqual( X( localNodeIndex, 0 ), m_min[0], m_coordinatePrecision ) )
-            {
-              xnegNodes.insert( localNodeIndex );
-            }
-            if( isEqual( X( localNodeIndex, 0 ), m_max[0], m_coordinatePrecision ) )
-            {
-              xposNodes.insert( localNodeIndex );
-            }
-            if( isEqual( X( localNodeIndex, 1 ), m_min[1], m_coordinatePrecision ) )
-            {
-              ynegNodes.insert( localNodeIndex );
-            }
-            if( isEqual( X( localNodeIndex, 1 ), m_max[1], m_coordinatePrecision ) )
-            {
-              yposNodes.insert( localNodeIndex );
-            }
-          }
+      integer mask = 0;
+      // Cartesian-specific nodesets
+      if( isCartesian() )
+      {
+        for( int i = 0; i < 2; ++i )
+        {
+          mask |= isEqual( X( localNodeIndex, i ), m_min[i], m_coordinatePrecision ) ? 1 << ( 2 * i ) : 0;
+          mask |= isEqual( X( localNodeIndex, i ), m_max[i], m_coordinatePrecision ) ? 1 << ( 2 * i + 1 ) : 0;
+        }
+      }
 
-          // General nodesets
-          if( isEqual( X( localNodeIndex, 2 ), m_min[2], m_coordinatePrecision ) )
-          {
-            znegNodes.insert( localNodeIndex );
-          }
-          if( isEqual( X( localNodeIndex, 2 ), m_max[2], m_coordinatePrecision ) )
-          {
-            zposNodes.insert( localNodeIndex );
-          }
-          allNodes.insert( localNodeIndex );
+      // General nodesets
+      mask |= isEqual( X( localNodeIndex, 2 ), m_min[2], m_coordinatePrecision ) ? 1 << 4 : 0;
+      mask |= isEqual( X( localNodeIndex, 2 ), m_max[2], m_coordinatePrecision ) ? 1 << 5 : 0;
+      nodeSetMask[localNodeIndex] = mask;
+    } );
 
-          ++localNodeIndex;
+    std::vector< localIndex > nodeSetIndices[6];
+    for( localIndex localNodeIndex = 0; localNodeIndex < numNodes; ++localNodeIndex )
+    {
+      for( int iSet = 0; iSet < 6; ++iSet )
+      {
+        if( nodeSetMask[localNodeIndex] & ( 1 << iSet ) )
+        {
+          nodeSetIndices[iSet].emplace_back( localNodeIndex );
         }
       }
     }
+    for( int iSet = 0; iSet < 6; ++iSet )
+    {
+      boundaryNodeSets[iSet]->insert( nodeSetIndices[iSet].begin(), nodeSetIndices[iSet].end() );
+    }
+
+    array1d< localIndex > allNodeIndices( numNodes );
+    forAll< parallelHostPolicy >( numNodes, [allNodeIndices = allNodeIndices.toView()]( localIndex const localNodeIndex )
+    {
+      allNodeIndices[localNodeIndex] = localNodeIndex;
+    } );
+    allNodes.insert( allNodeIndices.begin(), allNodeIndices.end() );
   }
 
   {
@@ -828,7 +991,7 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
       {
         numNodesInDir[i] = lastElemIndexInPartition[i] - firstElemIndexInPartition[i] + 2;
       }
-      numNodes = numNodesInDir[0] * numNodesInDir[1] * numNodesInDir[2];
+      numNodes = localIndex( numNodesInDir[0] ) * numNodesInDir[1] * numNodesInDir[2];
     }
 
     for( int iblock = 0; iblock < m_nElems[0].size(); ++iblock )
@@ -841,98 +1004,103 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
 
           CellBlock & cellBlock = cellBlockManager.getCellBlock( m_regionNames[regionOffset] );
           int const numNodesPerElem = LvArray::integerConversion< int >( cellBlock.numNodesPerElement());
-          integer nodeIDInBox[ 8 ];
+          int const numElePerBox = m_numElePerBox[iR];
 
           arrayView2d< localIndex, cells::NODE_MAP_USD > elemsToNodes = cellBlock.getElemToNode();
           arrayView1d< globalIndex > const & elemLocalToGlobal = cellBlock.localToGlobalMap();
 
-          int numElemsInDirForBlock[3] =
+          int const numElemsInDirForBlock[3] =
           { lastElemIndexForBlockInPartition[0][iblock] - firstElemIndexForBlockInPartition[0][iblock] + 1,
             lastElemIndexForBlockInPartition[1][jblock] - firstElemIndexForBlockInPartition[1][jblock] + 1,
             lastElemIndexForBlockInPartition[2][kblock] - firstElemIndexForBlockInPartition[2][kblock] + 1 };
+          int const firstElemIndexForBlock[3] =
+          { firstElemIndexForBlockInPartition[0][iblock],
+            firstElemIndexForBlockInPartition[1][jblock],
+            firstElemIndexForBlockInPartition[2][kblock] };
+
+          // The boxes of a block are numbered in (i,j,k) order, each one holding numElePerBox consecutive elements
+          localIndex & localElemIndexOffset = localElemIndexInRegion[ m_regionNames[ regionOffset ] ];
+          localIndex const firstLocalElemIndex = localElemIndexOffset;
+          localIndex const numBoxes = localIndex( numElemsInDirForBlock[0] ) * numElemsInDirForBlock[1] * numElemsInDirForBlock[2];
 
-          for( int i = 0; i < numElemsInDirForBlock[0]; ++i )
+          forAll< parallelHostPolicy >( numBoxes, [&]( localIndex const boxIndex )
           {
-            for( int j = 0; j < numElemsInDirForBlock[1]; ++j )
+            int globalIJK[3] =
+            { LvArray::integerConversion< int >( boxIndex / ( localIndex( numElemsInDirForBlock[1] ) * numElemsInDirForBlock[2] ) ) + firstElemIndexForBlock[0],
+              LvArray::integerConversion< int >( ( boxIndex / numElemsInDirForBlock[2] ) % numElemsInDirForBlock[1] ) + firstElemIndexForBlock[1],
+              LvArray::integerConversion< int >( boxIndex % numElemsInDirForBlock[2] ) + firstElemIndexForBlock[2] };
+
+            const localIndex firstNodeIndex = localIndex( numNodesInDir[1] ) * numNodesInDir[2] * ( globalIJK[0] - firstElemIndexInPartition[0] )
+                                              + numNodesInDir[2] * ( globalIJK[1] - firstElemIndexInPartition[1] )
+                                              + ( globalIJK[2] - firstElemIndexInPartition[2] );
+            localIndex nodeOfBox[8];
+
+            if( elementType == ElementType::Quadrilateral || elementType == ElementType::Triangle )
             {
-              for( int k = 0; k < numElemsInDirForBlock[2]; ++k )
+              nodeOfBox[0] = firstNodeIndex;
+              nodeOfBox[1] = numNodesInDir[1] * numNodesInDir[2] + firstNodeIndex;
+              nodeOfBox[2] = numNodesInDir[1] * numNodesInDir[2] + numNodesInDir[2] + firstNodeIndex;
+              nodeOfBox[3] = numNodesInDir[2] + firstNodeIndex;
+            }
+            else
+            {
+              nodeOfBox[0] = firstNodeIndex;
+              nodeOfBox[1] = numNodesInDir[1] * numNodesInDir[2] + firstNodeIndex;
+              nodeOfBox[2] = numNodesInDir[1] * numNodesInDir[2] + numNodesInDir[2] + firstNodeIndex;
+              nodeOfBox[3] = numNodesInDir[2] + firstNodeIndex;
+
+              nodeOfBox[4] = firstNodeIndex + 1;
+              nodeOfBox[5] = numNodesInDir[1] * numNodesInDir[2] + firstNodeIndex + 1;
+              nodeOfBox[6] = numNodesInDir[1] * numNodesInDir[2] + numNodesInDir[2] + firstNodeIndex + 1;
+              nodeOfBox[7] = numNodesInDir[2] + firstNodeIndex + 1;
+
+              //               7___________________ 6
+              //               /                   /|
+              //              /                   / |
+              //             /                   /  |
+              //           4/__________________5/   |
+              //            |                   |   |
+              //            |                   |   |
+              //            |                   |   |
+              //            |                   |   |
+              //            |                   |   |
+              //            |   3               |   /2        z
+              //            |                   |  /          |   y
+              //            |                   | /           |  /
+              //            |___________________|/            | /
+              //            0                   1             |/____ x
+
+            }
+
+
+            // Fix local connectivity for single theta (y) partition (radial meshes only)
+
+            setConnectivityForPeriodicBoundaries( globalIJK,
+                                                  numNodesInDir,
+                                                  firstElemIndexInPartition,
+                                                  nodeOfBox );
+
+            integer nodeIDInBox[ 8 ];
+            for( int iEle = 0; iEle < numElePerBox; ++iEle )
+            {
+              localIndex const localElemIndex = firstLocalElemIndex + boxIndex * numElePerBox + iEle;
+              elemLocalToGlobal[localElemIndex] = elemGlobalIndex( globalIJK ) * numElePerBox + iEle;
+
+              getElemToNodesRelationInBox( elementType,
+                                           m_trianglePattern,
+                                           globalIJK,
+                                           iEle,
+                                           nodeIDInBox,
+                                           numNodesPerElem );
+
+              for( localIndex iN = 0; iN < numNodesPerElem; ++iN )
               {
-                int globalIJK[3] =
-                { i + firstElemIndexForBlockInPartition[0][iblock],
-                  j + firstElemIndexForBlockInPartition[1][jblock],
-                  k + firstElemIndexForBlockInPartition[2][kblock] };
-
-                const localIndex firstNodeIndex = numNodesInDir[1] * numNodesInDir[2] * ( globalIJK[0] - firstElemIndexInPartition[0] )
-                                                  + numNodesInDir[2] * ( globalIJK[1] - firstElemIndexInPartition[1] )
-                                                  + ( globalIJK[2] - firstElemIndexInPartition[2] );
-                localIndex nodeOfBox[8];
-
-                if( elementType == ElementType::Quadrilateral || elementType == ElementType::Triangle )
-                {
-                  nodeOfBox[0] = firstNodeIndex;
-                  nodeOfBox[1] = numNodesInDir[1] * numNodesInDir[2] + firstNodeIndex;
-                  nodeOfBox[2] = numNodesInDir[1] * numNodesInDir[2] + numNodesInDir[2] + firstNodeIndex;
-                  nodeOfBox[3] = numNodesInDir[2] + firstNodeIndex;
-                }
-                else
-                {
-                  nodeOfBox[0] = firstNodeIndex;
-                  nodeOfBox[1] = numNodesInDir[1] * numNodesInDir[2] + firstNodeIndex;
-                  nodeOfBox[2] = numNodesInDir[1] * numNodesInDir[2] + numNodesInDir[2] + firstNodeIndex;
-                  nodeOfBox[3] = numNodesInDir[2] + firstNodeIndex;
-
-                  nodeOfBox[4] = firstNodeIndex + 1;
-                  nodeOfBox[5] = numNodesInDir[1] * numNodesInDir[2] + firstNodeIndex + 1;
-                  nodeOfBox[6] = numNodesInDir[1] * numNodesInDir[2] + numNodesInDir[2] + firstNodeIndex + 1;
-                  nodeOfBox[7] = numNodesInDir[2] + firstNodeIndex + 1;
-
-                  //               7___________________ 6
-                  //               /                   /|
-                  //              /                   / |
-                  //             /                   /  |
-                  //           4/__________________5/   |
-                  //            |                   |   |
-                  //            |                   |   |
-                  //            |                   |   |
-                  //            |                   |   |
-                  //            |                   |   |
-                  //            |   3               |   /2        z
-                  //            |                   |  /          |   y
-                  //            |                   | /           |  /
-                  //            |___________________|/            | /
-                  //            0                   1             |/____ x
-
-                }
-
-
-                // Fix local connectivity for single theta (y) partition (radial meshes only)
-
-                setConnectivityForPeriodicBoundaries( globalIJK,
-                                                      numNodesInDir,
-                                                      firstElemIndexInPartition,
-                                                      nodeOfBox );
-
-                for( int iEle = 0; iEle < m_numElePerBox[iR]; ++iEle )
-                {
-                  localIndex & localElemIndex = localElemIndexInRegion[ m_regionNames[ regionOffset ] ];
-                  elemLocalToGlobal[localElemIndex] = elemGlobalIndex( globalIJK ) * m_numElePerBox[iR] + iEle;
-
-                  getElemToNodesRelationInBox( elementType,
-                                               m_trianglePattern,
-                                               globalIJK,
-                                               iEle,
-                                               nodeIDInBox,
-                                               numNodesPerElem );
-
-                  for( localIndex iN = 0; iN < numNodesPerElem; ++iN )
-                  {
-                    elemsToNodes[localElemIndex][iN] = nodeOfBox[nodeIDInBox[iN]];
-                  }
-                  ++localElemIndex;
-                }
+                elemsToNodes[localElemIndex][iN] = nodeOfBox[nodeIDInBox[iN]];
               }
             }
-          }
+          } );
+
+          localElemIndexOffset += numBoxes * numElePerBox;
         }
       }
     }
@@ -960,10 +1128,12 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
 
   if( std::fabs( m_skewAngle ) > 0.0 )
   {
-    for( localIndex iN = 0; iN != numNodes; ++iN )
+    real64 const skewCenter = m_skewCenter[1];
+    real64 const skewTangent = std::tan( m_skewAngle );
+    forAll< parallelHostPolicy >( numNodes, [=]( localIndex const iN )
     {
-      X[iN][0] -= ( X[iN][1] - m_skewCenter[1] ) * std::tan( m_skewAngle );
-    }
+      X[iN][0] -= ( X[iN][1] - skewCenter ) * skewTangent;
+    } );
   }
 
   coordinateTransformation( X, nodeSets );
@@ -971,9 +1141,9 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
   cellBlockManager.buildMaps();
 
   GEOSX_LOG_RANK_0( GEOSX_FMT( "{}: total number of nodes = {}", getName(),
-                               ( m_numElemsTotal[0] + 1 ) * ( m_numElemsTotal[1] + 1 ) * ( m_numElemsTotal[2] + 1 ) ) );
+                               globalIndex( m_numElemsTotal[0] + 1 ) * ( m_numElemsTotal[1] + 1 ) * ( m_numElemsTotal[2] + 1 ) ) );
   GEOSX_LOG_RANK_0( GEOSX_FMT( "{}: total number of elems = {}", getName(),
-                               m_numElemsTotal[0] * m_numElemsTotal[1] * m_numElemsTotal[2] ) );
+                               globalIndex( m_numElemsTotal[0] ) * m_numElemsTotal[1] * m_numElemsTotal[2] ) );
 }
 
 void
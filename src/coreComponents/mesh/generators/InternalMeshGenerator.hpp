@@ -44,6 +44,15 @@ public:
 
   virtual ~InternalMeshGenerator() override = default;
 
+  /**
+   * @brief Choice of the domain decomposition of the structured index space
+   */
+  enum class PartitionMethod : integer
+  {
+    cartesian, ///< Tensor-product decomposition given by the x/y/z partition counts
+    bisection, ///< Recursive coordinate bisection, works with any number of ranks
+  };
+
   /**
    * @brief Return the name of the InternalMeshGenerator in object Catalog.
    * @return string that contains the key name to InternalMeshGenerator in the Catalog
@@ -146,6 +155,7 @@ protected:
     constexpr static char const * trianglePatternString() { return "trianglePattern"; }
     constexpr static char const * meshTypeString() { return "meshType"; }
     constexpr static char const * positionToleranceString() { return "positionTolerance"; }
+    constexpr static char const * partitionMethodString() { return "partitionMethod"; }
   };
   /// @endcond
 
@@ -197,6 +207,9 @@ private:
   /// Array of number of element per box
   array1d< integer > m_numElePerBox;
 
+  /// Domain decomposition of the structured index space
+  PartitionMethod m_partitionMethod = PartitionMethod::cartesian;
+
   /**
    * @brief Member variable for triangle pattern seletion.
    * @note In Pattern 0, half nodes have 4 edges and the other half have 8; for Pattern 1, every node has 6.
@@ -250,22 +263,33 @@ private:
 
 
 
+  /**
+   * @brief Compute the element index box of this rank by recursive coordinate bisection, collect its neighbor ranks
+   *        and color the partition.
+   * @param[in,out] domain the domain partition, in which the neighbor ranks and the partition color are registered
+   * @param[out] firstElemIndexInPartition the first element index of this rank in each direction
+   * @param[out] lastElemIndexInPartition the last element index of this rank in each direction
+   */
+  void computeBisectionPartition( DomainPartition & domain,
+                                  int (& firstElemIndexInPartition)[3],
+                                  int (& lastElemIndexInPartition)[3] ) const;
+
   /**
    * @brief Convert ndim node spatialized index to node global index.
    * @param[in] node ndim spatialized array index
    */
-  inline globalIndex nodeGlobalIndex( int const index[3] )
+  inline globalIndex nodeGlobalIndex( int const index[3] ) const
   {
-    return index[0]*(m_numElemsTotal[1]+1)*(m_numElemsTotal[2]+1) + index[1]*(m_numElemsTotal[2]+1) + index[2];
+    return globalIndex( index[0] )*(m_numElemsTotal[1]+1)*(m_numElemsTotal[2]+1) + globalIndex( index[1] )*(m_numElemsTotal[2]+1) + index[2];
   }
 
   /**
    * @brief Convert ndim element spatialized index to element global index.
    * @param[in] element ndim spatialized array index
    */
-  inline globalIndex elemGlobalIndex( int const index[3] )
+  inline globalIndex elemGlobalIndex( int const index[3] ) const
   {
-    return index[0]*m_numElemsTotal[1]*m_numElemsTotal[2] + index[1]*m_numElemsTotal[2] + index[2];
+    return globalIndex( index[0] )*m_numElemsTotal[1]*m_numElemsTotal[2] + globalIndex( index[1] )*m_numElemsTotal[2] + index[2];
   }
 
   /**
@@ -369,6 +393,11 @@ public:
 
 };
 
+/// Strings for InternalMeshGenerator::PartitionMethod enumeration
+ENUM_STRINGS( InternalMeshGenerator::PartitionMethod,
+              "cartesian",
+              "bisection" );
+
 } /* namespace geosx */
 
 #endif /* GEOSX_MESH_GENERATORS_INTERNALMESHGENERATOR_HPP */
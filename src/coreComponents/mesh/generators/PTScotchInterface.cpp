@@ -38,6 +38,8 @@ namespace ptscotch
 
 array1d< int64_t >
 partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+           arrayView1d< int64_t const > const & vertWeights,
+           arrayView1d< int64_t const > const & edgeWeights,
            int64_t const numParts,
            MPI_Comm comm )
 {
@@ -49,6 +51,11 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
     return part;
   }
 
+  GEOSX_ERROR_IF( !vertWeights.empty() && vertWeights.size() != numVerts,
+                  "Number of vertex weights does not match the number of graph vertices" );
+  GEOSX_ERROR_IF( !edgeWeights.empty() && edgeWeights.size() != graph.getOffsets()[numVerts],
+                  "Number of edge weights does not match the number of graph edges" );
+
   SCOTCH_Dgraph * const gr = SCOTCH_dgraphAlloc();
   GEOSX_SCOTCH_CHECK( SCOTCH_dgraphInit( gr, comm ) );
 
@@ -57,6 +64,8 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
   // Technical UB if Scotch writes into these arrays; in practice we discard them right after
   SCOTCH_Num * const offsets = const_cast< SCOTCH_Num * >( graph.getOffsets() );
   SCOTCH_Num * const edges = const_cast< SCOTCH_Num * >( graph.getValues() );
+  SCOTCH_Num * const vertLoads = vertWeights.empty() ? nullptr : const_cast< SCOTCH_Num * >( vertWeights.data() );
+  SCOTCH_Num * const edgeLoads = edgeWeights.empty() ? nullptr : const_cast< SCOTCH_Num * >( edgeWeights.data() );
 
   GEOSX_SCOTCH_CHECK( SCOTCH_dgraphBuild( gr,          // graphptr
                                           0,           // baseval
@@ -64,13 +73,13 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
                                           numVerts,    // vertlocmax
                                           offsets,     // vertloctab
                                           offsets + 1, // vendloctab
-                                          nullptr,     // veloloctab
+                                          vertLoads,   // veloloctab
                                           nullptr,     // vlblloctab
                                           numEdges,    // edgelocnbr
                                           numEdges,    // edgelocsiz
                                           edges,       // edgeloctab
                                           nullptr,     // edgegsttab
-                                          nullptr      // edloloctab,
+                                          edgeLoads    // edloloctab,
                                           ) );
 
   // TODO: maybe remove?
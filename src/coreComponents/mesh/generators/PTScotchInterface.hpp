@@ -30,12 +30,16 @@ namespace ptscotch
 /**
  * @brief Partition a mesh according to its dual graph.
  * @param graph the input graph (edges of locally owned nodes)
+ * @param vertWeights weights of locally owned vertices (empty for unit weights)
+ * @param edgeWeights weights of the edges, same layout as the values of @p graph (empty for unit weights)
  * @param numParts target number of partitions
  * @param comm the MPI communicator of processes to partition over
  * @return an array of target partitions for each element in local mesh
  */
 array1d< int64_t >
 partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+           arrayView1d< int64_t const > const & vertWeights,
+           arrayView1d< int64_t const > const & edgeWeights,
            int64_t const numParts,
            MPI_Comm comm );
 
@@ -74,6 +74,8 @@ meshToDual( ArrayOfArraysView< int64_t const, int64_t > const & elemToNodes,
 
 array1d< int64_t >
 partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+           arrayView1d< int64_t const > const & vertWeights,
+           arrayView1d< int64_t const > const & edgeWeights,
            arrayView1d< int64_t const > const & vertDist,
            int64_t const numParts,
            MPI_Comm comm,
@@ -89,8 +91,17 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
   array1d< real_t > tpwgts( numParts );
   tpwgts.setValues< serialPolicy >( 1.0f / static_cast< real_t >( numParts ) );
 
+  GEOSX_ERROR_IF( !vertWeights.empty() && vertWeights.size() != graph.size(),
+                  "Number of vertex weights does not match the number of graph vertices" );
+  GEOSX_ERROR_IF( !edgeWeights.empty() && edgeWeights.size() != graph.getOffsets()[graph.size()],
+                  "Number of edge weights does not match the number of graph edges" );
+
+  // Weights are passed as null pointers when not provided; wgtflag tells ParMETIS which ones to read
+  idx_t * const vwgt = vertWeights.empty() ? nullptr : const_cast< idx_t * >( vertWeights.data() );
+  idx_t * const adjwgt = edgeWeights.empty() ? nullptr : const_cast< idx_t * >( edgeWeights.data() );
+
   // Set other ParMETIS parameters
-  idx_t wgtflag = 0;
+  idx_t wgtflag = ( adjwgt != nullptr ? 1 : 0 ) + ( vwgt != nullptr ? 2 : 0 );
   idx_t numflag = 0;
   idx_t ncon = 1;
   idx_t npart = numParts;
@@ -102,7 +113,7 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
   GEOSX_PARMETIS_CHECK( ParMETIS_V3_PartKway( const_cast< idx_t * >( vertDist.data() ),
                                               const_cast< idx_t * >( graph.getOffsets() ),
                                               const_cast< idx_t * >( graph.getValues() ),
-                                              nullptr, nullptr, &wgtflag,
+                                              vwgt, adjwgt, &wgtflag,
                                               &numflag, &ncon, &npart, tpwgts.data(),
                                               &ubvec, options, &edgecut, part.data(), &comm ) );
 
@@ -111,7 +122,7 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
     GEOSX_PARMETIS_CHECK( ParMETIS_V3_RefineKway( const_cast< idx_t * >( vertDist.data() ),
                                                   const_cast< idx_t * >( graph.getOffsets() ),
                                                   const_cast< idx_t * >( graph.getValues() ),
-                                                  nullptr, nullptr, &wgtflag,
+                                                  vwgt, adjwgt, &wgtflag,
                                                   &numflag, &ncon, &npart, tpwgts.data(),
                                                   &ubvec, options, &edgecut, part.data(), &comm ) );
   }
@@ -119,5 +130,49 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
   return part;
 }
 
+array1d< int64_t >
+repartition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+             arrayView1d< int64_t const > const & vertWeights,
+             arrayView1d< int64_t const > const & vertDist,
+             MPI_Comm comm,
+             real64 const redistributionCostRatio )
+{
+  int const numParts = MpiWrapper::commSize( comm );
+
+  // The current distribution is the starting point of the adaptive repartitioning
+  array1d< int64_t > part( graph.size() );
+  part.setValues< serialPolicy >( MpiWrapper::commRank( comm ) );
+  if( numParts == 1 )
+  {
+    return part;
+  }
+
+  GEOSX_ERROR_IF_NE_MSG( vertWeights.size(), graph.size(),
+                         "Number of vertex weights does not match the number of graph vertices" );
+
+  array1d< real_t > tpwgts( numParts );
+  tpwgts.setValues< serialPolicy >( 1.0f / static_cast< real_t >( numParts ) );
+
+  idx_t wgtflag = 2;
+  idx_t numflag = 0;
+  idx_t ncon = 1;
+  idx_t npart = numParts;
+  idx_t options[4] = { 1, 0, 2022, PARMETIS_PSR_COUPLED };
+  idx_t edgecut = 0;
+  real_t ubvec = 1.05;
+  real_t itr = static_cast< real_t >( redistributionCostRatio );
+
+  // Technical UB if ParMETIS writes into these arrays; in practice we discard them right after
+  GEOSX_PARMETIS_CHECK( ParMETIS_V3_AdaptiveRepart( const_cast< idx_t * >( vertDist.data() ),
+                                                    const_cast< idx_t * >( graph.getOffsets() ),
+                                                    const_cast< idx_t * >( graph.getValues() ),
+                                                    const_cast< idx_t * >( vertWeights.data() ),
+                                                    nullptr, nullptr, &wgtflag,
+                                                    &numflag, &ncon, &npart, tpwgts.data(),
+                                                    &ubvec, &itr, options, &edgecut, part.data(), &comm ) );
+
+  return part;
+}
+
 } // namespace parmetis
 } // namespace geosx
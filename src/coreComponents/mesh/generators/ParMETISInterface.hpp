@@ -47,6 +47,8 @@ meshToDual( ArrayOfArraysView< int64_t const, int64_t > const & elemToNodes,
 /**
  * @brief Partition a mesh according to its dual graph.
  * @param graph the input graph (edges of locally owned nodes)
+ * @param vertWeights weights of locally owned vertices (empty for unit weights)
+ * @param edgeWeights weights of the edges, same layout as the values of @p graph (empty for unit weights)
  * @param vertDist the parallel distribution of vertices: vertex index offset on each rank
  * @param numParts target number of partitions
  * @param comm the MPI communicator of processes to partition over
@@ -55,11 +57,31 @@ meshToDual( ArrayOfArraysView< int64_t const, int64_t > const & elemToNodes,
  */
 array1d< int64_t >
 partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+           arrayView1d< int64_t const > const & vertWeights,
+           arrayView1d< int64_t const > const & edgeWeights,
            arrayView1d< int64_t const > const & vertDist,
            int64_t const numParts,
            MPI_Comm comm,
            int const numRefinements );
 
+/**
+ * @brief Compute a new partition of an already distributed graph that balances the vertex weights
+ *        while limiting the number of vertices moved away from their current rank.
+ * @param graph the input graph (edges of locally owned nodes)
+ * @param vertWeights weights of locally owned vertices (e.g. measured cost)
+ * @param vertDist the parallel distribution of vertices: vertex index offset on each rank
+ * @param comm the MPI communicator of processes to partition over (one partition per rank)
+ * @param redistributionCostRatio ratio of the communication time to the data redistribution time,
+ *        large values favor a low edge cut over a low migration volume
+ * @return an array of target partitions for each element in local mesh
+ */
+array1d< int64_t >
+repartition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+             arrayView1d< int64_t const > const & vertWeights,
+             arrayView1d< int64_t const > const & vertDist,
+             MPI_Comm comm,
+             real64 const redistributionCostRatio );
+
 } // namespace parmetis
 } // namespace geosx
 
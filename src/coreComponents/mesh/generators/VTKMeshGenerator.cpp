@@ -34,17 +34,23 @@
 
 #include <vtkArrayDispatch.h>
 #include <vtkBoundingBox.h>
+#include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkExtractCells.h>
 #include <vtkGenerateGlobalIds.h>
+#include <vtkIdTypeArray.h>
 #include <vtkPartitionedDataSet.h>
 #include <vtkPointData.h>
+#include <vtkPoints.h>
 #include <vtkRedistributeDataSetFilter.h>
 #include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkUnstructuredGridReader.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
+#include <vtkXMLDataElement.h>
+#include <vtkXMLDataParser.h>
 // for vts import
 #include <vtkNew.h>
 #include <vtkStructuredGrid.h>
@@ -63,7 +69,13 @@
 #include <vtkDummyController.h>
 #endif
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <map>
 #include <numeric>
+#include <set>
 #include <unordered_set>
 
 namespace geosx
@@ -95,6 +107,34 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Method (library) used to partition the mesh" );
 
+  registerWrapper( viewKeyStruct::partitionCostRegionsString(), &m_partitionCostRegions ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Values of the region attribute of the cells whose partitioning cost is scaled by ``" +
+                    string( viewKeyStruct::partitionCostFactorsString() ) + "`` (e.g. fractured or compositional regions)" );
+
+  registerWrapper( viewKeyStruct::partitionCostFactorsString(), &m_partitionCostFactors ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Relative partitioning cost of the cells of each region listed in ``" +
+                    string( viewKeyStruct::partitionCostRegionsString() ) + "`` (other cells have a unit cost)" );
+
+  registerWrapper( viewKeyStruct::partitionCellWeightsString(), &m_partitionCellWeights ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of a VTK cell array multiplying the partitioning cost of each cell "
+                    "(e.g. estimated constitutive cost, or a larger value for cells with well perforations)" );
+
+  registerWrapper( viewKeyStruct::partitionConnectionWeightsString(), &m_partitionConnectionWeights ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of a VTK cell array (e.g. permeability) used to weight the connections of the partitioning graph: "
+                    "the weight of a connection is the harmonic average of the values in the two cells, as a proxy of the transmissibility, "
+                    "so that strongly coupled cells are kept on the same rank" );
+
+  registerWrapper( viewKeyStruct::localOrderingString(), &m_localOrdering ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_localOrdering ).
+    setDescription( "Ordering of the local cells and nodes after partitioning. Valid options: ``" + EnumStrings< LocalOrdering >::concat( "``, ``" ) + "``."
+                    " With ``morton``, cells are sorted along a Morton curve of their centers and nodes are numbered in order of first use,"
+                    " to improve the memory locality of the element and face loops" );
+
   registerWrapper( viewKeyStruct::useGlobalIdsString(), &m_useGlobalIds ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
@@ -102,6 +142,12 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
                     " If set to 0 (default value), the GlobalId arrays in the input mesh are used if available, and generated otherwise."
                     " If set to a negative value, the GlobalId arrays in the input mesh are not used, and generated global Ids are automatically generated."
                     " If set to a positive value, the GlobalId arrays in the input mesh are used and required, and the simulation aborts if they are not available" );
+
+  registerWrapper( viewKeyStruct::parallelReadString(), &m_parallelRead ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to read a single-piece .vtu file in parallel, each rank reading a contiguous block of cells, instead of loading it on the root rank."
+                    " Requires the arrays to be stored in raw appended format, otherwise the mesh is read on the root rank." );
 }
 
 namespace vtk
@@ -200,6 +246,265 @@ loadMesh( Path const & filePath )
   return loadedMesh;
 }
 
+/**
+ * @brief Read some tuples of an array stored in the appended data section of a .vtu file
+ * @param[in] parser the XML parser of the file, after the header has been read
+ * @param[in] arrayElement the DataArray element describing the array
+ * @param[in] runs the ranges of tuples to read, as (first tuple, number of tuples) pairs
+ * @return the tuples of all the ranges, stored contiguously
+ */
+vtkSmartPointer< vtkDataArray >
+readAppendedArray( vtkXMLDataParser & parser,
+                   vtkXMLDataElement & arrayElement,
+                   std::vector< std::pair< vtkIdType, vtkIdType > > const & runs )
+{
+  int wordType = VTK_VOID;
+  arrayElement.GetWordTypeAttribute( "type", wordType );
+  int numComponents = 1;
+  arrayElement.GetScalarAttribute( "NumberOfComponents", numComponents );
+  vtkTypeInt64 offset = 0;
+  arrayElement.GetScalarAttribute( "offset", offset );
+
+  vtkIdType numTuples = 0;
+  for( std::pair< vtkIdType, vtkIdType > const & run : runs )
+  {
+    numTuples += run.second;
+  }
+
+  vtkSmartPointer< vtkDataArray > array = vtkSmartPointer< vtkDataArray >::Take( vtkDataArray::CreateDataArray( wordType ) );
+  array->SetName( arrayElement.GetAttribute( "Name" ) );
+  array->SetNumberOfComponents( numComponents );
+  array->SetNumberOfTuples( numTuples );
+
+  // The parser only decompresses the blocks overlapping the requested words
+  char * const data = static_cast< char * >( array->GetVoidPointer( 0 ) );
+  size_t const tupleSize = LvArray::integerConversion< size_t >( numComponents * array->GetDataTypeSize() );
+  vtkIdType tuple = 0;
+  for( std::pair< vtkIdType, vtkIdType > const & run : runs )
+  {
+    size_t const numWords = LvArray::integerConversion< size_t >( run.second * numComponents );
+    size_t const numRead = parser.ReadAppendedData( offset,
+                                                    data + tuple * tupleSize,
+                                                    LvArray::integerConversion< vtkTypeUInt64 >( run.first * numComponents ),
+                                                    numWords,
+                                                    wordType );
+    GEOSX_ERROR_IF_NE_MSG( numRead, numWords, "Failed to read array " << arrayElement.GetAttribute( "Name" ) << " from the appended data" );
+    tuple += run.second;
+  }
+  return array;
+}
+
+/**
+ * @brief Load a single-piece .vtu file in parallel, each rank reading a contiguous block of cells
+ * @param[in] filePath the Path of the file to load
+ * @return the local part of the mesh, or nullptr if the file layout does not allow a parallel read
+ *
+ * Only the XML header is parsed by every rank. The arrays must be stored in the raw appended data section,
+ * so that each rank can read the byte ranges of its cells and of the points they use, without ever holding
+ * the full mesh. The cell and point indices in the file are used as global ids if the file does not provide any.
+ */
+vtkSmartPointer< vtkDataSet >
+loadMeshInParallel( Path const & filePath )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( filePath.extension() != "vtu" )
+  {
+    return nullptr;
+  }
+
+  // UpdateInformation only parses the XML header and stops at the appended data
+  vtkNew< vtkXMLUnstructuredGridReader > reader;
+  reader->SetFileName( filePath.c_str() );
+  reader->UpdateInformation();
+
+  vtkXMLDataParser * const parser = reader->GetXMLParser();
+  vtkXMLDataElement * const root = parser != nullptr ? parser->GetRootElement() : nullptr;
+  vtkXMLDataElement * const grid = root != nullptr ? root->FindNestedElementWithName( "UnstructuredGrid" ) : nullptr;
+  vtkXMLDataElement * const appendedData = root != nullptr ? root->FindNestedElementWithName( "AppendedData" ) : nullptr;
+
+  auto const hasAttribute = []( vtkXMLDataElement const * const element, char const * const name, string const & value )
+  {
+    return element != nullptr && element->GetAttribute( name ) != nullptr && value == element->GetAttribute( name );
+  };
+
+  auto const allArraysAppended = [&]( vtkXMLDataElement * const parent )
+  {
+    for( int i = 0; parent != nullptr && i < parent->GetNumberOfNestedElements(); ++i )
+    {
+      if( !hasAttribute( parent->GetNestedElement( i ), "format", "appended" ) )
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  int numPieces = 0;
+  for( int i = 0; grid != nullptr && i < grid->GetNumberOfNestedElements(); ++i )
+  {
+    numPieces += string( grid->GetNestedElement( i )->GetName() ) == "Piece" ? 1 : 0;
+  }
+  vtkXMLDataElement * const piece = numPieces == 1 ? grid->FindNestedElementWithName( "Piece" ) : nullptr;
+  vtkXMLDataElement * const pointsElem = piece != nullptr ? piece->FindNestedElementWithName( "Points" ) : nullptr;
+  vtkXMLDataElement * const cellsElem = piece != nullptr ? piece->FindNestedElementWithName( "Cells" ) : nullptr;
+  vtkXMLDataElement * const pointData = piece != nullptr ? piece->FindNestedElementWithName( "PointData" ) : nullptr;
+  vtkXMLDataElement * const cellData = piece != nullptr ? piece->FindNestedElementWithName( "CellData" ) : nullptr;
+
+  vtkXMLDataElement * const connectivityElem = cellsElem != nullptr
+                                             ? cellsElem->FindNestedElementWithNameAndAttribute( "DataArray", "Name", "connectivity" ) : nullptr;
+  vtkXMLDataElement * const offsetsElem = cellsElem != nullptr
+                                        ? cellsElem->FindNestedElementWithNameAndAttribute( "DataArray", "Name", "offsets" ) : nullptr;
+  vtkXMLDataElement * const typesElem = cellsElem != nullptr
+                                      ? cellsElem->FindNestedElementWithNameAndAttribute( "DataArray", "Name", "types" ) : nullptr;
+  vtkXMLDataElement * const facesElem = cellsElem != nullptr
+                                      ? cellsElem->FindNestedElementWithNameAndAttribute( "DataArray", "Name", "faces" ) : nullptr;
+
+  bool const supported = hasAttribute( appendedData, "encoding", "raw" )
+                         && pointsElem != nullptr && pointsElem->GetNumberOfNestedElements() == 1
+                         && connectivityElem != nullptr && offsetsElem != nullptr && typesElem != nullptr && facesElem == nullptr
+                         && allArraysAppended( pointsElem ) && allArraysAppended( cellsElem )
+                         && allArraysAppended( pointData ) && allArraysAppended( cellData );
+  if( !supported )
+  {
+    GEOSX_LOG_RANK_0( "Parallel read requires a single-piece .vtu file with raw appended data and no polyhedra, "
+                      "falling back to reading the mesh on rank 0" );
+    return nullptr;
+  }
+
+  // The reader closes the file once the header is parsed, give the parser its own stream for the data
+  std::ifstream stream( filePath, std::ios::in | std::ios::binary );
+  GEOSX_ERROR_IF( !stream, "Failed to open " << filePath );
+  parser->SetStream( &stream );
+
+  vtkIdType numCells = 0;
+  piece->GetScalarAttribute( "NumberOfCells", numCells );
+
+  // Contiguous block of cells read by this rank
+  vtkIdType const rank = MpiWrapper::commRank();
+  vtkIdType const numRanks = MpiWrapper::commSize();
+  vtkIdType const firstCell = numCells * rank / numRanks;
+  vtkIdType const numLocalCells = numCells * ( rank + 1 ) / numRanks - firstCell;
+
+  // The offsets array stores the end of each cell in the connectivity array, read the previous one as well
+  vtkIdType const firstOffset = firstCell > 0 ? firstCell - 1 : 0;
+  vtkSmartPointer< vtkDataArray > const offsets = readAppendedArray( *parser, *offsetsElem, { { firstOffset, firstCell + numLocalCells - firstOffset } } );
+  vtkIdType const shift = firstCell > 0 ? 1 : 0;
+  vtkIdType const connectivityBegin = firstCell > 0 ? static_cast< vtkIdType >( offsets->GetTuple1( 0 ) ) : 0;
+  vtkIdType const connectivityEnd = numLocalCells > 0 ? static_cast< vtkIdType >( offsets->GetTuple1( numLocalCells - 1 + shift ) ) : connectivityBegin;
+
+  vtkSmartPointer< vtkDataArray > const connectivity =
+    readAppendedArray( *parser, *connectivityElem, { { connectivityBegin, connectivityEnd - connectivityBegin } } );
+  vtkSmartPointer< vtkDataArray > const types = readAppendedArray( *parser, *typesElem, { { firstCell, numLocalCells } } );
+
+  // Points used by the local cells, read by runs of consecutive indices
+  vtkIdType const connectivitySize = connectivityEnd - connectivityBegin;
+  std::vector< vtkIdType > globalConnectivity( connectivitySize );
+  for( vtkIdType i = 0; i < connectivitySize; ++i )
+  {
+    globalConnectivity[i] = static_cast< vtkIdType >( connectivity->GetTuple1( i ) );
+  }
+  std::vector< vtkIdType > pointIds( globalConnectivity );
+  std::sort( pointIds.begin(), pointIds.end() );
+  pointIds.erase( std::unique( pointIds.begin(), pointIds.end() ), pointIds.end() );
+
+  std::vector< std::pair< vtkIdType, vtkIdType > > pointRuns;
+  for( vtkIdType const pointId : pointIds )
+  {
+    if( !pointRuns.empty() && pointRuns.back().first + pointRuns.back().second == pointId )
+    {
+      ++pointRuns.back().second;
+    }
+    else
+    {
+      pointRuns.emplace_back( pointId, 1 );
+    }
+  }
+
+  vtkNew< vtkPoints > points;
+  points->SetData( readAppendedArray( *parser, *pointsElem->GetNestedElement( 0 ), pointRuns ) );
+
+  // Build the local cells, with point indices renumbered according to the local points
+  vtkNew< vtkIdTypeArray > localOffsets;
+  localOffsets->SetNumberOfTuples( numLocalCells + 1 );
+  localOffsets->SetValue( 0, 0 );
+  for( vtkIdType c = 0; c < numLocalCells; ++c )
+  {
+    localOffsets->SetValue( c + 1, static_cast< vtkIdType >( offsets->GetTuple1( c + shift ) ) - connectivityBegin );
+  }
+
+  vtkNew< vtkIdTypeArray > localConnectivity;
+  localConnectivity->SetNumberOfTuples( connectivitySize );
+  vtkIdType * const localConnectivityPtr = localConnectivity->GetPointer( 0 );
+  forAll< parallelHostPolicy >( connectivitySize, [&]( vtkIdType const i )
+  {
+    localConnectivityPtr[i] = std::lower_bound( pointIds.begin(), pointIds.end(), globalConnectivity[i] ) - pointIds.begin();
+  } );
+
+  vtkNew< vtkCellArray > cells;
+  cells->SetData( localOffsets, localConnectivity );
+
+  // The cell types are UInt8 in the files written by VTK, but the reader keeps the type declared in the file
+  vtkNew< vtkUnsignedCharArray > cellTypes;
+  cellTypes->SetNumberOfTuples( numLocalCells );
+  for( vtkIdType c = 0; c < numLocalCells; ++c )
+  {
+    cellTypes->SetValue( c, static_cast< unsigned char >( types->GetTuple1( c ) ) );
+  }
+
+  vtkSmartPointer< vtkUnstructuredGrid > mesh = vtkSmartPointer< vtkUnstructuredGrid >::New();
+  mesh->SetPoints( points );
+  mesh->SetCells( cellTypes, cells );
+
+  // Attach the point and cell data arrays, picking the global ids if the file provides them
+  auto const readData = [&]( vtkXMLDataElement * const dataElem,
+                             vtkDataSetAttributes & attributes,
+                             std::vector< std::pair< vtkIdType, vtkIdType > > const & runs )
+  {
+    for( int i = 0; dataElem != nullptr && i < dataElem->GetNumberOfNestedElements(); ++i )
+    {
+      vtkXMLDataElement * const arrayElem = dataElem->GetNestedElement( i );
+      vtkSmartPointer< vtkDataArray > const array = readAppendedArray( *parser, *arrayElem, runs );
+      if( hasAttribute( dataElem, "GlobalIds", arrayElem->GetAttribute( "Name" ) ) )
+      {
+        // the global ids are used as vtkIdTypeArray downstream, whatever their type in the file
+        vtkNew< vtkIdTypeArray > globalIds;
+        globalIds->DeepCopy( array );
+        globalIds->SetName( array->GetName() );
+        attributes.SetGlobalIds( globalIds );
+      }
+      else
+      {
+        attributes.AddArray( array );
+      }
+    }
+  };
+  readData( pointData, *mesh->GetPointData(), pointRuns );
+  readData( cellData, *mesh->GetCellData(), { { firstCell, numLocalCells } } );
+
+  // Fill in the missing global ids with the file indices, keeping the ones the file provides
+  if( mesh->GetPointData()->GetGlobalIds() == nullptr )
+  {
+    vtkNew< vtkIdTypeArray > globalPointIds;
+    globalPointIds->SetName( "GlobalPointIds" );
+    globalPointIds->SetNumberOfTuples( LvArray::integerConversion< vtkIdType >( pointIds.size() ) );
+    std::copy( pointIds.begin(), pointIds.end(), globalPointIds->GetPointer( 0 ) );
+    mesh->GetPointData()->SetGlobalIds( globalPointIds );
+  }
+  if( mesh->GetCellData()->GetGlobalIds() == nullptr )
+  {
+    vtkNew< vtkIdTypeArray > globalCellIds;
+    globalCellIds->SetName( "GlobalCellIds" );
+    globalCellIds->SetNumberOfTuples( numLocalCells );
+    std::iota( globalCellIds->GetPointer( 0 ), globalCellIds->GetPointer( 0 ) + numLocalCells, firstCell );
+    mesh->GetCellData()->SetGlobalIds( globalCellIds );
+  }
+
+  parser->SetStream( nullptr );
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "Read {} cells in parallel over {} ranks", numCells, numRanks ) );
+  return mesh;
+}
+
 /**
  * @brief Get the cell array object
  *
@@ -328,11 +633,340 @@ generateGlobalIDs( vtkDataSet & mesh )
   return vtkDataSet::SafeDownCast( generator->GetOutputDataObject( 0 ) );
 }
 
+/**
+ * @brief Cell and connection weights fed to the graph partitioner.
+ */
+struct PartitionWeighting
+{
+  /// Name of the cell attribute marking regions
+  string regionAttribute;
+  /// Region attribute values that are assigned a cost factor
+  arrayView1d< integer const > costRegions;
+  /// Cost factor of each region listed in @p costRegions
+  arrayView1d< real64 const > costFactors;
+  /// Name of a cell array scaling the cost of each cell, unused if empty
+  string cellWeightArray;
+  /// Name of a cell array from which the connection weights are derived, unused if empty
+  string connectionWeightArray;
+};
+
+/// Integer weight of a cell of unit cost (allows fractional cost factors)
+constexpr int64_t cellWeightScale = 10;
+
+/// Integer weight of the strongest connection of the mesh
+constexpr int64_t connectionWeightScale = 100;
+
+/**
+ * @brief Send rank-grouped values to their destination ranks.
+ * @tparam T type of the values
+ * @param[in] sendValues the values to send, grouped by destination rank
+ * @param[in] sendCounts the number of values sent to each rank
+ * @param[out] recvCounts the number of values received from each rank
+ * @param[in] comm the MPI communicator
+ * @return the received values, grouped by source rank
+ */
+template< typename T >
+std::vector< T >
+exchangeWithRanks( std::vector< T > const & sendValues,
+                   std::vector< int > const & sendCounts,
+                   std::vector< int > & recvCounts,
+                   MPI_Comm const comm )
+{
+  int const numProcs = MpiWrapper::commSize( comm );
+  recvCounts.resize( numProcs );
+  MpiWrapper::allToAll( sendCounts.data(), 1, recvCounts.data(), comm );
+
+  std::vector< int > sendOffsets( numProcs + 1 );
+  std::vector< int > recvOffsets( numProcs + 1 );
+  std::partial_sum( sendCounts.begin(), sendCounts.end(), sendOffsets.begin() + 1 );
+  std::partial_sum( recvCounts.begin(), recvCounts.end(), recvOffsets.begin() + 1 );
+
+  std::vector< T > recvValues( recvOffsets.back() );
+  MpiWrapper::allToAllv( sendValues.data(), sendCounts.data(), sendOffsets.data(),
+                         recvValues.data(), recvCounts.data(), recvOffsets.data(), comm );
+  return recvValues;
+}
+
+/**
+ * @brief Fetch, for each edge of a distributed graph, a value attached to the target vertex of the edge.
+ * @tparam T type of the values
+ * @param[in] graph the local part of the graph (global vertex indices)
+ * @param[in] vertDist the vertex index offset on each rank
+ * @param[in] localValues the values of the locally owned vertices
+ * @param[in] comm the MPI communicator
+ * @return the values of the edge targets, same layout as the values of @p graph
+ */
+template< typename T >
+array1d< T >
+gatherNeighborValues( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+                      arrayView1d< int64_t const > const & vertDist,
+                      arrayView1d< T const > const & localValues,
+                      MPI_Comm const comm )
+{
+  int const numProcs = MpiWrapper::commSize( comm );
+  int64_t const firstVertex = vertDist[MpiWrapper::commRank( comm )];
+  int64_t const numEdges = graph.getOffsets()[graph.size()];
+  int64_t const * const targets = graph.getValues();
+
+  // Group the requested vertices by owning rank
+  std::vector< int > owners( numEdges );
+  std::vector< int > sendCounts( numProcs );
+  for( int64_t e = 0; e < numEdges; ++e )
+  {
+    owners[e] = LvArray::integerConversion< int >( std::upper_bound( vertDist.begin(), vertDist.end(), targets[e] ) - vertDist.begin() - 1 );
+    ++sendCounts[owners[e]];
+  }
+  std::vector< int > position( numProcs + 1 );
+  std::partial_sum( sendCounts.begin(), sendCounts.end(), position.begin() + 1 );
+
+  std::vector< int64_t > requests( numEdges );
+  std::vector< int64_t > requestToEdge( numEdges );
+  for( int64_t e = 0; e < numEdges; ++e )
+  {
+    int const slot = position[owners[e]]++;
+    requests[slot] = targets[e];
+    requestToEdge[slot] = e;
+  }
+
+  // Answer the requests of other ranks and send the answers back
+  std::vector< int > recvCounts;
+  std::vector< int64_t > const received = exchangeWithRanks( requests, sendCounts, recvCounts, comm );
+  std::vector< T > replies( received.size() );
+  for( std::size_t i = 0; i < received.size(); ++i )
+  {
+    replies[i] = localValues[received[i] - firstVertex];
+  }
+  std::vector< int > answerCounts;
+  std::vector< T > const answers = exchangeWithRanks( replies, recvCounts, answerCounts, comm );
+
+  array1d< T > values( numEdges );
+  for( int64_t slot = 0; slot < numEdges; ++slot )
+  {
+    values[requestToEdge[slot]] = answers[slot];
+  }
+  return values;
+}
+
+/**
+ * @brief Compute the partitioning weights of the local cells from region cost factors and a cell array.
+ * @param[in] mesh the local mesh
+ * @param[in] weighting the weighting parameters
+ * @return the weight of each local cell, or an empty array if cells are not weighted
+ */
+array1d< int64_t >
+computeCellWeights( vtkDataSet & mesh,
+                    PartitionWeighting const & weighting )
+{
+  array1d< int64_t > weights;
+  if( weighting.costRegions.empty() && weighting.cellWeightArray.empty() )
+  {
+    return weights;
+  }
+
+  vtkCellData & cellData = *mesh.GetCellData();
+  vtkDataArray * const attributeArray = vtkDataArray::FastDownCast( cellData.GetAbstractArray( weighting.regionAttribute.c_str() ) );
+  vtkDataArray * costArray = nullptr;
+  if( !weighting.cellWeightArray.empty() )
+  {
+    costArray = vtkDataArray::FastDownCast( cellData.GetAbstractArray( weighting.cellWeightArray.c_str() ) );
+    GEOSX_THROW_IF( costArray == nullptr,
+                    GEOSX_FMT( "Partition cell weight array '{}' not found in mesh", weighting.cellWeightArray ),
+                    InputError );
+  }
+
+  std::map< integer, real64 > regionFactors;
+  for( localIndex i = 0; i < weighting.costRegions.size(); ++i )
+  {
+    regionFactors[weighting.costRegions[i]] = weighting.costFactors[i];
+  }
+
+  vtkIdType const numCells = mesh.GetNumberOfCells();
+  weights.resize( numCells );
+
+  // vtkDataArray::GetComponent() is not thread-safe, use a serial loop
+  for( vtkIdType c = 0; c < numCells; ++c )
+  {
+    real64 cost = 1.0;
+    if( attributeArray != nullptr )
+    {
+      auto const it = regionFactors.find( static_cast< integer >( attributeArray->GetComponent( c, 0 ) ) );
+      if( it != regionFactors.end() )
+      {
+        cost *= it->second;
+      }
+    }
+    if( costArray != nullptr )
+    {
+      cost *= costArray->GetComponent( c, 0 );
+    }
+    weights[c] = std::max( int64_t{ 1 }, static_cast< int64_t >( std::llround( cellWeightScale * cost ) ) );
+  }
+  return weights;
+}
+
+/**
+ * @brief Compute the partitioning weights of the dual graph edges.
+ * @param[in] mesh the local mesh
+ * @param[in] graph the local part of the dual graph
+ * @param[in] elemDist the element index offset on each rank
+ * @param[in] weighting the weighting parameters
+ * @param[in] comm the MPI communicator
+ * @return the weight of each edge of @p graph, or an empty array if edges are not weighted
+ *
+ * The weight of a connection is the harmonic average of the (absolute) values of the cell array
+ * in the two cells, e.g. a permeability, as a proxy for the transmissibility magnitude.
+ */
+array1d< int64_t >
+computeConnectionWeights( vtkDataSet & mesh,
+                          ArrayOfArraysView< int64_t const, int64_t > const & graph,
+                          arrayView1d< int64_t const > const & elemDist,
+                          PartitionWeighting const & weighting,
+                          MPI_Comm const comm )
+{
+  array1d< int64_t > weights;
+  if( weighting.connectionWeightArray.empty() )
+  {
+    return weights;
+  }
+
+  vtkDataArray * const valueArray =
+    vtkDataArray::FastDownCast( mesh.GetCellData()->GetAbstractArray( weighting.connectionWeightArray.c_str() ) );
+  GEOSX_THROW_IF( valueArray == nullptr,
+                  GEOSX_FMT( "Partition connection weight array '{}' not found in mesh", weighting.connectionWeightArray ),
+                  InputError );
+
+  localIndex const numCells = graph.size();
+  array1d< real64 > cellValues( numCells );
+  for( localIndex c = 0; c < numCells; ++c )
+  {
+    cellValues[c] = std::fabs( valueArray->GetComponent( c, 0 ) );
+  }
+  array1d< real64 > const neighborValues = gatherNeighborValues( graph, elemDist, cellValues.toViewConst(), comm );
+
+  array1d< real64 > means( neighborValues.size() );
+  real64 maxMean = 0.0;
+  for( localIndex c = 0; c < numCells; ++c )
+  {
+    for( int64_t e = graph.getOffsets()[c]; e < graph.getOffsets()[c+1]; ++e )
+    {
+      real64 const sum = cellValues[c] + neighborValues[e];
+      means[e] = sum > 0.0 ? 2.0 * cellValues[c] * neighborValues[e] / sum : 0.0;
+      maxMean = std::max( maxMean, means[e] );
+    }
+  }
+  maxMean = MpiWrapper::max( maxMean, comm );
+
+  weights.resize( means.size() );
+  for( localIndex e = 0; e < means.size(); ++e )
+  {
+    int64_t const w = maxMean > 0.0 ? static_cast< int64_t >( std::llround( connectionWeightScale * means[e] / maxMean ) ) : 1;
+    weights[e] = std::max( int64_t{ 1 }, w );
+  }
+  return weights;
+}
+
+/**
+ * @brief Print the quality metrics of a graph partition.
+ * @param[in] graph the local part of the dual graph
+ * @param[in] elemDist the element index offset on each rank
+ * @param[in] cellWeights the cell weights (empty for unit weights)
+ * @param[in] connectionWeights the edge weights (empty for unit weights)
+ * @param[in] parts the target partition of each local cell
+ * @param[in] comm the MPI communicator
+ *
+ * Reports the load imbalance (max/avg partition weight), the edge cut, the ghost ratio
+ * (cells adjacent to a partition but owned by another one, relative to owned cells)
+ * and the maximum number of neighbor partitions.
+ */
+void printPartitionQuality( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+                            arrayView1d< int64_t const > const & elemDist,
+                            arrayView1d< int64_t const > const & cellWeights,
+                            arrayView1d< int64_t const > const & connectionWeights,
+                            arrayView1d< int64_t const > const & parts,
+                            MPI_Comm const comm )
+{
+  int const numProcs = MpiWrapper::commSize( comm );
+  array1d< int64_t > const neighborParts = gatherNeighborValues( graph, elemDist, parts, comm );
+
+  // Per-partition weight, number of cells and number of ghost cells
+  array1d< int64_t > localCounts( 3 * numProcs );
+  int64_t localCut[2] = { 0, 0 };
+  std::set< std::pair< int64_t, int64_t > > adjacentParts;
+  std::set< int64_t > ghostOf;
+  for( localIndex c = 0; c < graph.size(); ++c )
+  {
+    localCounts[parts[c]] += cellWeights.empty() ? 1 : cellWeights[c];
+    localCounts[numProcs + parts[c]] += 1;
+    ghostOf.clear();
+    for( int64_t e = graph.getOffsets()[c]; e < graph.getOffsets()[c+1]; ++e )
+    {
+      if( neighborParts[e] != parts[c] )
+      {
+        localCut[0] += 1;
+        localCut[1] += connectionWeights.empty() ? 1 : connectionWeights[e];
+        ghostOf.insert( neighborParts[e] );
+        adjacentParts.emplace( parts[c], neighborParts[e] );
+      }
+    }
+    for( int64_t const p : ghostOf )
+    {
+      localCounts[2 * numProcs + p] += 1;
+    }
+  }
+
+  array1d< int64_t > counts( 3 * numProcs );
+  MpiWrapper::allReduce( localCounts.data(), counts.data(), 3 * numProcs, MPI_SUM, comm );
+  int64_t cut[2];
+  MpiWrapper::allReduce( localCut, cut, 2, MPI_SUM, comm );
+
+  // Send each adjacency to the rank of the partition, which deduplicates them
+  std::vector< int > sendCounts( numProcs );
+  std::vector< int64_t > sendParts;
+  for( std::pair< int64_t, int64_t > const & adj : adjacentParts )
+  {
+    ++sendCounts[adj.first];
+    sendParts.push_back( adj.second );
+  }
+  std::vector< int > recvCounts;
+  std::vector< int64_t > const recvParts = exchangeWithRanks( sendParts, sendCounts, recvCounts, comm );
+  int const numNeighbors = LvArray::integerConversion< int >( std::set< int64_t >( recvParts.begin(), recvParts.end() ).size() );
+  int const maxNeighbors = MpiWrapper::max( numNeighbors, comm );
+
+  if( MpiWrapper::commRank( comm ) == 0 )
+  {
+    int64_t maxWeight = 0;
+    int64_t totalWeight = 0;
+    int64_t totalGhosts = 0;
+    real64 maxGhostRatio = 0.0;
+    for( int p = 0; p < numProcs; ++p )
+    {
+      maxWeight = std::max( maxWeight, counts[p] );
+      totalWeight += counts[p];
+      totalGhosts += counts[2 * numProcs + p];
+      if( counts[numProcs + p] > 0 )
+      {
+        maxGhostRatio = std::max( maxGhostRatio, static_cast< real64 >( counts[2 * numProcs + p] ) / counts[numProcs + p] );
+      }
+    }
+    real64 const avgWeight = static_cast< real64 >( totalWeight ) / numProcs;
+    int64_t const numElems = elemDist[numProcs];
+
+    GEOSX_LOG( GEOSX_FMT( "Partition quality over {} ranks:", numProcs ) );
+    GEOSX_LOG( GEOSX_FMT( "  load imbalance (max/avg weight): {:.3f}", avgWeight > 0.0 ? maxWeight / avgWeight : 1.0 ) );
+    GEOSX_LOG( GEOSX_FMT( "  edge cut: {} connections (weighted: {})", cut[0] / 2, cut[1] / 2 ) );
+    GEOSX_LOG( GEOSX_FMT( "  ghost ratio (ghost/owned cells): {:.3f} overall, {:.3f} max",
+                          numElems > 0 ? static_cast< real64 >( totalGhosts ) / numElems : 0.0, maxGhostRatio ) );
+    GEOSX_LOG( GEOSX_FMT( "  max neighbors per rank: {}", maxNeighbors ) );
+  }
+}
+
 vtkSmartPointer< vtkDataSet >
 redistributeByCellGraph( vtkDataSet & mesh,
                          VTKMeshGenerator::PartitionMethod const method,
+                         PartitionWeighting const & weighting,
                          MPI_Comm const comm,
-                         int const numRefinements )
+                         int const numRefinements,
+                         bool const printQuality )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -350,6 +984,8 @@ redistributeByCellGraph( vtkDataSet & mesh,
   // Use int64_t here to match ParMETIS' idx_t
   ArrayOfArrays< int64_t, int64_t > const elemToNodes = buildElemToNodes< int64_t >( mesh );
   ArrayOfArrays< int64_t, int64_t > const graph = parmetis::meshToDual( elemToNodes.toViewConst(), elemDist, comm, 3 );
+  array1d< int64_t > const cellWeights = computeCellWeights( mesh, weighting );
+  array1d< int64_t > const connectionWeights = computeConnectionWeights( mesh, graph.toViewConst(), elemDist, weighting, comm );
 
   array1d< int64_t > const newParts = [&]()
   {
@@ -357,13 +993,13 @@ redistributeByCellGraph( vtkDataSet & mesh,
     {
       case VTKMeshGenerator::PartitionMethod::parmetis:
       {
-        return parmetis::partition( graph.toViewConst(), elemDist, numProcs, comm, numRefinements );
+        return parmetis::partition( graph.toViewConst(), cellWeights, connectionWeights, elemDist, numProcs, comm, numRefinements );
       }
       case VTKMeshGenerator::PartitionMethod::ptscotch:
       {
 #ifdef GEOSX_USE_SCOTCH
         GEOSX_WARNING_IF( numRefinements > 0, "Partition refinement is not supported by 'ptscotch' partitioning method" );
-        return ptscotch::partition( graph.toViewConst(), numProcs, comm );
+        return ptscotch::partition( graph.toViewConst(), cellWeights, connectionWeights, numProcs, comm );
 #else
         GEOSX_THROW( "GEOSX must be built with Scotch support (ENABLE_SCOTCH=ON) to use 'ptscotch' partitioning method" );
 #endif
@@ -374,6 +1010,11 @@ redistributeByCellGraph( vtkDataSet & mesh,
       }
     }
   }();
+  if( printQuality )
+  {
+    printPartitionQuality( graph.toViewConst(), elemDist, cellWeights, connectionWeights, newParts, comm );
+  }
+
   vtkSmartPointer< vtkPartitionedDataSet > const splitMesh = splitMeshByPartition( mesh, numProcs, newParts.toViewConst() );
   return vtk::redistribute( *splitMesh, MPI_COMM_GEOSX );
 }
@@ -425,15 +1066,20 @@ findNeighborRanks( std::vector< vtkBoundingBox > boundingBoxes )
  * @brief Generate global point/cell IDs and redistribute the mesh among MPI ranks.
  * @param[in] loadedMesh the mesh that was loaded on one or several MPI ranks
  * @param[in] comm the MPI communicator
+ * @param[in] method the graph partitioning library
+ * @param[in] weighting the cell and connection weights of the graph partitioning
  * @param[in] partitionRefinement number of graph partitioning refinement cycles
  * @param[in] useGlobalIds controls whether global id arrays from the vtk input should be used
+ * @param[in] printQuality whether the quality of the graph partitioning is reported (collective)
  */
 vtkSmartPointer< vtkDataSet >
 redistributeMesh( vtkDataSet & loadedMesh,
                   MPI_Comm const comm,
                   VTKMeshGenerator::PartitionMethod const method,
+                  PartitionWeighting const & weighting,
                   int const partitionRefinement,
-                  int const useGlobalIds )
+                  int const useGlobalIds,
+                  bool const printQuality )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -478,12 +1124,193 @@ redistributeMesh( vtkDataSet & loadedMesh,
   // Redistribute the mesh again using higher-quality graph partitioner
   if( partitionRefinement > 0 )
   {
-    mesh = redistributeByCellGraph( *mesh, method, comm, partitionRefinement - 1 );
+    mesh = redistributeByCellGraph( *mesh, method, weighting, comm, partitionRefinement - 1, printQuality );
   }
 
   return mesh;
 }
 
+/**
+ * @brief Interleave the bits of three 21-bit integer coordinates into a Morton (Z-order) key.
+ * @param[in] i first coordinate
+ * @param[in] j second coordinate
+ * @param[in] k third coordinate
+ * @return the Morton key
+ */
+std::uint64_t mortonKey( std::uint64_t const i, std::uint64_t const j, std::uint64_t const k )
+{
+  auto const spread = []( std::uint64_t x )
+  {
+    x &= 0x1fffff;
+    x = ( x | x << 32 ) & 0x1f00000000ffff;
+    x = ( x | x << 16 ) & 0x1f0000ff0000ff;
+    x = ( x | x << 8 ) & 0x100f00f00f00f00f;
+    x = ( x | x << 4 ) & 0x10c30c30c30c30c3;
+    x = ( x | x << 2 ) & 0x1249249249249249;
+    return x;
+  };
+  return spread( i ) | ( spread( j ) << 1 ) | ( spread( k ) << 2 );
+}
+
+template< typename POLICY >
+array2d< real64 >
+computeCellCentersImpl( vtkDataSet & mesh,
+                        vtkSmartPointer< vtkCellArray > const & cells )
+{
+  localIndex const numCells = LvArray::integerConversion< localIndex >( mesh.GetNumberOfCells() );
+  array2d< real64 > centers( numCells, 3 );
+
+  // GetCellAtId() is conditionally thread-safe, use POLICY argument
+  forAll< POLICY >( numCells, [&mesh, &cells, centers = centers.toView()] ( localIndex const cellIdx )
+  {
+    vtkIdType numPts;
+    vtkIdType const * points;
+    cells->GetCellAtId( cellIdx, numPts, points );
+    for( vtkIdType a = 0; a < numPts; ++a )
+    {
+      double x[3];
+      mesh.GetPoint( points[a], x );
+      for( integer d = 0; d < 3; ++d )
+      {
+        centers[cellIdx][d] += x[d] / numPts;
+      }
+    }
+  } );
+
+  return centers;
+}
+
+/**
+ * @brief Renumber the local cells along a Morton curve of their centers, and the local points in order of first use.
+ * @param[in] mesh the local part of the redistributed mesh
+ * @return the reordered mesh, or @p mesh itself if it is not an unstructured grid
+ *
+ * Faces and edges are built afterwards from the cell to node map, so they inherit the new ordering.
+ */
+vtkSmartPointer< vtkDataSet >
+reorderMesh( vtkDataSet & mesh )
+{
+  GEOSX_MARK_FUNCTION;
+
+  vtkUnstructuredGrid * const ug = vtkUnstructuredGrid::SafeDownCast( &mesh );
+  if( ug == nullptr )
+  {
+    return &mesh;
+  }
+
+  vtkIdType const numCells = ug->GetNumberOfCells();
+  vtkIdType const numPoints = ug->GetNumberOfPoints();
+
+  // Step 1: sort the cells by the Morton key of their centers in the local bounding box
+  vtkSmartPointer< vtkCellArray > const & cells = GetCellArray( *ug );
+  array2d< real64 > const centers = cells->IsStorageShareable()
+                                  ? computeCellCentersImpl< parallelHostPolicy >( *ug, cells )
+                                  : computeCellCentersImpl< serialPolicy >( *ug, cells );
+
+  real64 boxMin[3] = { LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max };
+  real64 boxMax[3] = { -LvArray::NumericLimits< real64 >::max, -LvArray::NumericLimits< real64 >::max, -LvArray::NumericLimits< real64 >::max };
+  for( vtkIdType c = 0; c < numCells; ++c )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      boxMin[d] = LvArray::math::min( boxMin[d], centers[c][d] );
+      boxMax[d] = LvArray::math::max( boxMax[d], centers[c][d] );
+    }
+  }
+
+  real64 constexpr maxCoord = ( 1 << 21 ) - 1;
+  std::vector< std::pair< std::uint64_t, vtkIdType > > cellKeys( numCells );
+  forAll< parallelHostPolicy >( numCells, [&] ( localIndex const c )
+  {
+    std::uint64_t ijk[3];
+    for( integer d = 0; d < 3; ++d )
+    {
+      real64 const length = boxMax[d] - boxMin[d];
+      ijk[d] = length > 0.0 ? static_cast< std::uint64_t >( ( centers[c][d] - boxMin[d] ) / length * maxCoord ) : 0;
+    }
+    cellKeys[c] = { mortonKey( ijk[0], ijk[1], ijk[2] ), c };
+  } );
+  std::sort( cellKeys.begin(), cellKeys.end() );
+
+  // Step 2: number the points in the order in which the sorted cells use them, unused points go last
+  std::vector< vtkIdType > oldToNewPoint( numPoints, -1 );
+  std::vector< vtkIdType > newToOldPoint;
+  newToOldPoint.reserve( numPoints );
+  vtkNew< vtkIdList > pointIds;
+  for( std::pair< std::uint64_t, vtkIdType > const & cellKey : cellKeys )
+  {
+    ug->GetCellPoints( cellKey.second, pointIds );
+    for( vtkIdType a = 0; a < pointIds->GetNumberOfIds(); ++a )
+    {
+      vtkIdType const oldPoint = pointIds->GetId( a );
+      if( oldToNewPoint[oldPoint] < 0 )
+      {
+        oldToNewPoint[oldPoint] = LvArray::integerConversion< vtkIdType >( newToOldPoint.size() );
+        newToOldPoint.emplace_back( oldPoint );
+      }
+    }
+  }
+  for( vtkIdType p = 0; p < numPoints; ++p )
+  {
+    if( oldToNewPoint[p] < 0 )
+    {
+      oldToNewPoint[p] = LvArray::integerConversion< vtkIdType >( newToOldPoint.size() );
+      newToOldPoint.emplace_back( p );
+    }
+  }
+
+  // Step 3: build the reordered grid, carrying over all the point and cell data (including global ids)
+  vtkSmartPointer< vtkUnstructuredGrid > result = vtkSmartPointer< vtkUnstructuredGrid >::New();
+
+  vtkNew< vtkPoints > points;
+  points->SetDataType( ug->GetPoints()->GetDataType() );
+  points->SetNumberOfPoints( numPoints );
+  result->GetPointData()->CopyAllOn();
+  result->GetPointData()->CopyAllocate( ug->GetPointData(), numPoints );
+  for( vtkIdType p = 0; p < numPoints; ++p )
+  {
+    points->SetPoint( p, ug->GetPoint( newToOldPoint[p] ) );
+    result->GetPointData()->CopyData( ug->GetPointData(), newToOldPoint[p], p );
+  }
+  result->SetPoints( points );
+
+  result->Allocate( numCells );
+  result->GetCellData()->CopyAllOn();
+  result->GetCellData()->CopyAllocate( ug->GetCellData(), numCells );
+  for( vtkIdType c = 0; c < numCells; ++c )
+  {
+    vtkIdType const oldCell = cellKeys[c].second;
+    int const cellType = ug->GetCellType( oldCell );
+    if( cellType == VTK_POLYHEDRON )
+    {
+      // The face stream is (numFaces, numFacePoints_0, points_0..., numFacePoints_1, points_1..., ...)
+      ug->GetFaceStream( oldCell, pointIds );
+      vtkIdType pos = 1;
+      for( vtkIdType f = 0; f < pointIds->GetId( 0 ); ++f )
+      {
+        vtkIdType const numFacePoints = pointIds->GetId( pos );
+        for( vtkIdType a = 1; a <= numFacePoints; ++a )
+        {
+          pointIds->SetId( pos + a, oldToNewPoint[pointIds->GetId( pos + a )] );
+        }
+        pos += numFacePoints + 1;
+      }
+    }
+    else
+    {
+      ug->GetCellPoints( oldCell, pointIds );
+      for( vtkIdType a = 0; a < pointIds->GetNumberOfIds(); ++a )
+      {
+        pointIds->SetId( a, oldToNewPoint[pointIds->GetId( a )] );
+      }
+    }
+    result->InsertNextCell( cellType, pointIds );
+    result->GetCellData()->CopyData( ug->GetCellData(), oldCell, c );
+  }
+
+  return result;
+}
+
 /**
  * @brief Gathers all the data from all ranks, merge them, sort them, and remove duplicates.
  * @tparam T Type of the exchanged data.
@@ -1777,12 +2604,39 @@ void VTKMeshGenerator::generateMesh( DomainPartition & domain )
   vtkSmartPointer< vtkMultiProcessController > controller = vtk::getController();
   vtkMultiProcessController::SetGlobalController( controller );
 
+  GEOSX_THROW_IF_NE_MSG( m_partitionCostRegions.size(), m_partitionCostFactors.size(),
+                         GEOSX_FMT( "{} '{}': {} and {} must have the same size", catalogName(), getName(),
+                                    viewKeyStruct::partitionCostRegionsString(), viewKeyStruct::partitionCostFactorsString() ),
+                         InputError );
+  GEOSX_THROW_IF( std::any_of( m_partitionCostFactors.begin(), m_partitionCostFactors.end(), []( real64 const f ) { return f <= 0.0; } ),
+                  GEOSX_FMT( "{} '{}': {} must be positive", catalogName(), getName(), viewKeyStruct::partitionCostFactorsString() ),
+                  InputError );
+
   GEOSX_LOG_RANK_0( GEOSX_FMT( "{} '{}': reading mesh from {}", catalogName(), getName(), m_filePath ) );
   {
     GEOSX_LOG_LEVEL_RANK_0( 2, "  reading the dataset..." );
-    vtkSmartPointer< vtkDataSet > loadedMesh = vtk::loadMesh( m_filePath );
+    vtkSmartPointer< vtkDataSet > loadedMesh;
+    if( m_parallelRead )
+    {
+      loadedMesh = vtk::loadMeshInParallel( m_filePath );
+    }
+    if( loadedMesh == nullptr )
+    {
+      loadedMesh = vtk::loadMesh( m_filePath );
+    }
     GEOSX_LOG_LEVEL_RANK_0( 2, "  redistributing mesh..." );
-    m_vtkMesh = vtk::redistributeMesh( *loadedMesh, comm, m_partitionMethod, m_partitionRefinement, m_useGlobalIds );
+    vtk::PartitionWeighting weighting;
+    weighting.regionAttribute = m_attributeName;
+    weighting.costRegions = m_partitionCostRegions.toViewConst();
+    weighting.costFactors = m_partitionCostFactors.toViewConst();
+    weighting.cellWeightArray = m_partitionCellWeights;
+    weighting.connectionWeightArray = m_partitionConnectionWeights;
+    m_vtkMesh = vtk::redistributeMesh( *loadedMesh, comm, m_partitionMethod, weighting, m_partitionRefinement, m_useGlobalIds, getLogLevel() > 0 );
+    if( m_localOrdering == LocalOrdering::morton )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 2, "  reordering local cells and points..." );
+      m_vtkMesh = vtk::reorderMesh( *m_vtkMesh );
+    }
     GEOSX_LOG_LEVEL_RANK_0( 2, "  finding neighbor ranks..." );
     std::vector< vtkBoundingBox > boxes = vtk::exchangeBoundingBoxes( *m_vtkMesh, comm );
     std::vector< int > const neighbors = vtk::findNeighborRanks( std::move( boxes ) );
@@ -58,6 +58,15 @@ public:
     ptscotch, ///< Use PTScotch library
   };
 
+  /**
+   * @brief Choice of local renumbering of the mesh entities after partitioning
+   */
+  enum class LocalOrdering : integer
+  {
+    none,   ///< Keep the order produced by the reader and the redistribution
+    morton, ///< Sort cells along a Morton curve and nodes by first use
+  };
+
   /**
    * @brief Main constructor for MeshGenerator base class.
    * @param[in] name of the VTKMeshGenerator object
@@ -83,7 +92,9 @@ public:
    * can be decomposed into a power of 2.
    *
    * - If a .vtu, .vts, .vti or .vtk file is used, the root MPI process will load it.
-   *   The mesh will be then redistribute among all the available MPI processes
+   *   The mesh will be then redistribute among all the available MPI processes.
+   *   If parallelRead is enabled, a .vtu file with raw appended data is instead read by all the
+   *   MPI processes, each one loading a contiguous block of cells before the redistribution.
    * - If a .pvtu or .pvts file is used, it means that the mesh is pre-partionned in the file system.
    *   The available MPI processes will load the pre-partionned mesh. The mesh will be then
    *   redistributed among ALL the available MPI processes.
@@ -148,6 +159,12 @@ private:
     constexpr static char const * partitionRefinementString() { return "partitionRefinement"; }
     constexpr static char const * partitionMethodString() { return "partitionMethod"; }
     constexpr static char const * useGlobalIdsString() { return "useGlobalIds"; }
+    constexpr static char const * parallelReadString() { return "parallelRead"; }
+    constexpr static char const * localOrderingString() { return "localOrdering"; }
+    constexpr static char const * partitionCostRegionsString() { return "partitionCostRegions"; }
+    constexpr static char const * partitionCostFactorsString() { return "partitionCostFactors"; }
+    constexpr static char const * partitionCellWeightsString() { return "partitionCellWeights"; }
+    constexpr static char const * partitionConnectionWeightsString() { return "partitionConnectionWeights"; }
   };
   /// @endcond
 
@@ -169,9 +186,27 @@ private:
   /// Whether global id arrays should be used, if available
   integer m_useGlobalIds = 0;
 
+  /// Whether a single-piece .vtu file should be read in parallel
+  integer m_parallelRead = 0;
+
   /// Method (library) used to partition the mesh
   PartitionMethod m_partitionMethod = PartitionMethod::parmetis;
 
+  /// Local renumbering applied after partitioning
+  LocalOrdering m_localOrdering = LocalOrdering::none;
+
+  /// Region attribute values with a non-unit partitioning cost
+  array1d< integer > m_partitionCostRegions;
+
+  /// Partitioning cost factors of the regions in m_partitionCostRegions
+  array1d< real64 > m_partitionCostFactors;
+
+  /// Name of the VTK cell array scaling the partitioning cost of each cell
+  string m_partitionCellWeights;
+
+  /// Name of the VTK cell array used to weight the partitioning graph connections
+  string m_partitionConnectionWeights;
+
   /// Lists of VTK cell ids, organized by element type, then by region
   CellMapType m_cellMap;
 };
@@ -181,6 +216,11 @@ ENUM_STRINGS( VTKMeshGenerator::PartitionMethod,
               "parmetis",
               "ptscotch" );
 
+/// Strings for VTKMeshGenerator::LocalOrdering enumeration
+ENUM_STRINGS( VTKMeshGenerator::LocalOrdering,
+              "none",
+              "morton" );
+
 } // namespace geosx
 
 #endif /* GEOSX_MESH_GENERATORS_VTKMESHGENERATOR_HPP */
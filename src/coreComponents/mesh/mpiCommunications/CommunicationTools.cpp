@@ -27,6 +27,7 @@
 #include "common/GEOS_RAJA_Interface.hpp"
 
 #include <algorithm>
+#include <sstream>
 
 namespace geosx
 {
@@ -49,6 +50,9 @@ CommunicationTools::CommunicationTools()
 
 CommunicationTools::~CommunicationTools()
 {
+  // the persistent requests must be freed before MPI is finalized
+  invalidateSyncPlans();
+
   GEOSX_ERROR_IF( m_instance != this, "m_instance != this should not be possible." );
   m_instance = nullptr;
 }
@@ -615,9 +619,13 @@ void waitOrderedOrWaitAll( int const n, std::vector< std::function< MPI_Request
 
 void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
                                       std::vector< NeighborCommunicator > & neighbors,
+                                      GhostingRequirements const & ghosting,
                                       bool const unorderedComms )
 {
   GEOSX_MARK_FUNCTION;
+  // the ghosting changes, and so do the buffer sizes of the synchronizations
+  invalidateSyncPlans();
+
   MPI_iCommData commData( getCommID() );
   commData.resize( neighbors.size() );
 
@@ -629,7 +637,7 @@ void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
   auto sendGhosts = [&] ( int idx )
   {
     neighbors[idx].prepareAndSendGhosts( false,
-                                         1,
+                                         ghosting,
                                          meshLevel,
                                          commData.commID(),
                                          commData.mpiRecvBufferSizeRequest( idx ),
@@ -880,11 +888,168 @@ void CommunicationTools::synchronizeFields( FieldIdentifiers const & fieldsToBeS
                                             std::vector< NeighborCommunicator > & neighbors,
                                             bool onDevice )
 {
+  SyncPlan * const plan = getSyncPlan( fieldsToBeSync, mesh, neighbors, onDevice );
+  if( plan == nullptr )
+  {
+    MPI_iCommData icomm( getCommID() );
+    icomm.resize( neighbors.size() );
+    synchronizePackSendRecvSizes( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
+    synchronizePackSendRecv( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
+    synchronizeUnpack( mesh, neighbors, icomm, onDevice );
+    return;
+  }
+
+  GEOSX_MARK_SCOPE( synchronizeFieldsPersistent );
+  int const numNeighbors = LvArray::integerConversion< int >( neighbors.size() );
+
+  // the receives are started first, the buffers sizes are already known
+  MpiWrapper::startAll( numNeighbors, plan->recvRequests.data() );
+
+  parallelDeviceEvents events;
+  for( NeighborCommunicator & neighbor : neighbors )
+  {
+    neighbor.packCommBufferForSync( fieldsToBeSync, mesh, plan->commID, onDevice, events );
+  }
+  waitAllDeviceEvents( events );
+  MpiWrapper::startAll( numNeighbors, plan->sendRequests.data() );
+
+  // unpack the buffers in their order of arrival
+  for( int count = 0; count < numNeighbors; ++count )
+  {
+    int neighborIndex = -1;
+    MpiWrapper::waitAny( numNeighbors,
+                         plan->recvRequests.data(),
+                         &neighborIndex,
+                         plan->recvStatuses.data() );
+    neighbors[neighborIndex].unpackBufferForSync( fieldsToBeSync, mesh, plan->commID, onDevice, events );
+  }
+  waitAllDeviceEvents( events );
+
+  // the send buffers are reused by the next exchange
+  MpiWrapper::waitAll( numNeighbors,
+                       plan->sendRequests.data(),
+                       plan->sendStatuses.data() );
+}
+
+CommunicationTools::SyncPlan * CommunicationTools::getSyncPlan( FieldIdentifiers const & fieldsToBeSync,
+                                                                 MeshLevel & mesh,
+                                                                 std::vector< NeighborCommunicator > & neighbors,
+                                                                 bool onDevice )
+{
+  std::ostringstream fieldsKey;
+  for( auto const & iter : fieldsToBeSync.getFields() )
+  {
+    fieldsKey << iter.first << ':';
+    for( string const & fieldName : iter.second )
+    {
+      fieldsKey << fieldName << ',';
+    }
+    fieldsKey << ';';
+  }
+  SyncPlanKey const key( &mesh, &neighbors, onDevice, fieldsKey.str() );
+
+  auto const iterPlan = m_syncPlans.find( key );
+  if( iterPlan != m_syncPlans.end() )
+  {
+    // The objects or the exchanged fields may have been resized since the plan was created
+    SyncPlan & plan = iterPlan->second;
+    if( plan.sizeModificationCount == mesh.sizeModificationCount() )
+    {
+      return &plan;
+    }
+    releaseSyncPlan( plan );
+    m_syncPlans.erase( iterPlan );
+  }
+
+  // m_freeCommIDs is identical on all ranks, so every rank takes the same decision here
+  if( m_freeCommIDs.size() <= numReservedCommIDs )
+  {
+    return nullptr;
+  }
+
+  GEOSX_MARK_FUNCTION;
+  SyncPlan & plan = m_syncPlans[key];
+  plan.commID = reserveCommID();
+  plan.sizeModificationCount = mesh.sizeModificationCount();
+
+  // the size handshake is only done once, when the plan is created
   MPI_iCommData icomm( getCommID() );
-  icomm.resize( neighbors.size() );
   synchronizePackSendRecvSizes( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
-  synchronizePackSendRecv( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
-  synchronizeUnpack( mesh, neighbors, icomm, onDevice );
+  MpiWrapper::waitAll( icomm.size(),
+                       icomm.mpiRecvBufferSizeRequest(),
+                       icomm.mpiRecvBufferSizeStatus() );
+  MpiWrapper::waitAll( icomm.size(),
+                       icomm.mpiSendBufferSizeRequest(),
+                       icomm.mpiSendBufferSizeStatus() );
+
+  std::size_t const numNeighbors = neighbors.size();
+  plan.sendRequests.resize( numNeighbors );
+  plan.recvRequests.resize( numNeighbors );
+  plan.sendStatuses.resize( numNeighbors );
+  plan.recvStatuses.resize( numNeighbors );
+
+  // a tag per plan, distinct from the ones of the one-off exchanges
+  int const tag = 200 + plan.commID;
+  for( std::size_t neighborIndex = 0; neighborIndex < numNeighbors; ++neighborIndex )
+  {
+    NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    neighbor.resizeSendBuffer( plan.commID, LvArray::integerConversion< int >( neighbor.sendBuffer( icomm.commID() ).size() ) );
+    neighbor.resizeRecvBuffer( plan.commID, neighbor.receiveBufferSize( icomm.commID() ) );
+
+    MpiWrapper::sendInit( neighbor.sendBuffer( plan.commID ).data(),
+                          LvArray::integerConversion< int >( neighbor.sendBuffer( plan.commID ).size() ),
+                          neighbor.neighborRank(),
+                          tag,
+                          MPI_COMM_GEOSX,
+                          &plan.sendRequests[neighborIndex] );
+    MpiWrapper::recvInit( neighbor.receiveBuffer( plan.commID ).data(),
+                          neighbor.receiveBufferSize( plan.commID ),
+                          neighbor.neighborRank(),
+                          tag,
+                          MPI_COMM_GEOSX,
+                          &plan.recvRequests[neighborIndex] );
+  }
+
+  return &plan;
+}
+
+void CommunicationTools::releaseSyncPlan( SyncPlan & plan )
+{
+  for( MPI_Request & request : plan.sendRequests )
+  {
+    MpiWrapper::requestFree( &request );
+  }
+  for( MPI_Request & request : plan.recvRequests )
+  {
+    MpiWrapper::requestFree( &request );
+  }
+  plan.sendRequests.clear();
+  plan.recvRequests.clear();
+  releaseCommID( plan.commID );
+}
+
+void CommunicationTools::invalidateSyncPlans()
+{
+  for( auto & iter : m_syncPlans )
+  {
+    releaseSyncPlan( iter.second );
+  }
+  m_syncPlans.clear();
+}
+
+int CommunicationTools::reserveCommID()
+{
+  GEOSX_ERROR_IF( m_freeCommIDs.empty(), "No communication id left" );
+  // the ids handed out by getCommID() are taken from the front of the set
+  auto const iter = std::prev( m_freeCommIDs.end() );
+  int const commID = *iter;
+  m_freeCommIDs.erase( iter );
+  return commID;
+}
+
+void CommunicationTools::releaseCommID( int const commID )
+{
+  m_freeCommIDs.insert( commID );
 }
 
 } /* namespace geosx */
@@ -26,7 +26,9 @@
 
 #include "mesh/FieldIdentifiers.hpp"
 
+#include <map>
 #include <set>
+#include <tuple>
 
 namespace geosx
 {
@@ -36,6 +38,7 @@ class ObjectManagerBase;
 class NodeManager;
 class NeighborCommunicator;
 class MeshLevel;
+struct GhostingRequirements;
 class ElementRegionManager;
 
 class MPI_iCommData;
@@ -62,11 +65,27 @@ public:
 
   void setupGhosts( MeshLevel & meshLevel,
                     std::vector< NeighborCommunicator > & neighbors,
+                    GhostingRequirements const & ghosting,
                     bool use_nonblocking );
 
   CommID getCommID()
   { return CommID( m_freeCommIDs ); }
 
+  /**
+   * @brief Take a communication id out of the free ones until it is explicitly released.
+   * @return the reserved communication id
+   *
+   * Unlike getCommID(), the id stays reserved beyond the lifetime of a temporary, so it can be used
+   * by exchanges that remain in flight across function calls. Must be called in the same order on all ranks.
+   */
+  int reserveCommID();
+
+  /**
+   * @brief Give back a communication id obtained with reserveCommID().
+   * @param commID the communication id to release
+   */
+  void releaseCommID( int const commID );
+
   void findMatchedPartitionBoundaryObjects( ObjectManagerBase & group,
                                             std::vector< NeighborCommunicator > & allNeighbors );
 
@@ -116,7 +135,67 @@ public:
                        bool onDevice,
                        parallelDeviceEvents & events );
 
+  /**
+   * @brief Release the persistent synchronization plans used by synchronizeFields.
+   *
+   * The plans cache the buffer sizes of the exchanges, so this must be called (collectively)
+   * whenever the ghosting, and hence the content of the send/receive lists, changes.
+   * The plans of a single mesh level are instead rebuilt on their next use after a call to
+   * MeshLevel::modifiedSizes.
+   */
+  void invalidateSyncPlans();
+
 private:
+
+  /**
+   * @struct SyncPlan
+   * @brief Persistent exchange of a given set of fields with all the neighbors.
+   */
+  struct SyncPlan
+  {
+    /// communication id dedicated to the plan, owning the send/receive buffers of the neighbors
+    int commID;
+    /// MeshLevel::sizeModificationCount of the mesh level when the plan was created
+    integer sizeModificationCount;
+    /// persistent send requests, one per neighbor
+    std::vector< MPI_Request > sendRequests;
+    /// persistent receive requests, one per neighbor
+    std::vector< MPI_Request > recvRequests;
+    /// statuses of the send requests
+    std::vector< MPI_Status > sendStatuses;
+    /// statuses of the receive requests
+    std::vector< MPI_Status > recvStatuses;
+  };
+
+  /// Key of a plan: the mesh level, the neighbors, whether the data lives on device, and the serialized fields
+  using SyncPlanKey = std::tuple< MeshLevel const *, std::vector< NeighborCommunicator > const *, bool, string >;
+
+  /**
+   * @brief Get the synchronization plan of a set of fields, creating it if needed.
+   * @param fieldsToBeSync the fields to synchronize
+   * @param mesh the mesh level holding the fields
+   * @param neighbors the neighbors to exchange with
+   * @param onDevice whether the fields are packed/unpacked on device
+   * @return the plan, or nullptr if no communication id could be dedicated to a new plan
+   *
+   * An existing plan is rebuilt if MeshLevel::modifiedSizes was called since its creation.
+   * This check is local: the calls to MeshLevel::modifiedSizes are collective.
+   */
+  SyncPlan * getSyncPlan( FieldIdentifiers const & fieldsToBeSync,
+                          MeshLevel & mesh,
+                          std::vector< NeighborCommunicator > & neighbors,
+                          bool onDevice );
+
+  /**
+   * @brief Free the persistent requests and the communication id of a plan.
+   * @param plan the plan to release
+   */
+  void releaseSyncPlan( SyncPlan & plan );
+
+  /// Number of communication ids never dedicated to a plan, kept for the one-off exchanges
+  static constexpr std::size_t numReservedCommIDs = 20;
+
+  std::map< SyncPlanKey, SyncPlan > m_syncPlans;
   std::set< int > m_freeCommIDs;
   static CommunicationTools * m_instance;
 
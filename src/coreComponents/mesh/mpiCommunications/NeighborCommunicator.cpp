@@ -231,7 +231,7 @@ inline int PackGhosts( buffer_unit_type * sendBufferPtr,
 }
 
 void NeighborCommunicator::prepareAndSendGhosts( bool const GEOSX_UNUSED_PARAM( contactActive ),
-                                                 integer const depth,
+                                                 GhostingRequirements const & ghosting,
                                                  MeshLevel & mesh,
                                                  int const commID,
                                                  MPI_Request & mpiRecvSizeRequest,
@@ -258,11 +258,12 @@ void NeighborCommunicator::prepareAndSendGhosts( bool const GEOSX_UNUSED_PARAM(
                                                                   std::to_string( this->m_neighborRank ) );
 
     mesh.generateAdjacencyLists( nodeManager.getNeighborData( m_neighborRank ).matchedPartitionBoundary(),
+                                 faceManager.getNeighborData( m_neighborRank ).matchedPartitionBoundary(),
                                  nodeAdjacencyList,
                                  edgeAdjacencyList,
                                  faceAdjacencyList,
                                  elementAdjacencyList,
-                                 depth );
+                                 ghosting );
   }
 
   ElemAdjListViewType const elemAdjacencyList =
@@ -35,6 +35,7 @@ inline int CommTag( int const GEOSX_UNUSED_PARAM( senderRank ),
 }
 
 class MeshLevel;
+struct GhostingRequirements;
 class MPI_iCommData;
 
 class NeighborCommunicator
@@ -173,9 +174,10 @@ public:
    *  information from m_neighborRank, this size recv
    *  must be completed before PostRecv is called in order
    *  to correctly resize the receive buffer.
+   *  The ghosted objects are selected according to @p ghosting.
    */
   void prepareAndSendGhosts( bool const contactActive,
-                             integer const depth,
+                             GhostingRequirements const & ghosting,
                              MeshLevel & mesh,
                              int const commID,
                              MPI_Request & mpiRecvSizeRequest,
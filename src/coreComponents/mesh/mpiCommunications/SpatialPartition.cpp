@@ -50,6 +50,7 @@ SpatialPartition::SpatialPartition():
   m_Partitions(),
   m_Periodic( nsdof ),
   m_coords( nsdof ),
+  m_color( -1 ),
   m_min{ 0.0 },
   m_max{ 0.0 },
   m_blockSize{ 1.0 },
@@ -84,6 +85,11 @@ void SpatialPartition::setPartitions( unsigned int xPartitions,
 
 int SpatialPartition::getColor()
 {
+  if( m_color >= 0 )
+  {
+    return m_color;
+  }
+
   int color = 0;
 
   if( isOdd( m_coords[0] ) )
@@ -106,6 +112,12 @@ int SpatialPartition::getColor()
   return color;
 }
 
+void SpatialPartition::setColor( int const color, int const numColors )
+{
+  m_color = color;
+  m_numColors = numColors;
+}
+
 void SpatialPartition::addNeighbors( const unsigned int idim,
                                      MPI_Comm & cartcomm,
                                      int * ncoords )
@@ -245,6 +257,24 @@ void SpatialPartition::setSizes( real64 const ( &min )[ 3 ],
   }
 }
 
+void SpatialPartition::setBox( real64 const ( &gridMin )[ 3 ],
+                               real64 const ( &gridMax )[ 3 ],
+                               real64 const ( &min )[ 3 ],
+                               real64 const ( &max )[ 3 ] )
+{
+  LvArray::tensorOps::copy< 3 >( m_gridMin, gridMin );
+  LvArray::tensorOps::copy< 3 >( m_gridMax, gridMax );
+  LvArray::tensorOps::copy< 3 >( m_gridSize, gridMax );
+  LvArray::tensorOps::subtract< 3 >( m_gridSize, gridMin );
+
+  LvArray::tensorOps::copy< 3 >( m_min, min );
+  LvArray::tensorOps::copy< 3 >( m_max, max );
+  LvArray::tensorOps::copy< 3 >( m_blockSize, max );
+  LvArray::tensorOps::subtract< 3 >( m_blockSize, min );
+
+  setContactGhostRange( 0.0 );
+}
+
 bool SpatialPartition::isCoordInPartition( const real64 & coord, const int dir )
 {
   bool rval = true;
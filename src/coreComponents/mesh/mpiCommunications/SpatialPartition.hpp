@@ -43,8 +43,36 @@ public:
                       unsigned int yPartitions,
                       unsigned int zPartitions ) override;
 
+  /**
+   * @brief Computes the color of the partition from the parity of its cartesian coordinates,
+   *        unless a color has been set with setColor().
+   * @return The color
+   */
   int getColor() override;
 
+  /**
+   * @brief Set the color of a partition that is not part of a cartesian grid of partitions.
+   * @param color the color of this partition, different from the colors of its neighbors
+   * @param numColors the total number of colors
+   */
+  void setColor( int const color, int const numColors );
+
+  /**
+   * @brief Set the extent of a partition that is not part of a cartesian grid of partitions
+   *        (e.g. a box of a recursive bisection).
+   * @param gridMin the global minimum extent of the problem
+   * @param gridMax the global maximum extent of the problem
+   * @param min the minimum extent of this partition
+   * @param max the maximum extent of this partition
+   *
+   * @note The number of partitions and the cartesian coordinates of the partition are not meaningful
+   *       for such a partition and are left unchanged, so isCoordInPartition() must not be used.
+   */
+  void setBox( real64 const ( &gridMin )[ 3 ],
+               real64 const ( &gridMax )[ 3 ],
+               real64 const ( &min )[ 3 ],
+               real64 const ( &max )[ 3 ] );
+
   /// number of partitions
   array1d< int > m_Partitions;
   /**
@@ -76,6 +104,9 @@ private:
    */
   void setContactGhostRange( const real64 bufferSize );
 
+  /// Color set explicitly with setColor(), -1 to compute it from the cartesian coordinates
+  int m_color;
+
   /// Minimum extent of partition dimensions (excluding ghost objects)
   real64 m_min[3];
   /// Maximum extent of partition dimensions (excluding ghost objects)
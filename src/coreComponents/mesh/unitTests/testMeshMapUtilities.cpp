@@ -0,0 +1,176 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testMeshMapUtilities.cpp
+ */
+
+#include "../utilities/MeshMapUtilities.hpp"
+
+#include <gtest/gtest.h>
+
+namespace geosx
+{
+
+/**
+ * @brief Build the element-to-node map of a structured grid of hexahedra.
+ * @param n the number of elements in each direction
+ * @return the element-to-node map, with the nodes numbered lexicographically
+ */
+array2d< localIndex > structuredHexahedra( localIndex const n )
+{
+  array2d< localIndex > elemToNodes( n * n * n, 8 );
+  localIndex const np = n + 1;
+  for( localIndex i = 0; i < n; ++i )
+  {
+    for( localIndex j = 0; j < n; ++j )
+    {
+      for( localIndex k = 0; k < n; ++k )
+      {
+        localIndex const elem = ( i * n + j ) * n + k;
+        localIndex a = 0;
+        for( localIndex di = 0; di < 2; ++di )
+        {
+          for( localIndex dj = 0; dj < 2; ++dj )
+          {
+            for( localIndex dk = 0; dk < 2; ++dk )
+            {
+              elemToNodes( elem, a++ ) = ( ( i + di ) * np + j + dj ) * np + k + dk;
+            }
+          }
+        }
+      }
+    }
+  }
+  return elemToNodes;
+}
+
+/**
+ * @brief Check that a coloring is a partition of the element list, in order within each color,
+ *        and that the elements of a color share no node.
+ * @param elemToNodes the element-to-node map
+ * @param elementList the colored elements
+ * @param numNodes the number of nodes
+ * @param colors the elements grouped by color
+ */
+void checkColoring( arrayView2d< localIndex const > const & elemToNodes,
+                    arrayView1d< localIndex const > const & elementList,
+                    localIndex const numNodes,
+                    ArrayOfArraysView< localIndex const > const & colors )
+{
+  std::vector< localIndex > numTimesColored( elemToNodes.size( 0 ), 0 );
+  localIndex numColored = 0;
+  for( localIndex color = 0; color < colors.size(); ++color )
+  {
+    EXPECT_GT( colors.sizeOfArray( color ), 0 );
+
+    std::vector< localIndex > nodeUsed( numNodes, -1 );
+    for( localIndex i = 0; i < colors.sizeOfArray( color ); ++i )
+    {
+      localIndex const k = colors( color, i );
+      if( i > 0 )
+      {
+        EXPECT_LT( colors( color, i - 1 ), k );
+      }
+      ++numTimesColored[ k ];
+      for( localIndex const nodeIndex : elemToNodes[ k ] )
+      {
+        EXPECT_EQ( nodeUsed[ nodeIndex ], -1 ) << "elements " << nodeUsed[ nodeIndex ] << " and " << k
+                                               << " of color " << color << " share node " << nodeIndex;
+        nodeUsed[ nodeIndex ] = k;
+      }
+    }
+    numColored += colors.sizeOfArray( color );
+  }
+
+  EXPECT_EQ( numColored, elementList.size() );
+  for( localIndex const k : elementList )
+  {
+    EXPECT_EQ( numTimesColored[ k ], 1 );
+  }
+}
+
+TEST( testMeshMapUtilities, colorStructuredHexahedra )
+{
+  localIndex const n = 4;
+  array2d< localIndex > const elemToNodes = structuredHexahedra( n );
+  localIndex const numNodes = ( n + 1 ) * ( n + 1 ) * ( n + 1 );
+
+  array1d< localIndex > elementList( elemToNodes.size( 0 ) );
+  for( localIndex k = 0; k < elementList.size(); ++k )
+  {
+    elementList[ k ] = k;
+  }
+
+  ArrayOfArrays< localIndex > const colors =
+    meshMapUtilities::colorElements( elemToNodes.toViewConst(), elementList.toViewConst(), numNodes );
+  checkColoring( elemToNodes.toViewConst(), elementList.toViewConst(), numNodes, colors.toViewConst() );
+
+  // the lexicographic greedy coloring of a structured grid is the optimal 2 x 2 x 2 coloring
+  EXPECT_EQ( colors.size(), 8 );
+}
+
+TEST( testMeshMapUtilities, colorElementSubset )
+{
+  localIndex const n = 4;
+  array2d< localIndex > const elemToNodes = structuredHexahedra( n );
+  localIndex const numNodes = ( n + 1 ) * ( n + 1 ) * ( n + 1 );
+
+  // every other element: only the elements of the subset are colored
+  array1d< localIndex > elementList;
+  for( localIndex k = 0; k < elemToNodes.size( 0 ); k += 2 )
+  {
+    elementList.emplace_back( k );
+  }
+
+  ArrayOfArrays< localIndex > const colors =
+    meshMapUtilities::colorElements( elemToNodes.toViewConst(), elementList.toViewConst(), numNodes );
+  checkColoring( elemToNodes.toViewConst(), elementList.toViewConst(), numNodes, colors.toViewConst() );
+  EXPECT_LE( colors.size(), 8 );
+
+  // an empty list has no color
+  array1d< localIndex > const emptyList;
+  EXPECT_EQ( meshMapUtilities::colorElements( elemToNodes.toViewConst(), emptyList.toViewConst(), numNodes ).size(), 0 );
+}
+
+TEST( testMeshMapUtilities, colorTooManyColors )
+{
+  // a fan of elements sharing the node 0: each element needs its own color
+  localIndex const maxNumColors = 64;
+  array2d< localIndex > elemToNodes( maxNumColors + 1, 2 );
+  array1d< localIndex > elementList( maxNumColors + 1 );
+  for( localIndex k = 0; k <= maxNumColors; ++k )
+  {
+    elemToNodes( k, 0 ) = 0;
+    elemToNodes( k, 1 ) = k + 1;
+    elementList[ k ] = k;
+  }
+  localIndex const numNodes = maxNumColors + 2;
+
+  // 64 colors are still representable
+  array1d< localIndex > firstElements( maxNumColors );
+  for( localIndex k = 0; k < maxNumColors; ++k )
+  {
+    firstElements[ k ] = k;
+  }
+  ArrayOfArrays< localIndex > const colors =
+    meshMapUtilities::colorElements( elemToNodes.toViewConst(), firstElements.toViewConst(), numNodes );
+  checkColoring( elemToNodes.toViewConst(), firstElements.toViewConst(), numNodes, colors.toViewConst() );
+  EXPECT_EQ( colors.size(), maxNumColors );
+
+  // the 65th color is not
+  EXPECT_DEATH_IF_SUPPORTED( meshMapUtilities::colorElements( elemToNodes.toViewConst(), elementList.toViewConst(), numNodes ), "" );
+}
+
+} /* namespace geosx */
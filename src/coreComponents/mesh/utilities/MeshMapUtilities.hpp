@@ -209,6 +209,69 @@ void transformCellBlockToRegionMap( arrayView2d< localIndex const > const & bloc
   } );
 }
 
+/**
+ * @brief Greedily color a list of elements so that two elements of the same color share no node.
+ * @tparam ELEM_TO_NODES type of the element-to-node map (array2d or ArrayOfArrays view)
+ * @tparam ELEM_LIST type of the list of elements to color
+ * @param elemToNodes the element-to-node map
+ * @param elementList the elements to color
+ * @param numNodes the number of nodes addressed by @p elemToNodes
+ * @return the elements of @p elementList grouped by color, in their original order within each color
+ *
+ * The colors already used around each node are stored in a 64-bit mask, hence the
+ * coloring fails if an element is adjacent to elements of 64 different colors.
+ */
+template< typename ELEM_TO_NODES, typename ELEM_LIST >
+ArrayOfArrays< localIndex >
+colorElements( ELEM_TO_NODES const & elemToNodes,
+               ELEM_LIST const & elementList,
+               localIndex const numNodes )
+{
+  constexpr integer maxNumColors = 64;
+
+  std::vector< std::uint64_t > nodeColorMasks( numNodes, 0 );
+  std::vector< integer > elemColors( elementList.size() );
+  std::vector< localIndex > colorCounts;
+
+  for( localIndex i = 0; i < elementList.size(); ++i )
+  {
+    localIndex const k = elementList[ i ];
+
+    std::uint64_t usedColors = 0;
+    for( localIndex const nodeIndex : elemToNodes[ k ] )
+    {
+      usedColors |= nodeColorMasks[ nodeIndex ];
+    }
+
+    integer color = 0;
+    while( color < maxNumColors && ( usedColors & ( std::uint64_t( 1 ) << color ) ) )
+    {
+      ++color;
+    }
+    GEOSX_ERROR_IF( color == maxNumColors,
+                    "Element " << k << " is adjacent to elements of " << maxNumColors << " different colors" );
+
+    for( localIndex const nodeIndex : elemToNodes[ k ] )
+    {
+      nodeColorMasks[ nodeIndex ] |= std::uint64_t( 1 ) << color;
+    }
+    elemColors[ i ] = color;
+    if( color == LvArray::integerConversion< integer >( colorCounts.size() ) )
+    {
+      colorCounts.push_back( 0 );
+    }
+    ++colorCounts[ color ];
+  }
+
+  ArrayOfArrays< localIndex > colors;
+  colors.resizeFromCapacities< serialPolicy >( LvArray::integerConversion< localIndex >( colorCounts.size() ), colorCounts.data() );
+  for( localIndex i = 0; i < elementList.size(); ++i )
+  {
+    colors.emplaceBack( elemColors[ i ], elementList[ i ] );
+  }
+  return colors;
+}
+
 } // namespace meshMapUtilities
 
 } // namespace geosx
@@ -0,0 +1,150 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file LocalTimeSteppingUtilities.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_LOCALTIMESTEPPINGUTILITIES_HPP_
+#define GEOSX_PHYSICSSOLVERS_LOCALTIMESTEPPINGUTILITIES_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/DataLayouts.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Helper functions for explicit schemes advancing the elements with different time steps,
+ *        the powers of two dividing a coarse time step.
+ */
+namespace localTimeStepping
+{
+
+/**
+ * @brief Estimate the stable time step of the elements of a subregion for an explicit scheme.
+ * @tparam POLICY the execution policy
+ * @tparam WAVE_SPEED the type of the function returning the fastest wave speed of an element
+ * @param X the node positions
+ * @param elemsToNodes the element to node map, with all the support points of the elements
+ * @param waveSpeed the function returning the fastest wave speed of an element
+ * @param cflFactor the safety factor applied to the estimate
+ * @param stableDt the stable time step of each element
+ *
+ * The estimate is cflFactor times the smallest distance between two support points of the element,
+ * divided by the wave speed. For spectral elements, the smallest distance between two Gauss-Lobatto
+ * points accounts for the order of the element.
+ */
+template< typename POLICY, typename WAVE_SPEED >
+void computeElementStableTimeSteps( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X,
+                                    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes,
+                                    WAVE_SPEED && waveSpeed,
+                                    real64 const cflFactor,
+                                    arrayView1d< real64 > const stableDt )
+{
+  localIndex const numNodesPerElem = elemsToNodes.size( 1 );
+  forAll< POLICY >( elemsToNodes.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+  {
+    real64 minDistance2 = LvArray::NumericLimits< real64 >::max;
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      for( localIndex b = a + 1; b < numNodesPerElem; ++b )
+      {
+        real64 distance[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[elemsToNodes[k][a]] );
+        LvArray::tensorOps::subtract< 3 >( distance, X[elemsToNodes[k][b]] );
+        minDistance2 = LvArray::math::min( minDistance2, LvArray::tensorOps::l2NormSquared< 3 >( distance ) );
+      }
+    }
+    stableDt[k] = cflFactor * LvArray::math::sqrt( minDistance2 ) / waveSpeed( k );
+  } );
+}
+
+/**
+ * @brief Get the time step level of an element.
+ * @param dt the coarse time step
+ * @param stableDt the stable time step of the element
+ * @param numLevels the number of levels
+ * @return the smallest level such that dt / 2^level is stable, capped at numLevels - 1
+ */
+GEOSX_HOST_DEVICE
+inline integer timeSteppingLevel( real64 const dt,
+                                  real64 const stableDt,
+                                  integer const numLevels )
+{
+  integer level = 0;
+  real64 levelDt = dt;
+  while( levelDt > stableDt && level < numLevels - 1 )
+  {
+    levelDt *= 0.5;
+    ++level;
+  }
+  return level;
+}
+
+/**
+ * @brief Compute the element updates saved by advancing each level with its own time step.
+ * @param numElementsPerLevel the global number of elements advanced at each level
+ * @return the ratio between the element updates with the time step of the finest level used everywhere,
+ *   and the element updates with each level advanced with its own time step
+ */
+inline real64 localTimeSteppingSpeedup( array1d< globalIndex > const & numElementsPerLevel )
+{
+  integer finestLevel = 0;
+  globalIndex numElements = 0;
+  real64 localUpdates = 0.0;
+  for( integer level = 0; level < numElementsPerLevel.size(); ++level )
+  {
+    if( numElementsPerLevel[level] > 0 )
+    {
+      finestLevel = level;
+    }
+    numElements += numElementsPerLevel[level];
+    localUpdates += numElementsPerLevel[level] * std::pow( 2.0, level );
+  }
+  return ( localUpdates > 0.0 ) ? numElements * std::pow( 2.0, finestLevel ) / localUpdates : 1.0;
+}
+
+/**
+ * @brief Log the number of elements of each level, and the speedup of the local time stepping.
+ * @param solverName the name of the solver, used as prefix
+ * @param dt the coarse time step
+ * @param numElementsPerLevel the number of elements of each level on this rank, summed over the ranks by this function
+ * @note This is collective over MPI_COMM_GEOSX.
+ */
+inline void logTimeSteppingLevels( string const & solverName,
+                                   real64 const dt,
+                                   array1d< globalIndex > & numElementsPerLevel )
+{
+  for( integer level = 0; level < numElementsPerLevel.size(); ++level )
+  {
+    numElementsPerLevel[level] = MpiWrapper::sum( numElementsPerLevel[level] );
+  }
+
+  std::ostringstream levels;
+  for( integer level = 0; level < numElementsPerLevel.size(); ++level )
+  {
+    levels << "\n\t level " << level << " (dt = " << dt / std::pow( 2.0, level ) << " s): " << numElementsPerLevel[level] << " elements";
+  }
+  GEOSX_LOG_RANK_0( solverName << ": time step levels of the elements" << levels.str()
+                               << "\n\t speedup of the local time stepping over the finest time step: "
+                               << localTimeSteppingSpeedup( numElementsPerLevel ) );
+}
+
+} // namespace localTimeStepping
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_LOCALTIMESTEPPINGUTILITIES_HPP_
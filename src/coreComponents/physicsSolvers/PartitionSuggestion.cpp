@@ -0,0 +1,282 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file PartitionSuggestion.cpp
+ */
+
+#include "PartitionSuggestion.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "common/TimingMacros.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/generators/ParMETISInterface.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// Integer weight of the most expensive cell passed to the partitioner
+constexpr real64 maxCellWeight = 1000.0;
+
+}
+
+PartitionSuggestion::PartitionSuggestion( const string & name,
+                                          Group * const parent ):
+  TaskBase( name, parent ),
+  m_solverName(),
+  m_solver( nullptr )
+{
+  enableLogLevelInput();
+
+  registerWrapper( viewKeyStruct::solverNameString(), &m_solverName ).
+    setInputFlag( InputFlags::REQUIRED ).
+    setDescription( "Name of the physics solver whose cost is measured" );
+
+  registerWrapper( viewKeyStruct::imbalanceToleranceString(), &m_imbalanceTolerance ).
+    setApplyDefaultValue( 1.1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Ratio of the maximum to the average rank cost above which a new partition is suggested" );
+
+  registerWrapper( viewKeyStruct::redistributionCostRatioString(), &m_redistributionCostRatio ).
+    setApplyDefaultValue( 1000.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Ratio of the communication time to the data redistribution time used by the adaptive repartitioning. "
+                    "Large values favor a small edge cut, small values favor a small number of migrated cells" );
+}
+
+PartitionSuggestion::~PartitionSuggestion()
+{}
+
+void PartitionSuggestion::postProcessInput()
+{
+  ProblemManager & problemManager = this->getGroupByPath< ProblemManager >( "/Problem" );
+  PhysicsSolverManager & physicsSolverManager = problemManager.getPhysicsSolverManager();
+
+  GEOSX_THROW_IF( !physicsSolverManager.hasGroup( m_solverName ),
+                  GEOSX_FMT( "Task {}: physics solver named {} not found",
+                             getName(), m_solverName ),
+                  InputError );
+
+  GEOSX_THROW_IF_LT_MSG( m_imbalanceTolerance, 1.0,
+                         GEOSX_FMT( "Task {}: {} must be at least 1",
+                                    getName(), viewKeyStruct::imbalanceToleranceString() ),
+                         InputError );
+
+  m_solver = &physicsSolverManager.getGroup< SolverBase >( m_solverName );
+}
+
+void PartitionSuggestion::registerDataOnMesh( Group & meshBodies )
+{
+  // for now, this guard is needed to avoid breaking the xml schema generation
+  if( m_solver == nullptr )
+  {
+    return;
+  }
+
+  m_solver->forDiscretizationOnMeshTargets( meshBodies, [&] ( string const &,
+                                                              MeshLevel & mesh,
+                                                              arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      subRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::cellCostString() ).
+        setPlotLevel( PlotLevel::LEVEL_0 ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setDescription( "Estimated cost of the cell relative to the average cell cost: local work time of its rank split over its owned cells "
+                        "in proportion to their number of nodes. Can be used as partitionCellWeights of the VTK mesh of a subsequent run" );
+
+      subRegion.registerWrapper< array1d< integer > >( viewKeyStruct::targetRankString() ).
+        setApplyDefaultValue( -1 ).
+        setPlotLevel( PlotLevel::LEVEL_0 ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setDescription( "Rank of the cell in the suggested cost-balanced partition, -1 if no partition has been suggested" );
+    } );
+  } );
+}
+
+bool PartitionSuggestion::execute( real64 const time_n,
+                                   real64 const GEOSX_UNUSED_PARAM( dt ),
+                                   integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                                   integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                   real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                                   DomainPartition & domain )
+{
+  real64 const rankCost = m_solver->getLocalWorkTime();
+  m_solver->resetLocalWorkTime();
+
+  real64 const minCost = MpiWrapper::min( rankCost );
+  real64 const maxCost = MpiWrapper::max( rankCost );
+  real64 const avgCost = MpiWrapper::sum( rankCost ) / MpiWrapper::commSize();
+  real64 const imbalance = avgCost > 0.0 ? maxCost / avgCost : 1.0;
+
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "Task `{}`: at time {}s, local work of solver `{}` per rank (min, avg, max): {:.3g}, {:.3g}, {:.3g} s, imbalance {:.3f}",
+                               getName(), time_n, m_solverName, minCost, avgCost, maxCost, imbalance ) );
+
+  if( imbalance <= m_imbalanceTolerance )
+  {
+    return false;
+  }
+
+  m_solver->forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                          MeshLevel & mesh,
+                                                                          arrayView1d< string const > const & regionNames )
+  {
+    suggestPartition( mesh, regionNames, rankCost );
+  } );
+
+  return false;
+}
+
+void PartitionSuggestion::suggestPartition( MeshLevel & mesh,
+                                            arrayView1d< string const > const & regionNames,
+                                            real64 const rankCost ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  MPI_Comm const comm = MPI_COMM_GEOSX;
+  int const rank = MpiWrapper::commRank( comm );
+  int const numRanks = MpiWrapper::commSize( comm );
+
+  ElementRegionManager & elemManager = mesh.getElemManager();
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = mesh.getNodeManager().localToGlobalMap();
+
+  // Step 1: build the element-to-node map of the owned cells, with global node indices
+  array1d< int64_t > nodeCounts;
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        nodeCounts.emplace_back( subRegion.numNodesPerElement() );
+      }
+    }
+  } );
+  localIndex const numOwnedCells = nodeCounts.size();
+
+  ArrayOfArrays< int64_t, int64_t > elemToNodes;
+  elemToNodes.resizeFromCapacities< serialPolicy >( numOwnedCells, nodeCounts.data() );
+  {
+    localIndex cellIndex = 0;
+    elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                CellElementSubRegion const & subRegion )
+    {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      auto const nodeList = subRegion.nodeList().toViewConst();
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        if( ghostRank[ei] < 0 )
+        {
+          for( localIndex a = 0; a < subRegion.numNodesPerElement(); ++a )
+          {
+            elemToNodes.emplaceBack( cellIndex, nodeLocalToGlobal[nodeList( ei, a )] );
+          }
+          ++cellIndex;
+        }
+      }
+    } );
+  }
+
+  array1d< int64_t > elemDist( numRanks + 1 );
+  {
+    array1d< int64_t > elemCounts;
+    MpiWrapper::allGather( static_cast< int64_t >( numOwnedCells ), elemCounts, comm );
+    std::partial_sum( elemCounts.begin(), elemCounts.end(), elemDist.begin() + 1 );
+  }
+
+  ArrayOfArrays< int64_t, int64_t > const graph = parmetis::meshToDual( elemToNodes.toViewConst(), elemDist, comm, 3 );
+
+  // Step 2: spread the measured rank cost over the owned cells in proportion to their number of nodes,
+  // which approximates the relative assembly cost of cells of different types, and compute the partition
+  int64_t const totalNodeCount = std::accumulate( nodeCounts.begin(), nodeCounts.end(), int64_t{ 0 } );
+  array1d< real64 > cellCosts( numOwnedCells );
+  for( localIndex k = 0; k < numOwnedCells; ++k )
+  {
+    cellCosts[k] = rankCost * nodeCounts[k] / totalNodeCount;
+  }
+  real64 const maxCellCost = MpiWrapper::max( cellCosts.empty() ? 0.0 : *std::max_element( cellCosts.begin(), cellCosts.end() ), comm );
+  array1d< int64_t > weights( numOwnedCells );
+  for( localIndex k = 0; k < numOwnedCells; ++k )
+  {
+    weights[k] = maxCellCost > 0.0
+               ? std::max( int64_t{ 1 }, static_cast< int64_t >( std::llround( maxCellWeight * cellCosts[k] / maxCellCost ) ) )
+               : 1;
+  }
+
+  array1d< int64_t > const targetRanks = parmetis::repartition( graph.toViewConst(), weights, elemDist, comm, m_redistributionCostRatio );
+
+  // The stored cost is relative to the average cell cost, so that it is independent of the measured time scale
+  // and can be turned into integer partitioning weights by the mesh generator of a subsequent run
+  real64 const avgCellCost = MpiWrapper::sum( rankCost, comm ) / elemDist[numRanks];
+
+  // Step 3: store the results and report the projected balance
+  array1d< real64 > localLoads( numRanks );
+  int64_t numMoved = 0;
+  {
+    localIndex cellIndex = 0;
+    elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                CellElementSubRegion & subRegion )
+    {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView1d< real64 > const cost = subRegion.getReference< array1d< real64 > >( viewKeyStruct::cellCostString() );
+      arrayView1d< integer > const target = subRegion.getReference< array1d< integer > >( viewKeyStruct::targetRankString() );
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        if( ghostRank[ei] < 0 )
+        {
+          int64_t const newRank = targetRanks[cellIndex];
+          cost[ei] = avgCellCost > 0.0 ? cellCosts[cellIndex] / avgCellCost : 1.0;
+          target[ei] = LvArray::integerConversion< integer >( newRank );
+          localLoads[newRank] += cellCosts[cellIndex];
+          ++cellIndex;
+          numMoved += ( newRank != rank );
+        }
+      }
+    } );
+  }
+
+  array1d< real64 > loads( numRanks );
+  MpiWrapper::allReduce( localLoads.data(), loads.data(), numRanks, MPI_SUM, comm );
+  real64 const totalLoad = std::accumulate( loads.begin(), loads.end(), 0.0 );
+  real64 const maxLoad = *std::max_element( loads.begin(), loads.end() );
+  real64 const newImbalance = totalLoad > 0.0 ? maxLoad * numRanks / totalLoad : 1.0;
+  int64_t const totalMoved = MpiWrapper::sum( numMoved, comm );
+
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "Task `{}`: suggested partition moves {} of {} cells, projected imbalance {:.3f} (target rank stored in `{}`, the mesh is not redistributed)",
+                               getName(), totalMoved, elemDist[numRanks], newImbalance, viewKeyStruct::targetRankString() ) );
+  GEOSX_LOG_LEVEL_RANK_0( 1, GEOSX_FMT( "Task `{}`: use the `{}` field as cell weights to partition the mesh of the next run",
+                                        getName(), viewKeyStruct::cellCostString() ) );
+}
+
+REGISTER_CATALOG_ENTRY( TaskBase,
+                        PartitionSuggestion,
+                        string const &, dataRepository::Group * const )
+
+} /* namespace geosx */
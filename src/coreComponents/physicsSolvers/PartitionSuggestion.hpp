@@ -0,0 +1,122 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file PartitionSuggestion.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_PARTITIONSUGGESTION_HPP_
+#define GEOSX_PHYSICSSOLVERS_PARTITIONSUGGESTION_HPP_
+
+#include "events/tasks/TaskBase.hpp"
+
+namespace geosx
+{
+
+class SolverBase;
+class MeshLevel;
+
+/**
+ * @class PartitionSuggestion
+ *
+ * Diagnostic task measuring the per-rank cost of a physics solver and suggesting, when the imbalance
+ * exceeds a tolerance, a cost-balanced partition of the solver cells computed with ParMETIS adaptive repartitioning.
+ * The cells are not migrated: the estimated relative cost and the suggested rank of each cell are only stored
+ * as cell fields, so that they can be written by an output and used to partition the mesh of a subsequent run
+ * (e.g. with the ``partitionCellWeights`` attribute of the VTK mesh generator).
+ */
+class PartitionSuggestion : public TaskBase
+{
+public:
+
+  /**
+   * @brief Constructor for the partition suggestion class
+   * @param[in] name the name of the task coming from the xml
+   * @param[in] parent the parent group of the task
+   */
+  PartitionSuggestion( const string & name,
+                       Group * const parent );
+
+  /// Destructor for the class
+  ~PartitionSuggestion() override;
+
+  /// Accessor for the catalog name
+  static string catalogName() { return "PartitionSuggestion"; }
+
+  /**
+   * @defgroup Tasks Interface Functions
+   *
+   * This function implements the interface defined by the abstract TaskBase class
+   */
+  /**@{*/
+
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**@}*/
+
+  /**
+   * @struct viewKeyStruct holds char strings and viewKeys for fast lookup
+   */
+  struct viewKeyStruct
+  {
+    /// String for the solver name
+    constexpr static char const * solverNameString() { return "solverName"; }
+    /// String for the imbalance tolerance
+    constexpr static char const * imbalanceToleranceString() { return "imbalanceTolerance"; }
+    /// String for the ratio of communication to redistribution time
+    constexpr static char const * redistributionCostRatioString() { return "redistributionCostRatio"; }
+    /// String for the estimated cell cost field
+    constexpr static char const * cellCostString() { return "cellCost"; }
+    /// String for the target rank field
+    constexpr static char const * targetRankString() { return "targetRank"; }
+  };
+
+private:
+
+  void postProcessInput() override;
+
+  void registerDataOnMesh( Group & meshBodies ) override;
+
+  /**
+   * @brief Store the estimated cost of the owned cells and compute their suggested ranks
+   * @param[in] mesh the mesh level of the solver
+   * @param[in] regionNames the names of the solver target regions
+   * @param[in] rankCost the local work time of this rank since the last execution
+   */
+  void suggestPartition( MeshLevel & mesh,
+                         arrayView1d< string const > const & regionNames,
+                         real64 const rankCost ) const;
+
+  /// Name of the physics solver
+  string m_solverName;
+
+  /// Pointer to the physics solver
+  SolverBase * m_solver;
+
+  /// Max/average cost ratio above which a new partition is suggested
+  real64 m_imbalanceTolerance;
+
+  /// Ratio of the communication time to the data redistribution time passed to ParMETIS
+  real64 m_redistributionCostRatio;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_PARTITIONSUGGESTION_HPP_ */
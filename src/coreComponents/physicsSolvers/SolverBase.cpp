@@ -15,6 +15,7 @@
 #include "SolverBase.hpp"
 #include "PhysicsSolverManager.hpp"
 
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
@@ -345,12 +346,14 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
     arrayView1d< real64 > const localRhs = m_rhs.open();
 
     // call assemble to fill the matrix and the rhs
+    Stopwatch assemblyWatch;
     assembleSystem( time_n,
                     dt,
                     domain,
                     m_dofManager,
                     m_localMatrix.toViewConstSizes(),
                     localRhs );
+    addLocalWorkTime( assemblyWatch.elapsedTime() );
 
     // apply boundary conditions to system
     applyBoundaryConditions( time_n,
@@ -396,7 +399,11 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
   applySystemSolution( m_dofManager, m_solution.values(), 1.0, domain );
 
   // update non-primary variables (constitutive models)
-  updateState( domain );
+  {
+    Stopwatch updateWatch;
+    updateState( domain );
+    addLocalWorkTime( updateWatch.elapsedTime() );
+  }
 
   // final step for completion of timestep. typically secondary variable updates and cleanup.
   implicitStepComplete( time_n, dt, domain );
@@ -778,12 +785,14 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
       arrayView1d< real64 > const localRhs = m_rhs.open();
 
       // call assemble to fill the matrix and the rhs
+      Stopwatch assemblyWatch;
       assembleSystem( time_n,
                       stepDt,
                       domain,
                       m_dofManager,
                       m_localMatrix.toViewConstSizes(),
                       localRhs );
+      addLocalWorkTime( assemblyWatch.elapsedTime() );
 
 //      LvArray::print<serialPolicy>( m_localMatrix.toViewConst() );
 
@@ -932,7 +941,11 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
     applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, domain );
 
     // update non-primary variables (constitutive models)
-    updateState( domain );
+    {
+      Stopwatch updateWatch;
+      updateState( domain );
+      addLocalWorkTime( updateWatch.elapsedTime() );
+    }
 
     lastResidual = residualNorm;
   }
@@ -524,6 +524,20 @@ public:
    */
   virtual void updateState( DomainPartition & domain );
 
+  /**
+   * @brief Get the ghost layers this solver needs on the partition boundaries of its mesh bodies.
+   * @param domain the domain containing the numerical methods
+   * @return the ghosting requirements of the solver
+   *
+   * The ghost layers of a mesh body are the union of the requirements of the solvers targeting it.
+   * The default is one layer of node-adjacent elements, which is what the finite element solvers need.
+   */
+  virtual GhostingRequirements getGhostingRequirements( DomainPartition const & domain ) const
+  {
+    GEOSX_UNUSED_VAR( domain );
+    return GhostingRequirements();
+  }
+
   /**
    * @brief reset state of physics back to the beginning of the step.
    * @param domain
@@ -715,6 +729,26 @@ public:
   {
     return m_meshTargets;
   }
+
+  /**
+   * @brief Get the time spent by this rank in local work (assembly and state updates) since the last reset.
+   * @return the local work time in seconds
+   * @note Unlike the wall time of a step, this excludes the linear solve and most of the waiting
+   *       on other ranks, so it can be compared across ranks to measure the load imbalance.
+   */
+  real64 getLocalWorkTime() const { return m_localWorkTime; }
+
+  /**
+   * @brief Reset the accumulated local work time.
+   */
+  void resetLocalWorkTime() { m_localWorkTime = 0.0; }
+
+  /**
+   * @brief Add to the accumulated local work time.
+   * @param time the time to add in seconds
+   */
+  void addLocalWorkTime( real64 const time ) { m_localWorkTime += time; }
+
 protected:
 
 
@@ -779,6 +813,9 @@ protected:
   /// Solver statistics
   SolverStatistics m_solverStatistics;
 
+  /// Time spent by this rank in assembly and state updates since the last reset
+  real64 m_localWorkTime = 0.0;
+
   std::function< void( CRSMatrix< real64, globalIndex >, array1d< real64 > ) > m_assemblyCallback;
 
 
@@ -0,0 +1,94 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file AsyncHaloExchange.cpp
+ */
+
+#include "AsyncHaloExchange.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "mesh/mpiCommunications/NeighborCommunicator.hpp"
+
+namespace geosx
+{
+
+AsyncHaloExchange::~AsyncHaloExchange()
+{
+  for( auto const & iter : m_commIDs )
+  {
+    CommunicationTools::getInstance().releaseCommID( iter.second );
+  }
+}
+
+AsyncHaloExchange::AsyncHaloExchange( AsyncHaloExchange && source ):
+  m_pendingExchanges( std::move( source.m_pendingExchanges ) ),
+  m_commIDs( std::move( source.m_commIDs ) )
+{
+  // the moved-from object must not release the ids
+  source.m_pendingExchanges.clear();
+  source.m_commIDs.clear();
+}
+
+void AsyncHaloExchange::start( FieldIdentifiers const & fieldsToBeSync,
+                               MeshLevel & mesh,
+                               std::vector< NeighborCommunicator > & neighbors )
+{
+  GEOSX_MARK_FUNCTION;
+
+  CommunicationTools & commTools = CommunicationTools::getInstance();
+
+  finish( mesh, neighbors );
+
+  // the id is kept for the lifetime of the object, since the buffers are used across calls
+  if( m_commIDs.count( &mesh ) == 0 )
+  {
+    m_commIDs[&mesh] = commTools.reserveCommID();
+  }
+
+  MPI_iCommData & icomm =
+    m_pendingExchanges.emplace( std::piecewise_construct,
+                                std::forward_as_tuple( &mesh ),
+                                std::forward_as_tuple( m_commIDs.at( &mesh ) ) ).first->second;
+  icomm.resize( neighbors.size() );
+
+  commTools.synchronizePackSendRecvSizes( fieldsToBeSync, mesh, neighbors, icomm, true );
+
+  parallelDeviceEvents packEvents;
+  commTools.asyncPack( fieldsToBeSync, mesh, neighbors, icomm, true, packEvents );
+  waitAllDeviceEvents( packEvents );
+  commTools.asyncSendRecv( neighbors, icomm, true, packEvents );
+}
+
+bool AsyncHaloExchange::finish( MeshLevel & mesh,
+                                std::vector< NeighborCommunicator > & neighbors )
+{
+  auto const iter = m_pendingExchanges.find( &mesh );
+  if( iter == m_pendingExchanges.end() )
+  {
+    return false;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  // this includes a device sync after launching all the unpacking kernels
+  parallelDeviceEvents unpackEvents;
+  CommunicationTools::getInstance().finalizeUnpack( mesh, neighbors, iter->second, true, unpackEvents );
+  m_pendingExchanges.erase( iter );
+  return true;
+}
+
+} /* namespace geosx */
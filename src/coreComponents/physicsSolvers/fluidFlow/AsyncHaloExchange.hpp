@@ -0,0 +1,156 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file AsyncHaloExchange.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_ASYNCHALOEXCHANGE_HPP_
+#define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_ASYNCHALOEXCHANGE_HPP_
+
+#include "common/DataTypes.hpp"
+#include "mesh/FieldIdentifiers.hpp"
+#include "mesh/mpiCommunications/MPI_iCommData.hpp"
+
+#include <map>
+
+namespace geosx
+{
+
+class MeshLevel;
+class NeighborCommunicator;
+
+/**
+ * @brief Subset of the connections of a stencil on which a flux kernel is launched.
+ */
+enum class ConnectionSubset : integer
+{
+  all,      ///< all the connections
+  interior, ///< the connections touching no ghost element
+  boundary  ///< the connections touching at least one ghost element
+};
+
+/**
+ * @brief Subset of the elements of a sub-region on which the state is updated.
+ */
+enum class ElementSubset : integer
+{
+  all,    ///< all the elements
+  owned,  ///< the locally owned elements
+  ghosts  ///< the ghost elements
+};
+
+/**
+ * @brief Check if an element belongs to a subset.
+ * @param[in] subset the subset
+ * @param[in] ghostRank the ghost rank of the element
+ * @return true if the element belongs to the subset
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+bool isInSubset( ElementSubset const subset, integer const ghostRank )
+{
+  return subset == ElementSubset::all || ( ghostRank < 0 ) == ( subset == ElementSubset::owned );
+}
+
+/**
+ * @brief Get the range of the connections of a stencil belonging to a subset.
+ * @tparam STENCILWRAPPER the type of the stencil wrapper
+ * @param[in] stencilWrapper the stencil wrapper, storing its interior connections first
+ * @param[in] subset the subset of connections
+ * @param[out] first the index of the first connection of the subset
+ * @param[out] last one past the index of the last connection of the subset
+ */
+template< typename STENCILWRAPPER >
+void getConnectionRange( STENCILWRAPPER const & stencilWrapper,
+                         ConnectionSubset const subset,
+                         localIndex & first,
+                         localIndex & last )
+{
+  first = ( subset == ConnectionSubset::boundary ) ? stencilWrapper.numInteriorConnections() : 0;
+  last = ( subset == ConnectionSubset::interior ) ? stencilWrapper.numInteriorConnections() : stencilWrapper.size();
+}
+
+/**
+ * @class AsyncHaloExchange
+ *
+ * Synchronization of fields with the neighbors that stays in flight between the moment the owned values
+ * are known and the moment the ghost values are needed, so that the work on the interior can overlap it.
+ */
+class AsyncHaloExchange
+{
+public:
+
+  /// Constructor
+  AsyncHaloExchange() = default;
+
+  /// Destructor, giving back the communication ids to CommunicationTools
+  ~AsyncHaloExchange();
+
+  /// Deleted copy constructor
+  AsyncHaloExchange( AsyncHaloExchange const & ) = delete;
+
+  /// Deleted copy assignment
+  AsyncHaloExchange & operator=( AsyncHaloExchange const & ) = delete;
+
+  /**
+   * @brief Move constructor, the communication ids are transferred to the new object
+   * @param[in] source the object to move from
+   */
+  AsyncHaloExchange( AsyncHaloExchange && source );
+
+  /// Deleted move assignment
+  AsyncHaloExchange & operator=( AsyncHaloExchange && ) = delete;
+
+  /**
+   * @brief Pack the fields and post the sends and receives, without waiting for their completion.
+   * @param[in] fieldsToBeSync the fields to synchronize
+   * @param[in] mesh the mesh level holding the fields
+   * @param[in] neighbors the neighbors to exchange with
+   *
+   * An exchange already pending on the same mesh level is completed first.
+   */
+  void start( FieldIdentifiers const & fieldsToBeSync,
+              MeshLevel & mesh,
+              std::vector< NeighborCommunicator > & neighbors );
+
+  /**
+   * @brief Wait for the exchange pending on a mesh level, and unpack the ghost values.
+   * @param[in] mesh the mesh level
+   * @param[in] neighbors the neighbors to exchange with
+   * @return true if an exchange was pending on the mesh level
+   */
+  bool finish( MeshLevel & mesh,
+               std::vector< NeighborCommunicator > & neighbors );
+
+  /**
+   * @brief Check if an exchange is pending on a mesh level.
+   * @param[in] mesh the mesh level
+   * @return true if an exchange has been started and not finished yet
+   */
+  bool isPending( MeshLevel const & mesh ) const
+  { return m_pendingExchanges.count( &mesh ) > 0; }
+
+private:
+
+  /// Communication data of the exchanges in flight, for each mesh level
+  std::map< MeshLevel const *, MPI_iCommData > m_pendingExchanges;
+
+  /// Communication id reserved for each mesh level, for the lifetime of the object
+  std::map< MeshLevel const *, int > m_commIDs;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_FLUIDFLOW_ASYNCHALOEXCHANGE_HPP_ */
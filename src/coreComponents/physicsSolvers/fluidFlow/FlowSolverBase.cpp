@@ -27,6 +27,7 @@
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "finiteVolume/TwoPointFluxApproximation.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "physicsSolvers/fluidFlow/FluxKernelsHelper.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
@@ -40,10 +41,17 @@ using namespace constitutive;
 template< typename POROUSWRAPPER_TYPE >
 void execute1( POROUSWRAPPER_TYPE porousWrapper,
                CellElementSubRegion & subRegion,
-               arrayView1d< real64 const > const & pressure )
+               arrayView1d< real64 const > const & pressure,
+               ElementSubset const subset )
 {
+  arrayView1d< integer const > const ghostRank = subRegion.ghostRank().toViewConst();
+
   forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_DEVICE ( localIndex const k )
   {
+    if( !isInSubset( subset, ghostRank[k] ) )
+    {
+      return;
+    }
     for( localIndex q = 0; q < porousWrapper.numGauss(); ++q )
     {
       porousWrapper.updateStateFromPressure( k, q,
@@ -154,6 +162,18 @@ void FlowSolverBase::registerDataOnMesh( Group & meshBodies )
   }
 }
 
+GhostingRequirements FlowSolverBase::getGhostingRequirements( DomainPartition const & domain ) const
+{
+  GhostingRequirements ghosting = SolverBase::getGhostingRequirements( domain );
+
+  FiniteVolumeManager const & fvManager = domain.getNumericalMethodManager().getFiniteVolumeManager();
+  if( fvManager.getGroupPointer< TwoPointFluxApproximation >( m_discretizationName ) != nullptr )
+  {
+    ghosting.adjacency = GhostingRequirements::Adjacency::face;
+  }
+  return ghosting;
+}
+
 void FlowSolverBase::setConstitutiveNamesCallSuper( ElementSubRegionBase & subRegion ) const
 {
   SolverBase::setConstitutiveNamesCallSuper( subRegion );
@@ -279,7 +299,8 @@ void FlowSolverBase::precomputeData( MeshLevel & mesh,
   }
 }
 
-void FlowSolverBase::updatePorosityAndPermeability( CellElementSubRegion & subRegion ) const
+void FlowSolverBase::updatePorosityAndPermeability( CellElementSubRegion & subRegion,
+                                                    ElementSubset const subset ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -292,7 +313,7 @@ void FlowSolverBase::updatePorosityAndPermeability( CellElementSubRegion & subRe
   {
     typename TYPEOFREF( castedPorousSolid ) ::KernelWrapper porousWrapper = castedPorousSolid.createKernelUpdates();
 
-    execute1( porousWrapper, subRegion, pressure );
+    execute1( porousWrapper, subRegion, pressure, subset );
   } );
 }
 
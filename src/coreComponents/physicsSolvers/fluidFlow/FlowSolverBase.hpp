@@ -20,6 +20,7 @@
 #define GEOSX_PHYSICSSOLVERS_FINITEVOLUME_FLOWSOLVERBASE_HPP_
 
 #include "physicsSolvers/SolverBase.hpp"
+#include "physicsSolvers/fluidFlow/AsyncHaloExchange.hpp"
 
 namespace geosx
 {
@@ -63,6 +64,13 @@ public:
 
   virtual void registerDataOnMesh( Group & MeshBodies ) override;
 
+  /**
+   * @copydoc SolverBase::getGhostingRequirements
+   *
+   * A two-point flux approximation only couples the cells sharing a face, so one layer of face-adjacent cells is enough.
+   */
+  virtual GhostingRequirements getGhostingRequirements( DomainPartition const & domain ) const override;
+
   localIndex numDofPerCell() const { return m_numDofPerCell; }
 
   struct viewKeyStruct : SolverBase::viewKeyStruct
@@ -82,7 +90,8 @@ public:
 
   };
 
-  void updatePorosityAndPermeability( CellElementSubRegion & subRegion ) const;
+  void updatePorosityAndPermeability( CellElementSubRegion & subRegion,
+                                      ElementSubset const subset = ElementSubset::all ) const;
 
   virtual void updatePorosityAndPermeability( SurfaceElementSubRegion & subRegion ) const;
 
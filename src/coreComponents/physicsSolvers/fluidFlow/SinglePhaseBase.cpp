@@ -231,12 +231,14 @@ void SinglePhaseBase::initializePreSubGroups()
   initializeAquiferBC();
 }
 
-void SinglePhaseBase::updateFluidModel( ObjectManagerBase & dataGroup ) const
+void SinglePhaseBase::updateFluidModel( ObjectManagerBase & dataGroup,
+                                        ElementSubset const subset ) const
 {
   GEOSX_MARK_FUNCTION;
 
   arrayView1d< real64 const > const pres = dataGroup.getExtrinsicData< extrinsicMeshData::flow::pressure >();
   arrayView1d< real64 const > const temp = dataGroup.getExtrinsicData< extrinsicMeshData::flow::temperature >();
+  arrayView1d< integer const > const ghostRank = dataGroup.ghostRank().toViewConst();
 
   SingleFluidBase & fluid =
     getConstitutiveModel< SingleFluidBase >( dataGroup, dataGroup.getReference< string >( viewKeyStruct::fluidNamesString() ) );
@@ -244,7 +246,7 @@ void SinglePhaseBase::updateFluidModel( ObjectManagerBase & dataGroup ) const
   constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
   {
     typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
-    thermalSinglePhaseBaseKernels::FluidUpdateKernel::launch( fluidWrapper, pres, temp );
+    thermalSinglePhaseBaseKernels::FluidUpdateKernel::launch( fluidWrapper, pres, temp, ghostRank, subset );
   } );
 }
 
@@ -260,13 +262,15 @@ void SinglePhaseBase::updateSolidInternalEnergyModel( ObjectManagerBase & dataGr
   thermalSinglePhaseBaseKernels::SolidInternalEnergyUpdateKernel::launch< parallelDevicePolicy<> >( dataGroup.size(), solidInternalEnergyWrapper, temp );
 }
 
-void SinglePhaseBase::updateFluidState( ObjectManagerBase & subRegion ) const
+void SinglePhaseBase::updateFluidState( ObjectManagerBase & subRegion,
+                                        ElementSubset const subset ) const
 {
-  updateFluidModel( subRegion );
-  updateMobility( subRegion );
+  updateFluidModel( subRegion, subset );
+  updateMobility( subRegion, subset );
 }
 
-void SinglePhaseBase::updateMobility( ObjectManagerBase & dataGroup ) const
+void SinglePhaseBase::updateMobility( ObjectManagerBase & dataGroup,
+                                      ElementSubset const subset ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -305,6 +309,8 @@ void SinglePhaseBase::updateMobility( ObjectManagerBase & dataGroup ) const
   else
   {
     singlePhaseBaseKernels::MobilityKernel::launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                                                              dataGroup.ghostRank().toViewConst(),
+                                                                              subset,
                                                                               fluidProps.dens,
                                                                               fluidProps.dDens_dPres,
                                                                               fluidProps.visc,
@@ -699,6 +705,8 @@ void SinglePhaseBase::implicitStepComplete( real64 const & time,
 {
   GEOSX_MARK_FUNCTION;
 
+  finishHaloExchange( domain );
+
   // note: we have to save the aquifer state **before** updating the pressure,
   // otherwise the aquifer flux is saved with the wrong pressure time level
   saveAquiferConvergedState( time, dt, domain );
@@ -1100,22 +1108,62 @@ void SinglePhaseBase::updateState( DomainPartition & domain )
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
   {
-    mesh.getElemManager().forElementSubRegions< CellElementSubRegion, SurfaceElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                                                   auto & subRegion )
+    // while the ghost values are in flight, only the owned elements can be updated,
+    // the ghost elements are updated when the exchange completes (see finishHaloExchange)
+    ElementSubset const subset = m_haloExchange.isPending( mesh ) ? ElementSubset::owned : ElementSubset::all;
+    updateMeshState( mesh, regionNames, subset );
+  } );
+}
+
+void SinglePhaseBase::updateMeshState( MeshLevel & mesh,
+                                       arrayView1d< string const > const & regionNames,
+                                       ElementSubset const subset )
+{
+  ElementRegionManager & elemManager = mesh.getElemManager();
+
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion & subRegion )
+  {
+    updatePorosityAndPermeability( subRegion, subset );
+    updateFluidState( subRegion, subset );
+
+    if( m_isThermal )
     {
-      updatePorosityAndPermeability( subRegion );
-      updateFluidState( subRegion );
+      updateSolidInternalEnergyModel( subRegion );
+    }
+  } );
 
-      if( m_isThermal )
-      {
-        updateSolidInternalEnergyModel( subRegion );
-      }
-    } );
+  elemManager.forElementSubRegions< SurfaceElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                 SurfaceElementSubRegion & subRegion )
+  {
+    updatePorosityAndPermeability( subRegion );
+    updateFluidState( subRegion );
+
+    if( m_isThermal )
+    {
+      updateSolidInternalEnergyModel( subRegion );
+    }
+  } );
+}
+
+void SinglePhaseBase::finishHaloExchange( DomainPartition & domain )
+{
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    if( m_haloExchange.finish( mesh, domain.getNeighbors() ) )
+    {
+      updateMeshState( mesh, regionNames, ElementSubset::ghosts );
+    }
   } );
 }
 
 void SinglePhaseBase::resetStateToBeginningOfStep( DomainPartition & domain )
 {
+  // the values in flight must not overwrite the reset ones
+  finishHaloExchange( domain );
+
   // set mass fraction flag on fluid models
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
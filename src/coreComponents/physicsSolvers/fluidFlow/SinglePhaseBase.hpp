@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEBASE_HPP_
 #define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEBASE_HPP_
 
+#include "physicsSolvers/fluidFlow/AsyncHaloExchange.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBase.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBaseKernels.hpp"
 #include "physicsSolvers/fluidFlow/ThermalSinglePhaseBaseKernels.hpp"
@@ -258,17 +259,21 @@ public:
   /**
    * @brief Function to update all constitutive state and dependent variables
    * @param dataGroup group that contains the fields
+   * @param subset the subset of elements to update
    */
   void
-  updateFluidState( ObjectManagerBase & subRegion ) const;
+  updateFluidState( ObjectManagerBase & subRegion,
+                    ElementSubset const subset = ElementSubset::all ) const;
 
 
   /**
    * @brief Function to update all constitutive models
    * @param dataGroup group that contains the fields
+   * @param subset the subset of elements to update
    */
   virtual void
-  updateFluidModel( ObjectManagerBase & dataGroup ) const;
+  updateFluidModel( ObjectManagerBase & dataGroup,
+                    ElementSubset const subset = ElementSubset::all ) const;
 
   /**
    * @brief Update all relevant solid internal energy models using current values of temperature
@@ -279,9 +284,11 @@ public:
   /**
    * @brief Function to update fluid mobility
    * @param dataGroup group that contains the fields
+   * @param subset the subset of elements to update
    */
   void
-  updateMobility( ObjectManagerBase & dataGroup ) const;
+  updateMobility( ObjectManagerBase & dataGroup,
+                  ElementSubset const subset = ElementSubset::all ) const;
 
   /**
    * @brief Setup stored views into domain data for the current step
@@ -313,6 +320,23 @@ protected:
 
   virtual void setConstitutiveNamesCallSuper( ElementSubRegionBase & subRegion ) const override;
 
+  /**
+   * @brief Update the state of a subset of the elements of a mesh level.
+   * @param[in] mesh the mesh level
+   * @param[in] regionNames the names of the target regions
+   * @param[in] subset the subset of elements to update
+   *
+   * The surface elements are always updated entirely.
+   */
+  void updateMeshState( MeshLevel & mesh,
+                        arrayView1d< string const > const & regionNames,
+                        ElementSubset const subset );
+
+  /**
+   * @brief Complete the pending halo exchanges of the primary variables, and update the state of the ghost elements.
+   * @param[in] domain the domain partition
+   */
+  void finishHaloExchange( DomainPartition & domain );
 
   /**
    * @brief Structure holding views into fluid properties used by the base solver.
@@ -353,6 +377,9 @@ protected:
   /// the input temperature
   real64 m_inputTemperature;
 
+  /// the exchange of the primary variables left in flight by applySystemSolution, if any
+  AsyncHaloExchange m_haloExchange;
+
 private:
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const override;
 
@@ -25,6 +25,7 @@
 #include "constitutive/solid/CoupledSolidBase.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "physicsSolvers/fluidFlow/AsyncHaloExchange.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
 
 namespace geosx
@@ -81,6 +82,32 @@ struct MobilityKernel
     } );
   }
 
+  template< typename POLICY >
+  static void launch( localIndex const size,
+                      arrayView1d< integer const > const & ghostRank,
+                      ElementSubset const subset,
+                      arrayView2d< real64 const > const & dens,
+                      arrayView2d< real64 const > const & dDens_dPres,
+                      arrayView2d< real64 const > const & visc,
+                      arrayView2d< real64 const > const & dVisc_dPres,
+                      arrayView1d< real64 > const & mob,
+                      arrayView1d< real64 > const & dMob_dPres )
+  {
+    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const a )
+    {
+      if( !isInSubset( subset, ghostRank[a] ) )
+      {
+        return;
+      }
+      compute( dens[a][0],
+               dDens_dPres[a][0],
+               visc[a][0],
+               dVisc_dPres[a][0],
+               mob[a],
+               dMob_dPres[a] );
+    } );
+  }
+
   template< typename POLICY >
   static void launch( localIndex const size,
                       arrayView2d< real64 const > const & dens,
@@ -54,7 +54,13 @@ template< typename BASE >
 SinglePhaseFVM< BASE >::SinglePhaseFVM( const string & name,
                                         Group * const parent ):
   BASE( name, parent )
-{}
+{
+  this->registerWrapper( viewKeyStruct::overlapHaloExchangeString(), &m_overlapHaloExchange ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to overlap the halo exchange of the primary variables with the assembly of the connections touching no ghost cell.\n"
+                    "Only for standalone SinglePhaseFVM solvers, an error is raised if the solver is used by a coupled solver." );
+}
 
 template< typename BASE >
 void SinglePhaseFVM< BASE >::initializePreSubGroups()
@@ -62,13 +68,39 @@ void SinglePhaseFVM< BASE >::initializePreSubGroups()
   BASE::initializePreSubGroups();
 
   DomainPartition & domain = this->template getGroupByPath< DomainPartition >( "/Problem/domain" );
-  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
-  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  NumericalMethodsManager & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager & fvManager = numericalMethodManager.getFiniteVolumeManager();
 
   if( !fvManager.hasGroup< FluxApproximationBase >( m_discretizationName ) )
   {
     GEOSX_ERROR( "A discretization deriving from FluxApproximationBase must be selected with SinglePhaseFVM" );
   }
+
+  if( m_overlapHaloExchange )
+  {
+    GEOSX_THROW_IF( std::is_same< BASE, SinglePhaseProppantBase >::value,
+                    this->getName() << ": " << viewKeyStruct::overlapHaloExchangeString() << " is not supported with proppant",
+                    InputError );
+
+    // The coupled solvers refer to their sub-solvers with "<prefix>SolverName" attributes,
+    // and read the ghost pressures outside of the flow assembly
+    string const suffix = "SolverName";
+    this->getParent().template forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+    {
+      solver.template forWrappers< string >( [&]( Wrapper< string > const & wrapper )
+      {
+        string const & key = wrapper.getName();
+        bool const isSubSolverName = key.size() > suffix.size() && key.compare( key.size() - suffix.size(), suffix.size(), suffix ) == 0;
+        GEOSX_THROW_IF( isSubSolverName && wrapper.reference() == this->getName(),
+                        this->getName() << ": " << viewKeyStruct::overlapHaloExchangeString() << " is only supported by standalone solvers, "
+                                        << "but this solver is used by " << solver.getName(),
+                        InputError );
+      } );
+    } );
+
+    // the interior connections are assembled while the halo exchange is in flight
+    fvManager.getFluxApproximation( m_discretizationName ).splitInteriorConnections();
+  }
 }
 
 template< typename BASE >
@@ -277,17 +309,63 @@ void SinglePhaseFVM< BASE >::applySystemSolution( DofManager const & dofManager,
 
     fieldsToBeSync.addElementFields( fields, regionNames );
 
-    CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync, mesh, domain.getNeighbors(), true );
+    if( m_overlapHaloExchange )
+    {
+      // completed in assembleSystem, once the connections touching no ghost cell are assembled
+      this->m_haloExchange.start( fieldsToBeSync, mesh, domain.getNeighbors() );
+    }
+    else
+    {
+      CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync, mesh, domain.getNeighbors(), true );
+    }
   } );
 }
 
+template< typename BASE >
+void SinglePhaseFVM< BASE >::assembleSystem( real64 const time_n,
+                                             real64 const dt,
+                                             DomainPartition & domain,
+                                             DofManager const & dofManager,
+                                             CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                             arrayView1d< real64 > const & localRhs )
+{
+  if( !m_overlapHaloExchange )
+  {
+    BASE::assembleSystem( time_n, dt, domain, dofManager, localMatrix, localRhs );
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  // these terms only involve the state of the owned cells
+  this->assembleAccumulationTerms( domain, dofManager, localMatrix, localRhs );
+  assembleFluxTerms( time_n, dt, domain, dofManager, localMatrix, localRhs, ConnectionSubset::interior );
+
+  // wait for the ghost values and update the state of the ghost cells
+  this->finishHaloExchange( domain );
+
+  assembleFluxTerms( time_n, dt, domain, dofManager, localMatrix, localRhs, ConnectionSubset::boundary );
+}
+
 template< >
-void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM ( time_n ),
+void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const time_n,
                                                            real64 const dt,
                                                            DomainPartition const & domain,
                                                            DofManager const & dofManager,
                                                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                                            arrayView1d< real64 > const & localRhs )
+{
+  assembleFluxTerms( time_n, dt, domain, dofManager, localMatrix, localRhs, ConnectionSubset::all );
+}
+
+template< >
+void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM ( time_n ),
+                                                           real64 const dt,
+                                                           DomainPartition const & domain,
+                                                           DofManager const & dofManager,
+                                                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                           arrayView1d< real64 > const & localRhs,
+                                                           ConnectionSubset const connections )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -321,7 +399,8 @@ void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UN
                                                                                      stencilWrapper,
                                                                                      dt,
                                                                                      localMatrix.toViewConstSizes(),
-                                                                                     localRhs.toView() );
+                                                                                     localRhs.toView(),
+                                                                                     connections );
       }
       else
       {
@@ -333,7 +412,8 @@ void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UN
                                                                                      stencilWrapper,
                                                                                      dt,
                                                                                      localMatrix.toViewConstSizes(),
-                                                                                     localRhs.toView() );
+                                                                                     localRhs.toView(),
+                                                                                     connections );
       }
 
 
@@ -343,6 +423,20 @@ void SinglePhaseFVM< SinglePhaseBase >::assembleFluxTerms( real64 const GEOSX_UN
 }
 
 
+template<>
+void SinglePhaseFVM< SinglePhaseProppantBase >::assembleFluxTerms( real64 const time_n,
+                                                                   real64 const dt,
+                                                                   DomainPartition const & domain,
+                                                                   DofManager const & dofManager,
+                                                                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                                   arrayView1d< real64 > const & localRhs,
+                                                                   ConnectionSubset const connections )
+{
+  // the halo exchange is never overlapped with proppant, see initializePreSubGroups
+  GEOSX_ERROR_IF( connections != ConnectionSubset::all, "The flux terms can only be assembled on all the connections with proppant" );
+  assembleFluxTerms( time_n, dt, domain, dofManager, localMatrix, localRhs );
+}
+
 template<>
 void SinglePhaseFVM< SinglePhaseProppantBase >::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM ( time_n ),
                                                                    real64 const dt,
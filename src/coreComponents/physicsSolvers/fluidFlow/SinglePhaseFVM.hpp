@@ -155,6 +155,21 @@ public:
                        arrayView1d< real64 const > const & localSolution,
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
+
+  /**
+   * @copydoc SinglePhaseBase::assembleSystem
+   *
+   * When the halo exchange is overlapped, the accumulation terms and the interior connections are
+   * assembled while the ghost values are in flight, and the boundary connections once they arrived.
+   */
+  virtual void
+  assembleSystem( real64 const time_n,
+                  real64 const dt,
+                  DomainPartition & domain,
+                  DofManager const & dofManager,
+                  CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                  arrayView1d< real64 > const & localRhs ) override;
+
   virtual void
   assembleFluxTerms( real64 const time_n,
                      real64 const dt,
@@ -163,6 +178,25 @@ public:
                      CRSMatrixView< real64, globalIndex const > const & localMatrix,
                      arrayView1d< real64 > const & localRhs ) override;
 
+  /**
+   * @brief assembles the flux terms on a subset of the connections of the stencils
+   * @param time_n previous time value
+   * @param dt time step
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the system matrix
+   * @param localRhs the system right-hand side vector
+   * @param connections the subset of connections to assemble
+   */
+  void
+  assembleFluxTerms( real64 const time_n,
+                     real64 const dt,
+                     DomainPartition const & domain,
+                     DofManager const & dofManager,
+                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                     arrayView1d< real64 > const & localRhs,
+                     ConnectionSubset const connections );
+
   virtual void
   assemblePoroelasticFluxTerms( real64 const time_n,
                                 real64 const dt,
@@ -193,6 +227,11 @@ public:
 
   virtual void initializePreSubGroups() override;
 
+  struct viewKeyStruct : BASE::viewKeyStruct
+  {
+    static constexpr char const * overlapHaloExchangeString() { return "overlapHaloExchange"; }
+  };
+
 private:
 
   /**
@@ -211,7 +250,8 @@ private:
                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
                              arrayView1d< real64 > const & localRhs );
 
-  // no data needed here, see SinglePhaseBase
+  /// flag to overlap the halo exchange of the primary variables with the assembly
+  integer m_overlapHaloExchange;
 
 };
 
@@ -32,6 +32,7 @@
 #include "finiteVolume/BoundaryStencil.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "physicsSolvers/fluidFlow/AsyncHaloExchange.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseExtrinsicData.hpp"
 #include "physicsSolvers/fluidFlow/FluxKernelsHelper.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBaseExtrinsicData.hpp"
@@ -543,11 +544,29 @@ public:
   static void
   launch( localIndex const numConnections,
           KERNEL_TYPE const & kernelComponent )
+  {
+    launch< POLICY >( 0, numConnections, kernelComponent );
+  }
+
+  /**
+   * @brief Performs the kernel launch on a contiguous range of connections
+   * @tparam POLICY the policy used in the RAJA kernels
+   * @tparam KERNEL_TYPE the kernel type
+   * @param[in] firstConnection the index of the first connection
+   * @param[in] lastConnection one past the index of the last connection
+   * @param[inout] kernelComponent the kernel component providing access to setup/compute/complete functions and stack variables
+   */
+  template< typename POLICY, typename KERNEL_TYPE >
+  static void
+  launch( localIndex const firstConnection,
+          localIndex const lastConnection,
+          KERNEL_TYPE const & kernelComponent )
   {
     GEOSX_MARK_FUNCTION;
 
-    forAll< POLICY >( numConnections, [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    forAll< POLICY >( lastConnection - firstConnection, [=] GEOSX_HOST_DEVICE ( localIndex const i )
     {
+      localIndex const iconn = firstConnection + i;
       typename KERNEL_TYPE::StackVariables stack( kernelComponent.stencilSize( iconn ),
                                                   kernelComponent.numPointsInFlux( iconn ) );
 
@@ -590,6 +609,7 @@ public:
    * @param[in] dt time step size
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
+   * @param[in] connections the subset of connections of the stencil to assemble
    */
   template< typename POLICY, typename STENCILWRAPPER >
   static void
@@ -600,7 +620,8 @@ public:
                    STENCILWRAPPER const & stencilWrapper,
                    real64 const & dt,
                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                   arrayView1d< real64 > const & localRhs )
+                   arrayView1d< real64 > const & localRhs,
+                   ConnectionSubset const connections = ConnectionSubset::all )
   {
     integer constexpr NUM_DOF = 1;
 
@@ -616,7 +637,10 @@ public:
     kernelType kernel( rankOffset, stencilWrapper, dofNumberAccessor,
                        flowAccessors, fluidAccessors, permAccessors,
                        dt, localMatrix, localRhs );
-    kernelType::template launch< POLICY >( stencilWrapper.size(), kernel );
+
+    localIndex firstConnection, lastConnection;
+    getConnectionRange( stencilWrapper, connections, firstConnection, lastConnection );
+    kernelType::template launch< POLICY >( firstConnection, lastConnection, kernel );
   }
 };
 
@@ -102,7 +102,8 @@ SinglePhaseBase::FluidPropViews SinglePhaseProppantBase::getFluidProperties( con
            slurryFluid.getExtrinsicData< extrinsicMeshData::singlefluid::viscosity >().getDefaultValue() };
 }
 
-void SinglePhaseProppantBase::updateFluidModel( ObjectManagerBase & dataGroup ) const
+void SinglePhaseProppantBase::updateFluidModel( ObjectManagerBase & dataGroup,
+                                                ElementSubset const GEOSX_UNUSED_PARAM( subset ) ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -54,7 +54,12 @@ public:
    */
   virtual ~SinglePhaseProppantBase();
 
-  virtual void updateFluidModel( ObjectManagerBase & dataGroup ) const override;
+  /**
+   * @copydoc SinglePhaseBase::updateFluidModel
+   * @note The slurry model is always updated on all the elements
+   */
+  virtual void updateFluidModel( ObjectManagerBase & dataGroup,
+                                 ElementSubset const subset = ElementSubset::all ) const override;
 
   virtual void updatePorosityAndPermeability( SurfaceElementSubRegion & subRegion ) const override;
 
@@ -447,6 +447,26 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+  template< typename FLUID_WRAPPER >
+  static void launch( FLUID_WRAPPER const & fluidWrapper,
+                      arrayView1d< real64 const > const & pres,
+                      arrayView1d< real64 const > const & temp,
+                      arrayView1d< integer const > const & ghostRank,
+                      ElementSubset const subset )
+  {
+    forAll< parallelDevicePolicy<> >( fluidWrapper.numElems(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      if( !isInSubset( subset, ghostRank[k] ) )
+      {
+        return;
+      }
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pres[k], temp[k] );
+      }
+    } );
+  }
 };
 
 /******************************** SolidInternalEnergyUpdateKernel ********************************/
@@ -442,6 +442,7 @@ public:
    * @param[in] dt time step size
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
+   * @param[in] connections the subset of connections of the stencil to assemble
    */
   template< typename POLICY, typename STENCILWRAPPER >
   static void
@@ -452,7 +453,8 @@ public:
                    STENCILWRAPPER const & stencilWrapper,
                    real64 const & dt,
                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                   arrayView1d< real64 > const & localRhs )
+                   arrayView1d< real64 > const & localRhs,
+                   ConnectionSubset const connections = ConnectionSubset::all )
   {
     integer constexpr NUM_DOF = 2;
 
@@ -472,7 +474,10 @@ public:
                        flowAccessors, thermalFlowAccessors, fluidAccessors, thermalFluidAccessors,
                        permAccessors, thermalConductivityAccessors,
                        dt, localMatrix, localRhs );
-    KernelType::template launch< POLICY >( stencilWrapper.size(), kernel );
+
+    localIndex firstConnection, lastConnection;
+    getConnectionRange( stencilWrapper, connections, firstConnection, lastConnection );
+    KernelType::template launch< POLICY >( firstConnection, lastConnection, kernel );
   }
 };
 
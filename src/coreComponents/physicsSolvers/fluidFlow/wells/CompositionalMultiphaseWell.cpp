@@ -926,11 +926,11 @@ void CompositionalMultiphaseWell::initializeWells( DomainPartition & domain )
 
         thermalCompositionalMultiphaseBaseKernels::
           FluidUpdateKernel::
-          launch< serialPolicy >( subRegion.size(),
-                                  fluidWrapper,
-                                  wellElemPressure,
-                                  wellElemTemp,
-                                  wellElemCompFrac );
+          launch< parallelDevicePolicy<> >( subRegion.size(),
+                                            fluidWrapper,
+                                            wellElemPressure,
+                                            wellElemTemp,
+                                            wellElemCompFrac );
       } );
 
       CompDensInitializationKernel::launch( subRegion.size(),
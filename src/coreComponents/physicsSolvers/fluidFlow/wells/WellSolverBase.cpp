@@ -243,13 +243,13 @@ void WellSolverBase::precomputeData( DomainPartition & domain )
       arrayView1d< real64 > const perfGravCoef =
         perforationData.getExtrinsicData< extrinsicMeshData::well::gravityCoefficient >();
 
-      forAll< serialPolicy >( perforationData.size(), [=]( localIndex const iperf )
+      forAll< parallelDevicePolicy<> >( perforationData.size(), [=]( localIndex const iperf )
       {
         // precompute the depth of the perforations
         perfGravCoef[iperf] = LvArray::tensorOps::AiBi< 3 >( perfLocation[iperf], gravVector );
       } );
 
-      forAll< serialPolicy >( subRegion.size(), [=]( localIndex const iwelem )
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=]( localIndex const iwelem )
       {
         // precompute the depth of the well elements
         wellElemGravCoef[iwelem] = LvArray::tensorOps::AiBi< 3 >( wellElemLocation[iwelem], gravVector );
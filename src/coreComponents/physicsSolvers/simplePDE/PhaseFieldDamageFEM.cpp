@@ -278,6 +278,10 @@ void PhaseFieldDamageFEM::assembleSystem( real64 const GEOSX_UNUSED_PARAM( time_
 
           arrayView4d< real64 const > const &
           dNdX = elementSubRegion.dNdX();
+          GEOSX_THROW_IF( dNdX.size( 2 ) != elementSubRegion.numNodesPerElement(),
+                          getName() << ": this assembly reads the stored shape function derivatives, "
+                                       "available with geometricFactors=\"full\" only",
+                          InputError );
 
           arrayView2d< real64 const > const &
           detJ = elementSubRegion.detJ();
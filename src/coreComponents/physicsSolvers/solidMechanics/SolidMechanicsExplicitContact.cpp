@@ -0,0 +1,498 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsExplicitContact.cpp
+ */
+
+#include "SolidMechanicsExplicitContact.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/TimingMacros.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "LvArray/src/tensorOps.hpp"
+
+namespace geosx
+{
+
+namespace
+{
+
+/// Offset making the integer coordinates of the cells positive in the keys of the spatial hash
+constexpr globalIndex cellCoordinateOffset = globalIndex( 1 ) << 20;
+
+}
+
+void SolidMechanicsExplicitContact::initialize( std::vector< MeshLevel const * > const & meshLevels,
+                                                real64 const penaltyStiffness,
+                                                real64 const cellSize )
+{
+  GEOSX_MARK_FUNCTION;
+
+  m_penaltyStiffness = penaltyStiffness;
+
+  std::vector< localIndex > surfaceNodes;
+  std::vector< std::vector< localIndex > > faceToNodes;
+  std::vector< std::array< real64, 3 > > elementCenters;
+
+  m_meshNodeOffsets.resize( LvArray::integerConversion< localIndex >( meshLevels.size() ) + 1 );
+  m_meshNodeOffsets[0] = 0;
+
+  for( std::size_t meshIndex = 0; meshIndex < meshLevels.size(); ++meshIndex )
+  {
+    MeshLevel const & mesh = *meshLevels[ meshIndex ];
+    FaceManager const & faceManager = mesh.getFaceManager();
+    ElementRegionManager const & elemManager = mesh.getElemManager();
+
+    arrayView1d< integer const > const isDomainBoundary = faceManager.getDomainBoundaryIndicator();
+    ArrayOfArraysView< localIndex const > const faceNodes = faceManager.nodeList().toViewConst();
+    arrayView2d< localIndex const > const elemRegionList = faceManager.elementRegionList();
+    arrayView2d< localIndex const > const elemSubRegionList = faceManager.elementSubRegionList();
+    arrayView2d< localIndex const > const elemList = faceManager.elementList();
+
+    // surface index of the nodes of the mesh, -1 for the nodes inside the mesh
+    array1d< localIndex > surfaceIndex( mesh.getNodeManager().size() );
+    surfaceIndex.setValues< serialPolicy >( -1 );
+
+    for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+    {
+      if( isDomainBoundary[kf] != 1 || elemRegionList( kf, 0 ) < 0 )
+      {
+        continue;
+      }
+
+      std::vector< localIndex > nodes;
+      for( localIndex const a : faceNodes[kf] )
+      {
+        if( surfaceIndex[a] < 0 )
+        {
+          surfaceIndex[a] = LvArray::integerConversion< localIndex >( surfaceNodes.size() );
+          surfaceNodes.emplace_back( a );
+        }
+        nodes.emplace_back( surfaceIndex[a] );
+      }
+      faceToNodes.emplace_back( std::move( nodes ) );
+
+      ElementSubRegionBase const & subRegion =
+        elemManager.getRegion( elemRegionList( kf, 0 ) ).getSubRegion( elemSubRegionList( kf, 0 ) );
+      arraySlice1d< real64 const > const elementCenter = subRegion.getElementCenter()[ elemList( kf, 0 ) ];
+      elementCenters.push_back( { elementCenter[0], elementCenter[1], elementCenter[2] } );
+    }
+
+    m_meshNodeOffsets[ meshIndex + 1 ] = LvArray::integerConversion< localIndex >( surfaceNodes.size() );
+  }
+
+  localIndex const numNodes = LvArray::integerConversion< localIndex >( surfaceNodes.size() );
+  localIndex const numFaces = LvArray::integerConversion< localIndex >( faceToNodes.size() );
+
+  m_surfaceNodes.resize( numNodes );
+  std::copy( surfaceNodes.begin(), surfaceNodes.end(), m_surfaceNodes.begin() );
+  m_positions.resize( numNodes, 3 );
+  m_forces.resize( numNodes, 3 );
+
+  std::vector< localIndex > faceCounts( numFaces );
+  std::vector< localIndex > nodeCounts( numNodes, 0 );
+  for( localIndex kf = 0; kf < numFaces; ++kf )
+  {
+    faceCounts[kf] = LvArray::integerConversion< localIndex >( faceToNodes[kf].size() );
+    for( localIndex const a : faceToNodes[kf] )
+    {
+      ++nodeCounts[a];
+    }
+  }
+  m_faceToNodes.resizeFromCapacities< serialPolicy >( numFaces, faceCounts.data() );
+  m_nodeToFaces.resizeFromCapacities< serialPolicy >( numNodes, nodeCounts.data() );
+  for( localIndex kf = 0; kf < numFaces; ++kf )
+  {
+    for( localIndex const a : faceToNodes[kf] )
+    {
+      m_faceToNodes.emplaceBack( kf, a );
+      m_nodeToFaces.emplaceBack( a, kf );
+    }
+  }
+
+  for( std::size_t meshIndex = 0; meshIndex < meshLevels.size(); ++meshIndex )
+  {
+    updatePositions( LvArray::integerConversion< localIndex >( meshIndex ), *meshLevels[ meshIndex ] );
+  }
+
+  // the node ordering of a face is kept as the mesh deforms, so the orientation is only computed once
+  m_faceOrientation.resize( numFaces );
+  m_faceCenters.resize( numFaces, 3 );
+  m_faceNormals.resize( numFaces, 3 );
+  real64 minEdgeLength = LvArray::NumericLimits< real64 >::max;
+  real64 maxFaceExtent = 0.0;
+  for( localIndex kf = 0; kf < numFaces; ++kf )
+  {
+    real64 center[3], normal[3];
+    faceGeometry( kf, center, normal );
+    real64 outwards = 0.0;
+    for( int j = 0; j < 3; ++j )
+    {
+      outwards += ( center[j] - elementCenters[kf][j] ) * normal[j];
+    }
+    m_faceOrientation[kf] = outwards < 0.0 ? -1.0 : 1.0;
+
+    real64 boxMin[3], boxMax[3];
+    faceBoundingBox( kf, boxMin, boxMax );
+    for( int j = 0; j < 3; ++j )
+    {
+      maxFaceExtent = fmax( maxFaceExtent, boxMax[j] - boxMin[j] );
+    }
+
+    localIndex const numFaceNodes = m_faceToNodes.sizeOfArray( kf );
+    for( localIndex i = 0; i < numFaceNodes; ++i )
+    {
+      real64 edge[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_positions[ m_faceToNodes( kf, ( i + 1 ) % numFaceNodes ) ] );
+      LvArray::tensorOps::subtract< 3 >( edge, m_positions[ m_faceToNodes( kf, i ) ] );
+      minEdgeLength = fmin( minEdgeLength, LvArray::tensorOps::l2Norm< 3 >( edge ) );
+    }
+  }
+
+  // the same search parameters on all the ranks, so that a contact pair gets the same force everywhere
+  minEdgeLength = MpiWrapper::min( minEdgeLength );
+  maxFaceExtent = MpiWrapper::max( maxFaceExtent );
+
+  m_detectionDepth = 0.5 * minEdgeLength;
+  m_cellSize = cellSize > 0.0 ? cellSize : 2.0 * maxFaceExtent;
+  m_margin = 0.25 * m_cellSize;
+
+  m_faceBoxes.resize( numFaces, 6 );
+  m_cells.clear();
+  for( localIndex kf = 0; kf < numFaces; ++kf )
+  {
+    insertFace( kf );
+  }
+  m_numFaceUpdates = 0;
+}
+
+void SolidMechanicsExplicitContact::updatePositions( localIndex const meshIndex,
+                                                     MeshLevel const & mesh )
+{
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const u = nodeManager.totalDisplacement();
+  arrayView1d< localIndex const > const surfaceNodes = m_surfaceNodes.toViewConst();
+  arrayView2d< real64 > const positions = m_positions.toView();
+
+  localIndex const offset = m_meshNodeOffsets[ meshIndex ];
+  forAll< parallelHostPolicy >( m_meshNodeOffsets[ meshIndex + 1 ] - offset, [=]( localIndex const i )
+  {
+    localIndex const a = surfaceNodes[ offset + i ];
+    for( int j = 0; j < 3; ++j )
+    {
+      positions( offset + i, j ) = X( a, j ) + u( a, j );
+    }
+  } );
+}
+
+localIndex SolidMechanicsExplicitContact::computeForces()
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numNodes = m_positions.size( 0 );
+  localIndex const numFaces = m_faceToNodes.size();
+
+  {
+    GEOSX_MARK_SCOPE( broadPhase );
+    updateSpatialHash();
+  }
+
+  GEOSX_MARK_SCOPE( narrowPhase );
+
+  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const kf )
+  {
+    real64 center[3], normal[3];
+    faceGeometry( kf, center, normal );
+    LvArray::tensorOps::scale< 3 >( normal, m_faceOrientation[kf] );
+    LvArray::tensorOps::copy< 3 >( m_faceCenters[kf], center );
+    LvArray::tensorOps::copy< 3 >( m_faceNormals[kf], normal );
+  } );
+
+  // closest penetrated face of each node, and the force pushing the node out of it
+  array1d< localIndex > contactFace( numNodes );
+  array2d< real64 > contactForce( numNodes, 3 );
+
+  forAll< parallelHostPolicy >( numNodes, [&]( localIndex const a )
+  {
+    contactFace[a] = -1;
+
+    real64 const position[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_positions[a] );
+    real64 maxPenetration = m_detectionDepth;
+    for( localIndex const kf : candidateFaces( position ) )
+    {
+      if( std::find( m_nodeToFaces[a].begin(), m_nodeToFaces[a].end(), kf ) != m_nodeToFaces[a].end() )
+      {
+        continue;
+      }
+
+      real64 gap[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_positions[a] );
+      LvArray::tensorOps::subtract< 3 >( gap, m_faceCenters[kf] );
+      real64 const penetration = -LvArray::tensorOps::AiBi< 3 >( gap, m_faceNormals[kf] );
+      if( penetration <= 0.0 || penetration >= maxPenetration )
+      {
+        continue;
+      }
+
+      // the projection of the node on the plane of the face must lie inside the face
+      real64 projection[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_positions[a] );
+      LvArray::tensorOps::scaledAdd< 3 >( projection, m_faceNormals[kf], penetration );
+
+      bool isInside = true;
+      localIndex const numFaceNodes = m_faceToNodes.sizeOfArray( kf );
+      for( localIndex i = 0; i < numFaceNodes && isInside; ++i )
+      {
+        arraySlice1d< real64 const > const x0 = m_positions[ m_faceToNodes( kf, i ) ];
+        real64 edge[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_positions[ m_faceToNodes( kf, ( i + 1 ) % numFaceNodes ) ] );
+        LvArray::tensorOps::subtract< 3 >( edge, x0 );
+        real64 toProjection[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( projection );
+        LvArray::tensorOps::subtract< 3 >( toProjection, x0 );
+        real64 side[3];
+        LvArray::tensorOps::crossProduct( side, edge, toProjection );
+        isInside = m_faceOrientation[kf] * LvArray::tensorOps::AiBi< 3 >( side, m_faceNormals[kf] ) >= 0.0;
+      }
+
+      if( isInside )
+      {
+        maxPenetration = penetration;
+        contactFace[a] = kf;
+        LvArray::tensorOps::scaledCopy< 3 >( contactForce[a], m_faceNormals[kf], m_penaltyStiffness * penetration );
+      }
+    }
+  } );
+
+  // the reactions on the face nodes are gathered serially, several nodes may push on the same face
+  m_forces.zero();
+  localIndex numContacts = 0;
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    localIndex const kf = contactFace[a];
+    if( kf < 0 )
+    {
+      continue;
+    }
+    ++numContacts;
+    LvArray::tensorOps::add< 3 >( m_forces[a], contactForce[a] );
+    real64 const weight = -1.0 / m_faceToNodes.sizeOfArray( kf );
+    for( localIndex const b : m_faceToNodes[kf] )
+    {
+      LvArray::tensorOps::scaledAdd< 3 >( m_forces[b], contactForce[a], weight );
+    }
+  }
+  return numContacts;
+}
+
+template< typename NODAL_REAL >
+void SolidMechanicsExplicitContact::addForces( localIndex const meshIndex,
+                                               MeshLevel const & mesh,
+                                               arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const & force ) const
+{
+  arrayView1d< integer const > const ghostRank = mesh.getNodeManager().ghostRank();
+  arrayView1d< localIndex const > const surfaceNodes = m_surfaceNodes.toViewConst();
+  arrayView2d< real64 const > const forces = m_forces.toViewConst();
+
+  localIndex const offset = m_meshNodeOffsets[ meshIndex ];
+  forAll< parallelHostPolicy >( m_meshNodeOffsets[ meshIndex + 1 ] - offset, [=]( localIndex const i )
+  {
+    localIndex const a = surfaceNodes[ offset + i ];
+    if( ghostRank[a] < 0 )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        force( a, j ) += static_cast< NODAL_REAL >( forces( offset + i, j ) );
+      }
+    }
+  } );
+}
+
+template void SolidMechanicsExplicitContact::addForces< real32 >( localIndex const,
+                                                                  MeshLevel const &,
+                                                                  arrayView2d< real32, nodes::ACCELERATION_USD > const & ) const;
+template void SolidMechanicsExplicitContact::addForces< real64 >( localIndex const,
+                                                                  MeshLevel const &,
+                                                                  arrayView2d< real64, nodes::ACCELERATION_USD > const & ) const;
+
+real64 SolidMechanicsExplicitContact::faceGeometry( localIndex const face,
+                                                    real64 ( & center )[3],
+                                                    real64 ( & normal )[3] ) const
+{
+  localIndex const numFaceNodes = m_faceToNodes.sizeOfArray( face );
+
+  LvArray::tensorOps::fill< 3 >( center, 0.0 );
+  for( localIndex const a : m_faceToNodes[face] )
+  {
+    LvArray::tensorOps::add< 3 >( center, m_positions[a] );
+  }
+  LvArray::tensorOps::scale< 3 >( center, 1.0 / numFaceNodes );
+
+  // sum of the area vectors of the triangles joining the center to the edges
+  LvArray::tensorOps::fill< 3 >( normal, 0.0 );
+  for( localIndex i = 0; i < numFaceNodes; ++i )
+  {
+    real64 x0[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_positions[ m_faceToNodes( face, i ) ] );
+    real64 x1[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_positions[ m_faceToNodes( face, ( i + 1 ) % numFaceNodes ) ] );
+    LvArray::tensorOps::subtract< 3 >( x0, center );
+    LvArray::tensorOps::subtract< 3 >( x1, center );
+    real64 triangleNormal[3];
+    LvArray::tensorOps::crossProduct( triangleNormal, x0, x1 );
+    LvArray::tensorOps::scaledAdd< 3 >( normal, triangleNormal, 0.5 );
+  }
+
+  real64 const area = LvArray::tensorOps::l2Norm< 3 >( normal );
+  if( area > 0.0 )
+  {
+    LvArray::tensorOps::scale< 3 >( normal, 1.0 / area );
+  }
+  return area;
+}
+
+void SolidMechanicsExplicitContact::faceBoundingBox( localIndex const face,
+                                                     real64 ( & boxMin )[3],
+                                                     real64 ( & boxMax )[3] ) const
+{
+  LvArray::tensorOps::fill< 3 >( boxMin, LvArray::NumericLimits< real64 >::max );
+  LvArray::tensorOps::fill< 3 >( boxMax, LvArray::NumericLimits< real64 >::min );
+  for( localIndex const a : m_faceToNodes[face] )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      boxMin[j] = fmin( boxMin[j], m_positions( a, j ) );
+      boxMax[j] = fmax( boxMax[j], m_positions( a, j ) );
+    }
+  }
+}
+
+void SolidMechanicsExplicitContact::insertFace( localIndex const face )
+{
+  real64 boxMin[3], boxMax[3];
+  faceBoundingBox( face, boxMin, boxMax );
+  LvArray::tensorOps::addScalar< 3 >( boxMin, -( m_detectionDepth + m_margin ) );
+  LvArray::tensorOps::addScalar< 3 >( boxMax, m_detectionDepth + m_margin );
+
+  integer cellMin[3], cellMax[3];
+  for( int j = 0; j < 3; ++j )
+  {
+    m_faceBoxes( face, j ) = boxMin[j];
+    m_faceBoxes( face, j + 3 ) = boxMax[j];
+    cellMin[j] = cellCoordinate( boxMin[j] );
+    cellMax[j] = cellCoordinate( boxMax[j] );
+  }
+
+  integer cell[3];
+  for( cell[0] = cellMin[0]; cell[0] <= cellMax[0]; ++cell[0] )
+  {
+    for( cell[1] = cellMin[1]; cell[1] <= cellMax[1]; ++cell[1] )
+    {
+      for( cell[2] = cellMin[2]; cell[2] <= cellMax[2]; ++cell[2] )
+      {
+        m_cells[ cellKey( cell ) ].emplace_back( face );
+      }
+    }
+  }
+}
+
+void SolidMechanicsExplicitContact::removeFace( localIndex const face )
+{
+  integer cellMin[3], cellMax[3];
+  for( int j = 0; j < 3; ++j )
+  {
+    cellMin[j] = cellCoordinate( m_faceBoxes( face, j ) );
+    cellMax[j] = cellCoordinate( m_faceBoxes( face, j + 3 ) );
+  }
+
+  integer cell[3];
+  for( cell[0] = cellMin[0]; cell[0] <= cellMax[0]; ++cell[0] )
+  {
+    for( cell[1] = cellMin[1]; cell[1] <= cellMax[1]; ++cell[1] )
+    {
+      for( cell[2] = cellMin[2]; cell[2] <= cellMax[2]; ++cell[2] )
+      {
+        auto const entry = m_cells.find( cellKey( cell ) );
+        GEOSX_ASSERT( entry != m_cells.end() );
+        std::vector< localIndex > & faces = entry->second;
+        auto const position = std::find( faces.begin(), faces.end(), face );
+        GEOSX_ASSERT( position != faces.end() );
+        *position = faces.back();
+        faces.pop_back();
+        if( faces.empty() )
+        {
+          m_cells.erase( entry );
+        }
+      }
+    }
+  }
+}
+
+void SolidMechanicsExplicitContact::updateSpatialHash()
+{
+  localIndex const numFaces = m_faceToNodes.size();
+
+  // the faces whose box, enlarged by the detection depth, is no longer inside the registered one
+  array1d< integer > hasMoved( numFaces );
+  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const kf )
+  {
+    real64 boxMin[3], boxMax[3];
+    faceBoundingBox( kf, boxMin, boxMax );
+    hasMoved[kf] = 0;
+    for( int j = 0; j < 3; ++j )
+    {
+      if( boxMin[j] - m_detectionDepth < m_faceBoxes( kf, j ) ||
+          boxMax[j] + m_detectionDepth > m_faceBoxes( kf, j + 3 ) )
+      {
+        hasMoved[kf] = 1;
+      }
+    }
+  } );
+
+  for( localIndex kf = 0; kf < numFaces; ++kf )
+  {
+    if( hasMoved[kf] )
+    {
+      removeFace( kf );
+      insertFace( kf );
+      ++m_numFaceUpdates;
+    }
+  }
+}
+
+std::vector< localIndex > const & SolidMechanicsExplicitContact::candidateFaces( real64 const ( &position )[3] ) const
+{
+  static std::vector< localIndex > const noFaces;
+
+  integer cell[3];
+  for( int j = 0; j < 3; ++j )
+  {
+    cell[j] = cellCoordinate( position[j] );
+  }
+  auto const candidates = m_cells.find( cellKey( cell ) );
+  return candidates == m_cells.end() ? noFaces : candidates->second;
+}
+
+globalIndex SolidMechanicsExplicitContact::cellKey( integer const ( &cell )[3] )
+{
+  GEOSX_ASSERT( LvArray::math::abs( cell[0] ) < cellCoordinateOffset );
+  GEOSX_ASSERT( LvArray::math::abs( cell[1] ) < cellCoordinateOffset );
+  GEOSX_ASSERT( LvArray::math::abs( cell[2] ) < cellCoordinateOffset );
+  return ( ( cell[0] + cellCoordinateOffset ) << 42 ) |
+         ( ( cell[1] + cellCoordinateOffset ) << 21 ) |
+         ( cell[2] + cellCoordinateOffset );
+}
+
+integer SolidMechanicsExplicitContact::cellCoordinate( real64 const x ) const
+{
+  return LvArray::integerConversion< integer >( static_cast< globalIndex >( std::floor( x / m_cellSize ) ) );
+}
+
+} // namespace geosx
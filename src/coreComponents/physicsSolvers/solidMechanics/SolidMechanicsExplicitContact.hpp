@@ -0,0 +1,215 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsExplicitContact.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEXPLICITCONTACT_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEXPLICITCONTACT_HPP_
+
+#include "common/DataLayouts.hpp"
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class MeshLevel;
+
+/**
+ * @class SolidMechanicsExplicitContact
+ *
+ * Penalty contact between the boundary faces of the meshes of an explicit solid dynamics solver.
+ *
+ * A surface node lying behind a boundary face, closer to its plane than half of the smallest
+ * boundary edge, is pushed back along the normal of the face by a force proportional to the
+ * penetration, and the opposite force is spread evenly over the nodes of the face. Only the
+ * closest of the penetrated faces is kept for each node.
+ *
+ * The broad phase is a spatial hash over a uniform grid: each boundary face is registered in the
+ * cells covered by its bounding box, enlarged by the detection depth and a margin, so that a node
+ * only has to look for faces in the cell it lies in. As the nodes move, a face is registered
+ * again only when its bounding box leaves the enlarged one, so the hash is updated incrementally.
+ *
+ * The search is done on the host, on the local and ghost boundary faces, and the forces are only
+ * added to the locally owned nodes; the ghost values are then overwritten by the synchronization
+ * of the explicit step. The solver deepens the ghost layers so that they cover a cell of the hash.
+ */
+class SolidMechanicsExplicitContact
+{
+public:
+
+  /**
+   * @brief Collect the boundary faces and nodes of the meshes, and build the spatial hash.
+   * @param meshLevels the mesh levels of the solver, in the order used by the other functions
+   * @param penaltyStiffness the penalty stiffness, in N/m
+   * @param cellSize the size of the cells of the spatial hash, or 0 to use twice the largest boundary face
+   */
+  void initialize( std::vector< MeshLevel const * > const & meshLevels,
+                   real64 const penaltyStiffness,
+                   real64 const cellSize );
+
+  /**
+   * @brief Gather the current positions of the surface nodes of a mesh.
+   * @param meshIndex the index of the mesh in the list given to initialize
+   * @param mesh the mesh level
+   */
+  void updatePositions( localIndex const meshIndex,
+                        MeshLevel const & mesh );
+
+  /**
+   * @brief Update the spatial hash and compute the contact forces at the current positions.
+   * @return the number of nodes in contact
+   */
+  localIndex computeForces();
+
+  /**
+   * @brief Add the contact forces to the locally owned nodes of a mesh.
+   * @tparam NODAL_REAL the floating point type of the nodal forces
+   * @param meshIndex the index of the mesh in the list given to initialize
+   * @param mesh the mesh level
+   * @param force the nodal forces the contact forces are added to
+   */
+  template< typename NODAL_REAL >
+  void addForces( localIndex const meshIndex,
+                  MeshLevel const & mesh,
+                  arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const & force ) const;
+
+  /**
+   * @return the size of the cells of the spatial hash
+   */
+  real64 cellSize() const { return m_cellSize; }
+
+  /**
+   * @return the number of local and ghost boundary faces
+   */
+  localIndex numFaces() const { return m_faceToNodes.size(); }
+
+  /**
+   * @return the number of faces registered again in the spatial hash since initialize
+   */
+  localIndex numFaceUpdates() const { return m_numFaceUpdates; }
+
+protected:
+
+  /**
+   * @brief Compute the current center and the unit normal of a boundary face.
+   * @param face the boundary face
+   * @param center the center of the face
+   * @param normal the unit normal, in the order of the nodes of the face
+   * @return the area of the face
+   */
+  real64 faceGeometry( localIndex const face,
+                       real64 ( &center )[3],
+                       real64 ( &normal )[3] ) const;
+
+  /**
+   * @brief Compute the current bounding box of a boundary face.
+   * @param face the boundary face
+   * @param boxMin the lower corner of the box
+   * @param boxMax the upper corner of the box
+   */
+  void faceBoundingBox( localIndex const face,
+                        real64 ( &boxMin )[3],
+                        real64 ( &boxMax )[3] ) const;
+
+  /**
+   * @brief Register a face in the cells covered by its enlarged bounding box.
+   * @param face the boundary face
+   */
+  void insertFace( localIndex const face );
+
+  /**
+   * @brief Remove a face from the cells it was registered in.
+   * @param face the boundary face
+   */
+  void removeFace( localIndex const face );
+
+  /**
+   * @brief Register again the faces whose bounding box has left the registered one.
+   */
+  void updateSpatialHash();
+
+  /**
+   * @param position a point
+   * @return the faces registered in the cell of the spatial hash containing the point
+   */
+  std::vector< localIndex > const & candidateFaces( real64 const ( &position )[3] ) const;
+
+private:
+
+  /**
+   * @param cell the integer coordinates of a cell
+   * @return the key of the cell in the spatial hash
+   */
+  static globalIndex cellKey( integer const ( &cell )[3] );
+
+  /**
+   * @param x a coordinate
+   * @return the integer coordinate of the cell containing x
+   */
+  integer cellCoordinate( real64 const x ) const;
+
+  /// The penalty stiffness
+  real64 m_penaltyStiffness = 0.0;
+
+  /// The size of the cells of the spatial hash
+  real64 m_cellSize = 0.0;
+
+  /// The largest distance behind a face at which a node is considered in contact
+  real64 m_detectionDepth = 0.0;
+
+  /// The margin added to the bounding boxes registered in the spatial hash
+  real64 m_margin = 0.0;
+
+  /// Offsets of the surface nodes of each mesh in the surface node numbering
+  array1d< localIndex > m_meshNodeOffsets;
+
+  /// Index of the surface nodes in their mesh
+  array1d< localIndex > m_surfaceNodes;
+
+  /// Current positions of the surface nodes
+  array2d< real64 > m_positions;
+
+  /// Contact forces on the surface nodes
+  array2d< real64 > m_forces;
+
+  /// Boundary faces of the surface nodes
+  ArrayOfArrays< localIndex > m_nodeToFaces;
+
+  /// Surface nodes of the boundary faces
+  ArrayOfArrays< localIndex > m_faceToNodes;
+
+  /// Sign turning the normal of the boundary faces outwards
+  array1d< real64 > m_faceOrientation;
+
+  /// Current centers of the boundary faces
+  array2d< real64 > m_faceCenters;
+
+  /// Current outward unit normals of the boundary faces
+  array2d< real64 > m_faceNormals;
+
+  /// Enlarged bounding boxes the boundary faces are registered with, lower corner then upper corner
+  array2d< real64 > m_faceBoxes;
+
+  /// The spatial hash, giving the faces registered in each cell
+  unordered_map< globalIndex, std::vector< localIndex > > m_cells;
+
+  /// The number of faces registered again since initialize
+  localIndex m_numFaceUpdates = 0;
+};
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEXPLICITCONTACT_HPP_
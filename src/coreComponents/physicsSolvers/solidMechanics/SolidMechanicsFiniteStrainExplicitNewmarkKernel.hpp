@@ -46,16 +46,19 @@ namespace solidMechanicsLagrangianFEMKernels
  */
 template< typename SUBREGION_TYPE,
           typename CONSTITUTIVE_TYPE,
-          typename FE_TYPE >
+          typename FE_TYPE,
+          typename NODAL_REAL >
 class ExplicitFiniteStrain : public ExplicitSmallStrain< SUBREGION_TYPE,
                                                          CONSTITUTIVE_TYPE,
-                                                         FE_TYPE >
+                                                         FE_TYPE,
+                                                         NODAL_REAL >
 {
 public:
   /// Alias for the base class;
   using Base = ExplicitSmallStrain< SUBREGION_TYPE,
                                     CONSTITUTIVE_TYPE,
-                                    FE_TYPE >;
+                                    FE_TYPE,
+                                    NODAL_REAL >;
 
   using Base::numNodesPerElem;
   using Base::numDofPerTestSupportPoint;
@@ -84,7 +87,8 @@ public:
                         FE_TYPE const & finiteElementSpace,
                         CONSTITUTIVE_TYPE & inputConstitutiveType,
                         real64 const dt,
-                        string const elementListName ):
+                        string const elementListName,
+                        string const elementColorsName ):
     Base( nodeManager,
           edgeManager,
           faceManager,
@@ -93,7 +97,8 @@ public:
           finiteElementSpace,
           inputConstitutiveType,
           dt,
-          elementListName )
+          elementListName,
+          elementColorsName )
   {}
 
 
@@ -199,11 +204,30 @@ public:
 };
 #undef UPDATE_STRESS
 
+/// ExplicitFiniteStrain with the nodal velocity and acceleration in double precision.
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+using ExplicitFiniteStrainDouble = ExplicitFiniteStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, real64 >;
+
+/// ExplicitFiniteStrain with the nodal velocity and acceleration in single precision.
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+using ExplicitFiniteStrainMixed = ExplicitFiniteStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, real32 >;
+
 /// The factory used to construct a ExplicitFiniteStrain kernel.
-using ExplicitFiniteStrainFactory = finiteElement::KernelFactory< ExplicitFiniteStrain,
+using ExplicitFiniteStrainFactory = finiteElement::KernelFactory< ExplicitFiniteStrainDouble,
                                                                   real64,
+                                                                  string const,
                                                                   string const >;
 
+/// The factory used to construct a mixed precision ExplicitFiniteStrain kernel.
+using ExplicitFiniteStrainMixedFactory = finiteElement::KernelFactory< ExplicitFiniteStrainMixed,
+                                                                       real64,
+                                                                       string const,
+                                                                       string const >;
+
 } // namespace solidMechanicsLagrangianFEMKernels
 
 } // namespace geosx
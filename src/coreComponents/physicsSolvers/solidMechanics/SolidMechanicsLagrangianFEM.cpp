@@ -21,13 +21,19 @@
 #include "SolidMechanicsSmallStrainImplicitNewmarkKernel.hpp"
 #include "SolidMechanicsSmallStrainExplicitNewmarkKernel.hpp"
 #include "SolidMechanicsFiniteStrainExplicitNewmarkKernel.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernel.hpp"
+#include "SolidMechanicsMatrixFreeOperator.hpp"
 
 #include "codingUtilities/Utilities.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/ConstitutivePassThru.hpp"
 #include "constitutive/contact/ContactBase.hpp"
+#include "constitutive/solid/ElasticIsotropic.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
 #include "finiteElement/Kinematics.h"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerChebyshev.hpp"
 #include "LvArray/src/output.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "mainInterface/ProblemManager.hpp"
@@ -36,8 +42,10 @@
 #include "fieldSpecification/TractionBoundaryCondition.hpp"
 #include "mesh/FaceElementSubRegion.hpp"
 #include "mesh/utilities/ComputationalGeometry.hpp"
+#include "mesh/utilities/MeshMapUtilities.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "mesh/mpiCommunications/NeighborCommunicator.hpp"
+#include "physicsSolvers/LocalTimeSteppingUtilities.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
 
 
@@ -55,6 +63,13 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
   m_massDamping( 0.0 ),
   m_stiffnessDamping( 0.0 ),
   m_timeIntegrationOption( TimeIntegrationOption::ExplicitDynamic ),
+  m_explicitAssemblyOption( ExplicitAssemblyOption::Atomics ),
+  m_explicitPrecisionOption( ExplicitPrecisionOption::Double ),
+  m_explicitConstitutiveUpdateOption( ExplicitConstitutiveUpdateOption::PointWise ),
+  m_explicitContactPenalty( 0.0 ),
+  m_explicitContactCellSize( 0.0 ),
+  m_matrixFree( 0 ),
+  m_chebyshevDegree( 3 ),
   m_useVelocityEstimateForQS( 0 ),
   m_maxForce( 0.0 ),
   m_maxNumResolves( 10 ),
@@ -88,6 +103,55 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
     setApplyDefaultValue( m_timeIntegrationOption ).
     setDescription( "Time integration method. Options are:\n* " + EnumStrings< TimeIntegrationOption >::concat( "\n* " ) );
 
+  registerWrapper( viewKeyStruct::explicitAssemblyOptionString(), &m_explicitAssemblyOption ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_explicitAssemblyOption ).
+    setDescription( "Method used to add the element forces to the nodes in explicit dynamics. "
+                    "Coloring launches the elements sharing no node together to avoid atomic additions. Options are:\n* " +
+                    EnumStrings< ExplicitAssemblyOption >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::explicitPrecisionOptionString(), &m_explicitPrecisionOption ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_explicitPrecisionOption ).
+    setDescription( "Floating point precision of the nodal velocity and acceleration in explicit dynamics. "
+                    "Mixed stores them in single precision, while the displacements are still accumulated "
+                    "in double precision. Options are:\n* " +
+                    EnumStrings< ExplicitPrecisionOption >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::explicitConstitutiveUpdateOptionString(), &m_explicitConstitutiveUpdateOption ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_explicitConstitutiveUpdateOption ).
+    setDescription( "Granularity of the constitutive updates of the small strain kernel in explicit dynamics. "
+                    "Batched updates the quadrature points of an element as one tile, which the solid models "
+                    "may vectorize. Options are:\n* " +
+                    EnumStrings< ExplicitConstitutiveUpdateOption >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::explicitContactPenaltyString(), &m_explicitContactPenalty ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Penalty stiffness (in N/m) of the contact between the boundary faces of the target meshes in explicit "
+                    "dynamics. A node penetrating a boundary face is pushed back by the penalty times the penetration. "
+                    "Contact is not searched if the penalty is zero." );
+
+  registerWrapper( viewKeyStruct::explicitContactCellSizeString(), &m_explicitContactCellSize ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Size of the cells of the spatial hash used to search the contacts in explicit dynamics. "
+                    "If zero, twice the largest boundary face is used." );
+
+  registerWrapper( viewKeyStruct::matrixFreeString(), &m_matrixFree ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to apply the quasi-static jacobian element by element in the Krylov iterations instead of "
+                    "assembling the global sparse matrix. Only the diagonal and the constitutive tangent at the quadrature "
+                    "points are stored, and the system is preconditioned with a Chebyshev polynomial of the Jacobi-scaled jacobian." );
+
+  registerWrapper( viewKeyStruct::chebyshevDegreeString(), &m_chebyshevDegree ).
+    setApplyDefaultValue( 3 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Chebyshev iterations of the preconditioner used with " +
+                    string( viewKeyStruct::matrixFreeString() ) + ", each one after the first applying the jacobian once." );
+
   registerWrapper( viewKeyStruct::useVelocityEstimateForQSString(), &m_useVelocityEstimateForQS ).
     setApplyDefaultValue( 0 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -130,6 +194,57 @@ void SolidMechanicsLagrangianFEM::postProcessInput()
   linParams.isSymmetric = true;
   linParams.dofsPerNode = 3;
   linParams.amg.separateComponents = true;
+
+  GEOSX_THROW_IF( m_explicitPrecisionOption != ExplicitPrecisionOption::Double &&
+                  m_timeIntegrationOption != TimeIntegrationOption::ExplicitDynamic,
+                  getName() << ": " << viewKeyStruct::explicitPrecisionOptionString() << " is only available with the " <<
+                  EnumStrings< TimeIntegrationOption >::toString( TimeIntegrationOption::ExplicitDynamic ) << " " <<
+                  viewKeyStruct::timeIntegrationOptionString(),
+                  InputError );
+
+  GEOSX_THROW_IF( m_explicitConstitutiveUpdateOption != ExplicitConstitutiveUpdateOption::PointWise &&
+                  ( m_timeIntegrationOption != TimeIntegrationOption::ExplicitDynamic || m_strainTheory != 0 ),
+                  getName() << ": " << viewKeyStruct::explicitConstitutiveUpdateOptionString() << " is only available with the " <<
+                  EnumStrings< TimeIntegrationOption >::toString( TimeIntegrationOption::ExplicitDynamic ) << " " <<
+                  viewKeyStruct::timeIntegrationOptionString() << " and the small strain theory",
+                  InputError );
+
+  GEOSX_THROW_IF_LT_MSG( m_explicitContactPenalty, 0.0,
+                         getName() << ": " << viewKeyStruct::explicitContactPenaltyString() << " must be non-negative",
+                         InputError );
+  GEOSX_THROW_IF( m_explicitContactPenalty > 0.0 &&
+                  m_timeIntegrationOption != TimeIntegrationOption::ExplicitDynamic,
+                  getName() << ": " << viewKeyStruct::explicitContactPenaltyString() << " is only available with the " <<
+                  EnumStrings< TimeIntegrationOption >::toString( TimeIntegrationOption::ExplicitDynamic ) << " " <<
+                  viewKeyStruct::timeIntegrationOptionString(),
+                  InputError );
+
+  if( m_matrixFree )
+  {
+    GEOSX_THROW_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                    getName() << ": " << viewKeyStruct::matrixFreeString() << " is only available with the " <<
+                    EnumStrings< TimeIntegrationOption >::toString( TimeIntegrationOption::QuasiStatic ) << " " <<
+                    viewKeyStruct::timeIntegrationOptionString(),
+                    InputError );
+    GEOSX_THROW_IF( m_contactRelationName != viewKeyStruct::noContactRelationNameString(),
+                    getName() << ": " << viewKeyStruct::matrixFreeString() << " cannot be used with a " <<
+                    viewKeyStruct::contactRelationNameString(),
+                    InputError );
+    GEOSX_THROW_IF( linParams.solverType != LinearSolverParameters::SolverType::cg &&
+                    linParams.solverType != LinearSolverParameters::SolverType::gmres &&
+                    linParams.solverType != LinearSolverParameters::SolverType::bicgstab,
+                    getName() << ": " << viewKeyStruct::matrixFreeString() << " requires a cg, gmres or bicgstab linear solver",
+                    InputError );
+    GEOSX_THROW_IF_LT_MSG( m_chebyshevDegree, 1,
+                           getName() << ": " << viewKeyStruct::chebyshevDegreeString() << " must be positive",
+                           InputError );
+    bool const preconditionerRead =
+      m_linearSolverParameters.getWrapperBase( LinearSolverParametersInput::viewKeyStruct::preconditionerTypeString() ).getSuccessfulReadFromInput();
+    GEOSX_THROW_IF( preconditionerRead && linParams.preconditionerType != LinearSolverParameters::PreconditionerType::chebyshev,
+                    getName() << ": " << viewKeyStruct::matrixFreeString() << " uses a Jacobi-scaled Chebyshev preconditioner of degree " <<
+                    viewKeyStruct::chebyshevDegreeString() << ", the preconditionerType of the linear solver must be chebyshev or omitted",
+                    InputError );
+  }
 }
 
 SolidMechanicsLagrangianFEM::~SolidMechanicsLagrangianFEM()
@@ -160,18 +275,32 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
       setDescription( "An array that holds the incremental displacements for the current time step on the nodes." ).
       reference().resizeDimension< 1 >( 3 );
 
-    nodes.registerWrapper< array2d< real64, nodes::VELOCITY_PERM > >( keys::Velocity ).
-      setPlotLevel( PlotLevel::LEVEL_0 ).
-      setRegisteringObjects( this->getName()).
-      setDescription( "An array that holds the current velocity on the nodes." ).
-      reference().resizeDimension< 1 >( 3 );
-
-    nodes.registerWrapper< array2d< real64, nodes::ACCELERATION_PERM > >( keys::Acceleration ).
-      setPlotLevel( PlotLevel::LEVEL_1 ).
-      setRegisteringObjects( this->getName()).
-      setDescription( "An array that holds the current acceleration on the nodes. This array also is used "
-                      "to hold the summation of nodal forces resulting from the governing equations." ).
-      reference().resizeDimension< 1 >( 3 );
+    // the velocity and acceleration are stored in single precision in mixed precision explicit dynamics
+    auto registerVelocityAndAcceleration = [&]( auto const nodalReal )
+    {
+      using NODAL_REAL = decltype( nodalReal );
+
+      nodes.registerWrapper< array2d< NODAL_REAL, nodes::VELOCITY_PERM > >( keys::Velocity ).
+        setPlotLevel( PlotLevel::LEVEL_0 ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "An array that holds the current velocity on the nodes." ).
+        reference().resizeDimension< 1 >( 3 );
+
+      nodes.registerWrapper< array2d< NODAL_REAL, nodes::ACCELERATION_PERM > >( keys::Acceleration ).
+        setPlotLevel( PlotLevel::LEVEL_1 ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "An array that holds the current acceleration on the nodes. This array also is used "
+                        "to hold the summation of nodal forces resulting from the governing equations." ).
+        reference().resizeDimension< 1 >( 3 );
+    };
+    if( m_explicitPrecisionOption == ExplicitPrecisionOption::Mixed )
+    {
+      registerVelocityAndAcceleration( real32{} );
+    }
+    else
+    {
+      registerVelocityAndAcceleration( real64{} );
+    }
 
     nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::forceExternalString() ).
       setPlotLevel( PlotLevel::LEVEL_0 ).
@@ -197,6 +326,16 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
       setDescription( "An array that holds the incremental displacement predictors on the nodes." ).
       reference().resizeDimension< 1 >( 3 );
 
+    if( m_matrixFree )
+    {
+      nodes.registerWrapper< array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > >( viewKeyStruct::matrixFreeDirectionString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "An array that holds the vector the matrix-free jacobian is applied to on the nodes." ).
+        reference().resizeDimension< 1 >( 3 );
+    }
+
     nodes.registerWrapper< array2d< real64 > >( viewKeyStruct::contactForceString() ).
       setPlotLevel( PlotLevel::LEVEL_0 ).
       setRegisteringObjects( this->getName()).
@@ -229,8 +368,28 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
         setPlotLevel( PlotLevel::NOPLOT ).
         setRestartFlags( RestartFlags::NO_WRITE );
 
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsAttachedToSendOrReceiveNodesColorsString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE );
+
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesColorsString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE );
+
+      if( m_matrixFree )
+      {
+        subRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::matrixFreeTangentString() ).
+          setPlotLevel( PlotLevel::NOPLOT ).
+          setRestartFlags( RestartFlags::NO_WRITE ).
+          setRegisteringObjects( this->getName()).
+          setDescription( "An array that caches the constitutive tangent at the quadrature points for the matrix-free jacobian." );
+        subRegion.excludeWrappersFromPacking( { viewKeyStruct::matrixFreeTangentString() } );
+      }
+
       subRegion.excludeWrappersFromPacking( { viewKeyStruct::elemsAttachedToSendOrReceiveNodesString(),
-                                              viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() } );
+                                              viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString(),
+                                              viewKeyStruct::elemsAttachedToSendOrReceiveNodesColorsString(),
+                                              viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesColorsString() } );
     } );
   } );
 }
@@ -288,19 +447,49 @@ void SolidMechanicsLagrangianFEM::initializePreSubGroups()
 
 
 
+void SolidMechanicsLagrangianFEM::logKernelThroughput( DomainPartition const & domain,
+                                                       MeshLevel const & mesh,
+                                                       arrayView1d< string const > const & regionNames,
+                                                       string const & kernelName,
+                                                       real64 const kernelTime ) const
+{
+  if( getLogLevel() < 2 )
+  {
+    return;
+  }
+
+  localIndex numElems = 0;
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                      [&]( localIndex const,
+                                                                           CellElementSubRegion const & subRegion )
+  {
+    numElems += subRegion.size();
+  } );
+
+  FiniteElementDiscretization const & feDiscretization =
+    domain.getNumericalMethodManager().getFiniteElementDiscretizationManager().getGroup< FiniteElementDiscretization >( m_discretizationName );
+
+  GEOSX_LOG_RANK_0( GEOSX_FMT( "        {}: {} kernels on rank 0, {} elements in {:4.2e} s, {:4.2e} elements/s with {} geometric factors",
+                               getName(), kernelName, numElems, kernelTime, kernelTime > 0.0 ? numElems / kernelTime : 0.0,
+                               EnumStrings< FiniteElementDiscretization::GeometricFactorsOption >::toString( feDiscretization.getGeometricFactorsOption() ) ) );
+}
+
 template< typename ... PARAMS >
 real64 SolidMechanicsLagrangianFEM::explicitKernelDispatch( MeshLevel & mesh,
                                                             arrayView1d< string const > const & targetRegions,
                                                             string const & finiteElementName,
                                                             real64 const dt,
-                                                            std::string const & elementListName )
+                                                            std::string const & elementListName,
+                                                            std::string const & elementColorsName )
 {
   GEOSX_MARK_FUNCTION;
   real64 rval = 0;
-  if( m_strainTheory==0 )
+  bool const mixedPrecision = m_explicitPrecisionOption == ExplicitPrecisionOption::Mixed;
+  bool const batchedUpdates = m_explicitConstitutiveUpdateOption == ExplicitConstitutiveUpdateOption::Batched;
+
+  auto launch = [&]( auto & kernelFactory )
   {
-    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainFactory( dt, elementListName );
-    rval = finiteElement::
+    return finiteElement::
              regionBasedKernelApplication< parallelDevicePolicy< 32 >,
                                            constitutive::SolidBase,
                                            CellElementSubRegion >( mesh,
@@ -308,18 +497,46 @@ real64 SolidMechanicsLagrangianFEM::explicitKernelDispatch( MeshLevel & mesh,
                                                                    finiteElementName,
                                                                    viewKeyStruct::solidMaterialNamesString(),
                                                                    kernelFactory );
+  };
+
+  if( m_strainTheory==0 && batchedUpdates )
+  {
+    if( mixedPrecision )
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainBatchedMixedFactory( dt, elementListName, elementColorsName );
+      rval = launch( kernelFactory );
+    }
+    else
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainBatchedFactory( dt, elementListName, elementColorsName );
+      rval = launch( kernelFactory );
+    }
+  }
+  else if( m_strainTheory==0 )
+  {
+    if( mixedPrecision )
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainMixedFactory( dt, elementListName, elementColorsName );
+      rval = launch( kernelFactory );
+    }
+    else
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainFactory( dt, elementListName, elementColorsName );
+      rval = launch( kernelFactory );
+    }
   }
   else if( m_strainTheory==1 )
   {
-    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitFiniteStrainFactory( dt, elementListName );
-    rval = finiteElement::
-             regionBasedKernelApplication< parallelDevicePolicy< 32 >,
-                                           constitutive::SolidBase,
-                                           CellElementSubRegion >( mesh,
-                                                                   targetRegions,
-                                                                   finiteElementName,
-                                                                   viewKeyStruct::solidMaterialNamesString(),
-                                                                   kernelFactory );
+    if( mixedPrecision )
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitFiniteStrainMixedFactory( dt, elementListName, elementColorsName );
+      rval = launch( kernelFactory );
+    }
+    else
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitFiniteStrainFactory( dt, elementListName, elementColorsName );
+      rval = launch( kernelFactory );
+    }
   }
   else
   {
@@ -440,6 +657,15 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
         elemsNotAttachedToSendOrReceiveNodes.insert( tmpElemsNotAttachedToSendOrReceiveNodes.begin(),
                                                      tmpElemsNotAttachedToSendOrReceiveNodes.end() );
 
+        // the colors stay empty with atomics, which is how the explicit kernels tell the two options apart
+        if( m_explicitAssemblyOption == ExplicitAssemblyOption::Coloring )
+        {
+          getElemsAttachedToSendOrReceiveNodesColors( elementSubRegion ) =
+            meshMapUtilities::colorElements( elemsToNodes, elemsAttachedToSendOrReceiveNodes.toViewConst(), nodes.size() );
+          getElemsNotAttachedToSendOrReceiveNodesColors( elementSubRegion ) =
+            meshMapUtilities::colorElements( elemsToNodes, elemsNotAttachedToSendOrReceiveNodes.toViewConst(), nodes.size() );
+        }
+
         m_sendOrReceiveNodes.insert( tmpSendOrReceiveNodes.begin(),
                                      tmpSendOrReceiveNodes.end() );
         m_nonSendOrReceiveNodes.insert( tmpNonSendOrReceiveNodes.begin(),
@@ -451,7 +677,172 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
       } );
     } );
 
+    if( m_timeIntegrationOption == TimeIntegrationOption::ExplicitDynamic )
+    {
+      estimateStableTimeSteps( mesh, regionNames );
+    }
+  } );
+
+  if( m_explicitContactPenalty > 0.0 )
+  {
+    initializeExplicitContact( domain );
+  }
+}
+
+void SolidMechanicsLagrangianFEM::initializeExplicitContact( DomainPartition & domain )
+{
+  std::vector< MeshLevel const * > meshLevels;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    meshLevels.push_back( &mesh );
+  } );
+
+  m_explicitContact.initialize( meshLevels, m_explicitContactPenalty, m_explicitContactCellSize );
+
+  // the ghost layers were sized before the cell size of the search was known exactly
+  real64 minExtent, maxExtent;
+  computeElementExtents( domain, minExtent, maxExtent );
+  integer const ghostDepth = getGhostingRequirements( domain ).depth;
+  GEOSX_LOG_RANK_0_IF( m_explicitContact.cellSize() > ghostDepth * minExtent,
+                       "WARNING: " << getName() << ": the contact cell size " << m_explicitContact.cellSize() <<
+                       " exceeds the width " << ghostDepth * minExtent << " of the " << ghostDepth <<
+                       " ghost layer(s), contacts across the partition boundaries may be missed" );
+
+  localIndex const totalNumFaces = MpiWrapper::sum( m_explicitContact.numFaces() );
+  GEOSX_LOG_RANK_0( getName() << ": contact searched between " << totalNumFaces <<
+                    " boundary faces (ghosts included), with a spatial hash of cell size " << m_explicitContact.cellSize() );
+}
+
+GhostingRequirements SolidMechanicsLagrangianFEM::getGhostingRequirements( DomainPartition const & domain ) const
+{
+  GhostingRequirements ghosting = SolverBase::getGhostingRequirements( domain );
+  if( m_explicitContactPenalty > 0.0 )
+  {
+    // the automatic cell size of the search is twice the largest boundary face, at most twice the largest element
+    real64 minExtent, maxExtent;
+    computeElementExtents( domain, minExtent, maxExtent );
+    real64 const cellSize = m_explicitContactCellSize > 0.0 ? m_explicitContactCellSize : 2.0 * maxExtent;
+    ghosting.depth = std::max( ghosting.depth, contactGhostDepth( cellSize, minExtent ) );
+  }
+  return ghosting;
+}
+
+void SolidMechanicsLagrangianFEM::computeElementExtents( DomainPartition const & domain,
+                                                         real64 & minExtent,
+                                                         real64 & maxExtent ) const
+{
+  minExtent = LvArray::NumericLimits< real64 >::max;
+  maxExtent = 0.0;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel const & mesh,
+                                                                arrayView1d< string const > const & regionNames )
+  {
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = mesh.getNodeManager().referencePosition();
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                         [&]( localIndex const,
+                                                                              CellElementSubRegion const & subRegion )
+    {
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+      for( localIndex k = 0; k < subRegion.size(); ++k )
+      {
+        real64 boxMin[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[ elemsToNodes( k, 0 ) ] );
+        real64 boxMax[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[ elemsToNodes( k, 0 ) ] );
+        for( localIndex a = 1; a < elemsToNodes.size( 1 ); ++a )
+        {
+          for( int j = 0; j < 3; ++j )
+          {
+            boxMin[j] = std::min( boxMin[j], X( elemsToNodes( k, a ), j ) );
+            boxMax[j] = std::max( boxMax[j], X( elemsToNodes( k, a ), j ) );
+          }
+        }
+        for( int j = 0; j < 3; ++j )
+        {
+          minExtent = std::min( minExtent, boxMax[j] - boxMin[j] );
+          maxExtent = std::max( maxExtent, boxMax[j] - boxMin[j] );
+        }
+      }
+    } );
+  } );
+  minExtent = MpiWrapper::min( minExtent );
+  maxExtent = MpiWrapper::max( maxExtent );
+}
+
+integer SolidMechanicsLagrangianFEM::contactGhostDepth( real64 const cellSize,
+                                                        real64 const minExtent )
+{
+  // each layer of node-adjacent elements is at least as wide as the smallest element
+  return minExtent > 0.0 ? std::max( 1, LvArray::integerConversion< integer >( std::ceil( cellSize / minExtent ) ) ) : 1;
+}
+
+void SolidMechanicsLagrangianFEM::estimateStableTimeSteps( MeshLevel const & mesh,
+                                                           arrayView1d< string const > const & regionNames )
+{
+  integer const maxNumLevels = 8;
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = mesh.getNodeManager().referencePosition();
+
+  // the estimates are kept until the smallest one is known, the levels are counted from the finest step
+  std::vector< array1d< real64 > > stableDt;
+  std::vector< arrayView1d< integer const > > elemGhostRank;
+  real64 minStableDt = LvArray::NumericLimits< real64 >::max;
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                        CellElementSubRegion const & elementSubRegion )
+  {
+    string const & solidMaterialName = elementSubRegion.getReference< string >( viewKeyStruct::solidMaterialNamesString() );
+    ElasticIsotropic const * const solid =
+      dynamicCast< ElasticIsotropic const * >( &elementSubRegion.getConstitutiveModel( solidMaterialName ) );
+    if( solid == nullptr )
+    {
+      return;
+    }
+
+    arrayView1d< real64 const > const bulkModulus = solid->bulkModulus();
+    arrayView1d< real64 const > const shearModulus = solid->shearModulus();
+    arrayView2d< real64 const > const rho = solid->getReference< array2d< real64 > >( SolidBase::viewKeyStruct::densityString() );
+
+    stableDt.emplace_back( elementSubRegion.size() );
+    elemGhostRank.emplace_back( elementSubRegion.ghostRank() );
+    localTimeStepping::computeElementStableTimeSteps< parallelHostPolicy >( X,
+                                                                            elementSubRegion.nodeList().toViewConst(),
+                                                                            [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      return LvArray::math::sqrt( ( bulkModulus[k] + 4.0 / 3.0 * shearModulus[k] ) / rho[k][0] );
+    },
+                                                                            m_cflFactor,
+                                                                            stableDt.back().toView() );
+
+    for( localIndex k = 0; k < elementSubRegion.size(); ++k )
+    {
+      minStableDt = LvArray::math::min( minStableDt, stableDt.back()[k] );
+    }
   } );
+
+  minStableDt = MpiWrapper::min( minStableDt );
+  if( minStableDt >= LvArray::NumericLimits< real64 >::max )
+  {
+    return;
+  }
+  m_maxStableDt = minStableDt;
+
+  // an element at level l would be advanced with minStableDt * 2^( numLevels - 1 - l )
+  real64 const coarseDt = minStableDt * std::pow( 2.0, maxNumLevels - 1 );
+  array1d< globalIndex > numElementsPerLevel( maxNumLevels );
+  for( std::size_t i = 0; i < stableDt.size(); ++i )
+  {
+    for( localIndex k = 0; k < stableDt[i].size(); ++k )
+    {
+      if( elemGhostRank[i][k] < 0 )
+      {
+        ++numElementsPerLevel[localTimeStepping::timeSteppingLevel( coarseDt, stableDt[i][k], maxNumLevels )];
+      }
+    }
+  }
+
+  GEOSX_LOG_RANK_0( getName() << ": smallest stable time step of the elements " << minStableDt << " s" );
+  localTimeStepping::logTimeSteppingLevels( getName(), coarseDt, numElementsPerLevel );
 }
 
 
@@ -527,122 +918,211 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
 
   #define USE_PHYSICS_LOOP
 
-  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
-                                                                MeshLevel & mesh,
-                                                                arrayView1d< string const > const & regionNames )
+  auto const launch = [&] ( auto const nodalReal )
   {
-    NodeManager & nodes = mesh.getNodeManager();
-    ElementRegionManager & elementRegionManager = mesh.getElemManager();
-    Group const & nodeSets = nodes.sets();
-
-    SortedArrayView< localIndex const > const &
-    m_sendOrReceiveNodes = nodeSets.getReference< SortedArray< localIndex > >( viewKeyStruct::sendOrReceiveNodesString() ).toViewConst();
-
-    SortedArrayView< localIndex const > const &
-    m_nonSendOrReceiveNodes = nodeSets.getReference< SortedArray< localIndex > >( viewKeyStruct::nonSendOrReceiveNodesString() ).toViewConst();
+    using NODAL_REAL = decltype( nodalReal );
 
-    // save previous constitutive state data in preparation for next timestep
-    elementRegionManager.forElementSubRegions< CellElementSubRegion >( regionNames,
-                                                                       [&]( localIndex const,
-                                                                            CellElementSubRegion & subRegion )
+    forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                  MeshLevel & mesh,
+                                                                  arrayView1d< string const > const & regionNames )
     {
-      string const & solidMaterialName = subRegion.template getReference< string >( viewKeyStruct::solidMaterialNamesString() );
-      SolidBase & constitutiveRelation = getConstitutiveModel< SolidBase >( subRegion, solidMaterialName );
-      constitutiveRelation.saveConvergedState();
+      explicitPredictorOnMesh< NODAL_REAL >( time_n, dt, mesh, regionNames );
     } );
 
-    FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+    // the contacts are searched once all the meshes have moved, since they may involve several of them
+    if( m_explicitContactPenalty > 0.0 )
+    {
+      GEOSX_MARK_SCOPE( explicitContact );
 
-    arrayView1d< real64 const > const & mass = nodes.getReference< array1d< real64 > >( keys::Mass );
-    arrayView2d< real64, nodes::VELOCITY_USD > const & vel = nodes.velocity();
+      localIndex meshIndex = 0;
+      forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                    MeshLevel & mesh,
+                                                                    arrayView1d< string const > const & )
+      {
+        m_explicitContact.updatePositions( meshIndex++, mesh );
+      } );
 
-    arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u = nodes.totalDisplacement();
-    arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat = nodes.incrementalDisplacement();
-    arrayView2d< real64, nodes::ACCELERATION_USD > const & acc = nodes.acceleration();
+      localIndex const numContacts = m_explicitContact.computeForces();
+      if( getLogLevel() >= 2 )
+      {
+        localIndex const totalNumContacts = MpiWrapper::sum( numContacts );
+        localIndex const totalNumFaceUpdates = MpiWrapper::sum( m_explicitContact.numFaceUpdates() );
+        GEOSX_LOG_RANK_0( getName() << ": " << totalNumContacts << " nodes in contact, " <<
+                          totalNumFaceUpdates << " faces registered again in the spatial hash so far" );
+      }
 
-    FieldIdentifiers fieldsToBeSync;
-    fieldsToBeSync.addFields( FieldLocation::Node, { keys::Velocity, keys::Acceleration } );
-    m_iComm.resize( domain.getNeighbors().size() );
-    CommunicationTools::getInstance().synchronizePackSendRecvSizes( fieldsToBeSync, mesh, domain.getNeighbors(), m_iComm, true );
+      meshIndex = 0;
+      forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                    MeshLevel & mesh,
+                                                                    arrayView1d< string const > const & )
+      {
+        arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const acc =
+          mesh.getNodeManager().getReference< array2d< NODAL_REAL, nodes::ACCELERATION_PERM > >( keys::Acceleration );
+        m_explicitContact.addForces( meshIndex++, mesh, acc );
+      } );
+    }
 
-    fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Acceleration );
+    forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                  MeshLevel & mesh,
+                                                                  arrayView1d< string const > const & regionNames )
+    {
+      explicitCorrectorOnMesh< NODAL_REAL >( time_n, dt, domain, mesh, regionNames );
+    } );
+  };
 
-    //3: v^{n+1/2} = v^{n} + a^{n} dt/2
-    solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, vel, dt / 2 );
+  if( m_explicitPrecisionOption == ExplicitPrecisionOption::Mixed )
+  {
+    launch( real32() );
+  }
+  else
+  {
+    launch( real64() );
+  }
 
-    fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Velocity );
+  return dt;
+}
 
-    //4. x^{n+1} = x^{n} + v^{n+{1}/{2}} dt (x is displacement)
-    solidMechanicsLagrangianFEMKernels::displacementUpdate( vel, uhat, u, dt );
+template< typename NODAL_REAL >
+void SolidMechanicsLagrangianFEM::explicitPredictorOnMesh( real64 const & time_n,
+                                                           real64 const & dt,
+                                                           MeshLevel & mesh,
+                                                           arrayView1d< string const > const & regionNames )
+{
+  NodeManager & nodes = mesh.getNodeManager();
+  ElementRegionManager & elementRegionManager = mesh.getElemManager();
 
-    fsManager.applyFieldValue( time_n + dt,
-                               mesh,
-                               NodeManager::viewKeyStruct::totalDisplacementString(),
-                               [&]( FieldSpecificationBase const & bc,
-                                    SortedArrayView< localIndex const > const & targetSet )
-    {
-      integer const component = bc.getComponent();
-      GEOSX_ERROR_IF_LT_MSG( component, 0, "Component index required for displacement BC " << bc.getName() );
+  // save previous constitutive state data in preparation for next timestep
+  elementRegionManager.forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                     [&]( localIndex const,
+                                                                          CellElementSubRegion & subRegion )
+  {
+    string const & solidMaterialName = subRegion.template getReference< string >( viewKeyStruct::solidMaterialNamesString() );
+    SolidBase & constitutiveRelation = getConstitutiveModel< SolidBase >( subRegion, solidMaterialName );
+    constitutiveRelation.saveConvergedState();
+  } );
 
-      forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
-                                              [=] GEOSX_DEVICE ( localIndex const i )
-      {
-        localIndex const a = targetSet[ i ];
-        vel( a, component ) = u( a, component );
-      } );
-    },
-                               [&]( FieldSpecificationBase const & bc,
-                                    SortedArrayView< localIndex const > const & targetSet )
-    {
-      integer const component = bc.getComponent();
-      GEOSX_ERROR_IF_LT_MSG( component, 0, "Component index required for displacement BC " << bc.getName() );
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
 
-      forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
-                                              [=] GEOSX_DEVICE ( localIndex const i )
-      {
-        localIndex const a = targetSet[ i ];
-        uhat( a, component ) = u( a, component ) - vel( a, component );
-        vel( a, component )  = uhat( a, component ) / dt;
-      } );
-    } );
+  arrayView2d< NODAL_REAL, nodes::VELOCITY_USD > const vel =
+    nodes.getReference< array2d< NODAL_REAL, nodes::VELOCITY_PERM > >( keys::Velocity );
 
-    //Step 5. Calculate deformation input to constitutive model and update state to
-    // Q^{n+1}
-    explicitKernelDispatch( mesh,
-                            regionNames,
-                            this->getDiscretizationName(),
-                            dt,
-                            string( viewKeyStruct::elemsAttachedToSendOrReceiveNodesString() ) );
+  // the displacements are accumulated in double precision whatever the precision of the velocity
+  arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u = nodes.totalDisplacement();
+  arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat = nodes.incrementalDisplacement();
+  arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const acc =
+    nodes.getReference< array2d< NODAL_REAL, nodes::ACCELERATION_PERM > >( keys::Acceleration );
 
-    // apply this over a set
-    solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_sendOrReceiveNodes.toViewConst() );
+  fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Acceleration );
 
-    fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Velocity );
+  //3: v^{n+1/2} = v^{n} + a^{n} dt/2
+  solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, vel, dt / 2 );
 
-    parallelDeviceEvents packEvents;
-    CommunicationTools::getInstance().asyncPack( fieldsToBeSync, mesh, domain.getNeighbors(), m_iComm, true, packEvents );
+  fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Velocity );
 
-    waitAllDeviceEvents( packEvents );
+  //4. x^{n+1} = x^{n} + v^{n+{1}/{2}} dt (x is displacement)
+  solidMechanicsLagrangianFEMKernels::displacementUpdate( vel.toViewConst(), uhat, u, dt );
 
-    CommunicationTools::getInstance().asyncSendRecv( domain.getNeighbors(), m_iComm, true, packEvents );
+  fsManager.applyFieldValue( time_n + dt,
+                             mesh,
+                             NodeManager::viewKeyStruct::totalDisplacementString(),
+                             [&]( FieldSpecificationBase const & bc,
+                                  SortedArrayView< localIndex const > const & targetSet )
+  {
+    integer const component = bc.getComponent();
+    GEOSX_ERROR_IF_LT_MSG( component, 0, "Component index required for displacement BC " << bc.getName() );
 
-    explicitKernelDispatch( mesh,
-                            regionNames,
-                            this->getDiscretizationName(),
-                            dt,
-                            string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() ) );
+    forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
+                                            [=] GEOSX_DEVICE ( localIndex const i )
+    {
+      localIndex const a = targetSet[ i ];
+      uhat( a, component ) = u( a, component );
+    } );
+  },
+                             [&]( FieldSpecificationBase const & bc,
+                                  SortedArrayView< localIndex const > const & targetSet )
+  {
+    integer const component = bc.getComponent();
+    GEOSX_ERROR_IF_LT_MSG( component, 0, "Component index required for displacement BC " << bc.getName() );
 
-    // apply this over a set
-    solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_nonSendOrReceiveNodes.toViewConst() );
-    fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Velocity );
+    forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
+                                            [=] GEOSX_DEVICE ( localIndex const i )
+    {
+      localIndex const a = targetSet[ i ];
+      uhat( a, component ) = u( a, component ) - uhat( a, component );
+      vel( a, component )  = static_cast< NODAL_REAL >( uhat( a, component ) / dt );
+    } );
+  } );
+}
 
-    // this includes  a device sync after launching all the unpacking kernels
-    parallelDeviceEvents unpackEvents;
-    CommunicationTools::getInstance().finalizeUnpack( mesh, domain.getNeighbors(), m_iComm, true, unpackEvents );
+template< typename NODAL_REAL >
+void SolidMechanicsLagrangianFEM::explicitCorrectorOnMesh( real64 const & time_n,
+                                                           real64 const & dt,
+                                                           DomainPartition & domain,
+                                                           MeshLevel & mesh,
+                                                           arrayView1d< string const > const & regionNames )
+{
+  NodeManager & nodes = mesh.getNodeManager();
+  Group const & nodeSets = nodes.sets();
 
-  } );
+  SortedArrayView< localIndex const > const &
+  m_sendOrReceiveNodes = nodeSets.getReference< SortedArray< localIndex > >( viewKeyStruct::sendOrReceiveNodesString() ).toViewConst();
 
-  return dt;
+  SortedArrayView< localIndex const > const &
+  m_nonSendOrReceiveNodes = nodeSets.getReference< SortedArray< localIndex > >( viewKeyStruct::nonSendOrReceiveNodesString() ).toViewConst();
+
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
+
+  arrayView1d< real64 const > const & mass = nodes.getReference< array1d< real64 > >( keys::Mass );
+  arrayView2d< NODAL_REAL, nodes::VELOCITY_USD > const vel =
+    nodes.getReference< array2d< NODAL_REAL, nodes::VELOCITY_PERM > >( keys::Velocity );
+  arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const acc =
+    nodes.getReference< array2d< NODAL_REAL, nodes::ACCELERATION_PERM > >( keys::Acceleration );
+
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { keys::Velocity, keys::Acceleration } );
+  m_iComm.resize( domain.getNeighbors().size() );
+  CommunicationTools::getInstance().synchronizePackSendRecvSizes( fieldsToBeSync, mesh, domain.getNeighbors(), m_iComm, true );
+
+  //Step 5. Calculate deformation input to constitutive model and update state to
+  // Q^{n+1}
+  Stopwatch kernelWatch;
+  explicitKernelDispatch( mesh,
+                          regionNames,
+                          this->getDiscretizationName(),
+                          dt,
+                          string( viewKeyStruct::elemsAttachedToSendOrReceiveNodesString() ),
+                          string( viewKeyStruct::elemsAttachedToSendOrReceiveNodesColorsString() ) );
+  real64 kernelTime = kernelWatch.elapsedTime();
+
+  // apply this over a set
+  solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_sendOrReceiveNodes.toViewConst() );
+
+  fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Velocity );
+
+  parallelDeviceEvents packEvents;
+  CommunicationTools::getInstance().asyncPack( fieldsToBeSync, mesh, domain.getNeighbors(), m_iComm, true, packEvents );
+
+  waitAllDeviceEvents( packEvents );
+
+  CommunicationTools::getInstance().asyncSendRecv( domain.getNeighbors(), m_iComm, true, packEvents );
+
+  kernelWatch.zero();
+  explicitKernelDispatch( mesh,
+                          regionNames,
+                          this->getDiscretizationName(),
+                          dt,
+                          string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() ),
+                          string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesColorsString() ) );
+  kernelTime += kernelWatch.elapsedTime();
+  logKernelThroughput( domain, mesh, regionNames, "explicit", kernelTime );
+
+  // apply this over a set
+  solidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_nonSendOrReceiveNodes.toViewConst() );
+  fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, keys::Velocity );
+
+  // this includes  a device sync after launching all the unpacking kernels
+  parallelDeviceEvents unpackEvents;
+  CommunicationTools::getInstance().finalizeUnpack( mesh, domain.getNeighbors(), m_iComm, true, unpackEvents );
 }
 
 
@@ -681,6 +1161,26 @@ void SolidMechanicsLagrangianFEM::applyDisplacementBCImplicit( real64 const time
                                                                        dofManager.rankOffset(),
                                                                        localMatrix,
                                                                        localRhs );
+
+      if( m_matrixFree )
+      {
+        // the matrix-free operator also needs the constrained columns
+        arrayView1d< globalIndex const > const dofNumber = targetGroup.getReference< array1d< globalIndex > >( dofKey );
+        globalIndex const rankOffset = dofManager.rankOffset();
+        integer const component = bc.getComponent();
+        for( localIndex const a : targetSet )
+        {
+          localIndex const row = LvArray::integerConversion< localIndex >( dofNumber[a] - rankOffset );
+          if( row < 0 || row >= localRhs.size() )
+          {
+            continue;
+          }
+          for( integer i = ( component < 0 ? 0 : component ); i < ( component < 0 ? 3 : component + 1 ); ++i )
+          {
+            m_matrixFreeConstrainedRows.emplace_back( row + i );
+          }
+        }
+      }
     } );
   } );
 }
@@ -929,6 +1429,23 @@ void SolidMechanicsLagrangianFEM::setupSystem( DomainPartition & domain,
                                                bool const setSparsity )
 {
   GEOSX_MARK_FUNCTION;
+
+  if( m_matrixFree )
+  {
+    // only the diagonal is stored, for the Jacobi scaling and the boundary conditions
+    SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, false );
+    SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
+                                                    dofManager.numGlobalDofs(),
+                                                    1 );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    for( localIndex row = 0; row < dofManager.numLocalDofs(); ++row )
+    {
+      sparsityPattern.insertNonZero( row, rankOffset + row );
+    }
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+    return;
+  }
+
   SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity );
 
   SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
@@ -994,7 +1511,39 @@ void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOSX_UNUSED_PARA
   localMatrix.zero();
   localRhs.zero();
 
-  if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
+  if( m_matrixFree )
+  {
+    // the constitutive tangent is cached at the quadrature points for the jacobian applications
+    forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                  MeshLevel & mesh,
+                                                                  arrayView1d< string const > const & regionNames )
+    {
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                          [&]( localIndex const,
+                                                                               CellElementSubRegion & subRegion )
+      {
+        string const & solidMaterialName = subRegion.getReference< string >( viewKeyStruct::solidMaterialNamesString() );
+        SolidBase & solid = getConstitutiveModel< SolidBase >( subRegion, solidMaterialName );
+        constitutive::ConstitutivePassThru< SolidBase >::execute( solid, [&]( auto & castedSolid )
+        {
+          using SOLID_TYPE = TYPEOFREF( castedSolid );
+          subRegion.getReference< array3d< real64 > >( viewKeyStruct::matrixFreeTangentString() ).
+            resizeDimension< 1, 2 >( solid.numQuadraturePoints(),
+                                     solidMechanicsLagrangianFEMKernels::matrixFreeTangentSize< SOLID_TYPE >() );
+        } );
+      } );
+    } );
+
+    // the residual and the diagonal of the jacobian, the jacobian is applied by SolidMechanicsMatrixFreeOperator
+    assemblyLaunch< constitutive::SolidBase,
+                    solidMechanicsLagrangianFEMKernels::QuasiStaticMatrixFreeFactory >( domain,
+                                                                                        dofManager,
+                                                                                        localMatrix,
+                                                                                        localRhs,
+                                                                                        arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD >(),
+                                                                                        viewKeyStruct::matrixFreeTangentString() );
+  }
+  else if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
   {
     GEOSX_UNUSED_VAR( dt );
     assemblyLaunch< constitutive::SolidBase,
@@ -1030,6 +1579,8 @@ SolidMechanicsLagrangianFEM::
   GEOSX_MARK_FUNCTION;
   FieldSpecificationManager & fsManager = FieldSpecificationManager::getInstance();
 
+  m_matrixFreeConstrainedRows.clear();
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
                                                                 arrayView1d< string const > const & )
@@ -1073,6 +1624,57 @@ SolidMechanicsLagrangianFEM::
   applyDisplacementBCImplicit( time_n + dt, dofManager, domain, localMatrix, localRhs );
 }
 
+void SolidMechanicsLagrangianFEM::solveLinearSystem( DofManager const & dofManager,
+                                                     ParallelMatrix & matrix,
+                                                     ParallelVector & rhs,
+                                                     ParallelVector & solution )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( !m_matrixFree )
+  {
+    SolverBase::solveLinearSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  rhs.scale( -1.0 );
+  solution.zero();
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+
+  // the matrix only holds the diagonal of the jacobian, with the boundary conditions applied
+  SolidMechanicsMatrixFreeOperator const matrixFreeOperator( *this,
+                                                             domain,
+                                                             dofManager,
+                                                             m_localMatrix.toViewConstSizes(),
+                                                             m_matrixFreeConstrainedRows.toViewConst() );
+  matrixFreeOperator.liftConstrainedValues( rhs );
+
+  ParallelVector diagonal;
+  diagonal.create( matrix.numLocalRows(), matrix.comm() );
+  matrix.extractDiagonal( diagonal );
+
+  PreconditionerChebyshev< LAInterface > precond( m_chebyshevDegree );
+  precond.setup( matrixFreeOperator, diagonal );
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrixFreeOperator, precond );
+  solver->solve( rhs, solution );
+  m_linearSolverResult = solver->result();
+
+  GEOSX_LOG_LEVEL_RANK_0( 2, GEOSX_FMT( "        {}: matrix-free solve, largest eigenvalue of the Jacobi-scaled jacobian estimated to {:4.2e}",
+                                        getName(), precond.largestEigenvalue() ) );
+
+  if( params.stopIfError )
+  {
+    GEOSX_ERROR_IF( m_linearSolverResult.breakdown(), "Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOSX_WARNING_IF( !m_linearSolverResult.success(), "Linear solution failed" );
+  }
+}
+
 real64
 SolidMechanicsLagrangianFEM::
   calculateResidualNorm( DomainPartition const & domain,
@@ -20,12 +20,14 @@
 #define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSLAGRANGIANFEM_HPP_
 
 #include "codingUtilities/EnumStrings.hpp"
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
 #include "mesh/MeshForLoopInterface.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "mesh/mpiCommunications/MPI_iCommData.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
+#include "SolidMechanicsExplicitContact.hpp"
 #include "SolidMechanicsLagrangianFEMKernels.hpp"
 
 namespace geosx
@@ -55,6 +57,39 @@ public:
     ExplicitDynamic   //!< ExplicitDynamic
   };
 
+  /**
+   * @enum ExplicitAssemblyOption
+   *
+   * The options for adding the element forces to the nodes in explicit dynamics
+   */
+  enum class ExplicitAssemblyOption : integer
+  {
+    Atomics,  //!< all the elements at once, with atomic additions
+    Coloring  //!< one color of elements sharing no node at a time, without atomics
+  };
+
+  /**
+   * @enum ExplicitPrecisionOption
+   *
+   * The floating point precision of the nodal velocity and acceleration in explicit dynamics
+   */
+  enum class ExplicitPrecisionOption : integer
+  {
+    Double, //!< all the nodal fields in double precision
+    Mixed   //!< velocity and acceleration in single precision, displacements accumulated in double precision
+  };
+
+  /**
+   * @enum ExplicitConstitutiveUpdateOption
+   *
+   * The granularity of the constitutive updates in explicit dynamics
+   */
+  enum class ExplicitConstitutiveUpdateOption : integer
+  {
+    PointWise, //!< one quadrature point at a time
+    Batched    //!< all the quadrature points of an element as one tile
+  };
+
   /**
    * Constructor
    * @param name The name of the solver instance
@@ -84,6 +119,14 @@ public:
 
   virtual void registerDataOnMesh( Group & meshBodies ) override final;
 
+  /**
+   * @copydoc SolverBase::getGhostingRequirements
+   *
+   * With the explicit contact, the ghost layers are deep enough to cover a cell of the contact search,
+   * so that the faces near the partition boundary are found on both sides of it.
+   */
+  virtual GhostingRequirements getGhostingRequirements( DomainPartition const & domain ) const override;
+
   void updateIntrinsicNodalData( DomainPartition * const domain );
 
 
@@ -130,6 +173,12 @@ public:
                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
                   arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  solveLinearSystem( DofManager const & dofManager,
+                     ParallelMatrix & matrix,
+                     ParallelVector & rhs,
+                     ParallelVector & solution ) override;
+
   virtual void
   applySystemSolution( DofManager const & dofManager,
                        arrayView1d< real64 const > const & localSolution,
@@ -173,12 +222,28 @@ public:
                        PARAMS && ... params );
 
 
+  /**
+   * @brief Log the element throughput of the finite element kernels on rank 0 (logLevel >= 2),
+   *        to compare the storage options of the geometric factors of the discretization.
+   * @param domain the domain partition
+   * @param mesh the mesh level on which the kernels were launched
+   * @param regionNames the names of the target regions
+   * @param kernelName the name of the kernels in the log
+   * @param kernelTime the time spent in the kernels on this rank
+   */
+  void logKernelThroughput( DomainPartition const & domain,
+                            MeshLevel const & mesh,
+                            arrayView1d< string const > const & regionNames,
+                            string const & kernelName,
+                            real64 const kernelTime ) const;
+
   template< typename ... PARAMS >
   real64 explicitKernelDispatch( MeshLevel & mesh,
                                  arrayView1d< string const > const & targetRegions,
                                  string const & finiteElementName,
                                  real64 const dt,
-                                 std::string const & elementListName );
+                                 std::string const & elementListName,
+                                 std::string const & elementColorsName );
 
   /**
    * Applies displacement boundary conditions to the system for implicit time integration
@@ -226,6 +291,15 @@ public:
     static constexpr char const * stiffnessDampingString() { return "stiffnessDamping"; }
     static constexpr char const * useVelocityEstimateForQSString() { return "useVelocityForQS"; }
     static constexpr char const * timeIntegrationOptionString() { return "timeIntegrationOption"; }
+    static constexpr char const * explicitAssemblyOptionString() { return "explicitAssembly"; }
+    static constexpr char const * explicitPrecisionOptionString() { return "explicitPrecision"; }
+    static constexpr char const * explicitConstitutiveUpdateOptionString() { return "explicitConstitutiveUpdate"; }
+    static constexpr char const * explicitContactPenaltyString() { return "explicitContactPenalty"; }
+    static constexpr char const * explicitContactCellSizeString() { return "explicitContactCellSize"; }
+    static constexpr char const * matrixFreeString() { return "matrixFree"; }
+    static constexpr char const * chebyshevDegreeString() { return "chebyshevDegree"; }
+    static constexpr char const * matrixFreeDirectionString() { return "matrixFreeDirection"; }
+    static constexpr char const * matrixFreeTangentString() { return "matrixFreeTangent"; }
     static constexpr char const * maxNumResolvesString() { return "maxNumResolves"; }
     static constexpr char const * strainTheoryString() { return "strainTheory"; }
     static constexpr char const * solidMaterialNamesString() { return "solidMaterialNames"; }
@@ -236,6 +310,8 @@ public:
     static constexpr char const * maxForceString() { return "maxForce"; }
     static constexpr char const * elemsAttachedToSendOrReceiveNodesString() { return "elemsAttachedToSendOrReceiveNodes"; }
     static constexpr char const * elemsNotAttachedToSendOrReceiveNodesString() { return "elemsNotAttachedToSendOrReceiveNodes"; }
+    static constexpr char const * elemsAttachedToSendOrReceiveNodesColorsString() { return "elemsAttachedToSendOrReceiveNodesColors"; }
+    static constexpr char const * elemsNotAttachedToSendOrReceiveNodesColorsString() { return "elemsNotAttachedToSendOrReceiveNodesColors"; }
 
     static constexpr char const * sendOrReceiveNodesString() { return "sendOrReceiveNodes";}
     static constexpr char const * nonSendOrReceiveNodesString() { return "nonSendOrReceiveNodes";}
@@ -263,8 +339,23 @@ public:
     return subRegion.getReference< SortedArray< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() );
   }
 
+  ArrayOfArrays< localIndex > & getElemsAttachedToSendOrReceiveNodesColors( ElementSubRegionBase & subRegion )
+  {
+    return subRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsAttachedToSendOrReceiveNodesColorsString() );
+  }
+
+  ArrayOfArrays< localIndex > & getElemsNotAttachedToSendOrReceiveNodesColors( ElementSubRegionBase & subRegion )
+  {
+    return subRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesColorsString() );
+  }
+
   real64 & getMaxForce() { return m_maxForce; }
 
+  /**
+   * @return the floating point precision of the nodal velocity and acceleration in explicit dynamics
+   */
+  ExplicitPrecisionOption getExplicitPrecisionOption() const { return m_explicitPrecisionOption; }
+
   arrayView1d< ParallelVector > const & getRigidBodyModes() const
   {
     return m_rigidBodyModes;
@@ -287,6 +378,13 @@ protected:
   real64 m_massDamping;
   real64 m_stiffnessDamping;
   TimeIntegrationOption m_timeIntegrationOption;
+  ExplicitAssemblyOption m_explicitAssemblyOption;
+  ExplicitPrecisionOption m_explicitPrecisionOption;
+  ExplicitConstitutiveUpdateOption m_explicitConstitutiveUpdateOption;
+  real64 m_explicitContactPenalty;
+  real64 m_explicitContactCellSize;
+  integer m_matrixFree;
+  integer m_chebyshevDegree;
   integer m_useVelocityEstimateForQS;
   real64 m_maxForce = 0.0;
   integer m_maxNumResolves;
@@ -297,9 +395,87 @@ protected:
   /// Rigid body modes
   array1d< ParallelVector > m_rigidBodyModes;
 
+  /// Local rows constrained by the displacement boundary conditions, only collected in matrix-free mode
+  array1d< localIndex > m_matrixFreeConstrainedRows;
+
+  /// Contact search between the boundary faces in explicit dynamics, only used with a positive penalty
+  SolidMechanicsExplicitContact m_explicitContact;
+
 private:
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const override;
 
+  /**
+   * @brief Estimate the stable time step of the elements for the explicit scheme, and log how they would
+   *        spread over time step levels if each element was advanced with its own power-of-two fraction of the step.
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   *
+   * Only the elastic isotropic models are handled, with the P-wave speed sqrt( ( K + 4/3 G ) / rho ).
+   * The smallest estimate is stored as the maximum stable time step of the solver.
+   */
+  void estimateStableTimeSteps( MeshLevel const & mesh,
+                                arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Collect the boundary faces of the target meshes and build the contact search of the explicit scheme.
+   * @param domain the domain partition
+   */
+  void initializeExplicitContact( DomainPartition & domain );
+
+  /**
+   * @brief Compute the extents of the elements of the target meshes.
+   * @param domain the domain partition
+   * @param minExtent the smallest side of the bounding boxes of the elements, over all the ranks
+   * @param maxExtent the largest side of the bounding boxes of the elements, over all the ranks
+   */
+  void computeElementExtents( DomainPartition const & domain,
+                              real64 & minExtent,
+                              real64 & maxExtent ) const;
+
+  /**
+   * @brief Compute the number of ghost layers covering a cell of the contact search.
+   * @param cellSize the size of the cells of the spatial hash
+   * @param minExtent the smallest side of the bounding boxes of the elements
+   * @return the number of layers
+   */
+  static integer contactGhostDepth( real64 const cellSize,
+                                    real64 const minExtent );
+
+  /**
+   * @brief First half of an explicit step on a mesh level: the velocity is advanced by half a step
+   *        and the displacements by a full step.
+   * @tparam NODAL_REAL the floating point type of the nodal velocity and acceleration
+   * @param time_n the time at the beginning of the step
+   * @param dt the time step
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   */
+  template< typename NODAL_REAL >
+  void explicitPredictorOnMesh( real64 const & time_n,
+                                real64 const & dt,
+                                MeshLevel & mesh,
+                                arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Second half of an explicit step on a mesh level: the element states and the nodal forces
+   *        are computed at the new displacements, and the velocity is advanced by the remaining half step.
+   * @tparam NODAL_REAL the floating point type of the nodal velocity and acceleration
+   * @param time_n the time at the beginning of the step
+   * @param dt the time step
+   * @param domain the domain partition
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   *
+   * The nodal forces added to the acceleration array between the two halves, such as the contact
+   * forces, are integrated together with the element forces.
+   */
+  template< typename NODAL_REAL >
+  void explicitCorrectorOnMesh( real64 const & time_n,
+                                real64 const & dt,
+                                DomainPartition & domain,
+                                MeshLevel & mesh,
+                                arrayView1d< string const > const & regionNames );
+
 };
 
 ENUM_STRINGS( SolidMechanicsLagrangianFEM::TimeIntegrationOption,
@@ -307,6 +483,18 @@ ENUM_STRINGS( SolidMechanicsLagrangianFEM::TimeIntegrationOption,
               "ImplicitDynamic",
               "ExplicitDynamic" );
 
+ENUM_STRINGS( SolidMechanicsLagrangianFEM::ExplicitAssemblyOption,
+              "Atomics",
+              "Coloring" );
+
+ENUM_STRINGS( SolidMechanicsLagrangianFEM::ExplicitPrecisionOption,
+              "Double",
+              "Mixed" );
+
+ENUM_STRINGS( SolidMechanicsLagrangianFEM::ExplicitConstitutiveUpdateOption,
+              "PointWise",
+              "Batched" );
+
 //**********************************************************************************************************************
 //**********************************************************************************************************************
 //**********************************************************************************************************************
@@ -341,6 +529,7 @@ void SolidMechanicsLagrangianFEM::assemblyLaunch( DomainPartition & domain,
                                   gravityVectorData,
                                   std::forward< PARAMS >( params )... );
 
+    Stopwatch kernelWatch;
     m_maxForce = finiteElement::
                    regionBasedKernelApplication< parallelDevicePolicy< 32 >,
                                                  CONSTITUTIVE_BASE,
@@ -349,6 +538,7 @@ void SolidMechanicsLagrangianFEM::assemblyLaunch( DomainPartition & domain,
                                                                          this->getDiscretizationName(),
                                                                          viewKeyStruct::solidMaterialNamesString(),
                                                                          kernelWrapper );
+    logKernelThroughput( domain, mesh, regionNames, "assembly", kernelWatch.elapsedTime() );
   } );
 
 
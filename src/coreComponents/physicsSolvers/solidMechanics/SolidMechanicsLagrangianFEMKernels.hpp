@@ -31,8 +31,9 @@ namespace geosx
 namespace solidMechanicsLagrangianFEMKernels
 {
 
-inline void velocityUpdate( arrayView2d< real64, nodes::ACCELERATION_USD > const & acceleration,
-                            arrayView2d< real64, nodes::VELOCITY_USD > const & velocity,
+template< typename NODAL_REAL >
+inline void velocityUpdate( arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const & acceleration,
+                            arrayView2d< NODAL_REAL, nodes::VELOCITY_USD > const & velocity,
                             real64 const dt )
 {
   GEOSX_MARK_FUNCTION;
@@ -45,9 +46,10 @@ inline void velocityUpdate( arrayView2d< real64, nodes::ACCELERATION_USD > const
   } );
 }
 
-inline void velocityUpdate( arrayView2d< real64, nodes::ACCELERATION_USD > const & acceleration,
+template< typename NODAL_REAL >
+inline void velocityUpdate( arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const & acceleration,
                             arrayView1d< real64 const > const & mass,
-                            arrayView2d< real64, nodes::VELOCITY_USD > const & velocity,
+                            arrayView2d< NODAL_REAL, nodes::VELOCITY_USD > const & velocity,
                             real64 const dt,
                             SortedArrayView< localIndex const > const & indices )
 {
@@ -61,7 +63,8 @@ inline void velocityUpdate( arrayView2d< real64, nodes::ACCELERATION_USD > const
   } );
 }
 
-inline void displacementUpdate( arrayView2d< real64 const, nodes::VELOCITY_USD > const & velocity,
+template< typename NODAL_REAL >
+inline void displacementUpdate( arrayView2d< NODAL_REAL const, nodes::VELOCITY_USD > const & velocity,
                                 arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat,
                                 arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u,
                                 real64 const dt )
@@ -0,0 +1,195 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.cpp
+ */
+
+#include "SolidMechanicsMatrixFreeOperator.hpp"
+
+#include "SolidMechanicsLagrangianFEM.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernel.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/TimingMacros.hpp"
+#include "constitutive/solid/SolidBase.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+SolidMechanicsMatrixFreeOperator::SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                                                    DomainPartition & domain,
+                                                                    DofManager const & dofManager,
+                                                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                                    arrayView1d< localIndex const > const & constrainedRows ):
+  LinearOperator< ParallelVector >(),
+  m_solver( solver ),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_localMatrix( localMatrix ),
+  m_constrainedRows( constrainedRows )
+{
+  m_work.create( m_dofManager.numLocalDofs(), MPI_COMM_GEOSX );
+}
+
+void SolidMechanicsMatrixFreeOperator::apply( ParallelVector const & src,
+                                              ParallelVector & dst ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView1d< localIndex const > const constrainedRows = m_constrainedRows;
+  CRSMatrixView< real64, globalIndex const > const localMatrix = m_localMatrix;
+
+  // the constrained columns are removed from the vector the element jacobians are applied to
+  m_work.copy( src );
+  arrayView1d< real64 > const work = m_work.open();
+  forAll< parallelDevicePolicy<> >( constrainedRows.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    work[ constrainedRows[i] ] = 0.0;
+  } );
+  m_work.close();
+
+  dst.zero();
+  arrayView1d< real64 > const dstValues = dst.open();
+  applyElementJacobians( m_work, dstValues );
+
+  // and the constrained rows only keep the diagonal set by the boundary conditions
+  arrayView1d< real64 const > const srcValues = src.values();
+  forAll< parallelDevicePolicy<> >( constrainedRows.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const row = constrainedRows[i];
+    dstValues[ row ] = localMatrix.getEntries( row )[0] * srcValues[ row ];
+  } );
+  dst.close();
+}
+
+void SolidMechanicsMatrixFreeOperator::liftConstrainedValues( ParallelVector & rhs ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView1d< localIndex const > const constrainedRows = m_constrainedRows;
+  CRSMatrixView< real64, globalIndex const > const localMatrix = m_localMatrix;
+
+  // the prescribed increments, zero on the free rows
+  m_work.zero();
+  arrayView1d< real64 > const work = m_work.open();
+  arrayView1d< real64 const > const rhsValues = rhs.values();
+  forAll< parallelDevicePolicy<> >( constrainedRows.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const row = constrainedRows[i];
+    work[ row ] = rhsValues[ row ] / localMatrix.getEntries( row )[0];
+  } );
+  m_work.close();
+
+  ParallelVector product;
+  product.create( numLocalRows(), comm() );
+  product.zero();
+  arrayView1d< real64 > const productValues = product.open();
+  applyElementJacobians( m_work, productValues );
+  forAll< parallelDevicePolicy<> >( constrainedRows.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    productValues[ constrainedRows[i] ] = 0.0;
+  } );
+  product.close();
+
+  rhs.axpy( -1.0, product );
+}
+
+void SolidMechanicsMatrixFreeOperator::applyElementJacobians( ParallelVector const & src,
+                                                              arrayView1d< real64 > const & dst ) const
+{
+  arrayView1d< real64 const > const srcValues = src.values();
+  localIndex const numLocalDofs = srcValues.size();
+  globalIndex const rankOffset = m_dofManager.rankOffset();
+  string const dofKey = m_dofManager.getKey( keys::TotalDisplacement );
+  string const directionKey = SolidMechanicsLagrangianFEM::viewKeyStruct::matrixFreeDirectionString();
+  real64 const gravityVectorData[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_solver.gravityVector() );
+
+  m_solver.forDiscretizationOnMeshTargets( m_domain.getMeshBodies(), [&] ( string const &,
+                                                                           MeshLevel & mesh,
+                                                                           arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    arrayView1d< globalIndex const > const dofNumber = nodeManager.getReference< globalIndex_array >( dofKey );
+    arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const direction =
+      nodeManager.getReference< array2d< real64, nodes::TOTAL_DISPLACEMENT_PERM > >( directionKey );
+
+    // scatter the locally owned values to the nodes, the ghosts are filled by their owners
+    forAll< parallelDevicePolicy<> >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+    {
+      localIndex const row = LvArray::integerConversion< localIndex >( dofNumber[a] - rankOffset );
+      bool const isLocalRow = row >= 0 && row < numLocalDofs;
+      for( int i = 0; i < 3; ++i )
+      {
+        direction[a][i] = isLocalRow ? srcValues[ row + i ] : 0.0;
+      }
+    } );
+
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addFields( FieldLocation::Node, { directionKey } );
+    CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                         mesh,
+                                                         m_domain.getNeighbors(),
+                                                         true );
+
+    solidMechanicsLagrangianFEMKernels::QuasiStaticMatrixFreeFactory kernelFactory( dofNumber,
+                                                                                    rankOffset,
+                                                                                    m_localMatrix,
+                                                                                    dst,
+                                                                                    gravityVectorData,
+                                                                                    direction.toViewConst(),
+                                                                                    SolidMechanicsLagrangianFEM::viewKeyStruct::matrixFreeTangentString() );
+
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                    constitutive::SolidBase,
+                                    CellElementSubRegion >( mesh,
+                                                            regionNames,
+                                                            m_solver.getDiscretizationName(),
+                                                            SolidMechanicsLagrangianFEM::viewKeyStruct::solidMaterialNamesString(),
+                                                            kernelFactory );
+  } );
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalRows() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalCols() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalRows() const
+{
+  return m_dofManager.numLocalDofs();
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalCols() const
+{
+  return m_dofManager.numLocalDofs();
+}
+
+MPI_Comm SolidMechanicsMatrixFreeOperator::comm() const
+{
+  return MPI_COMM_GEOSX;
+}
+
+} // namespace geosx
@@ -0,0 +1,116 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/common/LinearOperator.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+namespace geosx
+{
+
+class DofManager;
+class DomainPartition;
+class SolidMechanicsLagrangianFEM;
+
+/**
+ * @class SolidMechanicsMatrixFreeOperator
+ *
+ * The quasi-static jacobian of SolidMechanicsLagrangianFEM applied element by element,
+ * without assembling the global sparse matrix.
+ *
+ * The displacement boundary conditions are eliminated symmetrically: the constrained
+ * rows and columns are replaced by the diagonal set by the boundary conditions in the
+ * (diagonal only) local matrix of the solver, and liftConstrainedValues moves the
+ * coupling with the prescribed increments to the right-hand side beforehand. The solution
+ * is then the same as with the assembled matrix, whose constrained columns are kept.
+ */
+class SolidMechanicsMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param solver the solid mechanics solver providing the discretization and the materials
+   * @param domain the domain partition
+   * @param dofManager the degree-of-freedom manager of the solver
+   * @param localMatrix the local matrix of the solver, holding the diagonal of the jacobian
+   * @param constrainedRows the local rows constrained by the displacement boundary conditions
+   */
+  SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                    DomainPartition & domain,
+                                    DofManager const & dofManager,
+                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                    arrayView1d< localIndex const > const & constrainedRows );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~SolidMechanicsMatrixFreeOperator() override = default;
+
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override;
+
+  /**
+   * @brief Subtract the product of the free-constrained block with the prescribed increments from the free rows.
+   * @param rhs the right-hand side, whose constrained rows hold the diagonal times the prescribed increments
+   */
+  void liftConstrainedValues( ParallelVector & rhs ) const;
+
+  virtual globalIndex numGlobalRows() const override;
+
+  virtual globalIndex numGlobalCols() const override;
+
+  virtual localIndex numLocalRows() const override;
+
+  virtual localIndex numLocalCols() const override;
+
+  virtual MPI_Comm comm() const override;
+
+private:
+
+  /**
+   * @brief Add the product of the element jacobians with a vector to another one.
+   * @param src the vector the jacobian is applied to
+   * @param dst the local values the product is added to
+   */
+  void applyElementJacobians( ParallelVector const & src,
+                              arrayView1d< real64 > const & dst ) const;
+
+  /// The solid mechanics solver
+  SolidMechanicsLagrangianFEM const & m_solver;
+
+  /// The domain partition
+  DomainPartition & m_domain;
+
+  /// The degree-of-freedom manager
+  DofManager const & m_dofManager;
+
+  /// The local matrix of the solver, only holding the diagonal
+  CRSMatrixView< real64, globalIndex const > const m_localMatrix;
+
+  /// The local rows constrained by the displacement boundary conditions
+  arrayView1d< localIndex const > const m_constrainedRows;
+
+  /// Work vector holding the vector the element jacobians are applied to
+  mutable ParallelVector m_work;
+};
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
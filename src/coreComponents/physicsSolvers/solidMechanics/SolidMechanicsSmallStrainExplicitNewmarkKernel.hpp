@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINEXPLICITNEWMARK_HPP_
 #define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINEXPLICITNEWMARK_HPP_
 
+#include "constitutive/solid/SolidBase.hpp"
 #include "finiteElement/kernelInterface/KernelBase.hpp"
 
 
@@ -41,6 +42,7 @@ namespace solidMechanicsLagrangianFEMKernels
  *   explicit Newmark method under the small strain assumption.
  * @copydoc geosx::finiteElement::KernelBase
  * @tparam SUBREGION_TYPE The type of subregion that the kernel will act on.
+ * @tparam NODAL_REAL The floating point type of the nodal velocity and acceleration.
  *
  * ### Explicit Small Strain Description
  * Implements the KernelBase interface functions required for explicit time
@@ -53,10 +55,13 @@ namespace solidMechanicsLagrangianFEMKernels
  * does not inherit from KernelBase.
  * The number of degrees of freedom per support point for both
  * the test and trial spaces are specified as `3`.
+ * The element computations are performed in double precision, whatever the
+ * precision of the nodal velocity and acceleration.
  */
 template< typename SUBREGION_TYPE,
           typename CONSTITUTIVE_TYPE,
-          typename FE_TYPE >
+          typename FE_TYPE,
+          typename NODAL_REAL >
 class ExplicitSmallStrain : public finiteElement::KernelBase< SUBREGION_TYPE,
                                                               CONSTITUTIVE_TYPE,
                                                               FE_TYPE,
@@ -95,6 +100,8 @@ public:
    * @param dt The time interval for the step.
    * @param elementListName The name of the entry that holds the list of
    *   elements to be processed during this kernel launch.
+   * @param elementColorsName The name of the entry that holds the elements of
+   *   the list grouped by color, empty when the forces are added with atomics.
    */
   ExplicitSmallStrain( NodeManager & nodeManager,
                        EdgeManager const & edgeManager,
@@ -104,16 +111,18 @@ public:
                        FE_TYPE const & finiteElementSpace,
                        CONSTITUTIVE_TYPE & inputConstitutiveType,
                        real64 const dt,
-                       string const elementListName ):
+                       string const elementListName,
+                       string const elementColorsName ):
     Base( elementSubRegion,
           finiteElementSpace,
           inputConstitutiveType ),
     m_X( nodeManager.referencePosition()),
     m_u( nodeManager.totalDisplacement()),
-    m_vel( nodeManager.velocity()),
-    m_acc( nodeManager.acceleration() ),
+    m_vel( nodeManager.getReference< array2d< NODAL_REAL, nodes::VELOCITY_PERM > >( dataRepository::keys::Velocity ) ),
+    m_acc( nodeManager.getReference< array2d< NODAL_REAL, nodes::ACCELERATION_PERM > >( dataRepository::keys::Acceleration ) ),
     m_dt( dt ),
-    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() )
+    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() ),
+    m_elementColors( elementSubRegion.template getReference< ArrayOfArrays< localIndex > >( elementColorsName ).toViewConst() )
   {
     GEOSX_UNUSED_VAR( edgeManager );
     GEOSX_UNUSED_VAR( faceManager );
@@ -263,7 +272,10 @@ public:
    *
    * ### ExplicitSmallStrain Description
    * Performs the distribution of the nodal force out to the rank local arrays.
+   * @tparam ATOMIC_POLICY the atomic policy used to add the force to the nodes,
+   *   serialAtomic when no other element of the launch shares a node with @p k.
    */
+  template< typename ATOMIC_POLICY = parallelDeviceAtomic >
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
   real64 complete( localIndex const k,
@@ -274,7 +286,7 @@ public:
       localIndex const nodeIndex = m_elemsToNodes( k, a );
       for( int b = 0; b < numDofPerTestSupportPoint; ++b )
       {
-        RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+        RAJA::atomicAdd< ATOMIC_POLICY >( &m_acc( nodeIndex, b ), static_cast< NODAL_REAL >( stack.fLocal[ a ][ b ] ) );
       }
     }
     return 0;
@@ -285,7 +297,9 @@ public:
    *
    * ### ExplicitSmallStrain Description
    * Copy of the KernelBase::kernelLaunch function without the exclusion of ghost
-   * elements.
+   * elements. When the element list has been colored, the colors are launched
+   * one after the other and the elements of a color, which share no node, add
+   * their force to the nodes without atomics.
    */
   template< typename POLICY,
             typename KERNEL_TYPE >
@@ -297,21 +311,45 @@ public:
 
     GEOSX_UNUSED_VAR( numElems );
 
-    localIndex const numProcElems = kernelComponent.m_elementList.size();
-    forAll< POLICY >( numProcElems,
-                      [=] GEOSX_DEVICE ( localIndex const index )
+    localIndex const numColors = kernelComponent.m_elementColors.size();
+    if( numColors == 0 )
     {
-      localIndex const k = kernelComponent.m_elementList[ index ];
+      localIndex const numProcElems = kernelComponent.m_elementList.size();
+      forAll< POLICY >( numProcElems,
+                        [=] GEOSX_DEVICE ( localIndex const index )
+      {
+        localIndex const k = kernelComponent.m_elementList[ index ];
 
-      typename KERNEL_TYPE::StackVariables stack;
+        typename KERNEL_TYPE::StackVariables stack;
 
-      kernelComponent.setup( k, stack );
-      for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+        kernelComponent.setup( k, stack );
+        for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+        {
+          kernelComponent.quadraturePointKernel( k, q, stack );
+        }
+        kernelComponent.complete( k, stack );
+      } );
+    }
+    else
+    {
+      for( localIndex color = 0; color < numColors; ++color )
       {
-        kernelComponent.quadraturePointKernel( k, q, stack );
+        forAll< POLICY >( kernelComponent.m_elementColors.sizeOfArray( color ),
+                          [=] GEOSX_DEVICE ( localIndex const index )
+        {
+          localIndex const k = kernelComponent.m_elementColors( color, index );
+
+          typename KERNEL_TYPE::StackVariables stack;
+
+          kernelComponent.setup( k, stack );
+          for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+          {
+            kernelComponent.quadraturePointKernel( k, q, stack );
+          }
+          kernelComponent.template complete< serialAtomic >( k, stack );
+        } );
       }
-      kernelComponent.complete( k, stack );
-    } );
+    }
     return 0;
   }
 
@@ -324,11 +362,11 @@ protected:
   arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const m_u;
 
   /// The array containing the nodal velocity array.
-  arrayView2d< real64 const, nodes::VELOCITY_USD > const m_vel;
+  arrayView2d< NODAL_REAL const, nodes::VELOCITY_USD > const m_vel;
 
   /// The array containing the nodal acceleration array, which is used to store
   /// the force.
-  arrayView2d< real64, nodes::ACCELERATION_USD > const m_acc;
+  arrayView2d< NODAL_REAL, nodes::ACCELERATION_USD > const m_acc;
 
   /// The time increment for this time integration step.
   real64 const m_dt;
@@ -336,15 +374,171 @@ protected:
   /// The list of elements to process for the kernel launch.
   SortedArrayView< localIndex const > const m_elementList;
 
+  /// The elements of the list grouped by color, empty if the list is not colored.
+  ArrayOfArraysView< localIndex const > const m_elementColors;
+
 
 };
+
+/**
+ * @brief Explicit small strain kernel updating the material points of an element as one tile.
+ * @copydoc geosx::solidMechanicsLagrangianFEMKernels::ExplicitSmallStrain
+ *
+ * ### ExplicitSmallStrainBatched Description
+ * The quadrature points of an element form a constitutive::SmallStrainBatch: the strain
+ * increments of all the quadrature points are computed first, the stresses are updated with
+ * a single call to constitutive::smallStrainUpdateBatch_StressOnly, which the models may
+ * vectorize over the tile, and the stress divergence is integrated last. The shape function
+ * derivatives are kept on the stack between the two passes. As with UPDATE_STRESS 2, the
+ * strain increment is computed from the velocity and the stress state is updated.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE,
+          typename NODAL_REAL >
+class ExplicitSmallStrainBatched : public ExplicitSmallStrain< SUBREGION_TYPE,
+                                                               CONSTITUTIVE_TYPE,
+                                                               FE_TYPE,
+                                                               NODAL_REAL >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = ExplicitSmallStrain< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE,
+                                    NODAL_REAL >;
+
+  using Base::numNodesPerElem;
+  using Base::numQuadraturePointsPerElem;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+  using Base::Base;
+
+  /**
+   * @copydoc geosx::solidMechanicsLagrangianFEMKernels::ExplicitSmallStrain::StackVariables
+   *
+   * ### ExplicitSmallStrainBatched Description
+   * Adds the tile of the quadrature points, with their shape function derivatives.
+   */
+  struct StackVariables : Base::StackVariables
+  {
+public:
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables()
+    {}
+
+    /// The strain increments and stresses of the quadrature points
+    constitutive::SmallStrainBatch< numQuadraturePointsPerElem > batch;
+
+    /// The shape function derivatives at the quadrature points
+    real64 dNdX[ numQuadraturePointsPerElem ][ numNodesPerElem ][ 3 ];
+
+    /// The jacobian determinants times the weights at the quadrature points
+    real64 detJ[ numQuadraturePointsPerElem ];
+  };
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### ExplicitSmallStrainBatched Description
+   * Calculates the shape function derivatives and the strain increment, and adds
+   * the quadrature point to the tile.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    stack.detJ[ q ] = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, stack.dNdX[ q ] );
+    real64 strain[6] = {0};
+    FE_TYPE::symmetricGradient( stack.dNdX[ q ], stack.varLocal, strain );
+    stack.batch.addPoint( k, q, strain );
+  }
+
+  /**
+   * @copydoc geosx::solidMechanicsLagrangianFEMKernels::ExplicitSmallStrain::complete
+   *
+   * ### ExplicitSmallStrainBatched Description
+   * Updates the stresses of the tile, integrates the stress divergence, and
+   * distributes the nodal force.
+   */
+  template< typename ATOMIC_POLICY = parallelDeviceAtomic >
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    constitutive::smallStrainUpdateBatch_StressOnly( m_constitutiveUpdate, stack.batch );
+
+    for( integer q = 0; q < numQuadraturePointsPerElem; ++q )
+    {
+      real64 stressLocal[ 6 ];
+      stack.batch.getStress( q, stressLocal );
+      for( localIndex c = 0; c < 6; ++c )
+      {
+        stressLocal[ c ] *= -stack.detJ[ q ];
+      }
+      FE_TYPE::plusGradNajAij( stack.dNdX[ q ], stressLocal, stack.fLocal );
+    }
+
+    return Base::template complete< ATOMIC_POLICY >( k, stack );
+  }
+};
+
 #undef UPDATE_STRESS
 
+/// ExplicitSmallStrain with the nodal velocity and acceleration in double precision.
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+using ExplicitSmallStrainDouble = ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, real64 >;
+
+/// ExplicitSmallStrain with the nodal velocity and acceleration in single precision.
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+using ExplicitSmallStrainMixed = ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, real32 >;
+
 /// The factory used to construct a ExplicitSmallStrain kernel.
-using ExplicitSmallStrainFactory = finiteElement::KernelFactory< ExplicitSmallStrain,
+using ExplicitSmallStrainFactory = finiteElement::KernelFactory< ExplicitSmallStrainDouble,
                                                                  real64,
+                                                                 string const,
                                                                  string const >;
 
+/// The factory used to construct a mixed precision ExplicitSmallStrain kernel.
+using ExplicitSmallStrainMixedFactory = finiteElement::KernelFactory< ExplicitSmallStrainMixed,
+                                                                      real64,
+                                                                      string const,
+                                                                      string const >;
+
+/// ExplicitSmallStrainBatched with the nodal velocity and acceleration in double precision.
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+using ExplicitSmallStrainBatchedDouble = ExplicitSmallStrainBatched< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, real64 >;
+
+/// ExplicitSmallStrainBatched with the nodal velocity and acceleration in single precision.
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+using ExplicitSmallStrainBatchedMixed = ExplicitSmallStrainBatched< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, real32 >;
+
+/// The factory used to construct a ExplicitSmallStrainBatched kernel.
+using ExplicitSmallStrainBatchedFactory = finiteElement::KernelFactory< ExplicitSmallStrainBatchedDouble,
+                                                                        real64,
+                                                                        string const,
+                                                                        string const >;
+
+/// The factory used to construct a mixed precision ExplicitSmallStrainBatched kernel.
+using ExplicitSmallStrainBatchedMixedFactory = finiteElement::KernelFactory< ExplicitSmallStrainBatchedMixed,
+                                                                             real64,
+                                                                             string const,
+                                                                             string const >;
+
 } // namespace solidMechanicsLagrangianFEMKernels
 
 } // namespace geosx
@@ -0,0 +1,298 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsSmallStrainMatrixFreeKernel.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNEL_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNEL_HPP_
+
+#include "SolidMechanicsSmallStrainQuasiStaticKernel.hpp"
+
+#include <cstring>
+
+namespace geosx
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Number of values per quadrature point of the constitutive tangent cache of QuasiStaticMatrixFree.
+ * @tparam CONSTITUTIVE_TYPE the type of the solid model
+ * @return the number of real64 holding the DiscretizationOps of @p CONSTITUTIVE_TYPE
+ */
+template< typename CONSTITUTIVE_TYPE >
+constexpr localIndex matrixFreeTangentSize()
+{
+  return ( sizeof( typename CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps ) + sizeof( real64 ) - 1 ) / sizeof( real64 );
+}
+
+/**
+ * @brief Implements the quasi-static equilibrium kernels without a global sparse matrix.
+ * @copydoc QuasiStatic
+ *
+ * ### QuasiStaticMatrixFree Description
+ * The element residual and jacobian are computed as in QuasiStatic, but the element
+ * jacobian never leaves the stack. The kernel has two modes, selected by the size of
+ * the nodal direction array:
+ * - if the direction is empty, the residual is assembled in the right-hand side and
+ *   only the diagonal of the jacobian is assembled in the matrix, which must have
+ *   (at least) the diagonal entry in its sparsity pattern. The tangent returned by the
+ *   constitutive update is cached at each quadrature point;
+ * - otherwise, the product of the jacobian with the direction is added to the
+ *   right-hand side array, and the matrix is not used. The jacobian is formed from the
+ *   cached tangent, the constitutive update and the residual are not recomputed.
+ *
+ * The cache holds the DiscretizationOps of the constitutive model, see matrixFreeTangentSize,
+ * and is valid for the Newton iteration of the last residual pass.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticMatrixFree : public QuasiStatic< SUBREGION_TYPE,
+                                                  CONSTITUTIVE_TYPE,
+                                                  FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = QuasiStatic< SUBREGION_TYPE,
+                            CONSTITUTIVE_TYPE,
+                            FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+  using Base::m_gravityVector;
+  using Base::m_density;
+
+  /// The discretization operators of the constitutive tangent, cached at the quadrature points.
+  using DiscretizationOps = typename CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps;
+
+  static_assert( std::is_trivially_copyable< DiscretizationOps >::value,
+                 "The cached constitutive tangent must be trivially copyable" );
+
+  /**
+   * @brief Constructor
+   * @copydoc QuasiStatic::QuasiStatic
+   * @param inputDirection The nodal vector the jacobian is applied to, empty to assemble the residual.
+   * @param inputTangentKey The key of the subregion array caching the constitutive tangent.
+   */
+  QuasiStaticMatrixFree( NodeManager const & nodeManager,
+                         EdgeManager const & edgeManager,
+                         FaceManager const & faceManager,
+                         localIndex const targetRegionIndex,
+                         SUBREGION_TYPE const & elementSubRegion,
+                         FE_TYPE const & finiteElementSpace,
+                         CONSTITUTIVE_TYPE & inputConstitutiveType,
+                         arrayView1d< globalIndex const > const inputDofNumber,
+                         globalIndex const rankOffset,
+                         CRSMatrixView< real64, globalIndex const > const inputMatrix,
+                         arrayView1d< real64 > const inputRhs,
+                         real64 const (&inputGravityVector)[3],
+                         arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const inputDirection,
+                         string const inputTangentKey ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          targetRegionIndex,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          inputDofNumber,
+          rankOffset,
+          inputMatrix,
+          inputRhs,
+          inputGravityVector ),
+    m_direction( inputDirection ),
+    m_tangent( elementSubRegion.template getReference< array3d< real64 > >( inputTangentKey ).toView() )
+  {
+    GEOSX_ERROR_IF_LT_MSG( m_tangent.size( 2 ), matrixFreeTangentSize< CONSTITUTIVE_TYPE >(),
+                           "The constitutive tangent cache of " << elementSubRegion.getName() << " is too small" );
+  }
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc QuasiStatic::StackVariables
+   *
+   * Adds a stack array for the direction the jacobian is applied to.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+      direction_local()
+    {}
+
+    /// Stack storage for the element local direction
+    real64 direction_local[numNodesPerElem * numDofPerTrialSupportPoint];
+  };
+  //*****************************************************************************
+
+  /**
+   * @copydoc QuasiStatic::setup
+   *
+   * The element local direction is also gathered when the jacobian is applied.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    Base::setup( k, stack );
+    if( m_direction.size( 0 ) > 0 )
+    {
+      for( localIndex a=0; a<numNodesPerElem; ++a )
+      {
+        localIndex const localNodeIndex = m_elemsToNodes( k, a );
+        for( int i=0; i<numDofPerTrialSupportPoint; ++i )
+        {
+          stack.direction_local[ a*numDofPerTrialSupportPoint+i ] = m_direction[ localNodeIndex ][ i ];
+        }
+      }
+    }
+  }
+
+  /**
+   * @copydoc QuasiStatic::quadraturePointKernel
+   *
+   * The residual pass calls the constitutive update and caches its tangent, the
+   * jacobian applications read the cached tangent instead.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    DiscretizationOps stiffness;
+    real64 * const tangent = &m_tangent( k, q, 0 );
+
+    if( m_direction.size( 0 ) > 0 )
+    {
+      memcpy( &stiffness, tangent, sizeof( DiscretizationOps ) );
+    }
+    else
+    {
+      real64 strainInc[6] = {0};
+      real64 stress[6] = {0};
+
+      FE_TYPE::symmetricGradient( dNdX, stack.uhat_local, strainInc );
+
+      m_constitutiveUpdate.smallStrainUpdate( k, q, strainInc, stress, stiffness );
+      memcpy( tangent, &stiffness, sizeof( DiscretizationOps ) );
+
+      for( localIndex i=0; i<6; ++i )
+      {
+        stress[i] *= -detJ;
+      }
+
+      real64 const gravityForce[3] = { m_gravityVector[0] * m_density( k, q )* detJ,
+                                       m_gravityVector[1] * m_density( k, q )* detJ,
+                                       m_gravityVector[2] * m_density( k, q )* detJ };
+
+      real64 N[numNodesPerElem];
+      FE_TYPE::calcN( q, N );
+      FE_TYPE::plusGradNajAijPlusNaFi( dNdX,
+                                       stress,
+                                       N,
+                                       gravityForce,
+                                       reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual) );
+    }
+
+    stiffness.template upperBTDB< numNodesPerElem >( dNdX, -detJ, stack.localJacobian );
+  }
+
+  /**
+   * @copydoc QuasiStatic::complete
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+    real64 maxForce = 0;
+
+    CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps::template fillLowerBTDB< numNodesPerElem >( stack.localJacobian );
+
+    bool const applyJacobian = m_direction.size( 0 ) > 0;
+
+    for( int row = 0; row < numNodesPerElem * numDofPerTestSupportPoint; ++row )
+    {
+      localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ row ] - m_dofRankOffset );
+      if( dof < 0 || dof >= m_rhs.size() ) continue;
+
+      if( applyJacobian )
+      {
+        real64 product = 0.0;
+        for( int col = 0; col < numNodesPerElem * numDofPerTrialSupportPoint; ++col )
+        {
+          product += stack.localJacobian[ row ][ col ] * stack.direction_local[ col ];
+        }
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], product );
+      }
+      else
+      {
+        m_matrix.template addToRow< parallelDeviceAtomic >( dof,
+                                                            &stack.localRowDofIndex[ row ],
+                                                            &stack.localJacobian[ row ][ row ],
+                                                            1 );
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ row ] );
+        maxForce = fmax( maxForce, fabs( stack.localResidual[ row ] ) );
+      }
+    }
+
+    return maxForce;
+  }
+
+protected:
+  /// The nodal vector the jacobian is applied to.
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const m_direction;
+
+  /// The constitutive tangent cached at the quadrature points by the residual pass.
+  arrayView3d< real64 > const m_tangent;
+
+};
+
+/// The factory used to construct a QuasiStaticMatrixFree kernel.
+using QuasiStaticMatrixFreeFactory = finiteElement::KernelFactory< QuasiStaticMatrixFree,
+                                                                   arrayView1d< globalIndex const > const,
+                                                                   globalIndex,
+                                                                   CRSMatrixView< real64, globalIndex const > const,
+                                                                   arrayView1d< real64 > const,
+                                                                   real64 const (&)[3],
+                                                                   arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const,
+                                                                   string const >;
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNEL_HPP_
@@ -85,7 +85,14 @@ bool SolidMechanicsStateReset::execute( real64 const time_n,
 
       NodeManager & nodeManager = mesh.getNodeManager();
 
-      nodeManager.velocity().zero();
+      if( m_solidSolver->getExplicitPrecisionOption() == SolidMechanicsLagrangianFEM::ExplicitPrecisionOption::Mixed )
+      {
+        nodeManager.getReference< array2d< real32, nodes::VELOCITY_PERM > >( keys::Velocity ).zero();
+      }
+      else
+      {
+        nodeManager.velocity().zero();
+      }
       nodeManager.incrementalDisplacement().zero();
       nodeManager.totalDisplacement().zero();
     }
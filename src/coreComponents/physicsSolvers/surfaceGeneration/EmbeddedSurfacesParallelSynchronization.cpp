@@ -599,6 +599,8 @@ void sychronizeTopology( MeshLevel & mesh,
                          int const mpiCommOrder,
                          string const fractureRegionName )
 {
+  // the send/receive lists are modified, the cached synchronization plans of the mesh level are rebuilt on their next use
+  mesh.modifiedSizes();
 
   // Synchronize nodes
   synchronizeNewNodes( mesh,
@@ -785,6 +785,8 @@ void parallelTopologyChange::synchronizeTopologyChange( MeshLevel * const mesh,
                                                         ModifiedObjectLists & receivedObjects,
                                                         int mpiCommOrder )
 {
+  // the send/receive lists are modified, the cached synchronization plans of the mesh level are rebuilt on their next use
+  mesh->modifiedSizes();
 
   NodeManager & nodeManager = mesh->getNodeManager();
   EdgeManager & edgeManager = mesh->getEdgeManager();
@@ -391,6 +391,20 @@ void SurfaceGenerator::initializePostInitialConditionsPreSubGroups()
       }
     }
   } );
+
+  // The nodal forces used to compute the stress intensity factors read the stored shape function derivatives
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & meshLevel,
+                                                                arrayView1d< string const > const & )
+  {
+    meshLevel.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+    {
+      GEOSX_THROW_IF( subRegion.detJ().size( 1 ) > 0 && subRegion.dNdX().size( 2 ) == 0,
+                      getName() << ": the nodal forces require the shape function derivatives of " << subRegion.getName()
+                                << ", stored with geometricFactors=\"full\" only",
+                      InputError );
+    } );
+  } );
 }
 
 void SurfaceGenerator::postRestartInitialization()
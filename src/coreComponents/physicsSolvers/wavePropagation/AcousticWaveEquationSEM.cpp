@@ -20,6 +20,7 @@
 #include "AcousticWaveEquationSEM.hpp"
 #include "AcousticWaveEquationSEMKernel.hpp"
 
+#include "common/MpiWrapper.hpp"
 #include "dataRepository/KeyNames.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
@@ -28,6 +29,7 @@
 //#include "mesh/CellBlock.hpp"
 #include "mesh/ElementType.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "physicsSolvers/LocalTimeSteppingUtilities.hpp"
 
 namespace geosx
 {
@@ -37,7 +39,14 @@ using namespace dataRepository;
 AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
                                                   Group * const parent ):
   WaveSolverBase( name,
-                  parent )
+                  parent ),
+  m_checkpointCompression( WaveCheckpointStorage::Compression::None ),
+  m_numForwardSteps( 0 ),
+  m_forwardTime0( 0.0 ),
+  m_forwardCycle0( 0 ),
+  m_forwardDt( 0.0 ),
+  m_numShots( 1 ),
+  m_finestTimeSteppingLevel( 0 )
 {
 
   registerWrapper( viewKeyStruct::sourceNodeIdsString(), &m_sourceNodeIds ).
@@ -75,6 +84,57 @@ AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
     setSizedFromParent( 0 ).
     setDescription( "Pressure value at each receiver for each timestep" );
 
+  registerWrapper( viewKeyStruct::pressureObservedAtReceiversString(), &m_pressureObservedAtReceivers ).
+    setInputFlag( InputFlags::FALSE ).
+    setSizedFromParent( 0 ).
+    setDescription( "Observed pressure at each receiver for each timestep, the adjoint sources are the differences "
+                    "with the recorded pressure. Left to zero, the recorded pressure itself is back-propagated." );
+
+  registerWrapper( viewKeyStruct::computeGradientString(), &m_computeGradient ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to back-propagate the receiver residuals at the end of the run and accumulate "
+                    "the imaging condition and the gradient, 0 by default" );
+
+  registerWrapper( viewKeyStruct::numCheckpointsString(), &m_numCheckpoints ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 16 ).
+    setDescription( "Number of forward states stored at once during the backward run, the forward steps in "
+                    "between are recomputed following a binomial (Revolve) schedule" );
+
+  registerWrapper( viewKeyStruct::numCheckpointsInMemoryString(), &m_numCheckpointsInMemory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 16 ).
+    setDescription( "Number of stored forward states kept in memory, the others are written to disk in the background" );
+
+  registerWrapper( viewKeyStruct::checkpointCompressionString(), &m_checkpointCompression ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_checkpointCompression ).
+    setDescription( "Encoding of the stored forward states. Options are:\n"
+                    "* none: values stored as is\n"
+                    "* quantize16: lossy, values mapped to 16-bit integers between the min and max of each field" );
+
+  registerWrapper( viewKeyStruct::checkpointFilePrefixString(), &m_checkpointFilePrefix ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( "checkpoint" ).
+    setDescription( "Prefix, possibly with a directory on a local disk, of the files of the forward states written to disk" );
+
+  registerWrapper( viewKeyStruct::sourcesPerShotString(), &m_sourcesPerShot ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of consecutive sources of sourceCoordinates fired together in each shot. When positive, "
+                    "the shots are propagated together in a single run, sharing the mesh and the mass and damping "
+                    "matrices, with the pressures of the shots interleaved at each node, and the traces are recorded "
+                    "and written per shot. 0 (default) fires all the sources in a single shot" );
+
+  registerWrapper( viewKeyStruct::numTimeSteppingLevelsString(), &m_numTimeSteppingLevels ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1 ).
+    setDescription( "Maximum number of time step levels. The elements whose stable time step, estimated with cflFactor, "
+                    "is smaller than the time step of the event are advanced with the time step of the event divided by "
+                    "2^level, with level < numTimeSteppingLevels, and the nodes with the finest level of their elements. "
+                    "1 (default) advances all the nodes with the time step of the event" );
+
 }
 
 AcousticWaveEquationSEM::~AcousticWaveEquationSEM()
@@ -141,7 +201,8 @@ void AcousticWaveEquationSEM::initializePreSubGroups()
   m_receiverConstants.resize( numReceiversGlobal, numNodesPerElem );
   m_receiverIsLocal.resize( numReceiversGlobal );
 
-  m_pressureNp1AtReceivers.resizeDimension< 1 >( numReceiversGlobal );
+  m_pressureNp1AtReceivers.resizeDimension< 1 >( numReceiversGlobal * m_numShots );
+  m_pressureObservedAtReceivers.resizeDimension< 1 >( numReceiversGlobal );
 
 
 
@@ -181,11 +242,62 @@ void AcousticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
     FaceManager & faceManager = mesh.getFaceManager();
     faceManager.registerExtrinsicData< extrinsicMeshData::FreeSurfaceFaceIndicator >( this->getName() );
 
+    /// register the pressures of the shots only when several shots are propagated together
+    if( m_sourcesPerShot > 0 )
+    {
+      nodeManager.registerExtrinsicData< extrinsicMeshData::PressureShots_nm1,
+                                         extrinsicMeshData::PressureShots_n,
+                                         extrinsicMeshData::PressureShots_np1,
+                                         extrinsicMeshData::ForcingRHSShots,
+                                         extrinsicMeshData::StiffnessVectorShots >( this->getName() );
+
+      nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_nm1 >().resizeDimension< 1 >( m_numShots );
+      nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_n >().resizeDimension< 1 >( m_numShots );
+      nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_np1 >().resizeDimension< 1 >( m_numShots );
+      nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHSShots >().resizeDimension< 1 >( m_numShots );
+      nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVectorShots >().resizeDimension< 1 >( m_numShots );
+    }
+
+    /// register the time step levels only with local time stepping
+    if( m_numTimeSteppingLevels > 1 )
+    {
+      nodeManager.registerExtrinsicData< extrinsicMeshData::TimeSteppingLevel,
+                                         extrinsicMeshData::PressureStepStart >( this->getName() );
+
+      nodeManager.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::timeSteppingLevelNodesString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE );
+      nodeManager.excludeWrappersFromPacking( { viewKeyStruct::timeSteppingLevelNodesString() } );
+    }
+
+    /// register the adjoint variables only when the gradient is computed
+    if( m_computeGradient )
+    {
+      nodeManager.registerExtrinsicData< extrinsicMeshData::PressureAdjoint_nm1,
+                                         extrinsicMeshData::PressureAdjoint_n,
+                                         extrinsicMeshData::PressureAdjoint_np1,
+                                         extrinsicMeshData::AdjointImage,
+                                         extrinsicMeshData::NodalPartialGradient >( this->getName() );
+    }
+
     ElementRegionManager & elemManager = mesh.getElemManager();
 
     elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
     {
       subRegion.registerExtrinsicData< extrinsicMeshData::MediumVelocity >( this->getName() );
+      if( m_computeGradient )
+      {
+        subRegion.registerExtrinsicData< extrinsicMeshData::PartialGradient >( this->getName() );
+      }
+      if( m_numTimeSteppingLevels > 1 )
+      {
+        subRegion.registerExtrinsicData< extrinsicMeshData::TimeSteppingLevel >( this->getName() );
+
+        subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::timeSteppingLevelElementsString() ).
+          setPlotLevel( PlotLevel::NOPLOT ).
+          setRestartFlags( RestartFlags::NO_WRITE );
+        subRegion.excludeWrappersFromPacking( { viewKeyStruct::timeSteppingLevelElementsString() } );
+      }
     } );
 
   } );
@@ -204,17 +316,38 @@ void AcousticWaveEquationSEM::postProcessInput()
                   "Invalid number of physical coordinates for the receivers",
                   InputError );
 
+  GEOSX_THROW_IF( m_computeGradient && m_usePML,
+                  getName() << ": the backward run does not support PML",
+                  InputError );
+
+  GEOSX_THROW_IF( m_numCheckpoints < 0 || m_numCheckpointsInMemory < 0,
+                  getName() << ": the numbers of checkpoints must be non-negative",
+                  InputError );
+
+  GEOSX_THROW_IF( m_sourcesPerShot < 0 || ( m_sourcesPerShot > 0 && m_sourceCoordinates.size( 0 ) % m_sourcesPerShot != 0 ),
+                  getName() << ": the number of sources (" << m_sourceCoordinates.size( 0 ) << ") must be a multiple of "
+                            << viewKeyStruct::sourcesPerShotString() << " (" << m_sourcesPerShot << ")",
+                  InputError );
+
+  GEOSX_THROW_IF( m_sourcesPerShot > 0 && ( m_usePML || m_computeGradient ),
+                  getName() << ": the shots propagated together support neither PML nor the backward run",
+                  InputError );
+
+  m_numShots = ( m_sourcesPerShot > 0 ) ? m_sourceCoordinates.size( 0 ) / m_sourcesPerShot : 1;
+
+  GEOSX_THROW_IF( m_numTimeSteppingLevels < 1 || m_numTimeSteppingLevels > 16,
+                  getName() << ": " << viewKeyStruct::numTimeSteppingLevelsString() << " must be between 1 and 16",
+                  InputError );
+
+  GEOSX_THROW_IF( m_numTimeSteppingLevels > 1 && ( m_usePML || m_computeGradient || m_sourcesPerShot > 0 ),
+                  getName() << ": the local time stepping supports neither PML, nor the backward run, nor the shots propagated together",
+                  InputError );
+
+  m_levelFractions.resize( m_numTimeSteppingLevels );
+
   EventManager const & event = this->getGroupByPath< EventManager >( "/Problem/Events" );
   real64 const & maxTime = event.getReference< real64 >( EventManager::viewKeyStruct::maxTimeString() );
-  real64 dt = 0;
-  for( localIndex numSubEvent = 0; numSubEvent < event.numSubGroups(); ++numSubEvent )
-  {
-    EventBase const * subEvent = static_cast< EventBase const * >( event.getSubGroups()[numSubEvent] );
-    if( subEvent->getEventName() == "/Solvers/" + this->getName() )
-    {
-      dt = subEvent->getReference< real64 >( EventBase::viewKeyStruct::forceDtString() );
-    }
-  }
+  real64 const dt = getEventTimeStep();
 
   GEOSX_THROW_IF( dt < epsilonLoc*maxTime, "Value for dt: " << dt <<" is smaller than local threshold: " << epsilonLoc, std::runtime_error );
 
@@ -241,11 +374,27 @@ void AcousticWaveEquationSEM::postProcessInput()
   m_receiverConstants.resize( numReceiversGlobal, numNodesPerElem );
   m_receiverIsLocal.resize( numReceiversGlobal );
 
-  m_pressureNp1AtReceivers.resize( m_nsamplesSeismoTrace, numReceiversGlobal );
+  m_pressureNp1AtReceivers.resize( m_nsamplesSeismoTrace, numReceiversGlobal * m_numShots );
+  m_pressureObservedAtReceivers.resize( m_nsamplesSeismoTrace, numReceiversGlobal );
   m_sourceValue.resize( nsamples, numSourcesGlobal );
 
 }
 
+real64 AcousticWaveEquationSEM::getEventTimeStep() const
+{
+  real64 dt = 0;
+  EventManager const & event = this->getGroupByPath< EventManager >( "/Problem/Events" );
+  for( localIndex numSubEvent = 0; numSubEvent < event.numSubGroups(); ++numSubEvent )
+  {
+    EventBase const * subEvent = static_cast< EventBase const * >( event.getSubGroups()[numSubEvent] );
+    if( subEvent->getEventName() == "/Solvers/" + this->getName() )
+    {
+      dt = subEvent->getReference< real64 >( EventBase::viewKeyStruct::forceDtString() );
+    }
+  }
+  return dt;
+}
+
 void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
 {
@@ -277,16 +426,7 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
   real32 const timeSourceFrequency = this->m_timeSourceFrequency;
   localIndex const rickerOrder = this->m_rickerOrder;
   arrayView2d< real32 > const sourceValue = m_sourceValue.toView();
-  real64 dt = 0;
-  EventManager const & event = this->getGroupByPath< EventManager >( "/Problem/Events" );
-  for( localIndex numSubEvent = 0; numSubEvent < event.numSubGroups(); ++numSubEvent )
-  {
-    EventBase const * subEvent = static_cast< EventBase const * >( event.getSubGroups()[numSubEvent] );
-    if( subEvent->getEventName() == "/Solvers/" + this->getName() )
-    {
-      dt = subEvent->getReference< real64 >( EventBase::viewKeyStruct::forceDtString() );
-    }
-  }
+  real64 const dt = getEventTimeStep();
 
   // arrayView2d< real64 >  center;
 
@@ -374,13 +514,68 @@ void AcousticWaveEquationSEM::addSourceToRightHandSide( integer const & cycleNum
   } );
 }
 
+void AcousticWaveEquationSEM::addSourceToRightHandSideShots( integer const & cycleNumber, arrayView2d< real32 > const rhs )
+{
+  arrayView2d< localIndex const > const sourceNodeIds = m_sourceNodeIds.toViewConst();
+  arrayView2d< real64 const > const sourceConstants   = m_sourceConstants.toViewConst();
+  arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toViewConst();
+  arrayView2d< real32 const > const sourceValue   = m_sourceValue.toViewConst();
+  localIndex const sourcesPerShot = m_sourcesPerShot;
+
+  GEOSX_THROW_IF( cycleNumber > sourceValue.size( 0 ), "Too many steps compared to array size", std::runtime_error );
+  forAll< EXEC_POLICY >( sourceConstants.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const isrc )
+  {
+    if( sourceIsAccessible[isrc] == 1 )
+    {
+      localIndex const ishot = isrc / sourcesPerShot;
+      for( localIndex inode = 0; inode < sourceConstants.size( 1 ); ++inode )
+      {
+        real32 const localIncrement = sourceConstants[isrc][inode] * sourceValue[cycleNumber][isrc];
+        RAJA::atomicAdd< ATOMIC_POLICY >( &rhs[sourceNodeIds[isrc][inode]][ishot], localIncrement );
+      }
+    }
+  } );
+}
+
+void AcousticWaveEquationSEM::addSourceToRightHandSideLevel( integer const cycleNumber,
+                                                             real32 const fraction,
+                                                             integer const level,
+                                                             arrayView1d< integer const > const nodeLevel,
+                                                             arrayView1d< real32 > const rhs )
+{
+  arrayView2d< localIndex const > const sourceNodeIds = m_sourceNodeIds.toViewConst();
+  arrayView2d< real64 const > const sourceConstants   = m_sourceConstants.toViewConst();
+  arrayView1d< localIndex const > const sourceIsAccessible = m_sourceIsAccessible.toViewConst();
+  arrayView2d< real32 const > const sourceValue   = m_sourceValue.toViewConst();
+
+  GEOSX_THROW_IF( cycleNumber >= sourceValue.size( 0 ), "Too many steps compared to array size", std::runtime_error );
+  localIndex const nextCycle = ( cycleNumber + 1 < sourceValue.size( 0 ) ) ? cycleNumber + 1 : cycleNumber;
+  forAll< EXEC_POLICY >( sourceConstants.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const isrc )
+  {
+    if( sourceIsAccessible[isrc] == 1 )
+    {
+      real32 const value = sourceValue[cycleNumber][isrc] + fraction * ( sourceValue[nextCycle][isrc] - sourceValue[cycleNumber][isrc] );
+      for( localIndex inode = 0; inode < sourceConstants.size( 1 ); ++inode )
+      {
+        localIndex const a = sourceNodeIds[isrc][inode];
+        if( nodeLevel[a] == level )
+        {
+          real32 const localIncrement = sourceConstants[isrc][inode] * value;
+          RAJA::atomicAdd< ATOMIC_POLICY >( &rhs[a], localIncrement );
+        }
+      }
+    }
+  } );
+}
+
 void AcousticWaveEquationSEM::computeSeismoTrace( real64 const time_n,
                                                   real64 const dt,
                                                   real64 const timeSeismo,
                                                   localIndex iSeismo,
                                                   arrayView1d< real32 const > const var_np1,
                                                   arrayView1d< real32 const > const var_n,
-                                                  arrayView2d< real32 > varAtReceivers )
+                                                  arrayView2d< real32 > varAtReceivers,
+                                                  string const & varName )
 {
   real64 const time_np1 = time_n+dt;
   arrayView2d< localIndex const > const receiverNodeIds = m_receiverNodeIds.toViewConst();
@@ -412,7 +607,11 @@ void AcousticWaveEquationSEM::computeSeismoTrace( real64 const time_n,
 
   // TODO DEBUG: the following output is only temporary until our wave propagation kernels are finalized.
   // Output will then only be done via the previous code.
-  if( iSeismo == m_nsamplesSeismoTrace - 1 )
+  if( iSeismo == m_nsamplesSeismoTrace - 1 && m_outputSeismoTrace == 1 && m_outputSeismoTraceFormat == SeismoTraceFormat::HDF )
+  {
+    writeSeismoTraces( varName, varAtReceivers.toViewConst(), receiverIsLocal );
+  }
+  else if( iSeismo == m_nsamplesSeismoTrace - 1 )
   {
     forAll< serialPolicy >( receiverConstants.size( 0 ), [=] ( localIndex const ircv )
     {
@@ -454,6 +653,10 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
     AcousticWaveEquationSEM::initializePML();
   }
 
+  // a new forward run starts, for instance with another shot after reinit
+  m_checkpoints.reset();
+  m_numForwardSteps = 0;
+
   DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
 
   real64 const time = 0.0;
@@ -524,8 +727,138 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
                                                               damping );
       } );
     } );
+
+    if( m_numTimeSteppingLevels > 1 )
+    {
+      computeTimeSteppingLevels( domain, mesh, regionNames, getEventTimeStep() );
+    }
+  } );
+
+}
+
+void AcousticWaveEquationSEM::computeTimeSteppingLevels( DomainPartition & domain,
+                                                         MeshLevel & mesh,
+                                                         arrayView1d< string const > const & regionNames,
+                                                         real64 const dt )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
+  arrayView1d< integer > const nodeLevel = nodeManager.getExtrinsicData< extrinsicMeshData::TimeSteppingLevel >();
+  nodeLevel.zero();
+
+  integer const numLevels = m_numTimeSteppingLevels;
+  real64 minStableDt = LvArray::NumericLimits< real64 >::max;
+
+  /// the level of an element from its stable time step, and the level of a node from its finest element
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                        CellElementSubRegion & elementSubRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+    arrayView1d< real32 const > const velocity = elementSubRegion.getExtrinsicData< extrinsicMeshData::MediumVelocity >();
+    arrayView1d< integer > const elemLevel = elementSubRegion.getExtrinsicData< extrinsicMeshData::TimeSteppingLevel >();
+
+    array1d< real64 > stableDt( elementSubRegion.size() );
+    localTimeStepping::computeElementStableTimeSteps< EXEC_POLICY >( X,
+                                                                     elemsToNodes,
+                                                                     [velocity] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      return velocity[k];
+    },
+                                                                     m_cflFactor,
+                                                                     stableDt.toView() );
+
+    arrayView1d< real64 const > const stableDtView = stableDt.toViewConst();
+    RAJA::ReduceMin< ReducePolicy< EXEC_POLICY >, real64 > subRegionMinStableDt( minStableDt );
+    forAll< EXEC_POLICY >( elementSubRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      integer const level = localTimeStepping::timeSteppingLevel( dt, stableDtView[k], numLevels );
+      elemLevel[k] = level;
+      subRegionMinStableDt.min( stableDtView[k] );
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        RAJA::atomicMax< ATOMIC_POLICY >( &nodeLevel[elemsToNodes[k][a]], level );
+      }
+    } );
+    minStableDt = LvArray::math::min( minStableDt, subRegionMinStableDt.get() );
+  } );
+
+  /// the ghost nodes may miss some of their elements, their level comes from their owner
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { extrinsicMeshData::TimeSteppingLevel::key() } );
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                       mesh,
+                                                       domain.getNeighbors(),
+                                                       false );
+
+  /// list the nodes of each level
+  nodeLevel.move( LvArray::MemorySpace::host, false );
+  array1d< localIndex > numNodesPerLevel( numLevels );
+  integer finestLevel = 0;
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    ++numNodesPerLevel[nodeLevel[a]];
+    finestLevel = LvArray::math::max( finestLevel, nodeLevel[a] );
+  }
+  m_finestTimeSteppingLevel = MpiWrapper::max( finestLevel );
+
+  ArrayOfArrays< localIndex > & levelNodes =
+    nodeManager.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::timeSteppingLevelNodesString() );
+  levelNodes.resizeFromCapacities< serialPolicy >( numLevels, numNodesPerLevel.data() );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    levelNodes.emplaceBack( nodeLevel[a], a );
+  }
+
+  /// list the elements at the levels of their nodes, they contribute to the stiffness vectors of all of them
+  array1d< globalIndex > numElementsPerLevel( numLevels );
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                        CellElementSubRegion & elementSubRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+    arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
+    arrayView1d< integer const > const elemLevel = elementSubRegion.getExtrinsicData< extrinsicMeshData::TimeSteppingLevel >();
+    elemLevel.move( LvArray::MemorySpace::host, false );
+
+    array2d< integer > elemHasLevel( elementSubRegion.size(), numLevels );
+    array1d< localIndex > numElemsPerLevel( numLevels );
+    for( localIndex k = 0; k < elementSubRegion.size(); ++k )
+    {
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        elemHasLevel[k][nodeLevel[elemsToNodes[k][a]]] = 1;
+      }
+      for( integer level = 0; level < numLevels; ++level )
+      {
+        numElemsPerLevel[level] += elemHasLevel[k][level];
+      }
+      if( elemGhostRank[k] < 0 )
+      {
+        ++numElementsPerLevel[elemLevel[k]];
+      }
+    }
+
+    ArrayOfArrays< localIndex > & levelElements =
+      elementSubRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::timeSteppingLevelElementsString() );
+    levelElements.resizeFromCapacities< serialPolicy >( numLevels, numElemsPerLevel.data() );
+    for( localIndex k = 0; k < elementSubRegion.size(); ++k )
+    {
+      for( integer level = 0; level < numLevels; ++level )
+      {
+        if( elemHasLevel[k][level] == 1 )
+        {
+          levelElements.emplaceBack( level, k );
+        }
+      }
+    }
   } );
 
+  localTimeStepping::logTimeSteppingLevels( getName(), dt, numElementsPerLevel );
+
+  minStableDt = MpiWrapper::min( minStableDt );
+  GEOSX_LOG_RANK_0_IF( dt / std::pow( 2.0, numLevels - 1 ) > minStableDt,
+                       "Warning! " << getName() << ": the time step of the finest level, " << dt / std::pow( 2.0, numLevels - 1 )
+                                   << " s, exceeds the smallest stable time step of the elements, " << minStableDt
+                                   << " s. Increase " << viewKeyStruct::numTimeSteppingLevelsString() );
 }
 
 
@@ -541,6 +874,15 @@ void AcousticWaveEquationSEM::applyFreeSurfaceBC( real64 const time, DomainParti
   arrayView1d< real32 > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
   arrayView1d< real32 > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
 
+  /// pressures of the shots propagated together, empty views otherwise
+  arrayView2d< real32 > pShots_nm1, pShots_n, pShots_np1;
+  if( m_sourcesPerShot > 0 )
+  {
+    pShots_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_nm1 >();
+    pShots_n = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_n >();
+    pShots_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_np1 >();
+  }
+
   ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
 
   /// array of indicators: 1 if a face is on on free surface; 0 otherwise
@@ -581,6 +923,13 @@ void AcousticWaveEquationSEM::applyFreeSurfaceBC( real64 const time, DomainParti
           p_np1[dof] = value;
           p_n[dof]   = value;
           p_nm1[dof] = value;
+
+          for( localIndex ishot = 0; ishot < pShots_n.size( 1 ); ++ishot )
+          {
+            pShots_np1[dof][ishot] = value;
+            pShots_n[dof][ishot]   = value;
+            pShots_nm1[dof][ishot] = value;
+          }
         }
       }
     }
@@ -971,168 +1320,761 @@ real64 AcousticWaveEquationSEM::explicitStep( real64 const & time_n,
 
   GEOSX_LOG_RANK_0_IF( dt < epsilonLoc, "Warning! Value for dt: " << dt << "s is smaller than local threshold: " << epsilonLoc );
 
+  if( m_computeGradient )
+  {
+    // the initial state is the first checkpoint of the backward run, which replays the forward steps from it
+    if( m_numForwardSteps == 0 )
+    {
+      m_forwardTime0 = time_n;
+      m_forwardCycle0 = cycleNumber;
+      m_forwardDt = dt;
+      m_checkpoints = std::make_unique< WaveCheckpointStorage >( m_numCheckpointsInMemory,
+                                                                 m_checkpointCompression,
+                                                                 m_checkpointFilePrefix );
+      std::vector< arrayView1d< real32 > > const state = getForwardState( domain );
+      m_checkpoints->store( 0, std::vector< arrayView1d< real32 const > >( state.begin(), state.end() ) );
+    }
+    GEOSX_THROW_IF( std::abs( dt - m_forwardDt ) > epsilonLoc * m_forwardDt,
+                    getName() << ": the backward run requires a constant time step",
+                    std::runtime_error );
+    ++m_numForwardSteps;
+  }
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(),
                                   [&] ( string const &,
                                         MeshLevel & mesh,
                                         arrayView1d< string const > const & regionNames )
   {
-    NodeManager & nodeManager = mesh.getNodeManager();
+    if( m_sourcesPerShot > 0 )
+    {
+      computePressureNp1Shots( time_n, dt, cycleNumber, domain, mesh, regionNames );
 
-    arrayView1d< real32 const > const mass = nodeManager.getExtrinsicData< extrinsicMeshData::MassVector >();
-    arrayView1d< real32 const > const damping = nodeManager.getExtrinsicData< extrinsicMeshData::DampingVector >();
+      NodeManager & nodeManager = mesh.getNodeManager();
+      arrayView2d< real32 const > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_n >();
+      arrayView2d< real32 const > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_np1 >();
 
-    arrayView1d< real32 > const p_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_nm1 >();
-    arrayView1d< real32 > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
-    arrayView1d< real32 > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
+      computeAllSeismoTracesShots( time_n, dt, p_np1, p_n, m_pressureNp1AtReceivers.toView() );
 
-    arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getExtrinsicData< extrinsicMeshData::FreeSurfaceNodeIndicator >();
-    arrayView1d< real32 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >();
-    arrayView1d< real32 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHS >();
+      prepareNextStepShots( nodeManager );
+      return;
+    }
 
-    bool const usePML = m_usePML;
+    if( m_numTimeSteppingLevels > 1 )
+    {
+      explicitStepLocalTimeStepping( time_n, dt, cycleNumber, domain, mesh, regionNames );
+      return;
+    }
 
-    auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
+    computePressureNp1( time_n, dt, cycleNumber, domain, mesh, regionNames );
 
-    finiteElement::
-      regionBasedKernelApplication< EXEC_POLICY,
-                                    constitutive::NullModel,
-                                    CellElementSubRegion >( mesh,
-                                                            regionNames,
-                                                            getDiscretizationName(),
-                                                            "",
-                                                            kernelFactory );
+    NodeManager & nodeManager = mesh.getNodeManager();
+    arrayView1d< real32 const > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
+    arrayView1d< real32 const > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
 
-    addSourceToRightHandSide( cycleNumber, rhs );
+    // compute the seismic traces since last step.
+    arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
 
-    /// calculate your time integrators
-    real64 const dt2 = dt*dt;
+    computeAllSeismoTraces( time_n, dt, p_np1, p_n, pReceivers, viewKeyStruct::pressureNp1AtReceiversString() );
 
-    if( !usePML )
-    {
-      GEOSX_MARK_SCOPE ( updateP );
-      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
-      {
-        if( freeSurfaceNodeIndicator[a] != 1 )
-        {
-          p_np1[a] = p_n[a];
-          p_np1[a] *= 2.0*mass[a];
-          p_np1[a] -= (mass[a]-0.5*dt*damping[a])*p_nm1[a];
-          p_np1[a] += dt2*(rhs[a]-stiffnessVector[a]);
-          p_np1[a] /= mass[a]+0.5*dt*damping[a];
-        }
-      } );
-    }
-    else
-    {
-      parametersPML const & param = getReference< parametersPML >( viewKeyStruct::parametersPMLString() );
-      arrayView2d< real32 > const v_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar1PML >();
-      arrayView2d< real32 > const grad_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar2PML >();
-      arrayView1d< real32 > const divV_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar3PML >();
-      arrayView1d< real32 > const u_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar4PML >();
-      arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
-
-      real32 const xMin[ 3 ] = {param.xMinPML[0], param.xMinPML[1], param.xMinPML[2]};
-      real32 const xMax[ 3 ] = {param.xMaxPML[0], param.xMaxPML[1], param.xMaxPML[2]};
-      real32 const dMin[ 3 ] = {param.thicknessMinXYZPML[0], param.thicknessMinXYZPML[1], param.thicknessMinXYZPML[2]};
-      real32 const dMax[ 3 ] = {param.thicknessMaxXYZPML[0], param.thicknessMaxXYZPML[1], param.thicknessMaxXYZPML[2]};
-      real32 const cMin[ 3 ] = {param.waveSpeedMinXYZPML[0], param.waveSpeedMinXYZPML[1], param.waveSpeedMinXYZPML[2]};
-      real32 const cMax[ 3 ] = {param.waveSpeedMaxXYZPML[0], param.waveSpeedMaxXYZPML[1], param.waveSpeedMaxXYZPML[2]};
-      real32 const r = param.reflectivityPML;
+    prepareNextStep( nodeManager );
+  } );
 
-      /// apply the main function to update some of the PML auxiliary variables
-      /// Compute (divV) and (B.pressureGrad - C.auxUGrad) vectors for the PML region
-      applyPML( time_n, domain );
+  return dt;
+}
 
-      GEOSX_MARK_SCOPE ( updatePWithPML );
-      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
-      {
-        if( freeSurfaceNodeIndicator[a] != 1 )
-        {
-          real32 sigma[3];
-          real64 xLocal[ 3 ];
+void AcousticWaveEquationSEM::computePressureNp1( real64 const time_n,
+                                                  real64 const dt,
+                                                  integer const cycleNumber,
+                                                  DomainPartition & domain,
+                                                  MeshLevel & mesh,
+                                                  arrayView1d< string const > const & regionNames )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
 
-          for( integer i=0; i<3; ++i )
-          {
-            xLocal[i] = X[a][i];
-          }
+  arrayView1d< real32 const > const mass = nodeManager.getExtrinsicData< extrinsicMeshData::MassVector >();
+  arrayView1d< real32 const > const damping = nodeManager.getExtrinsicData< extrinsicMeshData::DampingVector >();
 
-          acousticWaveEquationSEMKernels::PMLKernelHelper::computeDampingProfilePML(
-            xLocal,
-            xMin,
-            xMax,
-            dMin,
-            dMax,
-            cMin,
-            cMax,
-            r,
-            sigma );
+  arrayView1d< real32 > const p_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_nm1 >();
+  arrayView1d< real32 > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
+  arrayView1d< real32 > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
 
-          real32 const alpha = sigma[0] + sigma[1] + sigma[2];
+  arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getExtrinsicData< extrinsicMeshData::FreeSurfaceNodeIndicator >();
+  arrayView1d< real32 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >();
+  arrayView1d< real32 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHS >();
 
-          p_np1[a] = dt2*( (rhs[a] - stiffnessVector[a])/mass[a] - divV_n[a])
-                     - (1 - 0.5*alpha*dt)*p_nm1[a]
-                     + 2*p_n[a];
+  bool const usePML = m_usePML;
 
-          p_np1[a] = p_np1[a] / (1 + 0.5*alpha*dt);
+  auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt, extrinsicMeshData::Pressure_n::key() );
 
-          for( integer i=0; i<3; ++i )
-          {
-            v_n[a][i] = (1 - dt*sigma[i])*v_n[a][i] - dt*grad_n[a][i];
-          }
-          u_n[a] += dt*p_n[a];
-        }
-      } );
-    }
+  finiteElement::
+    regionBasedKernelApplication< EXEC_POLICY,
+                                  constitutive::NullModel,
+                                  CellElementSubRegion >( mesh,
+                                                          regionNames,
+                                                          getDiscretizationName(),
+                                                          "",
+                                                          kernelFactory );
 
-    /// synchronize pressure fields
-    FieldIdentifiers fieldsToBeSync;
-    fieldsToBeSync.addFields( FieldLocation::Node, { extrinsicMeshData::Pressure_np1::key() } );
+  addSourceToRightHandSide( cycleNumber, rhs );
 
-    if( usePML )
-    {
-      fieldsToBeSync.addFields( FieldLocation::Node, {
-          extrinsicMeshData::AuxiliaryVar1PML::key(),
-          extrinsicMeshData::AuxiliaryVar4PML::key() } );
-    }
+  /// calculate your time integrators
+  real64 const dt2 = dt*dt;
 
-    CommunicationTools & syncFields = CommunicationTools::getInstance();
-    syncFields.synchronizeFields( fieldsToBeSync,
-                                  mesh,
-                                  domain.getNeighbors(),
-                                  true );
+  if( !usePML )
+  {
+    GEOSX_MARK_SCOPE ( updateP );
+    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+    {
+      if( freeSurfaceNodeIndicator[a] != 1 )
+      {
+        p_np1[a] = p_n[a];
+        p_np1[a] *= 2.0*mass[a];
+        p_np1[a] -= (mass[a]-0.5*dt*damping[a])*p_nm1[a];
+        p_np1[a] += dt2*(rhs[a]-stiffnessVector[a]);
+        p_np1[a] /= mass[a]+0.5*dt*damping[a];
+      }
+    } );
+  }
+  else
+  {
+    parametersPML const & param = getReference< parametersPML >( viewKeyStruct::parametersPMLString() );
+    arrayView2d< real32 > const v_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar1PML >();
+    arrayView2d< real32 > const grad_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar2PML >();
+    arrayView1d< real32 > const divV_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar3PML >();
+    arrayView1d< real32 > const u_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar4PML >();
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
 
-    // compute the seismic traces since last step.
-    arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
+    real32 const xMin[ 3 ] = {param.xMinPML[0], param.xMinPML[1], param.xMinPML[2]};
+    real32 const xMax[ 3 ] = {param.xMaxPML[0], param.xMaxPML[1], param.xMaxPML[2]};
+    real32 const dMin[ 3 ] = {param.thicknessMinXYZPML[0], param.thicknessMinXYZPML[1], param.thicknessMinXYZPML[2]};
+    real32 const dMax[ 3 ] = {param.thicknessMaxXYZPML[0], param.thicknessMaxXYZPML[1], param.thicknessMaxXYZPML[2]};
+    real32 const cMin[ 3 ] = {param.waveSpeedMinXYZPML[0], param.waveSpeedMinXYZPML[1], param.waveSpeedMinXYZPML[2]};
+    real32 const cMax[ 3 ] = {param.waveSpeedMaxXYZPML[0], param.waveSpeedMaxXYZPML[1], param.waveSpeedMaxXYZPML[2]};
+    real32 const r = param.reflectivityPML;
 
-    computeAllSeismoTraces( time_n, dt, p_np1, p_n, pReceivers );
+    /// apply the main function to update some of the PML auxiliary variables
+    /// Compute (divV) and (B.pressureGrad - C.auxUGrad) vectors for the PML region
+    applyPML( time_n, domain );
 
-    /// prepare next step
+    GEOSX_MARK_SCOPE ( updatePWithPML );
     forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
     {
-      p_nm1[a] = p_n[a];
-      p_n[a]   = p_np1[a];
+      if( freeSurfaceNodeIndicator[a] != 1 )
+      {
+        real32 sigma[3];
+        real64 xLocal[ 3 ];
 
-      stiffnessVector[a] = 0.0;
-      rhs[a] = 0.0;
-    } );
+        for( integer i=0; i<3; ++i )
+        {
+          xLocal[i] = X[a][i];
+        }
 
-    if( usePML )
-    {
-      arrayView2d< real32 > const grad_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar2PML >();
-      arrayView1d< real32 > const divV_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar3PML >();
-      grad_n.zero();
-      divV_n.zero();
-    }
+        acousticWaveEquationSEMKernels::PMLKernelHelper::computeDampingProfilePML(
+          xLocal,
+          xMin,
+          xMax,
+          dMin,
+          dMax,
+          cMin,
+          cMax,
+          r,
+          sigma );
 
-  } );
+        real32 const alpha = sigma[0] + sigma[1] + sigma[2];
 
-  return dt;
-}
+        p_np1[a] = dt2*( (rhs[a] - stiffnessVector[a])/mass[a] - divV_n[a])
+                   - (1 - 0.5*alpha*dt)*p_nm1[a]
+                   + 2*p_n[a];
 
-void AcousticWaveEquationSEM::cleanup( real64 const time_n,
-                                       integer const cycleNumber,
-                                       integer const eventCounter,
-                                       real64 const eventProgress,
+        p_np1[a] = p_np1[a] / (1 + 0.5*alpha*dt);
+
+        for( integer i=0; i<3; ++i )
+        {
+          v_n[a][i] = (1 - dt*sigma[i])*v_n[a][i] - dt*grad_n[a][i];
+        }
+        u_n[a] += dt*p_n[a];
+      }
+    } );
+  }
+
+  /// synchronize pressure fields
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { extrinsicMeshData::Pressure_np1::key() } );
+
+  if( usePML )
+  {
+    fieldsToBeSync.addFields( FieldLocation::Node, {
+        extrinsicMeshData::AuxiliaryVar1PML::key(),
+        extrinsicMeshData::AuxiliaryVar4PML::key() } );
+  }
+
+  CommunicationTools & syncFields = CommunicationTools::getInstance();
+  syncFields.synchronizeFields( fieldsToBeSync,
+                                mesh,
+                                domain.getNeighbors(),
+                                true );
+}
+
+void AcousticWaveEquationSEM::explicitStepLocalTimeStepping( real64 const time_n,
+                                                             real64 const dt,
+                                                             integer const cycleNumber,
+                                                             DomainPartition & domain,
+                                                             MeshLevel & mesh,
+                                                             arrayView1d< string const > const & regionNames )
+{
+  GEOSX_MARK_FUNCTION;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView1d< real32 const > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
+  arrayView1d< real32 > const pStart = nodeManager.getExtrinsicData< extrinsicMeshData::PressureStepStart >();
+
+  forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    pStart[a] = p_n[a];
+  } );
+
+  std::vector< real64 > levelStartTimes( m_numTimeSteppingLevels, time_n );
+  advanceTimeSteppingLevel( 0, time_n, time_n, dt, cycleNumber, levelStartTimes, domain, mesh, regionNames );
+
+  // all the nodes have reached time_n + dt, and the pressure at time_n was saved at the beginning of the step
+  arrayView2d< real32 > const pReceivers = m_pressureNp1AtReceivers.toView();
+  computeAllSeismoTraces( time_n, dt, p_n, pStart.toViewConst(), pReceivers, viewKeyStruct::pressureNp1AtReceiversString() );
+}
+
+void AcousticWaveEquationSEM::advanceTimeSteppingLevel( integer const level,
+                                                        real64 const time,
+                                                        real64 const time_n,
+                                                        real64 const dt,
+                                                        integer const cycleNumber,
+                                                        std::vector< real64 > & levelStartTimes,
+                                                        DomainPartition & domain,
+                                                        MeshLevel & mesh,
+                                                        arrayView1d< string const > const & regionNames )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
+
+  arrayView1d< real32 const > const mass = nodeManager.getExtrinsicData< extrinsicMeshData::MassVector >();
+  arrayView1d< real32 const > const damping = nodeManager.getExtrinsicData< extrinsicMeshData::DampingVector >();
+
+  arrayView1d< real32 > const p_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_nm1 >();
+  arrayView1d< real32 > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
+  arrayView1d< real32 > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
+
+  arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getExtrinsicData< extrinsicMeshData::FreeSurfaceNodeIndicator >();
+  arrayView1d< real32 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >();
+  arrayView1d< real32 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHS >();
+  arrayView1d< integer const > const nodeLevel = nodeManager.getExtrinsicData< extrinsicMeshData::TimeSteppingLevel >();
+  ArrayOfArraysView< localIndex const > const levelNodes =
+    nodeManager.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::timeSteppingLevelNodesString() ).toViewConst();
+
+  real64 const levelDt = dt / std::pow( 2.0, level );
+  levelStartTimes[level] = time;
+
+  /// the nodes of the coarser levels are somewhere in their current step
+  m_levelFractions.move( LvArray::MemorySpace::host, true );
+  for( integer coarserLevel = 0; coarserLevel < level; ++coarserLevel )
+  {
+    m_levelFractions[coarserLevel] = static_cast< real32 >( ( time - levelStartTimes[coarserLevel] ) * std::pow( 2.0, coarserLevel ) / dt );
+  }
+
+  auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMLocalTimeSteppingFactory( levelDt,
+                                                                                                     level,
+                                                                                                     m_levelFractions.toViewConst(),
+                                                                                                     viewKeyStruct::timeSteppingLevelElementsString() );
+
+  finiteElement::
+    regionBasedKernelApplication< EXEC_POLICY,
+                                  constitutive::NullModel,
+                                  CellElementSubRegion >( mesh,
+                                                          regionNames,
+                                                          getDiscretizationName(),
+                                                          "",
+                                                          kernelFactory );
+
+  addSourceToRightHandSideLevel( cycleNumber, static_cast< real32 >( ( time - time_n ) / dt ), level, nodeLevel, rhs );
+
+  real64 const dt2 = levelDt*levelDt;
+  forAll< EXEC_POLICY >( levelNodes.sizeOfArray( level ), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const a = levelNodes( level, i );
+    if( freeSurfaceNodeIndicator[a] != 1 )
+    {
+      p_np1[a] = p_n[a];
+      p_np1[a] *= 2.0*mass[a];
+      p_np1[a] -= (mass[a]-0.5*levelDt*damping[a])*p_nm1[a];
+      p_np1[a] += dt2*(rhs[a]-stiffnessVector[a]);
+      p_np1[a] /= mass[a]+0.5*levelDt*damping[a];
+    }
+  } );
+
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { extrinsicMeshData::Pressure_np1::key() } );
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                       mesh,
+                                                       domain.getNeighbors(),
+                                                       true );
+
+  /// the finer levels catch up with two steps of half the size, while this level is between p_n and p_np1
+  if( level < m_finestTimeSteppingLevel )
+  {
+    advanceTimeSteppingLevel( level + 1, time, time_n, dt, cycleNumber, levelStartTimes, domain, mesh, regionNames );
+    advanceTimeSteppingLevel( level + 1, time + 0.5 * levelDt, time_n, dt, cycleNumber, levelStartTimes, domain, mesh, regionNames );
+  }
+
+  forAll< EXEC_POLICY >( levelNodes.sizeOfArray( level ), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const a = levelNodes( level, i );
+    p_nm1[a] = p_n[a];
+    p_n[a]   = p_np1[a];
+
+    stiffnessVector[a] = 0.0;
+    rhs[a] = 0.0;
+  } );
+}
+
+void AcousticWaveEquationSEM::prepareNextStep( NodeManager & nodeManager )
+{
+  arrayView1d< real32 > const p_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_nm1 >();
+  arrayView1d< real32 > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
+  arrayView1d< real32 const > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
+  arrayView1d< real32 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >();
+  arrayView1d< real32 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHS >();
+
+  forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    p_nm1[a] = p_n[a];
+    p_n[a]   = p_np1[a];
+
+    stiffnessVector[a] = 0.0;
+    rhs[a] = 0.0;
+  } );
+
+  if( m_usePML )
+  {
+    arrayView2d< real32 > const grad_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar2PML >();
+    arrayView1d< real32 > const divV_n = nodeManager.getExtrinsicData< extrinsicMeshData::AuxiliaryVar3PML >();
+    grad_n.zero();
+    divV_n.zero();
+  }
+}
+
+void AcousticWaveEquationSEM::computePressureNp1Shots( real64 const time_n,
+                                                       real64 const dt,
+                                                       integer const cycleNumber,
+                                                       DomainPartition & domain,
+                                                       MeshLevel & mesh,
+                                                       arrayView1d< string const > const & regionNames )
+{
+  GEOSX_UNUSED_VAR( time_n );
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+
+  arrayView1d< real32 const > const mass = nodeManager.getExtrinsicData< extrinsicMeshData::MassVector >();
+  arrayView1d< real32 const > const damping = nodeManager.getExtrinsicData< extrinsicMeshData::DampingVector >();
+
+  arrayView2d< real32 const > const p_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_nm1 >();
+  arrayView2d< real32 const > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_n >();
+  arrayView2d< real32 > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_np1 >();
+
+  arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getExtrinsicData< extrinsicMeshData::FreeSurfaceNodeIndicator >();
+  arrayView2d< real32 const > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVectorShots >();
+  arrayView2d< real32 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHSShots >();
+
+  localIndex const numShots = m_numShots;
+
+  /// the mesh data are traversed once per launch, for numShotsPerLaunch shots at a time
+  for( localIndex firstShot = 0; firstShot < numShots; firstShot += acousticWaveEquationSEMKernels::numShotsPerLaunch )
+  {
+    auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMShotsFactory( dt, firstShot );
+
+    finiteElement::
+      regionBasedKernelApplication< EXEC_POLICY,
+                                    constitutive::NullModel,
+                                    CellElementSubRegion >( mesh,
+                                                            regionNames,
+                                                            getDiscretizationName(),
+                                                            "",
+                                                            kernelFactory );
+  }
+
+  addSourceToRightHandSideShots( cycleNumber, rhs );
+
+  /// calculate your time integrators
+  real64 const dt2 = dt*dt;
+
+  GEOSX_MARK_SCOPE ( updatePShots );
+  forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    if( freeSurfaceNodeIndicator[a] != 1 )
+    {
+      real32 const invDiagonal = 1.0 / ( mass[a]+0.5*dt*damping[a] );
+      for( localIndex ishot = 0; ishot < numShots; ++ishot )
+      {
+        p_np1[a][ishot] = ( 2.0*mass[a]*p_n[a][ishot]
+                            - (mass[a]-0.5*dt*damping[a])*p_nm1[a][ishot]
+                            + dt2*(rhs[a][ishot]-stiffnessVector[a][ishot]) ) * invDiagonal;
+      }
+    }
+  } );
+
+  /// synchronize pressure fields
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { extrinsicMeshData::PressureShots_np1::key() } );
+
+  CommunicationTools & syncFields = CommunicationTools::getInstance();
+  syncFields.synchronizeFields( fieldsToBeSync,
+                                mesh,
+                                domain.getNeighbors(),
+                                true );
+}
+
+void AcousticWaveEquationSEM::prepareNextStepShots( NodeManager & nodeManager )
+{
+  arrayView2d< real32 > const p_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_nm1 >();
+  arrayView2d< real32 > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_n >();
+  arrayView2d< real32 const > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_np1 >();
+  arrayView2d< real32 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVectorShots >();
+  arrayView2d< real32 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHSShots >();
+
+  localIndex const numShots = m_numShots;
+
+  forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    for( localIndex ishot = 0; ishot < numShots; ++ishot )
+    {
+      p_nm1[a][ishot] = p_n[a][ishot];
+      p_n[a][ishot]   = p_np1[a][ishot];
+
+      stiffnessVector[a][ishot] = 0.0;
+      rhs[a][ishot] = 0.0;
+    }
+  } );
+}
+
+std::vector< arrayView1d< real32 > > AcousticWaveEquationSEM::getForwardState( DomainPartition & domain )
+{
+  std::vector< arrayView1d< real32 > > state;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    state.emplace_back( nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_nm1 >().toView() );
+    state.emplace_back( nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >().toView() );
+  } );
+  return state;
+}
+
+void AcousticWaveEquationSEM::advanceForward( DomainPartition & domain,
+                                              localIndex const fromStep,
+                                              localIndex const toStep )
+{
+  GEOSX_MARK_FUNCTION;
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & regionNames )
+  {
+    for( localIndex step = fromStep; step < toStep; ++step )
+    {
+      computePressureNp1( m_forwardTime0 + step * m_forwardDt,
+                          m_forwardDt,
+                          LvArray::integerConversion< integer >( m_forwardCycle0 + step ),
+                          domain,
+                          mesh,
+                          regionNames );
+      prepareNextStep( mesh.getNodeManager() );
+    }
+  } );
+}
+
+void AcousticWaveEquationSEM::computeAdjoint( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  GEOSX_THROW_IF( m_checkpoints == nullptr,
+                  getName() << ": the backward run requires computeGradient and at least one forward step",
+                  std::runtime_error );
+
+  // residuals of the receivers local to this rank, then summed so that the ranks holding the receivers in a
+  // ghost element also get them
+  localIndex const numSamples = m_pressureNp1AtReceivers.size( 0 );
+  localIndex const numReceivers = m_pressureNp1AtReceivers.size( 1 );
+  array2d< real32 > localResiduals( numSamples, numReceivers );
+  m_residuals.resize( numSamples, numReceivers );
+  m_pressureNp1AtReceivers.move( LvArray::MemorySpace::host, false );
+  m_pressureObservedAtReceivers.move( LvArray::MemorySpace::host, false );
+  m_receiverIsLocal.move( LvArray::MemorySpace::host, false );
+  for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+  {
+    for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+    {
+      if( m_receiverIsLocal[ircv] == 1 )
+      {
+        localResiduals[iSample][ircv] = m_pressureNp1AtReceivers[iSample][ircv] - m_pressureObservedAtReceivers[iSample][ircv];
+      }
+    }
+  }
+  MpiWrapper::allReduce( localResiduals.data(),
+                         m_residuals.data(),
+                         LvArray::integerConversion< int >( localResiduals.size() ),
+                         MPI_SUM,
+                         MPI_COMM_GEOSX );
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    nodeManager.getExtrinsicData< extrinsicMeshData::PressureAdjoint_nm1 >().zero();
+    nodeManager.getExtrinsicData< extrinsicMeshData::PressureAdjoint_n >().zero();
+    nodeManager.getExtrinsicData< extrinsicMeshData::PressureAdjoint_np1 >().zero();
+    nodeManager.getExtrinsicData< extrinsicMeshData::AdjointImage >().zero();
+    nodeManager.getExtrinsicData< extrinsicMeshData::NodalPartialGradient >().zero();
+    nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >().zero();
+    nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHS >().zero();
+
+  } );
+
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": backward run over " << m_numForwardSteps << " steps with "
+                                       << m_numCheckpoints << " checkpoints" );
+
+  reverseSweep( domain, 0, m_numForwardSteps, 0, m_numCheckpoints );
+
+  // the derivative of the lumped mass of a node with respect to the squared slowness of a cell is the
+  // integral of the basis function of the node over the cell, and the misfit is integrated in time
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
+    arrayView1d< real32 const > const nodalGradient = nodeManager.getExtrinsicData< extrinsicMeshData::NodalPartialGradient >();
+
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & elementSubRegion )
+    {
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+      arrayView1d< real32 > const gradient = elementSubRegion.getExtrinsicData< extrinsicMeshData::PartialGradient >();
+
+      finiteElement::FiniteElementBase const &
+      fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
+      finiteElement::dispatch3D( fe,
+                                 [&]
+                                   ( auto const finiteElement )
+      {
+        using FE_TYPE = TYPEOFREF( finiteElement );
+
+        acousticWaveEquationSEMKernels::PartialGradientKernel< FE_TYPE > kernel( finiteElement );
+        kernel.template launch< EXEC_POLICY >( elementSubRegion.size(),
+                                               X,
+                                               elemsToNodes,
+                                               nodalGradient,
+                                               m_dtSeismoTrace,
+                                               gradient );
+      } );
+    } );
+  } );
+
+  m_checkpoints.reset();
+  m_numForwardSteps = 0;
+}
+
+void AcousticWaveEquationSEM::reverseSweep( DomainPartition & domain,
+                                            localIndex const start,
+                                            localIndex end,
+                                            integer const slot,
+                                            integer const numFreeSlots )
+{
+  while( end > start )
+  {
+    if( end - start > 1 && numFreeSlots > 0 )
+    {
+      // store an intermediate state and process the steps after it first
+      localIndex const split = WaveCheckpointStorage::revolveSplit( start, end, numFreeSlots );
+      m_checkpoints->restore( slot, getForwardState( domain ) );
+      advanceForward( domain, start, split );
+      std::vector< arrayView1d< real32 > > const state = getForwardState( domain );
+      m_checkpoints->store( slot + 1, std::vector< arrayView1d< real32 const > >( state.begin(), state.end() ) );
+      reverseSweep( domain, split, end, slot + 1, numFreeSlots - 1 );
+      m_checkpoints->release( slot + 1 );
+      end = split;
+    }
+    else
+    {
+      m_checkpoints->restore( slot, getForwardState( domain ) );
+      advanceForward( domain, start, end - 1 );
+      adjointStep( domain, end - 1 );
+      --end;
+    }
+  }
+}
+
+void AcousticWaveEquationSEM::adjointStep( DomainPartition & domain,
+                                           localIndex const step )
+{
+  GEOSX_MARK_FUNCTION;
+
+  real64 const dt = m_forwardDt;
+  real64 const dt2 = dt*dt;
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+
+    arrayView1d< real32 const > const mass = nodeManager.getExtrinsicData< extrinsicMeshData::MassVector >();
+    arrayView1d< real32 const > const damping = nodeManager.getExtrinsicData< extrinsicMeshData::DampingVector >();
+    arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getExtrinsicData< extrinsicMeshData::FreeSurfaceNodeIndicator >();
+    arrayView1d< real32 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >();
+    arrayView1d< real32 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHS >();
+
+    arrayView1d< real32 > const q_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureAdjoint_nm1 >();
+    arrayView1d< real32 > const q_n = nodeManager.getExtrinsicData< extrinsicMeshData::PressureAdjoint_n >();
+    arrayView1d< real32 > const q_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureAdjoint_np1 >();
+
+    // the adjoint of the forward step from n to n+1 is the step from the multiplier at n+1 to the one at n,
+    // with the same scheme run backward in time and the receiver residuals at time n+1 as sources
+    auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt, extrinsicMeshData::PressureAdjoint_n::key() );
+
+    finiteElement::
+      regionBasedKernelApplication< EXEC_POLICY,
+                                    constitutive::NullModel,
+                                    CellElementSubRegion >( mesh,
+                                                            regionNames,
+                                                            getDiscretizationName(),
+                                                            "",
+                                                            kernelFactory );
+
+    addResidualToRightHandSide( step + 1, m_residuals.toViewConst(), rhs );
+
+    {
+      GEOSX_MARK_SCOPE ( updateAdjointP );
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+      {
+        if( freeSurfaceNodeIndicator[a] != 1 )
+        {
+          q_nm1[a] = q_n[a];
+          q_nm1[a] *= 2.0*mass[a];
+          q_nm1[a] -= (mass[a]-0.5*dt*damping[a])*q_np1[a];
+          q_nm1[a] += dt2*(rhs[a]-stiffnessVector[a]);
+          q_nm1[a] /= mass[a]+0.5*dt*damping[a];
+        }
+      } );
+    }
+
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addFields( FieldLocation::Node, { extrinsicMeshData::PressureAdjoint_nm1::key() } );
+    CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                         mesh,
+                                                         domain.getNeighbors(),
+                                                         true );
+
+    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+    {
+      q_np1[a] = q_n[a];
+      q_n[a]   = q_nm1[a];
+
+      stiffnessVector[a] = 0.0;
+      rhs[a] = 0.0;
+    } );
+
+    // replay the forward step to get the second time derivative of the forward pressure at time n
+    computePressureNp1( m_forwardTime0 + step * dt,
+                        dt,
+                        LvArray::integerConversion< integer >( m_forwardCycle0 + step ),
+                        domain,
+                        mesh,
+                        regionNames );
+
+    arrayView1d< real32 const > const p_nm1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_nm1 >();
+    arrayView1d< real32 const > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
+    arrayView1d< real32 const > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
+    arrayView1d< real32 > const image = nodeManager.getExtrinsicData< extrinsicMeshData::AdjointImage >();
+    arrayView1d< real32 > const nodalGradient = nodeManager.getExtrinsicData< extrinsicMeshData::NodalPartialGradient >();
+
+    // the Lagrange multiplier of the forward step is -q_n/dt2, and the derivative of the step with respect to
+    // the lumped mass is the second difference of the pressure
+    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+    {
+      image[a] += p_n[a] * q_n[a];
+      nodalGradient[a] -= q_n[a] * ( p_np1[a] - 2.0 * p_n[a] + p_nm1[a] ) / dt2;
+
+      stiffnessVector[a] = 0.0;
+      rhs[a] = 0.0;
+    } );
+  } );
+}
+
+void AcousticWaveEquationSEM::addResidualToRightHandSide( localIndex const step,
+                                                          arrayView2d< real32 const > const residuals,
+                                                          arrayView1d< real32 > const rhs )
+{
+  arrayView2d< localIndex const > const receiverNodeIds = m_receiverNodeIds.toViewConst();
+  arrayView2d< real64 const > const receiverConstants = m_receiverConstants.toViewConst();
+  arrayView1d< localIndex const > const receiverIsLocal = m_receiverIsLocal.toViewConst();
+
+  if( m_dtSeismoTrace <= 0 )
+  {
+    return;
+  }
+
+  // a sample taken at the forward step n (the first one reaching its time) interpolates the pressure at
+  // time n with the weight a1 and at time n+1 with 1-a1, or only uses the last pressure when taken at cleanup
+  real64 const dt = m_forwardDt;
+  real64 const time = m_forwardTime0 + step * dt;
+  localIndex const firstSample = LvArray::math::max( localIndex( 0 ), localIndex( ( time - 2 * dt ) / m_dtSeismoTrace ) );
+  localIndex const lastSample = LvArray::math::min( m_indexSeismoTrace, localIndex( ( time + epsilonLoc ) / m_dtSeismoTrace ) + 2 );
+
+  for( localIndex iSample = firstSample; iSample < lastSample; ++iSample )
+  {
+    real64 const timeSeismo = m_dtSeismoTrace * iSample;
+    localIndex const sampleStep = LvArray::math::max( localIndex( 0 ),
+                                                      localIndex( std::ceil( ( timeSeismo - epsilonLoc - m_forwardTime0 ) / dt ) ) );
+    real32 const a1 = ( m_forwardTime0 + ( sampleStep + 1 ) * dt - timeSeismo ) / dt;
+
+    real32 weight = 0.0;
+    if( sampleStep >= m_numForwardSteps )
+    {
+      weight = ( sampleStep == step ) ? 1.0 : 0.0;
+    }
+    else if( sampleStep == step )
+    {
+      weight = a1;
+    }
+    else if( sampleStep + 1 == step )
+    {
+      weight = 1.0 - a1;
+    }
+    if( weight == 0.0 )
+    {
+      continue;
+    }
+
+    forAll< EXEC_POLICY >( receiverConstants.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] != 0 )
+      {
+        for( localIndex inode = 0; inode < receiverConstants.size( 1 ); ++inode )
+        {
+          real32 const localIncrement = receiverConstants[ircv][inode] * weight * residuals[iSample][ircv];
+          RAJA::atomicAdd< ATOMIC_POLICY >( &rhs[receiverNodeIds[ircv][inode]], localIncrement );
+        }
+      }
+    } );
+  }
+}
+
+void AcousticWaveEquationSEM::cleanup( real64 const time_n,
+                                       integer const cycleNumber,
+                                       integer const eventCounter,
+                                       real64 const eventProgress,
                                        DomainPartition & domain )
 {
   // call the base class cleanup (for reporting purposes)
@@ -1144,27 +2086,123 @@ void AcousticWaveEquationSEM::cleanup( real64 const time_n,
                                                                 arrayView1d< string const > const & )
   {
     NodeManager & nodeManager = mesh.getNodeManager();
+    arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
+    if( m_sourcesPerShot > 0 )
+    {
+      arrayView2d< real32 const > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_n >();
+      arrayView2d< real32 const > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_np1 >();
+      computeAllSeismoTracesShots( time_n, 0, p_np1, p_n, pReceivers );
+      return;
+    }
     arrayView1d< real32 const > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
     arrayView1d< real32 const > const p_np1 = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >();
-    arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
-    computeAllSeismoTraces( time_n, 0, p_np1, p_n, pReceivers );
+    computeAllSeismoTraces( time_n, 0, p_np1, p_n, pReceivers, viewKeyStruct::pressureNp1AtReceiversString() );
   } );
+
+  if( m_computeGradient && m_numForwardSteps > 0 )
+  {
+    computeAdjoint( domain );
+  }
 }
 
 void AcousticWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
                                                       real64 const dt,
                                                       arrayView1d< real32 const > const var_np1,
                                                       arrayView1d< real32 const > const var_n,
-                                                      arrayView2d< real32 > varAtReceivers )
+                                                      arrayView2d< real32 > varAtReceivers,
+                                                      string const & varName )
 {
   for( real64 timeSeismo;
        (timeSeismo = m_dtSeismoTrace*m_indexSeismoTrace) <= (time_n + epsilonLoc) && m_indexSeismoTrace < m_nsamplesSeismoTrace;
        m_indexSeismoTrace++ )
   {
-    computeSeismoTrace( time_n, dt, timeSeismo, m_indexSeismoTrace, var_np1, var_n, varAtReceivers );
+    computeSeismoTrace( time_n, dt, timeSeismo, m_indexSeismoTrace, var_np1, var_n, varAtReceivers, varName );
   }
 }
 
 REGISTER_CATALOG_ENTRY( SolverBase, AcousticWaveEquationSEM, string const &, dataRepository::Group * const )
 
+void AcousticWaveEquationSEM::computeAllSeismoTracesShots( real64 const time_n,
+                                                           real64 const dt,
+                                                           arrayView2d< real32 const > const var_np1,
+                                                           arrayView2d< real32 const > const var_n,
+                                                           arrayView2d< real32 > varAtReceivers )
+{
+  arrayView2d< localIndex const > const receiverNodeIds = m_receiverNodeIds.toViewConst();
+  arrayView2d< real64 const > const receiverConstants   = m_receiverConstants.toViewConst();
+  arrayView1d< localIndex const > const receiverIsLocal = m_receiverIsLocal.toViewConst();
+  localIndex const numReceivers = receiverConstants.size( 0 );
+  localIndex const numShots = m_numShots;
+  real64 const time_np1 = time_n+dt;
+
+  for( real64 timeSeismo;
+       (timeSeismo = m_dtSeismoTrace*m_indexSeismoTrace) <= (time_n + epsilonLoc) && m_indexSeismoTrace < m_nsamplesSeismoTrace;
+       m_indexSeismoTrace++ )
+  {
+    localIndex const iSeismo = m_indexSeismoTrace;
+    real32 const a1 = (dt < epsilonLoc) ? 1.0 : (time_np1 - timeSeismo)/dt;
+    real32 const a2 = 1.0 - a1;
+
+    forAll< EXEC_POLICY >( numReceivers, [=] GEOSX_HOST_DEVICE ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] == 1 )
+      {
+        for( localIndex ishot = 0; ishot < numShots; ++ishot )
+        {
+          real32 vtmp_np1 = 0.0;
+          real32 vtmp_n = 0.0;
+          for( localIndex inode = 0; inode < receiverConstants.size( 1 ); ++inode )
+          {
+            vtmp_np1 += var_np1[receiverNodeIds[ircv][inode]][ishot] * receiverConstants[ircv][inode];
+            vtmp_n += var_n[receiverNodeIds[ircv][inode]][ishot] * receiverConstants[ircv][inode];
+          }
+          // linear interpolation between the pressure value at time_n and time_(n+1)
+          varAtReceivers[iSeismo][ishot*numReceivers + ircv] = a1*vtmp_n + a2*vtmp_np1;
+        }
+      }
+    } );
+
+    if( iSeismo < m_nsamplesSeismoTrace - 1 || m_outputSeismoTrace != 1 )
+    {
+      continue;
+    }
+
+    // write the traces of each shot, in its own dataset or its own set of files
+    varAtReceivers.move( LvArray::MemorySpace::host, false );
+    array2d< real32 > shotTraces( m_nsamplesSeismoTrace, numReceivers );
+    for( localIndex ishot = 0; ishot < numShots; ++ishot )
+    {
+      for( localIndex iSample = 0; iSample < m_nsamplesSeismoTrace; ++iSample )
+      {
+        for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+        {
+          shotTraces[iSample][ircv] = varAtReceivers[iSample][ishot*numReceivers + ircv];
+        }
+      }
+
+      if( m_outputSeismoTraceFormat == SeismoTraceFormat::HDF )
+      {
+        writeSeismoTraces( GEOSX_FMT( "{}_shot{:03}", viewKeyStruct::pressureNp1AtReceiversString(), ishot ),
+                           shotTraces.toViewConst(),
+                           receiverIsLocal );
+        continue;
+      }
+
+      for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+      {
+        if( receiverIsLocal[ircv] == 1 )
+        {
+          // Note: this "manual" output to file is temporary, see computeSeismoTrace
+          std::ofstream f( GEOSX_FMT( "seismoTraceShot{:03}Receiver{:03}.txt", ishot, ircv ), std::ios::app );
+          for( localIndex iSample = 0; iSample < m_nsamplesSeismoTrace; ++iSample )
+          {
+            f << iSample << " " << shotTraces[iSample][ircv] << std::endl;
+          }
+          f.close();
+        }
+      }
+    }
+  }
+}
+
 } /* namespace geosx */
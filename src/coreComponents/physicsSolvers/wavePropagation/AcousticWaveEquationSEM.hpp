@@ -22,6 +22,7 @@
 
 #include "mesh/ExtrinsicMeshData.hpp"
 #include "physicsSolvers/SolverBase.hpp"
+#include "WaveCheckpointStorage.hpp"
 #include "WaveSolverBase.hpp"
 
 namespace geosx
@@ -87,6 +88,13 @@ public:
    */
   virtual void addSourceToRightHandSide( integer const & cycleNumber, arrayView1d< real32 > const rhs );
 
+  /**
+   * @brief Multiply the precomputed term by the Ricker and add to the right-hand side of the shot of each source
+   * @param cycleNumber the cycle number/step number of evaluation of the source
+   * @param rhs the right hand side vectors to be computed, one column per shot
+   */
+  void addSourceToRightHandSideShots( integer const & cycleNumber, arrayView2d< real32 > const rhs );
+
   /**
    * TODO: move implementation into WaveSolverBase
    * @brief Compute the sesimic traces for a given variable at each receiver coordinate at a given time, using the field values at the
@@ -98,6 +106,7 @@ public:
    * @param var_at_np1 the field values at time_n + dt
    * @param var_at_n the field values at time_n
    * @param var_at_receivers the array holding the trace values, where the output is written
+   * @param varName the name of the recorded variable, used to name the trace output
    */
   virtual void computeSeismoTrace( real64 const time_n,
                                    real64 const dt,
@@ -105,7 +114,8 @@ public:
                                    localIndex const iSeismo,
                                    arrayView1d< real32 const > const var_np1,
                                    arrayView1d< real32 const > const var_n,
-                                   arrayView2d< real32 > varAtReceivers ) override;
+                                   arrayView2d< real32 > varAtReceivers,
+                                   string const & varName ) override;
 
   /**
    * TODO: move implementation into WaveSolverBase
@@ -115,12 +125,28 @@ public:
    * @param var_at_np1 the field values at time_n + dt
    * @param var_at_n the field values at time_n
    * @param var_at_receivers the array holding the trace values, where the output is written
+   * @param varName the name of the recorded variable, used to name the trace output
    */
   virtual void computeAllSeismoTraces( real64 const time_n,
                                        real64 const dt,
                                        arrayView1d< real32 const > const var_np1,
                                        arrayView1d< real32 const > const var_n,
-                                       arrayView2d< real32 > varAtReceivers );
+                                       arrayView2d< real32 > varAtReceivers,
+                                       string const & varName );
+
+  /**
+   * @brief Computes the traces of all the shots on all receivers up to time_n+dt, and writes them out after the last sample
+   * @param time_n the time corresponding to the field values pressure_n
+   * @param dt the simulation timestep
+   * @param var_np1 the field values of the shots at time_n + dt, one column per shot
+   * @param var_n the field values of the shots at time_n, one column per shot
+   * @param varAtReceivers the array holding the trace values, one column per shot and receiver, shot by shot
+   */
+  void computeAllSeismoTracesShots( real64 const time_n,
+                                    real64 const dt,
+                                    arrayView2d< real32 const > const var_np1,
+                                    arrayView2d< real32 const > const var_n,
+                                    arrayView2d< real32 > varAtReceivers );
 
 
   /**
@@ -129,6 +155,21 @@ public:
   virtual void initializePML() override;
 
 
+  /**
+   * @brief Back-propagate the receiver residuals of the forward run and accumulate the imaging condition and the gradient.
+   * @param domain the domain partition
+   *
+   * The residuals are the differences between the recorded and the observed pressures at the receivers. The
+   * adjoint pressure is marched backward in time with the transpose of the forward scheme, and the forward
+   * pressure needed at each step is recomputed from checkpoints taken with a binomial (Revolve) schedule, so
+   * that at most numCheckpoints forward states are stored. The zero-lag cross-correlation of the forward and
+   * adjoint pressures is accumulated in the node field adjointImage, and the derivative of the misfit with
+   * respect to the squared slowness in the cell field partialGradient. The misfit is half the time integral of
+   * the squared residuals, sampled every dtSeismoTrace, and its derivative goes through the lumped mass matrix
+   * only: the damping of the absorbing boundaries is held fixed. The forward pressure is left in an arbitrary state.
+   */
+  void computeAdjoint( DomainPartition & domain );
+
   /**
    * @brief Overridden from ExecutableGroup. Used to write last seismogram if needed.
    */
@@ -145,6 +186,19 @@ public:
     static constexpr char const * receiverIsLocalString() { return "receiverIsLocal"; }
 
     static constexpr char const * pressureNp1AtReceiversString() { return "pressureNp1AtReceivers"; }
+    static constexpr char const * pressureObservedAtReceiversString() { return "pressureObservedAtReceivers"; }
+
+    static constexpr char const * computeGradientString() { return "computeGradient"; }
+    static constexpr char const * numCheckpointsString() { return "numCheckpoints"; }
+    static constexpr char const * numCheckpointsInMemoryString() { return "numCheckpointsInMemory"; }
+    static constexpr char const * checkpointCompressionString() { return "checkpointCompression"; }
+    static constexpr char const * checkpointFilePrefixString() { return "checkpointFilePrefix"; }
+
+    static constexpr char const * sourcesPerShotString() { return "sourcesPerShot"; }
+
+    static constexpr char const * numTimeSteppingLevelsString() { return "numTimeSteppingLevels"; }
+    static constexpr char const * timeSteppingLevelElementsString() { return "timeSteppingLevelElements"; }
+    static constexpr char const * timeSteppingLevelNodesString() { return "timeSteppingLevelNodes"; }
 
   } waveEquationViewKeys;
 
@@ -188,6 +242,173 @@ private:
 
   localIndex getNumNodesPerElem();
 
+  /**
+   * @brief Get the time step forced by the event targeting this solver.
+   * @return the forceDt of the event, 0 if no event forces the time step of this solver
+   */
+  real64 getEventTimeStep() const;
+
+  /**
+   * @brief Assign a time step level to the elements and nodes from their stable time step, and list them by level.
+   * @param domain the domain partition
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   * @param dt the coarse time step
+   *
+   * The level of an element is the smallest one whose step, dt / 2^level, satisfies the CFL condition of the
+   * element estimated with cflFactor. The level of a node is the finest level of its elements. The elements
+   * are listed at the levels of their nodes, since they contribute to the stiffness vectors of all of them.
+   */
+  void computeTimeSteppingLevels( DomainPartition & domain,
+                                  MeshLevel & mesh,
+                                  arrayView1d< string const > const & regionNames,
+                                  real64 const dt );
+
+  /**
+   * @brief Advance the pressure by one coarse step on one mesh, each node with the time step of its level.
+   * @param time_n the time of the current pressure
+   * @param dt the coarse time step
+   * @param cycleNumber the cycle number, used to evaluate the source
+   * @param domain the domain partition
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   */
+  void explicitStepLocalTimeStepping( real64 const time_n,
+                                      real64 const dt,
+                                      integer const cycleNumber,
+                                      DomainPartition & domain,
+                                      MeshLevel & mesh,
+                                      arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Advance the nodes of a level by one step of the level, then the finer levels by two steps of half the size.
+   * @param level the time step level
+   * @param time the time of the current pressure of the nodes of the level
+   * @param time_n the time at the beginning of the coarse step
+   * @param dt the coarse time step
+   * @param cycleNumber the cycle number of the coarse step, used to evaluate the source
+   * @param levelStartTimes the time at the beginning of the current step of each level
+   * @param domain the domain partition
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   */
+  void advanceTimeSteppingLevel( integer const level,
+                                 real64 const time,
+                                 real64 const time_n,
+                                 real64 const dt,
+                                 integer const cycleNumber,
+                                 std::vector< real64 > & levelStartTimes,
+                                 DomainPartition & domain,
+                                 MeshLevel & mesh,
+                                 arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Add the source terms of the nodes of a time step level to the right-hand side
+   * @param cycleNumber the cycle number of the coarse step
+   * @param fraction the elapsed fraction of the coarse step, the sources are interpolated linearly in time
+   * @param level the time step level
+   * @param nodeLevel the time step level of the nodes
+   * @param rhs the right hand side vector to be computed
+   */
+  void addSourceToRightHandSideLevel( integer const cycleNumber,
+                                      real32 const fraction,
+                                      integer const level,
+                                      arrayView1d< integer const > const nodeLevel,
+                                      arrayView1d< real32 > const rhs );
+
+  /**
+   * @brief Compute the pressure at time_n + dt on one mesh, without recording the seismic traces.
+   * @param time_n the time of the current pressure
+   * @param dt the time step
+   * @param cycleNumber the cycle number, used to evaluate the source
+   * @param domain the domain partition
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   */
+  void computePressureNp1( real64 const time_n,
+                           real64 const dt,
+                           integer const cycleNumber,
+                           DomainPartition & domain,
+                           MeshLevel & mesh,
+                           arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Shift the pressure fields by one step and reset the stiffness and right-hand side vectors.
+   * @param nodeManager the node manager of the mesh
+   */
+  void prepareNextStep( NodeManager & nodeManager );
+
+  /**
+   * @brief Compute the pressures of all the shots at time_n + dt on one mesh, without recording the seismic traces.
+   * @param time_n the time of the current pressures
+   * @param dt the time step
+   * @param cycleNumber the cycle number, used to evaluate the sources
+   * @param domain the domain partition
+   * @param mesh the mesh level
+   * @param regionNames the target regions of the mesh
+   */
+  void computePressureNp1Shots( real64 const time_n,
+                                real64 const dt,
+                                integer const cycleNumber,
+                                DomainPartition & domain,
+                                MeshLevel & mesh,
+                                arrayView1d< string const > const & regionNames );
+
+  /**
+   * @brief Shift the pressure fields of all the shots by one step and reset their stiffness and right-hand side vectors.
+   * @param nodeManager the node manager of the mesh
+   */
+  void prepareNextStepShots( NodeManager & nodeManager );
+
+  /**
+   * @brief Advance the forward pressure from one step to another, as done by explicitStep.
+   * @param domain the domain partition
+   * @param fromStep the step of the current forward state, counted from the first step of the run
+   * @param toStep the step to reach
+   */
+  void advanceForward( DomainPartition & domain,
+                       localIndex const fromStep,
+                       localIndex const toStep );
+
+  /**
+   * @brief Process the forward steps between two checkpoints in reverse order.
+   * @param domain the domain partition
+   * @param start the step of the checkpoint stored in @p slot
+   * @param end the step after the last one to process
+   * @param slot the checkpoint slot of the forward state at @p start
+   * @param numFreeSlots the number of checkpoint slots still available
+   */
+  void reverseSweep( DomainPartition & domain,
+                     localIndex const start,
+                     localIndex end,
+                     integer const slot,
+                     integer const numFreeSlots );
+
+  /**
+   * @brief Compute the adjoint pressure of a forward step and accumulate its imaging condition and gradient.
+   * @param domain the domain partition
+   * @param step the forward step, whose forward state must be the current one
+   */
+  void adjointStep( DomainPartition & domain,
+                    localIndex const step );
+
+  /**
+   * @brief Add the derivative of the misfit with respect to the pressure of a step to the right-hand side.
+   * @param step the step of the pressure, counted from the first step of the run
+   * @param residuals the residuals of all the receivers
+   * @param rhs the right hand side vector to be computed
+   */
+  void addResidualToRightHandSide( localIndex const step,
+                                   arrayView2d< real32 const > const residuals,
+                                   arrayView1d< real32 > const rhs );
+
+  /**
+   * @brief Collect the forward pressure state (pressure at time n-1 and n) of all the target meshes.
+   * @param domain the domain partition
+   * @return the pressure fields, two per mesh
+   */
+  std::vector< arrayView1d< real32 > > getForwardState( DomainPartition & domain );
+
   /// Indices of the nodes (in the right order) for each source point
   array2d< localIndex > m_sourceNodeIds;
 
@@ -203,12 +424,63 @@ private:
   /// Basis function evaluated at the receiver for the nodes listed in m_receiverNodeIds
   array2d< real64 > m_receiverConstants;
 
-  /// Flag that indicates whether the receiver is local or not to the MPI rank
+  /// Flag that indicates whether the receiver is local to the MPI rank (1), only in one of its ghost elements (2) or neither (0)
   array1d< localIndex > m_receiverIsLocal;
 
-  /// Pressure_np1 at the receiver location for each time step for each receiver
+  /// Pressure_np1 at the receiver location for each time step for each receiver, shot by shot
   array2d< real32 > m_pressureNp1AtReceivers;
 
+  /// Observed pressure at the receiver location for each time step for each receiver, the residuals are computed against it
+  array2d< real32 > m_pressureObservedAtReceivers;
+
+  /// Flag to back-propagate the residuals and compute the gradient at the end of the run
+  integer m_computeGradient;
+
+  /// Number of forward states stored during the reverse sweep, besides the initial one
+  integer m_numCheckpoints;
+
+  /// Number of stored forward states kept in memory, the others are written to disk
+  integer m_numCheckpointsInMemory;
+
+  /// Encoding of the stored forward states
+  WaveCheckpointStorage::Compression m_checkpointCompression;
+
+  /// Prefix of the files of the forward states written to disk
+  string m_checkpointFilePrefix;
+
+  /// Storage of the forward states
+  std::unique_ptr< WaveCheckpointStorage > m_checkpoints;
+
+  /// Number of forward steps taken since the initial state was stored
+  localIndex m_numForwardSteps;
+
+  /// Time of the initial forward state
+  real64 m_forwardTime0;
+
+  /// Cycle number of the initial forward state
+  integer m_forwardCycle0;
+
+  /// Constant time step of the forward run
+  real64 m_forwardDt;
+
+  /// Residuals of all the receivers, gathered on every rank during the adjoint run
+  array2d< real32 > m_residuals;
+
+  /// Number of consecutive sources fired together in each shot, 0 if all the sources make up a single shot
+  integer m_sourcesPerShot;
+
+  /// Number of shots propagated together
+  localIndex m_numShots;
+
+  /// Maximum number of time step levels, 1 if all the nodes are advanced with the time step of the event
+  integer m_numTimeSteppingLevels;
+
+  /// Finest time step level of the nodes over all the ranks
+  integer m_finestTimeSteppingLevel;
+
+  /// Elapsed fraction of the current step of each level, used to interpolate the pressure of the coarser levels
+  array1d< real32 > m_levelFractions;
+
 };
 
 
@@ -239,6 +511,111 @@ EXTRINSIC_MESH_DATA_TRAIT( Pressure_np1,
                            WRITE_AND_READ,
                            "Scalar pressure at time n+1." );
 
+EXTRINSIC_MESH_DATA_TRAIT( PressureStepStart,
+                           "pressureStepStart",
+                           array1d< real32 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Scalar pressure at the beginning of the coarse step, with local time stepping." );
+
+EXTRINSIC_MESH_DATA_TRAIT( TimeSteppingLevel,
+                           "timeSteppingLevel",
+                           array1d< integer >,
+                           0,
+                           LEVEL_0,
+                           NO_WRITE,
+                           "Time step level, advanced with the time step of the event divided by 2^level." );
+
+EXTRINSIC_MESH_DATA_TRAIT( PressureShots_nm1,
+                           "pressureShots_nm1",
+                           array2d< real32 >,
+                           0,
+                           NOPLOT,
+                           WRITE_AND_READ,
+                           "Scalar pressure of each shot at time n-1." );
+
+EXTRINSIC_MESH_DATA_TRAIT( PressureShots_n,
+                           "pressureShots_n",
+                           array2d< real32 >,
+                           0,
+                           NOPLOT,
+                           WRITE_AND_READ,
+                           "Scalar pressure of each shot at time n." );
+
+EXTRINSIC_MESH_DATA_TRAIT( PressureShots_np1,
+                           "pressureShots_np1",
+                           array2d< real32 >,
+                           0,
+                           LEVEL_0,
+                           WRITE_AND_READ,
+                           "Scalar pressure of each shot at time n+1." );
+
+EXTRINSIC_MESH_DATA_TRAIT( ForcingRHSShots,
+                           "rhsShots",
+                           array2d< real32 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "RHS of each shot." );
+
+EXTRINSIC_MESH_DATA_TRAIT( StiffnessVectorShots,
+                           "stiffnessVectorShots",
+                           array2d< real32 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Stiffness vector of each shot, contains R_h*PressureShots_n." );
+
+EXTRINSIC_MESH_DATA_TRAIT( PressureAdjoint_nm1,
+                           "pressureAdjoint_nm1",
+                           array1d< real32 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Adjoint pressure at time n-1, computed from time n and n+1 in the backward run." );
+
+EXTRINSIC_MESH_DATA_TRAIT( PressureAdjoint_n,
+                           "pressureAdjoint_n",
+                           array1d< real32 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Adjoint pressure at time n." );
+
+EXTRINSIC_MESH_DATA_TRAIT( PressureAdjoint_np1,
+                           "pressureAdjoint_np1",
+                           array1d< real32 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Adjoint pressure at time n+1." );
+
+EXTRINSIC_MESH_DATA_TRAIT( AdjointImage,
+                           "adjointImage",
+                           array1d< real32 >,
+                           0,
+                           LEVEL_0,
+                           WRITE_AND_READ,
+                           "Zero-lag cross-correlation of the forward and adjoint pressures." );
+
+EXTRINSIC_MESH_DATA_TRAIT( NodalPartialGradient,
+                           "nodalPartialGradient",
+                           array1d< real32 >,
+                           0,
+                           NOPLOT,
+                           NO_WRITE,
+                           "Sum over the steps of the adjoint pressure times the second time derivative of the pressure, "
+                           "weighted by the lumped mass into partialGradient at the end of the backward run." );
+
+EXTRINSIC_MESH_DATA_TRAIT( PartialGradient,
+                           "partialGradient",
+                           array1d< real32 >,
+                           0,
+                           LEVEL_0,
+                           WRITE_AND_READ,
+                           "Derivative of the misfit with respect to the squared slowness of the cell." );
+
 EXTRINSIC_MESH_DATA_TRAIT( ForcingRHS,
                            "rhs",
                            array1d< real32 >,
@@ -205,7 +205,7 @@ struct PrecomputeSourceAndReceiverKernel
    * @param[out] sourceNodeIds indices of the nodes of the element where the source is located
    * @param[out] sourceNodeConstants constant part of the source terms
    * @param[in] receiverCoordinates coordinates of the receiver terms
-   * @param[out] receiverIsLocal flag indicating whether the receiver is local or not
+   * @param[out] receiverIsLocal flag indicating whether the receiver is local (1), only in a ghost element (2) or not on this rank (0)
    * @param[out] receiverNodeIds indices of the nodes of the element where the receiver is located
    * @param[out] receiverNodeConstants constant part of the receiver term
    */
@@ -290,7 +290,7 @@ struct PrecomputeSourceAndReceiverKernel
       /// loop over all the receivers that haven't been found yet
       for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
       {
-        if( receiverIsLocal[ircv] == 0 )
+        if( receiverIsLocal[ircv] != 1 )
         {
           real64 const coords[3] = { receiverCoordinates[ircv][0],
                                      receiverCoordinates[ircv][1],
@@ -308,9 +308,11 @@ struct PrecomputeSourceAndReceiverKernel
                                                              X,
                                                              coordsOnRefElem );
 
-          if( receiverFound && elemGhostRank[k] < 0 )
+          // receivers only found in ghost elements are flagged with 2, they are not recorded on this rank
+          // but their node ids let the adjoint sources reach the ghost nodes
+          if( receiverFound )
           {
-            receiverIsLocal[ircv] = 1;
+            receiverIsLocal[ircv] = ( elemGhostRank[k] < 0 ) ? 1 : 2;
 
             real64 Ntest[FE_TYPE::numNodes];
             FE_TYPE::calcN( coordsOnRefElem, Ntest );
@@ -450,6 +452,75 @@ struct MassAndDampingMatrixKernel
 
 };
 
+template< typename FE_TYPE >
+struct PartialGradientKernel
+{
+
+  PartialGradientKernel( FE_TYPE const & finiteElement )
+    : m_finiteElement( finiteElement )
+  {}
+
+  /**
+   * @brief Launches the assembly of the cell-wise gradient from its nodal contributions
+   * @tparam EXEC_POLICY the execution policy
+   * @param[in] size the number of cells in the subRegion
+   * @param[in] X coordinates of the nodes
+   * @param[in] elemsToNodes map from element to nodes
+   * @param[in] nodalGradient derivative of the misfit with respect to the squared slowness at the nodes,
+   *                          per unit of lumped mass
+   * @param[in] scale factor applied to the gradient
+   * @param[out] gradient cell-wise derivative of the misfit with respect to the squared slowness
+   *
+   * The lumped mass of a node is the sum over the cells of the squared slowness of the cell times
+   * the integral of the basis function of the node over the cell, as in MassAndDampingMatrixKernel,
+   * so that each node contributes to the gradient of a cell with this integral as a weight.
+   */
+  template< typename EXEC_POLICY >
+  void
+  launch( localIndex const size,
+          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X,
+          arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes,
+          arrayView1d< real32 const > const nodalGradient,
+          real64 const scale,
+          arrayView1d< real32 > const gradient )
+  {
+    forAll< EXEC_POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
+      constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
+
+      real64 xLocal[ numNodesPerElem ][ 3 ];
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        for( localIndex i = 0; i < 3; ++i )
+        {
+          xLocal[a][i] = X( elemsToNodes( k, a ), i );
+        }
+      }
+
+      real64 N[ numNodesPerElem ];
+      real64 gradN[ numNodesPerElem ][ 3 ];
+
+      real64 value = 0.0;
+      for( localIndex q = 0; q < numQuadraturePointsPerElem; ++q )
+      {
+        FE_TYPE::calcN( q, N );
+        real64 const detJ = m_finiteElement.template getGradN< FE_TYPE >( k, q, xLocal, gradN );
+
+        for( localIndex a = 0; a < numNodesPerElem; ++a )
+        {
+          value += detJ * N[a] * nodalGradient[elemsToNodes[k][a]];
+        }
+      }
+      gradient[k] = scale * value;
+    } );
+  }
+
+  /// The finite element space/discretization object for the element type in the subRegion
+  FE_TYPE const & m_finiteElement;
+
+};
+
 
 struct PMLKernelHelper
 {
@@ -865,7 +936,7 @@ public:
    * @param faceManager Reference to the FaceManager object.
    * @param targetRegionIndex Index of the region the subregion belongs to.
    * @param dt The time interval for the step.
-   *   elements to be processed during this kernel launch.
+   * @param pressureName The name of the nodal pressure multiplied by the stiffness matrix.
    */
   ExplicitAcousticSEM( NodeManager & nodeManager,
                        EdgeManager const & edgeManager,
@@ -874,12 +945,13 @@ public:
                        SUBREGION_TYPE const & elementSubRegion,
                        FE_TYPE const & finiteElementSpace,
                        CONSTITUTIVE_TYPE & inputConstitutiveType,
-                       real64 const dt ):
+                       real64 const dt,
+                       string const pressureName ):
     Base( elementSubRegion,
           finiteElementSpace,
           inputConstitutiveType ),
     m_X( nodeManager.referencePosition() ),
-    m_p_n( nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >() ),
+    m_p_n( nodeManager.getReference< array1d< real32 > >( pressureName ) ),
     m_stiffnessVector( nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >() ),
     m_dt( dt )
   {
@@ -902,11 +974,19 @@ public:
 public:
     GEOSX_HOST_DEVICE
     StackVariables():
-      xLocal()
+      xLocal(),
+      pLocal(),
+      stiffnessVectorLocal()
     {}
 
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// C-array stack storage for the element local nodal pressure.
+    real64 pLocal[ numNodesPerElem ][ 1 ];
+
+    /// C-array stack storage for the element local stiffness vector.
+    real64 stiffnessVectorLocal[ numNodesPerElem ][ 1 ];
   };
   //***************************************************************************
 
@@ -929,6 +1009,7 @@ public:
       {
         stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
       }
+      stack.pLocal[ a ][ 0 ] = m_p_n[ nodeIndex ];
     }
   }
 
@@ -944,23 +1025,92 @@ public:
   void quadraturePointKernel( localIndex const k,
                               localIndex const q,
                               StackVariables & stack ) const
+  {
+    quadraturePointKernel( k, q, stack, std::integral_constant< bool, FE_TYPE::collocatedQuadrature >() );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitAcousticSEM Description
+   * Adds the element local stiffness vector to the nodes.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      real32 const localIncrement = stack.stiffnessVectorLocal[a][0];
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[m_elemsToNodes[k][a]], localIncrement );
+    }
+    return 0;
+  }
+
+private:
+
+  /**
+   * @brief Calculates the stiffness vector with all node pairs, for any finite element.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param stack The stack variables.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack,
+                              std::false_type ) const
   {
     real64 gradN[ numNodesPerElem ][ 3 ];
     real32 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, gradN );
 
-
     for( localIndex i=0; i<numNodesPerElem; ++i )
     {
       for( localIndex j=0; j<numNodesPerElem; ++j )
       {
         real32 const Rh_ij = detJ * LvArray::tensorOps::AiBi< 3 >( gradN[ i ], gradN[ j ] );
-        real32 const localIncrement = Rh_ij*m_p_n[m_elemsToNodes[k][j]];
-
-        RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[m_elemsToNodes[k][i]], localIncrement );
+        stack.stiffnessVectorLocal[i][0] += Rh_ij*stack.pLocal[j][0];
       }
     }
   }
 
+  /**
+   * @brief Calculates the stiffness vector in sum-factorized form when the quadrature points are the support points.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param stack The stack variables.
+   *
+   * The pressure gradient at @p q only involves the support points on the three lines of the tensor grid
+   * crossing @p q, and so does the contribution of the quadrature point to the stiffness vector. The cost per
+   * element drops from O(p^9) to O(p^4), and the contributions are accumulated on the stack until complete().
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack,
+                              std::true_type ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+
+    real64 invJ[3][3];
+    FE_TYPE::template parentGradient< 3 >( q, stack.xLocal, invJ );
+    real64 const detJ = LvArray::tensorOps::invert< 3 >( invJ ) * FE_TYPE::quadratureWeight( q );
+
+    real64 parentGradP[1][3];
+    FE_TYPE::template parentGradient< 1 >( q, stack.pLocal, parentGradP );
+
+    real64 gradP[3];
+    LvArray::tensorOps::Ri_eq_AjiBj< 3, 3 >( gradP, invJ, parentGradP[0] );
+
+    real64 flux[1][3];
+    LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( flux[0], invJ, gradP );
+    LvArray::tensorOps::scale< 3 >( flux[0], detJ );
+
+    FE_TYPE::template plusParentGradientTranspose< 1 >( q, flux, stack.stiffnessVectorLocal );
+  }
 
 protected:
   /// The array containing the nodal position array.
@@ -982,7 +1132,441 @@ protected:
 
 /// The factory used to construct a ExplicitAcousticWaveEquation kernel.
 using ExplicitAcousticSEMFactory = finiteElement::KernelFactory< ExplicitAcousticSEM,
-                                                                 real64 >;
+                                                                 real64,
+                                                                 string const >;
+
+
+/**
+ * @brief Implements the stiffness kernel of the acoustic wave equations for one level of the local time stepping.
+ * @copydoc geosx::finiteElement::KernelBase
+ * @tparam SUBREGION_TYPE The type of subregion that the kernel will act on.
+ *
+ * ### ExplicitAcousticSEMLocalTimeStepping Description
+ * Only the elements with a node of the level are processed, and only the nodes of the level receive their
+ * stiffness vector. The nodes of the finer levels have reached the time of the step of the level, while
+ * the step of the nodes of the coarser levels is not over: their pressure is interpolated linearly in time
+ * between pressure_n and pressure_np1, with the fraction of the step of their level.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ExplicitAcousticSEMLocalTimeStepping : public ExplicitAcousticSEM< SUBREGION_TYPE,
+                                                                         CONSTITUTIVE_TYPE,
+                                                                         FE_TYPE >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = ExplicitAcousticSEM< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using typename Base::StackVariables;
+  using Base::m_elemsToNodes;
+  using Base::m_X;
+  using Base::m_p_n;
+  using Base::m_stiffnessVector;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param dt The time step of the level.
+   * @param level The time step level of the nodes to update.
+   * @param levelFractions The elapsed fraction of the current step of each coarser level.
+   * @param levelElementsName The name of the entry that holds the elements with a node of each level.
+   */
+  ExplicitAcousticSEMLocalTimeStepping( NodeManager & nodeManager,
+                                        EdgeManager const & edgeManager,
+                                        FaceManager const & faceManager,
+                                        localIndex const targetRegionIndex,
+                                        SUBREGION_TYPE const & elementSubRegion,
+                                        FE_TYPE const & finiteElementSpace,
+                                        CONSTITUTIVE_TYPE & inputConstitutiveType,
+                                        real64 const dt,
+                                        integer const level,
+                                        arrayView1d< real32 const > const levelFractions,
+                                        string const levelElementsName ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          targetRegionIndex,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          dt,
+          extrinsicMeshData::Pressure_n::key() ),
+    m_p_np1( nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_np1 >() ),
+    m_nodeLevel( nodeManager.getExtrinsicData< extrinsicMeshData::TimeSteppingLevel >() ),
+    m_levelFractions( levelFractions ),
+    m_level( level ),
+    m_levelElements( elementSubRegion.template getReference< ArrayOfArrays< localIndex > >( levelElementsName ).toViewConst() )
+  {}
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::setup
+   *
+   * Copies the positions, and the pressures at the time of the step of the level into the local stack arrays.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    for( localIndex a=0; a< numNodesPerElem; ++a )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, a );
+      for( int i=0; i< 3; ++i )
+      {
+        stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
+      }
+      integer const nodeLevel = m_nodeLevel[ nodeIndex ];
+      real32 const fraction = ( nodeLevel < m_level ) ? m_levelFractions[ nodeLevel ] : 0.0;
+      stack.pLocal[ a ][ 0 ] = m_p_n[ nodeIndex ] + fraction * ( m_p_np1[ nodeIndex ] - m_p_n[ nodeIndex ] );
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitAcousticSEMLocalTimeStepping Description
+   * Adds the element local stiffness vector to the nodes of the level.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const nodeIndex = m_elemsToNodes[k][a];
+      if( m_nodeLevel[nodeIndex] == m_level )
+      {
+        real32 const localIncrement = stack.stiffnessVectorLocal[a][0];
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[nodeIndex], localIncrement );
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::kernelLaunch
+   *
+   * ### ExplicitAcousticSEMLocalTimeStepping Description
+   * Launches the kernel on the elements with a node of the level only.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+
+    GEOSX_UNUSED_VAR( numElems );
+
+    integer const level = kernelComponent.m_level;
+    forAll< POLICY >( kernelComponent.m_levelElements.sizeOfArray( level ),
+                      [=] GEOSX_HOST_DEVICE ( localIndex const index )
+    {
+      localIndex const k = kernelComponent.m_levelElements( level, index );
+
+      typename KERNEL_TYPE::StackVariables stack;
+
+      kernelComponent.setup( k, stack );
+      for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+      {
+        kernelComponent.quadraturePointKernel( k, q, stack );
+      }
+      kernelComponent.complete( k, stack );
+    } );
+    return 0;
+  }
+
+protected:
+  /// The array containing the nodal pressure at the end of the current step of each node.
+  arrayView1d< real32 const > const m_p_np1;
+
+  /// The array containing the time step level of the nodes.
+  arrayView1d< integer const > const m_nodeLevel;
+
+  /// The elapsed fraction of the current step of each coarser level.
+  arrayView1d< real32 const > const m_levelFractions;
+
+  /// The time step level of the nodes to update.
+  integer const m_level;
+
+  /// The elements with a node of each level.
+  ArrayOfArraysView< localIndex const > const m_levelElements;
+};
+
+/// The factory used to construct a ExplicitAcousticSEMLocalTimeStepping kernel.
+using ExplicitAcousticSEMLocalTimeSteppingFactory = finiteElement::KernelFactory< ExplicitAcousticSEMLocalTimeStepping,
+                                                                                  real64,
+                                                                                  integer,
+                                                                                  arrayView1d< real32 const >,
+                                                                                  string const >;
+
+
+/// Maximum number of shots processed by one launch of ExplicitAcousticSEMShots.
+static constexpr localIndex numShotsPerLaunch = 4;
+
+/**
+ * @brief Implements the stiffness kernel of the acoustic wave equations for several shots propagated together.
+ * @copydoc geosx::finiteElement::KernelBase
+ * @tparam SUBREGION_TYPE The type of subregion that the kernel will act on.
+ *
+ * ### ExplicitAcousticSEMShots Description
+ * The pressures of the shots are interleaved, one row per node and one column per shot. A launch processes
+ * numShotsPerLaunch consecutive shots: the geometry and the shape function gradients are evaluated once per
+ * quadrature point for all of them, and the innermost loops run over the shots, contiguous in memory.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ExplicitAcousticSEMShots : public finiteElement::KernelBase< SUBREGION_TYPE,
+                                                                   CONSTITUTIVE_TYPE,
+                                                                   FE_TYPE,
+                                                                   1,
+                                                                   1 >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          1,
+                                          1 >;
+
+  /// Number of nodes per element, see ExplicitAcousticSEM.
+  static constexpr int numNodesPerElem = Base::maxNumTestSupportPointsPerElem;
+
+  using Base::m_elemsToNodes;
+  using Base::m_finiteElementSpace;
+
+//*****************************************************************************
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param dt The time interval for the step.
+   * @param firstShot The index of the first shot processed by this launch.
+   */
+  ExplicitAcousticSEMShots( NodeManager & nodeManager,
+                            EdgeManager const & edgeManager,
+                            FaceManager const & faceManager,
+                            localIndex const targetRegionIndex,
+                            SUBREGION_TYPE const & elementSubRegion,
+                            FE_TYPE const & finiteElementSpace,
+                            CONSTITUTIVE_TYPE & inputConstitutiveType,
+                            real64 const dt,
+                            localIndex const firstShot ):
+    Base( elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType ),
+    m_X( nodeManager.referencePosition() ),
+    m_p_n( nodeManager.getExtrinsicData< extrinsicMeshData::PressureShots_n >() ),
+    m_stiffnessVector( nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVectorShots >() ),
+    m_dt( dt ),
+    m_firstShot( firstShot ),
+    m_numShots( LvArray::math::min( numShotsPerLaunch, m_p_n.size( 1 ) - firstShot ) )
+  {
+    GEOSX_UNUSED_VAR( edgeManager );
+    GEOSX_UNUSED_VAR( faceManager );
+    GEOSX_UNUSED_VAR( targetRegionIndex );
+  }
+
+  //*****************************************************************************
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::StackVariables
+   *
+   * ### ExplicitAcousticSEMShots Description
+   * Adds stack arrays for the nodal positions, and the pressures and stiffness vectors of the shots.
+   */
+  struct StackVariables : Base::StackVariables
+  {
+public:
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      xLocal(),
+      pLocal(),
+      stiffnessVectorLocal()
+    {}
+
+    /// C-array stack storage for element local the nodal positions.
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// C-array stack storage for the element local nodal pressures, one column per shot.
+    real64 pLocal[ numNodesPerElem ][ numShotsPerLaunch ];
+
+    /// C-array stack storage for the element local stiffness vectors, one column per shot.
+    real64 stiffnessVectorLocal[ numNodesPerElem ][ numShotsPerLaunch ];
+  };
+  //***************************************************************************
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::setup
+   *
+   * Copies the pressures of the shots, and the positions into the local stack arrays. The columns
+   * past the last shot are left to zero.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    for( localIndex a=0; a< numNodesPerElem; ++a )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, a );
+      for( int i=0; i< 3; ++i )
+      {
+        stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
+      }
+      for( localIndex s=0; s<m_numShots; ++s )
+      {
+        stack.pLocal[ a ][ s ] = m_p_n[ nodeIndex ][ m_firstShot + s ];
+      }
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### ExplicitAcousticSEMShots Description
+   * Calculates the stiffness vectors of the shots
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    quadraturePointKernel( k, q, stack, std::integral_constant< bool, FE_TYPE::collocatedQuadrature >() );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitAcousticSEMShots Description
+   * Adds the element local stiffness vectors of the shots to the nodes.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const nodeIndex = m_elemsToNodes[k][a];
+      for( localIndex s=0; s<m_numShots; ++s )
+      {
+        real32 const localIncrement = stack.stiffnessVectorLocal[a][s];
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[nodeIndex][m_firstShot + s], localIncrement );
+      }
+    }
+    return 0;
+  }
+
+private:
+
+  /**
+   * @brief Calculates the stiffness vectors with all node pairs, for any finite element.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param stack The stack variables.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack,
+                              std::false_type ) const
+  {
+    real64 gradN[ numNodesPerElem ][ 3 ];
+    real32 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, gradN );
+
+    for( localIndex i=0; i<numNodesPerElem; ++i )
+    {
+      for( localIndex j=0; j<numNodesPerElem; ++j )
+      {
+        real32 const Rh_ij = detJ * LvArray::tensorOps::AiBi< 3 >( gradN[ i ], gradN[ j ] );
+        for( localIndex s=0; s<numShotsPerLaunch; ++s )
+        {
+          stack.stiffnessVectorLocal[i][s] += Rh_ij * stack.pLocal[j][s];
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Calculates the stiffness vectors in sum-factorized form when the quadrature points are the support points.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param stack The stack variables.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack,
+                              std::true_type ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+
+    real64 invJ[3][3];
+    FE_TYPE::template parentGradient< 3 >( q, stack.xLocal, invJ );
+    real64 const detJ = LvArray::tensorOps::invert< 3 >( invJ ) * FE_TYPE::quadratureWeight( q );
+
+    // (J^-1 J^-T) detJ is shared by all the shots
+    real64 metric[3][3];
+    LvArray::tensorOps::Rij_eq_AikBjk< 3, 3, 3 >( metric, invJ, invJ );
+    LvArray::tensorOps::scale< 3, 3 >( metric, detJ );
+
+    real64 parentGradP[numShotsPerLaunch][3];
+    FE_TYPE::template parentGradient< numShotsPerLaunch >( q, stack.pLocal, parentGradP );
+
+    real64 flux[numShotsPerLaunch][3];
+    for( localIndex s=0; s<numShotsPerLaunch; ++s )
+    {
+      LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( flux[s], metric, parentGradP[s] );
+    }
+
+    FE_TYPE::template plusParentGradientTranspose< numShotsPerLaunch >( q, flux, stack.stiffnessVectorLocal );
+  }
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The array containing the nodal pressures of the shots.
+  arrayView2d< real32 const > const m_p_n;
+
+  /// The array containing the product of the stiffness matrix and the nodal pressures of the shots.
+  arrayView2d< real32 > const m_stiffnessVector;
+
+  /// The time increment for this time integration step.
+  real64 const m_dt;
+
+  /// The index of the first shot processed by this launch.
+  localIndex const m_firstShot;
+
+  /// The number of shots processed by this launch.
+  localIndex const m_numShots;
+
+};
+
+/// The factory used to construct a ExplicitAcousticSEMShots kernel.
+using ExplicitAcousticSEMShotsFactory = finiteElement::KernelFactory< ExplicitAcousticSEMShots,
+                                                                      real64,
+                                                                      localIndex >;
 
 
 } // namespace acousticWaveEquationSEMKernels
@@ -360,7 +360,8 @@ void ElasticWaveEquationSEM::computeSeismoTrace( real64 const time_n,
                                                  localIndex iSeismo,
                                                  arrayView1d< real32 const > const var_np1,
                                                  arrayView1d< real32 const > const var_n,
-                                                 arrayView2d< real32 > varAtReceivers )
+                                                 arrayView2d< real32 > varAtReceivers,
+                                                 string const & varName )
 {
   real64 const time_np1 = time_n+dt;
   arrayView2d< localIndex const > const receiverNodeIds = m_receiverNodeIds.toViewConst();
@@ -392,7 +393,11 @@ void ElasticWaveEquationSEM::computeSeismoTrace( real64 const time_n,
 
   // TODO DEBUG: the following output is only temporary until our wave propagation kernels are finalized.
   // Output will then only be done via the previous code.
-  if( iSeismo == m_nsamplesSeismoTrace - 1 )
+  if( iSeismo == m_nsamplesSeismoTrace - 1 && m_outputSeismoTrace == 1 && m_outputSeismoTraceFormat == SeismoTraceFormat::HDF )
+  {
+    writeSeismoTraces( varName, varAtReceivers.toViewConst(), receiverIsLocal );
+  }
+  else if( iSeismo == m_nsamplesSeismoTrace - 1 )
   {
     forAll< serialPolicy >( receiverConstants.size( 0 ), [=] ( localIndex const ircv )
     {
@@ -691,9 +696,9 @@ real64 ElasticWaveEquationSEM::explicitStep( real64 const & time_n,
     arrayView2d< real32 > const uYReceivers   = m_displacementYNp1AtReceivers.toView();
     arrayView2d< real32 > const uZReceivers   = m_displacementZNp1AtReceivers.toView();
 
-    computeAllSeismoTraces( time_n, dt, ux_np1, ux_n, uXReceivers );
-    computeAllSeismoTraces( time_n, dt, uy_np1, uy_n, uYReceivers );
-    computeAllSeismoTraces( time_n, dt, uz_np1, uz_n, uZReceivers );
+    computeAllSeismoTraces( time_n, dt, ux_np1, ux_n, uXReceivers, viewKeyStruct::displacementXNp1AtReceiversString() );
+    computeAllSeismoTraces( time_n, dt, uy_np1, uy_n, uYReceivers, viewKeyStruct::displacementYNp1AtReceiversString() );
+    computeAllSeismoTraces( time_n, dt, uz_np1, uz_n, uZReceivers, viewKeyStruct::displacementZNp1AtReceiversString() );
 
     forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
     {
@@ -748,9 +753,9 @@ void ElasticWaveEquationSEM::cleanup( real64 const time_n,
     arrayView2d< real32 > const uYReceivers   = m_displacementYNp1AtReceivers.toView();
     arrayView2d< real32 > const uZReceivers   = m_displacementZNp1AtReceivers.toView();
 
-    computeAllSeismoTraces( time_n, 0, ux_np1, ux_n, uXReceivers );
-    computeAllSeismoTraces( time_n, 0, uy_np1, uy_n, uYReceivers );
-    computeAllSeismoTraces( time_n, 0, uz_np1, uz_n, uZReceivers );
+    computeAllSeismoTraces( time_n, 0, ux_np1, ux_n, uXReceivers, viewKeyStruct::displacementXNp1AtReceiversString() );
+    computeAllSeismoTraces( time_n, 0, uy_np1, uy_n, uYReceivers, viewKeyStruct::displacementYNp1AtReceiversString() );
+    computeAllSeismoTraces( time_n, 0, uz_np1, uz_n, uZReceivers, viewKeyStruct::displacementZNp1AtReceiversString() );
   } );
 
   // increment m_indexSeismoTrace
@@ -764,7 +769,8 @@ void ElasticWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
                                                      real64 const dt,
                                                      arrayView1d< real32 const > const var_np1,
                                                      arrayView1d< real32 const > const var_n,
-                                                     arrayView2d< real32 > varAtReceivers )
+                                                     arrayView2d< real32 > varAtReceivers,
+                                                     string const & varName )
 {
   localIndex indexSeismoTrace = m_indexSeismoTrace;
 
@@ -772,7 +778,7 @@ void ElasticWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
        (timeSeismo = m_dtSeismoTrace*indexSeismoTrace) <= (time_n + epsilonLoc) && indexSeismoTrace < m_nsamplesSeismoTrace;
        indexSeismoTrace++ )
   {
-    computeSeismoTrace( time_n, dt, timeSeismo, indexSeismoTrace, var_np1, var_n, varAtReceivers );
+    computeSeismoTrace( time_n, dt, timeSeismo, indexSeismoTrace, var_np1, var_n, varAtReceivers, varName );
   }
 }
 
@@ -99,6 +99,7 @@ public:
    * @param var_np1 the field values at time_n + dt
    * @param var_n the field values at time_n
    * @param varAtreceivers the array holding the trace values, where the output is written
+   * @param varName the name of the recorded variable, used to name the trace output
    */
   virtual void computeSeismoTrace( real64 const time_n,
                                    real64 const dt,
@@ -106,7 +107,8 @@ public:
                                    localIndex const iSeismo,
                                    arrayView1d< real32 const > const var_np1,
                                    arrayView1d< real32 const > const var_n,
-                                   arrayView2d< real32 > varAtReceivers ) override;
+                                   arrayView2d< real32 > varAtReceivers,
+                                   string const & varName ) override;
 
   /**
    * TODO: move implementation into WaveSolverBase
@@ -116,12 +118,14 @@ public:
    * @param var_np1 the field values at time_n + dt
    * @param var_n the field values at time_n
    * @param varAtreceivers the array holding the trace values, where the output is written
+   * @param varName the name of the recorded variable, used to name the trace output
    */
   virtual void computeAllSeismoTraces( real64 const time_n,
                                        real64 const dt,
                                        arrayView1d< real32 const > const var_np1,
                                        arrayView1d< real32 const > const var_n,
-                                       arrayView2d< real32 > varAtReceivers );
+                                       arrayView2d< real32 > varAtReceivers,
+                                       string const & varName );
 
 
   /**
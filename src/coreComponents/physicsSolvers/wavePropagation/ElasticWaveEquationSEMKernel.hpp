@@ -589,10 +589,16 @@ public:
 public:
     GEOSX_HOST_DEVICE
     StackVariables():
-      xLocal()
+      xLocal(),
+      uLocal(),
+      stiffnessVectorLocal()
     {}
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ]{};
+    /// C-array stack storage for the element local nodal displacement, used with collocated quadratures.
+    real64 uLocal[ numNodesPerElem ][ 3 ]{};
+    /// C-array stack storage for the element local stiffness vector, used with collocated quadratures.
+    real64 stiffnessVectorLocal[ numNodesPerElem ][ 3 ]{};
     real32 mu=0;
     real32 lambda=0;
   };
@@ -617,6 +623,13 @@ public:
       {
         stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
       }
+      // only the sum-factorized path reads the displacement from the stack
+      if( FE_TYPE::collocatedQuadrature )
+      {
+        stack.uLocal[ a ][ 0 ] = m_ux_n[ nodeIndex ];
+        stack.uLocal[ a ][ 1 ] = m_uy_n[ nodeIndex ];
+        stack.uLocal[ a ][ 2 ] = m_uz_n[ nodeIndex ];
+      }
     }
     stack.mu = m_density[k] * m_velocityVs[k] * m_velocityVs[k];
     stack.lambda = m_density[k] *m_velocityVp[k] * m_velocityVp[k] - 2.0*stack.mu;
@@ -635,6 +648,51 @@ public:
                               localIndex const q,
                               StackVariables & stack ) const
   {
+    quadraturePointKernel( k, q, stack, std::integral_constant< bool, FE_TYPE::collocatedQuadrature >() );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitElasticSEM Description
+   * Adds the element local stiffness vector to the nodes with collocated quadratures.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    if( FE_TYPE::collocatedQuadrature )
+    {
+      for( localIndex a=0; a<numNodesPerElem; ++a )
+      {
+        localIndex const nodeIndex = m_elemsToNodes[k][a];
+        real32 const localIncrementx = stack.stiffnessVectorLocal[a][0];
+        real32 const localIncrementy = stack.stiffnessVectorLocal[a][1];
+        real32 const localIncrementz = stack.stiffnessVectorLocal[a][2];
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectorx[nodeIndex], localIncrementx );
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectory[nodeIndex], localIncrementy );
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectorz[nodeIndex], localIncrementz );
+      }
+    }
+    return 0;
+  }
+
+private:
+
+  /**
+   * @brief Calculates the stiffness vector with all node pairs, for any finite element.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param stack The stack variables.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack,
+                              std::false_type ) const
+  {
 
     real64 gradN[ numNodesPerElem ][ 3 ];
 
@@ -647,12 +705,12 @@ public:
         real32 const Rxx_ij = detJ* ((stack.lambda+2.0*stack.mu)*gradN[j][0]*gradN[i][0] + stack.mu * gradN[j][1]*gradN[i][1] + stack.mu * gradN[j][2]*gradN[i][2]);
         real32 const Ryy_ij = detJ* ((stack.lambda+2.0*stack.mu)*gradN[j][1]*gradN[i][1] + stack.mu * gradN[j][0]*gradN[i][0] + stack.mu * gradN[j][2]*gradN[i][2]);
         real32 const Rzz_ij = detJ*((stack.lambda+2.0*stack.mu)*gradN[j][2]*gradN[i][2] + stack.mu * gradN[j][1]*gradN[i][1] + stack.mu * gradN[j][0]*gradN[i][0]);
-        real32 const Rxy_ij =  detJ*(stack.mu * gradN[j][1]*gradN[i][0] + stack.lambda * gradN[j][0]*gradN[i][1]);
-        real32 const Ryx_ij =  detJ*(stack.mu * gradN[j][0]*gradN[i][1] + stack.lambda * gradN[j][1]*gradN[i][0]);
-        real32 const Rxz_ij =  detJ*(stack.mu * gradN[j][2]*gradN[i][0] + stack.lambda * gradN[j][0]*gradN[i][2]);
-        real32 const Rzx_ij =  detJ*(stack.mu * gradN[j][0]*gradN[i][2] + stack.lambda * gradN[j][2]*gradN[i][0]);
-        real32 const Ryz_ij =  detJ*(stack.mu * gradN[j][2]*gradN[i][1] + stack.lambda * gradN[j][1]*gradN[i][2]);
-        real32 const Rzy_ij =  detJ*(stack.mu * gradN[j][1]*gradN[i][2] + stack.lambda * gradN[j][2]*gradN[i][1]);
+        real32 const Rxy_ij =  detJ*(stack.lambda * gradN[j][1]*gradN[i][0] + stack.mu * gradN[j][0]*gradN[i][1]);
+        real32 const Ryx_ij =  detJ*(stack.lambda * gradN[j][0]*gradN[i][1] + stack.mu * gradN[j][1]*gradN[i][0]);
+        real32 const Rxz_ij =  detJ*(stack.lambda * gradN[j][2]*gradN[i][0] + stack.mu * gradN[j][0]*gradN[i][2]);
+        real32 const Rzx_ij =  detJ*(stack.lambda * gradN[j][0]*gradN[i][2] + stack.mu * gradN[j][2]*gradN[i][0]);
+        real32 const Ryz_ij =  detJ*(stack.lambda * gradN[j][2]*gradN[i][1] + stack.mu * gradN[j][1]*gradN[i][2]);
+        real32 const Rzy_ij =  detJ*(stack.lambda * gradN[j][1]*gradN[i][2] + stack.mu * gradN[j][2]*gradN[i][1]);
 
         real32 const localIncrementx = (Rxx_ij * m_ux_n[m_elemsToNodes[k][j]] + Rxy_ij*m_uy_n[m_elemsToNodes[k][j]] + Rxz_ij*m_uz_n[m_elemsToNodes[k][j]]);
         real32 const localIncrementy = (Ryx_ij * m_ux_n[m_elemsToNodes[k][j]] + Ryy_ij*m_uy_n[m_elemsToNodes[k][j]] + Ryz_ij*m_uz_n[m_elemsToNodes[k][j]]);
@@ -667,6 +725,52 @@ public:
 
   }
 
+  /**
+   * @brief Calculates the stiffness vector in sum-factorized form when the quadrature points are the support points.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param stack The stack variables.
+   *
+   * The displacement gradient at @p q is evaluated from the support points on the three lines of the tensor grid
+   * crossing @p q only, the isotropic stress is formed once, and its contribution is scattered back to the same
+   * support points. The contributions are accumulated on the stack until complete().
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack,
+                              std::true_type ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+
+    real64 invJ[3][3];
+    FE_TYPE::template parentGradient< 3 >( q, stack.xLocal, invJ );
+    real64 const detJ = LvArray::tensorOps::invert< 3 >( invJ ) * FE_TYPE::quadratureWeight( q );
+
+    real64 parentGradU[3][3];
+    FE_TYPE::template parentGradient< 3 >( q, stack.uLocal, parentGradU );
+
+    real64 gradU[3][3];
+    LvArray::tensorOps::Rij_eq_AikBkj< 3, 3, 3 >( gradU, parentGradU, invJ );
+
+    real64 const divU = gradU[0][0] + gradU[1][1] + gradU[2][2];
+    real64 stress[3][3];
+    for( int i = 0; i < 3; ++i )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        stress[i][j] = stack.mu * ( gradU[i][j] + gradU[j][i] );
+      }
+      stress[i][i] += stack.lambda * divU;
+    }
+
+    real64 flux[3][3];
+    LvArray::tensorOps::Rij_eq_AikBjk< 3, 3, 3 >( flux, stress, invJ );
+    LvArray::tensorOps::scale< 3, 3 >( flux, detJ );
+
+    FE_TYPE::template plusParentGradientTranspose< 3 >( q, flux, stack.stiffnessVectorLocal );
+  }
 
 protected:
   /// The array containing the nodal position array.
@@ -0,0 +1,231 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file WaveCheckpointStorage.cpp
+ */
+
+#include "WaveCheckpointStorage.hpp"
+
+#include "common/Format.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/TimingMacros.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace geosx
+{
+
+namespace
+{
+
+template< typename T >
+void appendValue( std::vector< char > & buffer, T const & value )
+{
+  char const * const bytes = reinterpret_cast< char const * >( &value );
+  buffer.insert( buffer.end(), bytes, bytes + sizeof( T ) );
+}
+
+template< typename T >
+T readValue( std::vector< char > const & buffer, std::size_t & offset )
+{
+  T value;
+  std::memcpy( &value, buffer.data() + offset, sizeof( T ) );
+  offset += sizeof( T );
+  return value;
+}
+
+}
+
+WaveCheckpointStorage::WaveCheckpointStorage( integer const maxInMemory,
+                                              Compression const compression,
+                                              string const & filePrefix ):
+  m_maxInMemory( maxInMemory ),
+  m_compression( compression ),
+  m_filePrefix( filePrefix )
+{}
+
+WaveCheckpointStorage::~WaveCheckpointStorage()
+{
+  while( !m_snapshots.empty() )
+  {
+    release( m_snapshots.begin()->first );
+  }
+}
+
+void WaveCheckpointStorage::store( integer const slot,
+                                   std::vector< arrayView1d< real32 const > > const & fields )
+{
+  GEOSX_MARK_FUNCTION;
+
+  release( slot );
+  Snapshot & snapshot = m_snapshots[ slot ];
+
+  for( arrayView1d< real32 const > const & field : fields )
+  {
+    field.move( LvArray::MemorySpace::host, false );
+    localIndex const size = field.size();
+    appendValue( snapshot.buffer, size );
+
+    if( m_compression == Compression::None )
+    {
+      char const * const bytes = reinterpret_cast< char const * >( field.data() );
+      snapshot.buffer.insert( snapshot.buffer.end(), bytes, bytes + size * sizeof( real32 ) );
+    }
+    else
+    {
+      real32 minValue = 0.0;
+      real32 maxValue = 0.0;
+      if( size > 0 )
+      {
+        minValue = *std::min_element( field.begin(), field.end() );
+        maxValue = *std::max_element( field.begin(), field.end() );
+      }
+      real32 const scale = ( maxValue > minValue ) ? 65535.0 / ( maxValue - minValue ) : 0.0;
+      appendValue( snapshot.buffer, minValue );
+      appendValue( snapshot.buffer, maxValue );
+      for( localIndex i = 0; i < size; ++i )
+      {
+        std::uint16_t const quantized = static_cast< std::uint16_t >( ( field[i] - minValue ) * scale + 0.5 );
+        appendValue( snapshot.buffer, quantized );
+      }
+    }
+  }
+
+  localIndex numInMemory = 0;
+  for( auto const & entry : m_snapshots )
+  {
+    numInMemory += entry.second.fileName.empty() ? 1 : 0;
+  }
+
+  if( numInMemory > m_maxInMemory )
+  {
+    // the buffer is handed over to the background write and freed once on disk
+    snapshot.fileName = GEOSX_FMT( "{}_{}_{}.bin", m_filePrefix, MpiWrapper::commRank( MPI_COMM_GEOSX ), slot );
+    snapshot.pendingWrite = std::async( std::launch::async,
+                                        [fileName = snapshot.fileName, buffer = std::move( snapshot.buffer )]()
+    {
+      std::ofstream file( fileName, std::ios::binary );
+      file.write( buffer.data(), buffer.size() );
+      GEOSX_ERROR_IF( !file, "Could not write the checkpoint file " << fileName );
+    } );
+    snapshot.buffer = std::vector< char >();
+  }
+}
+
+void WaveCheckpointStorage::restore( integer const slot,
+                                     std::vector< arrayView1d< real32 > > const & fields )
+{
+  GEOSX_MARK_FUNCTION;
+
+  auto const it = m_snapshots.find( slot );
+  GEOSX_THROW_IF( it == m_snapshots.end(), "No checkpoint stored in slot " << slot, std::runtime_error );
+  Snapshot & snapshot = it->second;
+
+  std::vector< char > fileBuffer;
+  if( !snapshot.fileName.empty() )
+  {
+    snapshot.pendingWrite.wait();
+    std::ifstream file( snapshot.fileName, std::ios::binary | std::ios::ate );
+    GEOSX_THROW_IF( !file, "Could not read the checkpoint file " << snapshot.fileName, std::runtime_error );
+    fileBuffer.resize( file.tellg() );
+    file.seekg( 0 );
+    file.read( fileBuffer.data(), fileBuffer.size() );
+  }
+  std::vector< char > const & buffer = snapshot.fileName.empty() ? snapshot.buffer : fileBuffer;
+
+  std::size_t offset = 0;
+  for( arrayView1d< real32 > const & field : fields )
+  {
+    field.move( LvArray::MemorySpace::host, true );
+    localIndex const size = readValue< localIndex >( buffer, offset );
+    GEOSX_THROW_IF_NE_MSG( size, field.size(), "The checkpoint does not match the field size", std::runtime_error );
+
+    if( m_compression == Compression::None )
+    {
+      std::memcpy( field.data(), buffer.data() + offset, size * sizeof( real32 ) );
+      offset += size * sizeof( real32 );
+    }
+    else
+    {
+      real32 const minValue = readValue< real32 >( buffer, offset );
+      real32 const maxValue = readValue< real32 >( buffer, offset );
+      real32 const step = ( maxValue - minValue ) / 65535.0;
+      for( localIndex i = 0; i < size; ++i )
+      {
+        field[i] = minValue + step * readValue< std::uint16_t >( buffer, offset );
+      }
+    }
+  }
+}
+
+void WaveCheckpointStorage::release( integer const slot )
+{
+  auto const it = m_snapshots.find( slot );
+  if( it == m_snapshots.end() )
+  {
+    return;
+  }
+  if( !it->second.fileName.empty() )
+  {
+    it->second.pendingWrite.wait();
+    std::remove( it->second.fileName.c_str() );
+  }
+  m_snapshots.erase( it );
+}
+
+localIndex WaveCheckpointStorage::revolveSplit( localIndex const start,
+                                                localIndex const end,
+                                                integer const numFreeSlots )
+{
+  GEOSX_ASSERT_GT( end - start, 1 );
+  GEOSX_ASSERT_GT( numFreeSlots, 0 );
+
+  // smallest number of repetitions such that the range beta(s,reps) = (s+reps)!/(s!reps!) covers the steps
+  long long const s = numFreeSlots;
+  long long reps = 0;
+  long long range = 1;
+  while( range < end - start )
+  {
+    ++reps;
+    range = range * ( reps + s ) / reps;
+  }
+
+  long long const bino1 = range * reps / ( s + reps );
+  long long const bino2 = ( s > 1 ) ? bino1 * s / ( s + reps - 1 ) : 1;
+  long long const bino3 = ( s == 1 ) ? 0 : ( ( s > 2 ) ? bino2 * ( s - 1 ) / ( s + reps - 2 ) : 1 );
+  long long const bino4 = bino2 * ( reps - 1 ) / s;
+  long long const bino5 = ( s < 3 ) ? 0 : ( ( s > 3 ) ? bino3 * ( s - 2 ) / reps : 1 );
+
+  localIndex split;
+  if( end - start <= bino1 + bino3 )
+  {
+    split = start + bino4;
+  }
+  else if( end - start >= range - bino5 )
+  {
+    split = start + bino1;
+  }
+  else
+  {
+    split = end - bino2 - bino3;
+  }
+  return LvArray::math::min( LvArray::math::max( split, start + 1 ), end - 1 );
+}
+
+} /* namespace geosx */
@@ -0,0 +1,138 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file WaveCheckpointStorage.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_WAVECHECKPOINTSTORAGE_HPP_
+#define GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_WAVECHECKPOINTSTORAGE_HPP_
+
+#include "codingUtilities/EnumStrings.hpp"
+#include "common/DataTypes.hpp"
+
+#include <future>
+#include <map>
+
+namespace geosx
+{
+
+/**
+ * @class WaveCheckpointStorage
+ *
+ * Storage of the forward wavefield snapshots taken during the reverse sweep of an adjoint
+ * computation. The snapshots are optionally compressed with a lossy 16-bit quantization, and
+ * the snapshots beyond the in-memory limit are written to local disk in the background.
+ */
+class WaveCheckpointStorage
+{
+public:
+
+  /**
+   * @enum Compression
+   *
+   * The encodings of the stored snapshots
+   */
+  enum class Compression : integer
+  {
+    None,      //!< values stored as is
+    Quantize16 //!< values mapped to 16-bit integers between the min and max of each field
+  };
+
+  /**
+   * @brief Constructor
+   * @param maxInMemory number of snapshots kept in memory, the others are spilled to disk
+   * @param compression encoding of the stored snapshots
+   * @param filePrefix prefix of the spill files, completed by the rank and the snapshot slot
+   */
+  WaveCheckpointStorage( integer const maxInMemory,
+                         Compression const compression,
+                         string const & filePrefix );
+
+  /// Destructor, waits for the pending writes and removes the spill files
+  ~WaveCheckpointStorage();
+
+  WaveCheckpointStorage( WaveCheckpointStorage const & ) = delete;
+  WaveCheckpointStorage & operator=( WaveCheckpointStorage const & ) = delete;
+
+  /**
+   * @brief Store a snapshot of some fields, replacing the one previously stored in the slot.
+   * @param slot the slot of the snapshot
+   * @param fields the fields to store
+   */
+  void store( integer const slot,
+              std::vector< arrayView1d< real32 const > > const & fields );
+
+  /**
+   * @brief Copy a stored snapshot back into the fields.
+   * @param slot the slot of the snapshot
+   * @param fields the fields to overwrite, in the order they were stored
+   */
+  void restore( integer const slot,
+                std::vector< arrayView1d< real32 > > const & fields );
+
+  /**
+   * @brief Free a slot and its memory or spill file.
+   * @param slot the slot of the snapshot
+   */
+  void release( integer const slot );
+
+  /**
+   * @brief Compute the step at which the next checkpoint is taken in a binomial (Revolve) schedule.
+   * @param start the step of the checkpoint the forward sweep starts from
+   * @param end the step the reverse sweep starts from
+   * @param numFreeSlots the number of checkpoints still available
+   * @return the step of the next checkpoint, strictly between @p start and @p end
+   *
+   * This is the placement rule of A. Griewank and A. Walther, Algorithm 799: Revolve, ACM TOMS 26 (2000),
+   * which minimizes the number of forward steps repeated during the reverse sweep.
+   */
+  static localIndex revolveSplit( localIndex const start,
+                                  localIndex const end,
+                                  integer const numFreeSlots );
+
+private:
+
+  /// A stored snapshot
+  struct Snapshot
+  {
+    /// encoded fields, empty when the snapshot lives on disk
+    std::vector< char > buffer;
+    /// name of the spill file, empty when the snapshot is in memory
+    string fileName;
+    /// the write of the spill file running in the background
+    std::future< void > pendingWrite;
+  };
+
+  /// Number of snapshots kept in memory
+  integer const m_maxInMemory;
+
+  /// Encoding of the snapshots
+  Compression const m_compression;
+
+  /// Prefix of the spill files
+  string const m_filePrefix;
+
+  /// The stored snapshots, by slot
+  std::map< integer, Snapshot > m_snapshots;
+};
+
+ENUM_STRINGS( WaveCheckpointStorage::Compression,
+              "none",
+              "quantize16" );
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_WAVECHECKPOINTSTORAGE_HPP_ */
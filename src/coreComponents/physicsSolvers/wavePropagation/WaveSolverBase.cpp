@@ -23,6 +23,7 @@
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/PerfectlyMatchedLayer.hpp"
+#include "fileIO/timeHistory/HDFReceiverTraces.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 
@@ -34,7 +35,8 @@ using namespace dataRepository;
 WaveSolverBase::WaveSolverBase( const std::string & name,
                                 Group * const parent ):
   SolverBase( name,
-              parent )
+              parent ),
+  m_outputSeismoTraceFormat( SeismoTraceFormat::TXT )
 {
 
   registerWrapper( viewKeyStruct::sourceCoordinatesString(), &m_sourceCoordinates ).
@@ -67,6 +69,13 @@ WaveSolverBase::WaveSolverBase( const std::string & name,
     setApplyDefaultValue( 0 ).
     setDescription( "Flag that indicates if we write the seismo trace in a file .txt, 0 no output, 1 otherwise" );
 
+  registerWrapper( viewKeyStruct::outputSeismoTraceFormatString(), &m_outputSeismoTraceFormat ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_outputSeismoTraceFormat ).
+    setDescription( "File format of the seismo trace output. Options are:\n"
+                    "* txt: one text file per receiver\n"
+                    "* hdf: all the receivers written collectively to seismoTraces.hdf5" );
+
   registerWrapper( viewKeyStruct::dtSeismoTraceString(), &m_dtSeismoTrace ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
@@ -120,6 +129,14 @@ void WaveSolverBase::postProcessInput()
 }
 
 
+void WaveSolverBase::writeSeismoTraces( string const & varName,
+                                        arrayView2d< real32 const > const varAtReceivers,
+                                        arrayView1d< localIndex const > const receiverIsLocal ) const
+{
+  GEOSX_MARK_FUNCTION;
+  writeHDFReceiverTraces( "seismoTraces", varName, m_dtSeismoTrace, varAtReceivers, receiverIsLocal );
+}
+
 real32 WaveSolverBase::evaluateRicker( real64 const & time_n, real32 const & f0, localIndex order )
 {
   real32 const o_tpeak = 1.0/f0;
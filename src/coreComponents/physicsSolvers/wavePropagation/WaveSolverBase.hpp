@@ -46,6 +46,17 @@ public:
 
   virtual void initializePreSubGroups() override;
 
+  /**
+   * @enum SeismoTraceFormat
+   *
+   * The file formats of the seismic traces output
+   */
+  enum class SeismoTraceFormat : integer
+  {
+    TXT, //!< one text file per receiver
+    HDF  //!< one dataset per recorded variable in a single HDF5 file, written collectively
+  };
+
   struct viewKeyStruct : SolverBase::viewKeyStruct
   {
     static constexpr char const * sourceCoordinatesString() { return "sourceCoordinates"; }
@@ -57,6 +68,7 @@ public:
 
     static constexpr char const * rickerOrderString() { return "rickerOrder"; }
     static constexpr char const * outputSeismoTraceString() { return "outputSeismoTrace"; }
+    static constexpr char const * outputSeismoTraceFormatString() { return "outputSeismoTraceFormat"; }
     static constexpr char const * dtSeismoTraceString() { return "dtSeismoTrace"; }
     static constexpr char const * indexSeismoTraceString() { return "indexSeismoTrace"; }
 
@@ -121,6 +133,7 @@ protected:
    * @param var_at_np1 the field values at time_n + dt
    * @param var_at_n the field values at time_n
    * @param var_at_receivers the array holding the trace values, where the output is written
+   * @param varName the name of the recorded variable, used to name the trace output
    */
   virtual void computeSeismoTrace( real64 const time_n,
                                    real64 const dt,
@@ -128,7 +141,8 @@ protected:
                                    localIndex iSeismo,
                                    arrayView1d< real32 const > const var_np1,
                                    arrayView1d< real32 const > const var_n,
-                                   arrayView2d< real32 > varAtReceivers ) = 0;
+                                   arrayView2d< real32 > varAtReceivers,
+                                   string const & varName ) = 0;
 
   /**
    * @brief Temporary debug function. Saves the sismo trace to a file.
@@ -138,6 +152,16 @@ protected:
    */
   virtual void saveSeismo( localIndex const iSeismo, real32 val, string const & filename ) = 0;
 
+  /**
+   * @brief Write the complete seismic traces of the receivers local to this rank to the HDF5 trace file.
+   * @param varName name of the recorded variable, used as dataset name
+   * @param varAtReceivers the trace values, one row per time sample and one column per receiver
+   * @param receiverIsLocal flag indicating whether each receiver is located on this rank
+   * @note This is collective over MPI_COMM_GEOSX.
+   */
+  void writeSeismoTraces( string const & varName,
+                          arrayView2d< real32 const > const varAtReceivers,
+                          arrayView1d< localIndex const > const receiverIsLocal ) const;
 
 
   /// Coordinates of the sources in the mesh
@@ -157,6 +181,9 @@ protected:
   /// Flag that indicates if we write the seismo trace in a file .txt, 0 no output, 1 otherwise
   localIndex m_outputSeismoTrace;
 
+  /// File format of the seismo trace output
+  SeismoTraceFormat m_outputSeismoTraceFormat;
+
   /// Time step for seismoTrace output
   real64 m_dtSeismoTrace;
 
@@ -191,6 +218,10 @@ protected:
 
 };
 
+ENUM_STRINGS( WaveSolverBase::SeismoTraceFormat,
+              "txt",
+              "hdf" );
+
 } /* namespace geosx */
 
 #endif /* GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_WAVESOLVERBASE_HPP_ */
@@ -1,10 +1,13 @@
 #include "fileIO/timeHistory/HDFHistoryIO.hpp"
 #include "fileIO/timeHistory/HDFFile.hpp"
+#include "fileIO/timeHistory/HDFReceiverTraces.hpp"
 #include "mainInterface/initialization.hpp"
 #include "dataRepository/BufferOpsDevice.hpp"
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using namespace geosx;
 
 TEST( testHDFIO, HDFFile )
@@ -32,6 +35,121 @@ TEST( testHDFIO, SingleValueHistory )
   io.write( );
 }
 
+TEST( testHDFIO, StagedHistory )
+{
+  string filename( "staged_history" );
+  HistoryMetadata spec( "Staged History", 1, std::type_index( typeid(real64)));
+
+  std::vector< real64 > expected;
+  real64 time = 0.0;
+  {
+    HDFHistoryIO io( filename, spec );
+    io.init( true );
+    for( localIndex writeIdx = 0; writeIdx < 4; ++writeIdx )
+    {
+      for( localIndex tidx = 0; tidx < 25; ++tidx )
+      {
+        time += 0.333;
+        buffer_unit_type * buffer = io.getBufferHead( );
+        memcpy( buffer, &time, sizeof(real64));
+        expected.push_back( time );
+      }
+      EXPECT_EQ( io.getBufferedCount( ), 25 );
+      io.stage( );
+      EXPECT_EQ( io.getBufferedCount( ), 0 );
+      // collection into the internal buffer continues while the staged states are written
+      std::thread writer( [&io]() { io.writeStaged( ); } );
+      time += 0.333;
+      buffer_unit_type * buffer = io.getBufferHead( );
+      memcpy( buffer, &time, sizeof(real64));
+      expected.push_back( time );
+      writer.join( );
+      io.stage( );
+      io.writeStaged( );
+    }
+    io.compressInFile( );
+  }
+
+  // read the data back with the hdf api, the rows must be in collection order
+  HDFFile file( filename, false, true, MPI_COMM_GEOSX );
+  hid_t dataset = H5Dopen( file, "Staged History", H5P_DEFAULT );
+  hid_t space = H5Dget_space( dataset );
+  int const rank = H5Sget_simple_extent_ndims( space );
+  std::vector< hsize_t > dims( rank );
+  H5Sget_simple_extent_dims( space, dims.data(), nullptr );
+  ASSERT_EQ( dims[0], expected.size() );
+  hsize_t numValues = 1;
+  for( hsize_t const dim : dims )
+  {
+    numValues *= dim;
+  }
+  ASSERT_EQ( numValues, expected.size() );
+
+  std::vector< real64 > written( numValues );
+  EXPECT_GE( H5Dread( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, written.data() ), 0 );
+  H5Sclose( space );
+  H5Dclose( dataset );
+  for( std::size_t row = 0; row < expected.size(); ++row )
+  {
+    EXPECT_EQ( written[row], expected[row] );
+  }
+}
+
+TEST( testHDFIO, ReceiverTraces )
+{
+  string filename( "receiver_traces" );
+  localIndex const numSamples = 7;
+  localIndex const numReceivers = 6;
+
+  array2d< real32 > traces( numSamples, numReceivers );
+  array1d< localIndex > receiverIsLocal( numReceivers );
+  for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+  {
+    // leave a gap in the local receivers so that several blocks are selected
+    receiverIsLocal[ircv] = ( ircv == 2 || ircv == 3 ) ? 0 : 1;
+    for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+    {
+      traces[iSample][ircv] = 100.0f * ircv + iSample;
+    }
+  }
+
+  // the second write replaces the dataset of the first one
+  writeHDFReceiverTraces( filename, "traces", 0.5, traces.toViewConst(), receiverIsLocal.toViewConst() );
+  writeHDFReceiverTraces( filename, "traces", 0.25, traces.toViewConst(), receiverIsLocal.toViewConst() );
+
+  HDFFile file( filename, false, true, MPI_COMM_GEOSX );
+  hid_t dataset = H5Dopen( file, "traces", H5P_DEFAULT );
+  ASSERT_GE( dataset, 0 );
+  hid_t space = H5Dget_space( dataset );
+  ASSERT_EQ( H5Sget_simple_extent_ndims( space ), 2 );
+  hsize_t dims[2];
+  H5Sget_simple_extent_dims( space, dims, nullptr );
+  ASSERT_EQ( dims[0], LvArray::integerConversion< hsize_t >( numReceivers ) );
+  ASSERT_EQ( dims[1], LvArray::integerConversion< hsize_t >( numSamples ) );
+
+  // one contiguous trace per receiver, the traces of the receivers not written are left to the fill value
+  std::vector< real32 > written( numReceivers * numSamples );
+  ASSERT_GE( H5Dread( dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, written.data() ), 0 );
+  for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+  {
+    for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+    {
+      real32 const expected = receiverIsLocal[ircv] ? traces[iSample][ircv] : 0.0f;
+      EXPECT_EQ( written[ircv * numSamples + iSample], expected );
+    }
+  }
+
+  real64 dtSample = 0.0;
+  hid_t attr = H5Aopen( dataset, "dt", H5P_DEFAULT );
+  ASSERT_GE( attr, 0 );
+  EXPECT_GE( H5Aread( attr, H5T_NATIVE_DOUBLE, &dtSample ), 0 );
+  EXPECT_EQ( dtSample, 0.25 );
+
+  H5Aclose( attr );
+  H5Sclose( space );
+  H5Dclose( dataset );
+}
+
 TEST( testHDFIO, ArrayHistory )
 {
   srand( time( NULL ));
@@ -0,0 +1,180 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "fileIO/Outputs/ReductionOutput.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// The element volumes of this mesh are 1 on the left half and 2 on the right half,
+// so that their statistics are known: min 1, max 2, volume-weighted average 5/3.
+char const * xmlInput =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 2, 6 }\"\n"
+  "      yCoords=\"{ 0, 2 }\"\n"
+  "      zCoords=\"{ 0, 1 }\"\n"
+  "      nx=\"{ 2, 2 }\"\n"
+  "      ny=\"{ 2 }\"\n"
+  "      nz=\"{ 1 }\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"Region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ nullModel }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <NullModel\n"
+  "      name=\"nullModel\"/>\n"
+  "  </Constitutive>\n"
+  "  <Outputs>\n"
+  "    <Reduction\n"
+  "      name=\"reduction\"\n"
+  "      fieldNames=\"{ elementVolume }\"\n"
+  "      histogramBins=\"2\"\n"
+  "      sampleStride=\"2\"/>\n"
+  "  </Outputs>\n"
+  "</Problem>\n";
+
+/**
+ * @brief Read all the lines of a text file.
+ * @param fileName the name of the file
+ * @return the lines of the file
+ */
+std::vector< string > readLines( string const & fileName )
+{
+  std::ifstream f( fileName );
+  std::vector< string > lines;
+  for( string line; std::getline( f, line ); )
+  {
+    lines.emplace_back( line );
+  }
+  return lines;
+}
+
+class ReductionOutputTest : public ::testing::Test
+{
+public:
+
+  ReductionOutputTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    output = &state.getProblemManager().getGroupByPath< ReductionOutput >( "/Outputs/reduction" );
+    statisticsFile = joinPath( output->getOutputDirectory(), "reduction_mesh_statistics.csv" );
+  }
+
+  void execute( real64 const time, integer const cycle )
+  {
+    output->execute( time, 0.0, cycle, 0, 0.0, state.getProblemManager().getDomainPartition() );
+  }
+
+  GeosxState state;
+  ReductionOutput * output;
+  string statisticsFile;
+};
+
+TEST_F( ReductionOutputTest, Statistics )
+{
+  execute( 0.0, 0 );
+  execute( 0.5, 1 );
+
+  // the file of a new run is truncated, then appended to at each output
+  std::vector< string > const lines = readLines( statisticsFile );
+  ASSERT_EQ( lines.size(), 3 );
+  EXPECT_EQ( lines[0], "time,region,field,min,average,max,bin0,bin1" );
+  EXPECT_EQ( lines[1].substr( 0, lines[1].find( ',' ) ), "0" );
+  EXPECT_EQ( lines[2].substr( 0, lines[2].find( ',' ) ), "0.5" );
+
+  std::istringstream row( lines[2] );
+  std::vector< string > values;
+  for( string value; std::getline( row, value, ',' ); )
+  {
+    values.emplace_back( value );
+  }
+  ASSERT_EQ( values.size(), 8 );
+  EXPECT_EQ( values[1], "Region" );
+  EXPECT_EQ( values[2], "elementVolume" );
+  EXPECT_DOUBLE_EQ( std::stod( values[3] ), 1.0 );
+  EXPECT_NEAR( std::stod( values[4] ), 5.0 / 3.0, 1.0e-5 );
+  EXPECT_DOUBLE_EQ( std::stod( values[5] ), 2.0 );
+  EXPECT_EQ( values[6], "4" );
+  EXPECT_EQ( values[7], "4" );
+
+  // one cell out of two is sampled, whatever the partitioning
+  std::vector< string > const samples = readLines( joinPath( output->getOutputDirectory(), "reduction_mesh_samples_000000001.csv" ) );
+  ASSERT_EQ( samples.size(), 5 );
+  EXPECT_EQ( samples[0], "region,globalIndex,x,y,z,elementVolume" );
+  for( std::size_t i = 1; i < samples.size(); ++i )
+  {
+    EXPECT_EQ( samples[i].substr( 0, samples[i].find( ',', 7 ) ), GEOSX_FMT( "Region,{}", 2 * ( i - 1 ) ) );
+  }
+}
+
+TEST_F( ReductionOutputTest, Restart )
+{
+  // statistics written by a previous run up to t = 2, restarted from a checkpoint taken at t = 1
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ofstream f( statisticsFile );
+    f << "time,region,field,min,average,max,bin0,bin1" << std::endl;
+    f << "0,Region,elementVolume,1,1.66667,2,4,4" << std::endl;
+    f << "1,Region,elementVolume,1,1.66667,2,4,4" << std::endl;
+    f << "2,Region,elementVolume,1,1.66667,2,4,4" << std::endl;
+  }
+  output->getReference< real64 >( ReductionOutput::viewKeysStruct::lastWriteTimeString ) = 1.0;
+
+  execute( 1.5, 3 );
+
+  // the lines written after the restart time are replaced by the new ones
+  std::vector< string > const lines = readLines( statisticsFile );
+  ASSERT_EQ( lines.size(), 4 );
+  EXPECT_EQ( lines[0], "time,region,field,min,average,max,bin0,bin1" );
+  EXPECT_EQ( lines[1].substr( 0, lines[1].find( ',' ) ), "0" );
+  EXPECT_EQ( lines[2].substr( 0, lines[2].find( ',' ) ), "1" );
+  EXPECT_EQ( lines[3].substr( 0, lines[3].find( ',' ) ), "1.5" );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
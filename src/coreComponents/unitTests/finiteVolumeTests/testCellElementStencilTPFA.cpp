@@ -0,0 +1,103 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "finiteVolume/CellElementStencilTPFA.hpp"
+#include "mainInterface/initialization.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace geosx;
+
+namespace
+{
+
+void addConnection( CellElementStencilTPFA & stencil,
+                    localIndex const connectorIndex,
+                    real64 const (&faceNormal)[3],
+                    real64 const (&cellToFaceVec)[2][3] )
+{
+  localIndex elemReg[2] = { 0, 0 };
+  localIndex elemSubReg[2] = { 0, 0 };
+  localIndex elemIndex[2] = { connectorIndex, connectorIndex + 1 };
+  real64 weights[2] = { 2.0 + connectorIndex, 3.0 };
+  stencil.add( 2, elemReg, elemSubReg, elemIndex, weights, connectorIndex );
+  stencil.addVectors( 1.0, faceNormal, cellToFaceVec );
+}
+
+void computeAllWeights( CellElementStencilTPFA const & stencil,
+                        array1d< real64 > & weights )
+{
+  CellElementStencilTPFA::KernelWrapper const wrapper = stencil.createKernelWrapper();
+  weights.resize( stencil.size() );
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    real64 weight[1][2];
+    real64 dWeight_dVar[1][2];
+    wrapper.computeWeights( iconn, weight, dWeight_dVar );
+    weights[iconn] = weight[0][0];
+  }
+}
+
+} // namespace
+
+TEST( CellElementStencilTPFA, axisAlignedCompression )
+{
+  CellElementStencilTPFA stencil;
+  addConnection( stencil, 0, { 1.0, 0.0, 0.0 }, { { 1.0, 0.0, 0.0 }, { -1.0, 0.0, 0.0 } } );
+  addConnection( stencil, 1, { 0.0, -1.0, 0.0 }, { { 0.0, 1.0, 0.0 }, { 0.0, -1.0, 0.0 } } );
+  addConnection( stencil, 2, { 0.0, 0.0, 1.0 }, { { 0.0, 0.0, -1.0 }, { 0.0, 0.0, 1.0 } } );
+
+  array1d< real64 > fullWeights;
+  computeAllWeights( stencil, fullWeights );
+
+  EXPECT_TRUE( stencil.compressAxisAlignedConnections() );
+  EXPECT_TRUE( stencil.isAxisAligned() );
+
+  array1d< real64 > compressedWeights;
+  computeAllWeights( stencil, compressedWeights );
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    EXPECT_DOUBLE_EQ( compressedWeights[iconn], fullWeights[iconn] );
+  }
+
+  // Adding a skewed connection restores the vectors
+  real64 const s = 1.0 / std::sqrt( 2.0 );
+  addConnection( stencil, 3, { s, s, 0.0 }, { { s, s, 0.0 }, { -s, -s, 0.0 } } );
+  EXPECT_FALSE( stencil.isAxisAligned() );
+  EXPECT_FALSE( stencil.compressAxisAlignedConnections() );
+
+  array1d< real64 > expandedWeights;
+  computeAllWeights( stencil, expandedWeights );
+  for( localIndex iconn = 0; iconn < fullWeights.size(); ++iconn )
+  {
+    EXPECT_DOUBLE_EQ( expandedWeights[iconn], fullWeights[iconn] );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
@@ -0,0 +1,191 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "<Solvers>\n"
+  "<SinglePhaseFVM\n"
+  "name=\"singleflow\"\n"
+  "discretization=\"fluidTPFA\"\n"
+  "overlapHaloExchange=\"1\"\n"
+  "targetRegions=\"{ region }\">\n"
+  "<NonlinearSolverParameters\n"
+  "newtonTol=\"1.0e-6\"\n"
+  "newtonMaxIter=\"10\"/>\n"
+  "</SinglePhaseFVM>\n"
+  "</Solvers>\n"
+  "<Mesh>\n"
+  "<InternalMesh\n"
+  "name=\"mesh\"\n"
+  "elementTypes=\"{ C3D8 }\"\n"
+  "xCoords=\"{ 0, 10 }\"\n"
+  "yCoords=\"{ 0, 4 }\"\n"
+  "zCoords=\"{ 0, 2 }\"\n"
+  "nx=\"{ 10 }\"\n"
+  "ny=\"{ 4 }\"\n"
+  "nz=\"{ 2 }\"\n"
+  "cellBlockNames=\"{ cb }\"/>\n"
+  "</Mesh>\n"
+  "<NumericalMethods>\n"
+  "<FiniteVolume>\n"
+  "<TwoPointFluxApproximation\n"
+  "name=\"fluidTPFA\"/>\n"
+  "</FiniteVolume>\n"
+  "</NumericalMethods>\n"
+  "<ElementRegions>\n"
+  "<CellElementRegion\n"
+  "name=\"region\"\n"
+  "cellBlocks=\"{ cb }\"\n"
+  "materialList=\"{ water, rock }\"/>\n"
+  "</ElementRegions>\n"
+  "<Constitutive>\n"
+  "<CompressibleSolidConstantPermeability\n"
+  "name=\"rock\"\n"
+  "solidModelName=\"nullSolid\"\n"
+  "porosityModelName=\"rockPorosity\"\n"
+  "permeabilityModelName=\"rockPerm\"/>\n"
+  "<NullModel\n"
+  "name=\"nullSolid\"/>\n"
+  "<PressurePorosity\n"
+  "name=\"rockPorosity\"\n"
+  "defaultReferencePorosity=\"0.05\"\n"
+  "referencePressure=\"0.0\"\n"
+  "compressibility=\"1.0e-9\"/>\n"
+  "<ConstantPermeability\n"
+  "name=\"rockPerm\"\n"
+  "permeabilityComponents=\"{ 1.0e-13, 1.0e-13, 1.0e-13 }\"/>\n"
+  "<CompressibleSinglePhaseFluid\n"
+  "name=\"water\"\n"
+  "defaultDensity=\"1000\"\n"
+  "defaultViscosity=\"0.001\"\n"
+  "referencePressure=\"0.0\"\n"
+  "compressibility=\"5e-10\"\n"
+  "viscosibility=\"1e-9\"/>\n"
+  "</Constitutive>\n"
+  "<FieldSpecifications>\n"
+  "<FieldSpecification\n"
+  "name=\"initialPressure\"\n"
+  "initialCondition=\"1\"\n"
+  "setNames=\"{ all }\"\n"
+  "objectPath=\"ElementRegions/region/cb\"\n"
+  "fieldName=\"pressure\"\n"
+  "scale=\"9e6\"/>\n"
+  "</FieldSpecifications>\n"
+  "</Problem>\n";
+
+class SinglePhaseHaloOverlapTest : public ::testing::Test
+{
+public:
+
+  SinglePhaseHaloOverlapTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SinglePhaseFVM< SinglePhaseBase > >( "singleflow" );
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+    solver->setupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getSystemRhs(),
+                         solver->getSystemSolution() );
+
+    solver->implicitStepSetup( time, dt, domain );
+  }
+
+  /**
+   * @brief Apply a non-uniform pressure update from the beginning of the step and assemble the system,
+   *        following the sequence of a Newton iteration.
+   * @param overlap whether the halo exchange is overlapped with the assembly
+   * @param residual the assembled residual
+   */
+  void assembleAfterUpdate( bool const overlap,
+                            array1d< real64 > & residual )
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    DofManager const & dofManager = solver->getDofManager();
+    CRSMatrix< real64, globalIndex > & jacobian = solver->getLocalMatrix();
+
+    solver->getReference< integer >( SinglePhaseFVM< SinglePhaseBase >::viewKeyStruct::overlapHaloExchangeString() ) = overlap;
+    solver->resetStateToBeginningOfStep( domain );
+
+    array1d< real64 > solution( jacobian.numRows() );
+    for( localIndex i = 0; i < solution.size(); ++i )
+    {
+      solution[i] = 1.0e5 * ( ( dofManager.rankOffset() + i ) % 7 );
+    }
+    solver->applySystemSolution( dofManager, solution.toViewConst(), 1.0, domain );
+    solver->updateState( domain );
+
+    residual.resize( jacobian.numRows() );
+    residual.zero();
+    jacobian.zero();
+    solver->assembleSystem( time, dt, domain, dofManager, jacobian.toViewConstSizes(), residual.toView() );
+    residual.move( LvArray::MemorySpace::host, false );
+    jacobian.move( LvArray::MemorySpace::host, false );
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1e4;
+
+  GeosxState state;
+  SinglePhaseFVM< SinglePhaseBase > * solver;
+};
+
+real64 constexpr SinglePhaseHaloOverlapTest::time;
+real64 constexpr SinglePhaseHaloOverlapTest::dt;
+
+TEST_F( SinglePhaseHaloOverlapTest, sameSystemWithAndWithoutOverlap )
+{
+  array1d< real64 > residualOverlap;
+  assembleAfterUpdate( true, residualOverlap );
+  CRSMatrix< real64, globalIndex > const jacobianOverlap( solver->getLocalMatrix() );
+
+  array1d< real64 > residual;
+  assembleAfterUpdate( false, residual );
+
+  ASSERT_EQ( residualOverlap.size(), residual.size() );
+  for( localIndex i = 0; i < residual.size(); ++i )
+  {
+    checkRelativeError( residualOverlap[i], residual[i], 1e-12, 1e-20 );
+  }
+  compareLocalMatrices( jacobianOverlap.toViewConst(), solver->getLocalMatrix().toViewConst(), 1e-12, 1e-20 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
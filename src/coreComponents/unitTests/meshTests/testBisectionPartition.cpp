@@ -0,0 +1,168 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/SpatialPartition.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+constexpr int numElemsInX = 12;
+constexpr int numElemsInY = 6;
+constexpr int numElemsInZ = 4;
+
+char const * xmlInput =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 12 }\"\n"
+  "      yCoords=\"{ 0, 6 }\"\n"
+  "      zCoords=\"{ 0, 4 }\"\n"
+  "      nx=\"{ 12 }\"\n"
+  "      ny=\"{ 6 }\"\n"
+  "      nz=\"{ 4 }\"\n"
+  "      partitionMethod=\"bisection\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ nullModel }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <NullModel\n"
+  "      name=\"nullModel\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>\n";
+
+class BisectionPartitionTest : public ::testing::Test
+{
+public:
+
+  BisectionPartitionTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+  }
+
+  GeosxState state;
+};
+
+TEST_F( BisectionPartitionTest, ownershipAndNeighbors )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  int const rank = MpiWrapper::commRank();
+  int const numRanks = MpiWrapper::commSize();
+
+  CellElementSubRegion const & subRegion =
+    domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion< CellElementSubRegion >( 0 );
+  arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+  arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+
+  std::set< int > neighborRanks;
+  for( NeighborCommunicator const & neighbor : domain.getNeighbors() )
+  {
+    neighborRanks.insert( neighbor.neighborRank() );
+  }
+
+  // the owned elements form a box of the structured index space
+  int first[3] = { numElemsInX, numElemsInY, numElemsInZ };
+  int last[3] = { -1, -1, -1 };
+  localIndex numOwned = 0;
+  globalIndex sumOwned = 0;
+  std::set< int > ghostOwners;
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    if( ghostRank[ei] >= 0 )
+    {
+      ghostOwners.insert( ghostRank[ei] );
+      continue;
+    }
+    globalIndex const gi = localToGlobal[ei];
+    int const index[3] = { LvArray::integerConversion< int >( gi / ( numElemsInY * numElemsInZ ) ),
+                           LvArray::integerConversion< int >( ( gi / numElemsInZ ) % numElemsInY ),
+                           LvArray::integerConversion< int >( gi % numElemsInZ ) };
+    for( int i = 0; i < 3; ++i )
+    {
+      first[i] = std::min( first[i], index[i] );
+      last[i] = std::max( last[i], index[i] );
+    }
+    ++numOwned;
+    sumOwned += gi;
+  }
+  ASSERT_GT( numOwned, 0 );
+  EXPECT_EQ( numOwned, localIndex( last[0] - first[0] + 1 ) * ( last[1] - first[1] + 1 ) * ( last[2] - first[2] + 1 ) );
+
+  // every element is owned by exactly one rank
+  globalIndex const numElems = numElemsInX * numElemsInY * numElemsInZ;
+  EXPECT_EQ( MpiWrapper::sum( globalIndex( numOwned ) ), numElems );
+  EXPECT_EQ( MpiWrapper::sum( sumOwned ), numElems * ( numElems - 1 ) / 2 );
+
+  // the ghost elements come from the neighbors, and each neighbor shares at least one element
+  EXPECT_EQ( ghostOwners, neighborRanks );
+  if( numRanks > 1 )
+  {
+    EXPECT_FALSE( neighborRanks.empty() );
+  }
+
+  // the neighbor relation is symmetric and neighbors have different colors
+  SpatialPartition & partition = dynamicCast< SpatialPartition & >( domain.getReference< PartitionBase >( dataRepository::keys::partitionManager ) );
+  int const color = partition.getColor();
+  EXPECT_GE( color, 0 );
+  EXPECT_LT( color, partition.numColor() );
+
+  array1d< int > colors;
+  MpiWrapper::allGather( color, colors );
+  array1d< int > isNeighbor( numRanks * numRanks );
+  array1d< int > localIsNeighbor( numRanks * numRanks );
+  for( int const neighborRank : neighborRanks )
+  {
+    localIsNeighbor[rank * numRanks + neighborRank] = 1;
+    EXPECT_NE( colors[neighborRank], color );
+  }
+  MpiWrapper::allReduce( localIsNeighbor.data(), isNeighbor.data(), numRanks * numRanks, MPI_SUM, MPI_COMM_GEOSX );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    EXPECT_EQ( isNeighbor[rank * numRanks + r], isNeighbor[r * numRanks + rank] );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
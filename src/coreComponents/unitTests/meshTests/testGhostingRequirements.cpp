@@ -0,0 +1,205 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshLevel.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+constexpr int numElemsPerDir = 4;
+
+char const * xmlInput =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 4 }\"\n"
+  "      yCoords=\"{ 0, 4 }\"\n"
+  "      zCoords=\"{ 0, 4 }\"\n"
+  "      nx=\"{ 4 }\"\n"
+  "      ny=\"{ 4 }\"\n"
+  "      nz=\"{ 4 }\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ nullModel }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <NullModel\n"
+  "      name=\"nullModel\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>\n";
+
+TEST( GhostingRequirementsTest, merge )
+{
+  GhostingRequirements const defaultGhosting;
+  EXPECT_EQ( defaultGhosting.adjacency, GhostingRequirements::Adjacency::node );
+  EXPECT_EQ( defaultGhosting.depth, 1 );
+
+  GhostingRequirements face;
+  face.adjacency = GhostingRequirements::Adjacency::face;
+  face.depth = 3;
+
+  // node adjacency is a superset of face adjacency, and the deepest requirement wins
+  GhostingRequirements merged = face;
+  merged.merge( defaultGhosting );
+  EXPECT_EQ( merged.adjacency, GhostingRequirements::Adjacency::node );
+  EXPECT_EQ( merged.depth, 3 );
+
+  merged = defaultGhosting;
+  merged.merge( face );
+  EXPECT_EQ( merged.adjacency, GhostingRequirements::Adjacency::node );
+  EXPECT_EQ( merged.depth, 3 );
+
+  GhostingRequirements shallowFace = face;
+  shallowFace.depth = 1;
+  merged = shallowFace;
+  merged.merge( face );
+  EXPECT_EQ( merged.adjacency, GhostingRequirements::Adjacency::face );
+  EXPECT_EQ( merged.depth, 3 );
+}
+
+class GhostingAdjacencyTest : public ::testing::Test
+{
+public:
+
+  GhostingAdjacencyTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    mesh = &state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getBaseDiscretization();
+    subRegion = &mesh->getElemManager().getRegion( "region" ).getSubRegion< CellElementSubRegion >( 0 );
+    subRegion->registerWrapper< localIndex_array >( adjacencyListName );
+
+    // seed the search with the interior face between the elements (1,1,1) and (2,1,1), and its nodes
+    localIndex const elem0 = subRegion->globalToLocalMap( elemGlobalIndex( 1, 1, 1 ) );
+    localIndex const elem1 = subRegion->globalToLocalMap( elemGlobalIndex( 2, 1, 1 ) );
+    arrayView2d< localIndex const > const elemsToFaces = subRegion->faceList();
+    for( localIndex a = 0; a < elemsToFaces.size( 1 ); ++a )
+    {
+      for( localIndex b = 0; b < elemsToFaces.size( 1 ); ++b )
+      {
+        if( elemsToFaces( elem0, a ) == elemsToFaces( elem1, b ) )
+        {
+          seedFaces.emplace_back( elemsToFaces( elem0, a ) );
+        }
+      }
+    }
+    ASSERT_EQ( seedFaces.size(), 1 );
+    ArrayOfArraysView< localIndex const > const faceToNodes = mesh->getFaceManager().nodeList().toViewConst();
+    for( localIndex const node : faceToNodes[seedFaces[0]] )
+    {
+      seedNodes.emplace_back( node );
+    }
+  }
+
+  static globalIndex elemGlobalIndex( int const i, int const j, int const k )
+  {
+    return ( i * numElemsPerDir + j ) * numElemsPerDir + k;
+  }
+
+  /**
+   * @brief Collect the elements, faces and nodes adjacent to the seeds.
+   * @param adjacency the connectivity of the search
+   * @param depth the number of layers
+   * @param numNodes the number of adjacent nodes
+   * @param numFaces the number of adjacent faces
+   * @return the number of adjacent elements
+   */
+  localIndex countAdjacent( GhostingRequirements::Adjacency const adjacency,
+                            integer const depth,
+                            localIndex & numNodes,
+                            localIndex & numFaces )
+  {
+    GhostingRequirements ghosting;
+    ghosting.adjacency = adjacency;
+    ghosting.depth = depth;
+
+    localIndex_array nodeList, edgeList, faceList;
+    ElementRegionManager::ElementViewAccessor< ReferenceWrapper< localIndex_array > > elemList =
+      mesh->getElemManager().constructReferenceAccessor< localIndex_array >( adjacencyListName );
+    mesh->generateAdjacencyLists( seedNodes.toViewConst(), seedFaces.toViewConst(), nodeList, edgeList, faceList, elemList, ghosting );
+
+    numNodes = nodeList.size();
+    numFaces = faceList.size();
+    return elemList[0][0].get().size();
+  }
+
+  static constexpr char const * adjacencyListName = "testAdjacencyList";
+
+  GeosxState state;
+  MeshLevel * mesh;
+  CellElementSubRegion * subRegion;
+  array1d< localIndex > seedNodes;
+  array1d< localIndex > seedFaces;
+};
+
+constexpr char const * GhostingAdjacencyTest::adjacencyListName;
+
+TEST_F( GhostingAdjacencyTest, faceAdjacency )
+{
+  localIndex numNodes, numFaces;
+
+  // the two elements sharing the seed face, with their 12 nodes and 11 faces
+  EXPECT_EQ( countAdjacent( GhostingRequirements::Adjacency::face, 1, numNodes, numFaces ), 2 );
+  EXPECT_EQ( numNodes, 12 );
+  EXPECT_EQ( numFaces, 11 );
+
+  // the second layer adds the 5 other face neighbors of each of the two elements
+  EXPECT_EQ( countAdjacent( GhostingRequirements::Adjacency::face, 2, numNodes, numFaces ), 12 );
+}
+
+TEST_F( GhostingAdjacencyTest, nodeAdjacency )
+{
+  localIndex numNodes, numFaces;
+
+  // all the elements touching one of the 4 seed nodes: 2 x 3 x 3 elements
+  EXPECT_EQ( countAdjacent( GhostingRequirements::Adjacency::node, 1, numNodes, numFaces ), 18 );
+  EXPECT_EQ( numNodes, 3 * 4 * 4 );
+
+  // the second layer covers the whole mesh
+  EXPECT_EQ( countAdjacent( GhostingRequirements::Adjacency::node, 2, numNodes, numFaces ),
+             numElemsPerDir * numElemsPerDir * numElemsPerDir );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
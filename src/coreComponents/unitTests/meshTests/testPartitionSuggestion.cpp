@@ -0,0 +1,187 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "physicsSolvers/PartitionSuggestion.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "<Solvers>\n"
+  "<SinglePhaseFVM\n"
+  "name=\"singleflow\"\n"
+  "discretization=\"fluidTPFA\"\n"
+  "targetRegions=\"{ region }\"/>\n"
+  "</Solvers>\n"
+  "<Mesh>\n"
+  "<InternalMesh\n"
+  "name=\"mesh\"\n"
+  "elementTypes=\"{ C3D8 }\"\n"
+  "xCoords=\"{ 0, 20 }\"\n"
+  "yCoords=\"{ 0, 4 }\"\n"
+  "zCoords=\"{ 0, 2 }\"\n"
+  "nx=\"{ 20 }\"\n"
+  "ny=\"{ 4 }\"\n"
+  "nz=\"{ 2 }\"\n"
+  "cellBlockNames=\"{ cb }\"/>\n"
+  "</Mesh>\n"
+  "<NumericalMethods>\n"
+  "<FiniteVolume>\n"
+  "<TwoPointFluxApproximation\n"
+  "name=\"fluidTPFA\"/>\n"
+  "</FiniteVolume>\n"
+  "</NumericalMethods>\n"
+  "<ElementRegions>\n"
+  "<CellElementRegion\n"
+  "name=\"region\"\n"
+  "cellBlocks=\"{ cb }\"\n"
+  "materialList=\"{ water, rock }\"/>\n"
+  "</ElementRegions>\n"
+  "<Constitutive>\n"
+  "<CompressibleSolidConstantPermeability\n"
+  "name=\"rock\"\n"
+  "solidModelName=\"nullSolid\"\n"
+  "porosityModelName=\"rockPorosity\"\n"
+  "permeabilityModelName=\"rockPerm\"/>\n"
+  "<NullModel\n"
+  "name=\"nullSolid\"/>\n"
+  "<PressurePorosity\n"
+  "name=\"rockPorosity\"\n"
+  "defaultReferencePorosity=\"0.05\"\n"
+  "referencePressure=\"0.0\"\n"
+  "compressibility=\"1.0e-9\"/>\n"
+  "<ConstantPermeability\n"
+  "name=\"rockPerm\"\n"
+  "permeabilityComponents=\"{ 1.0e-13, 1.0e-13, 1.0e-13 }\"/>\n"
+  "<CompressibleSinglePhaseFluid\n"
+  "name=\"water\"\n"
+  "defaultDensity=\"1000\"\n"
+  "defaultViscosity=\"0.001\"\n"
+  "referencePressure=\"0.0\"\n"
+  "compressibility=\"5e-10\"\n"
+  "viscosibility=\"1e-9\"/>\n"
+  "</Constitutive>\n"
+  "<Tasks>\n"
+  "<PartitionSuggestion\n"
+  "name=\"suggestion\"\n"
+  "solverName=\"singleflow\"/>\n"
+  "</Tasks>\n"
+  "</Problem>\n";
+
+class PartitionSuggestionTest : public ::testing::Test
+{
+public:
+
+  PartitionSuggestionTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SolverBase >( "singleflow" );
+    task = &state.getProblemManager().getGroupByPath< PartitionSuggestion >( "/Tasks/suggestion" );
+  }
+
+  GeosxState state;
+  SolverBase * solver;
+  PartitionSuggestion * task;
+};
+
+TEST_F( PartitionSuggestionTest, costBalancedPartition )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  int const rank = MpiWrapper::commRank();
+  int const numRanks = MpiWrapper::commSize();
+
+  // the first rank is measured three times slower than the others
+  real64 const rankCost = ( rank == 0 ) ? 3.0 : 1.0;
+  solver->resetLocalWorkTime();
+  solver->addLocalWorkTime( rankCost );
+  task->execute( 0.0, 0.0, 0, 0, 0.0, domain );
+
+  // the measured cost is consumed by the task
+  EXPECT_DOUBLE_EQ( solver->getLocalWorkTime(), 0.0 );
+
+  CellElementSubRegion const & subRegion =
+    domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion< CellElementSubRegion >( 0 );
+  arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+  arrayView1d< real64 const > const cost = subRegion.getReference< array1d< real64 > >( PartitionSuggestion::viewKeyStruct::cellCostString() );
+  arrayView1d< integer const > const target = subRegion.getReference< array1d< integer > >( PartitionSuggestion::viewKeyStruct::targetRankString() );
+
+  if( numRanks == 1 )
+  {
+    // a single rank is always balanced: no partition is suggested
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      EXPECT_EQ( target[ei], -1 );
+    }
+    return;
+  }
+
+  // the cost of the rank is split over its owned cells relative to the average cell cost,
+  // and each owned cell gets a valid target rank
+  real64 ownedCost = 0.0;
+  localIndex numOwnedCells = 0;
+  array1d< real64 > localLoads( numRanks );
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    if( ghostRank[ei] < 0 )
+    {
+      ownedCost += cost[ei];
+      ++numOwnedCells;
+      ASSERT_GE( target[ei], 0 );
+      ASSERT_LT( target[ei], numRanks );
+      localLoads[target[ei]] += cost[ei];
+    }
+  }
+  real64 const avgCellCost = MpiWrapper::sum( rankCost ) / MpiWrapper::sum( numOwnedCells );
+  EXPECT_NEAR( ownedCost * avgCellCost, rankCost, 1.0e-12 );
+
+  // the suggested partition reduces the imbalance from 3 / 2 to close to 1
+  real64 totalLoad = 0.0;
+  real64 maxLoad = 0.0;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    real64 const load = MpiWrapper::sum( localLoads[r] );
+    totalLoad += load;
+    maxLoad = std::max( maxLoad, load );
+  }
+  EXPECT_LT( maxLoad * numRanks / totalLoad, 1.25 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
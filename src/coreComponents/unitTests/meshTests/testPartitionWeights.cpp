@@ -0,0 +1,213 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mesh/generators/ParMETISInterface.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace geosx;
+
+/**
+ * The graph is a 2x4 grid, vertex (r,c) has index 2*c+r:
+ *
+ *   0 - 2 - 4 - 6
+ *   |   |   |   |
+ *   1 - 3 - 5 - 7
+ *
+ * With unit weights, the best balanced bisection cuts the two horizontal edges of the middle.
+ * The vertices are evenly distributed over the ranks.
+ */
+class PartitionWeightsTest : public ::testing::Test
+{
+protected:
+
+  static constexpr int64_t numRows = 2;
+  static constexpr int64_t numCols = 4;
+  static constexpr int64_t numVertices = numRows * numCols;
+  static constexpr int64_t numParts = 2;
+
+  void SetUp() override
+  {
+    int64_t const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+    int64_t const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+    ASSERT_EQ( numVertices % numRanks, 0 );
+
+    vertDist.resize( numRanks + 1 );
+    for( int64_t r = 0; r <= numRanks; ++r )
+    {
+      vertDist[r] = r * numVertices / numRanks;
+    }
+
+    for( int64_t v = vertDist[rank]; v < vertDist[rank + 1]; ++v )
+    {
+      int64_t const r = v % numRows;
+      int64_t const c = v / numRows;
+      graph.appendArray( 0 );
+      if( c > 0 )
+      {
+        graph.emplaceBack( graph.size() - 1, v - numRows );
+      }
+      if( c < numCols - 1 )
+      {
+        graph.emplaceBack( graph.size() - 1, v + numRows );
+      }
+      graph.emplaceBack( graph.size() - 1, v + ( r == 0 ? 1 : -1 ) );
+    }
+  }
+
+  /**
+   * @brief Partition the graph and gather the parts of all the vertices.
+   * @param vertWeights the weights of the local vertices (empty for unit weights)
+   * @param edgeWeights the weights of the local edges (empty for unit weights)
+   * @return the part of each vertex of the graph
+   */
+  array1d< int64_t > partition( arrayView1d< int64_t const > const & vertWeights,
+                                arrayView1d< int64_t const > const & edgeWeights ) const
+  {
+    array1d< int64_t > const localParts = parmetis::partition( graph.toViewConst(), vertWeights, edgeWeights,
+                                                               vertDist.toViewConst(), numParts, MPI_COMM_GEOSX, 0 );
+    array1d< int64_t > parts;
+    MpiWrapper::allGather( localParts.toViewConst(), parts, MPI_COMM_GEOSX );
+    return parts;
+  }
+
+  /**
+   * @brief Weights of the local edges: @p horizontal for the edges within a row, @p vertical otherwise.
+   */
+  array1d< int64_t > edgeWeights( int64_t const horizontal, int64_t const vertical ) const
+  {
+    int64_t const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+    array1d< int64_t > weights( graph.getOffsets()[graph.size()] );
+    for( localIndex i = 0; i < graph.size(); ++i )
+    {
+      int64_t const v = vertDist[rank] + i;
+      for( localIndex k = 0; k < graph.sizeOfArray( i ); ++k )
+      {
+        bool const sameRow = ( graph( i, k ) - v ) % numRows == 0;
+        weights[graph.getOffsets()[i] + k] = sameRow ? horizontal : vertical;
+      }
+    }
+    return weights;
+  }
+
+  /**
+   * @brief Compute the weighted cut of a partition of the whole graph.
+   */
+  static int64_t cut( arrayView1d< int64_t const > const & parts, int64_t const horizontal, int64_t const vertical )
+  {
+    int64_t result = 0;
+    for( int64_t c = 0; c < numCols; ++c )
+    {
+      for( int64_t r = 0; r < numRows; ++r )
+      {
+        int64_t const v = c * numRows + r;
+        if( c < numCols - 1 && parts[v] != parts[v + numRows] )
+        {
+          result += horizontal;
+        }
+        if( r < numRows - 1 && parts[v] != parts[v + 1] )
+        {
+          result += vertical;
+        }
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Compute the largest part weight of a partition of the whole graph.
+   */
+  static int64_t maxPartWeight( arrayView1d< int64_t const > const & parts, arrayView1d< int64_t const > const & weights )
+  {
+    array1d< int64_t > partWeights( numParts );
+    for( int64_t v = 0; v < numVertices; ++v )
+    {
+      partWeights[parts[v]] += weights[v];
+    }
+    return *std::max_element( partWeights.begin(), partWeights.end() );
+  }
+
+  ArrayOfArrays< int64_t, int64_t > graph;
+  array1d< int64_t > vertDist;
+  array1d< int64_t > const noWeights;
+};
+
+constexpr int64_t PartitionWeightsTest::numRows;
+constexpr int64_t PartitionWeightsTest::numCols;
+constexpr int64_t PartitionWeightsTest::numVertices;
+constexpr int64_t PartitionWeightsTest::numParts;
+
+TEST_F( PartitionWeightsTest, unitWeights )
+{
+  array1d< int64_t > const parts = partition( noWeights, noWeights );
+  EXPECT_EQ( cut( parts, 1, 1 ), 2 );
+}
+
+TEST_F( PartitionWeightsTest, connectionWeights )
+{
+  // strongly coupled rows must not be cut, the bisection now separates the two rows
+  int64_t const horizontal = 10;
+  int64_t const vertical = 1;
+  array1d< int64_t > const weights = edgeWeights( horizontal, vertical );
+  array1d< int64_t > const unitParts = partition( noWeights, noWeights );
+  array1d< int64_t > const parts = partition( noWeights, weights );
+
+  EXPECT_EQ( cut( parts, horizontal, vertical ), numCols * vertical );
+  EXPECT_LT( cut( parts, horizontal, vertical ), cut( unitParts, horizontal, vertical ) );
+  for( int64_t c = 1; c < numCols; ++c )
+  {
+    EXPECT_EQ( parts[c * numRows], parts[0] );
+    EXPECT_EQ( parts[c * numRows + 1], parts[1] );
+  }
+}
+
+TEST_F( PartitionWeightsTest, cellWeights )
+{
+  // the cells of the first column are three times more expensive, they are balanced by the three other columns
+  int64_t const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  array1d< int64_t > allWeights( numVertices );
+  allWeights.setValues< serialPolicy >( 1 );
+  allWeights[0] = 3;
+  allWeights[1] = 3;
+  array1d< int64_t > localWeights( vertDist[rank + 1] - vertDist[rank] );
+  for( localIndex i = 0; i < localWeights.size(); ++i )
+  {
+    localWeights[i] = allWeights[vertDist[rank] + i];
+  }
+
+  array1d< int64_t > const unitParts = partition( noWeights, noWeights );
+  array1d< int64_t > const parts = partition( localWeights, noWeights );
+
+  EXPECT_EQ( maxPartWeight( parts, allWeights ), 6 );
+  EXPECT_LT( maxPartWeight( parts, allWeights ), maxPartWeight( unitParts, allWeights ) );
+  EXPECT_EQ( parts[0], parts[1] );
+  for( int64_t v = numRows; v < numVertices; ++v )
+  {
+    EXPECT_NE( parts[v], parts[0] );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
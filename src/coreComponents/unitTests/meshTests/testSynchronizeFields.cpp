@@ -0,0 +1,162 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 4 }\"\n"
+  "      yCoords=\"{ 0, 4 }\"\n"
+  "      zCoords=\"{ 0, 4 }\"\n"
+  "      nx=\"{ 4 }\"\n"
+  "      ny=\"{ 4 }\"\n"
+  "      nz=\"{ 4 }\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ nullModel }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <NullModel\n"
+  "      name=\"nullModel\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>\n";
+
+class SynchronizeFieldsTest : public ::testing::Test
+{
+public:
+
+  SynchronizeFieldsTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    mesh = &state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getBaseDiscretization();
+    mesh->getNodeManager().registerWrapper< array2d< real64 > >( fieldName ).reference().resize( mesh->getNodeManager().size(), 1 );
+  }
+
+  /**
+   * @brief Fill the owned nodes with a value depending on their global index, the ghosts with -1.
+   * @param step a value distinguishing the successive synchronizations
+   */
+  void fillField( integer const step )
+  {
+    NodeManager & nodeManager = mesh->getNodeManager();
+    arrayView2d< real64 > const field = nodeManager.getReference< array2d< real64 > >( fieldName ).toView();
+    arrayView1d< integer const > const ghostRank = nodeManager.ghostRank();
+    arrayView1d< globalIndex const > const localToGlobal = nodeManager.localToGlobalMap();
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      for( localIndex i = 0; i < field.size( 1 ); ++i )
+      {
+        field( a, i ) = ghostRank[a] < 0 ? expectedValue( localToGlobal[a], i, step ) : -1.0;
+      }
+    }
+  }
+
+  /**
+   * @brief Synchronize the field and check the values of all the nodes.
+   * @param step the value given to fillField
+   */
+  void synchronizeAndCheck( integer const step )
+  {
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addFields( FieldLocation::Node, { fieldName } );
+    CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                         *mesh,
+                                                         state.getProblemManager().getDomainPartition().getNeighbors(),
+                                                         false );
+
+    NodeManager const & nodeManager = mesh->getNodeManager();
+    arrayView2d< real64 const > const field = nodeManager.getReference< array2d< real64 > >( fieldName ).toViewConst();
+    arrayView1d< globalIndex const > const localToGlobal = nodeManager.localToGlobalMap();
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      for( localIndex i = 0; i < field.size( 1 ); ++i )
+      {
+        EXPECT_EQ( field( a, i ), expectedValue( localToGlobal[a], i, step ) ) << "node " << localToGlobal[a] << ", component " << i;
+      }
+    }
+  }
+
+  static real64 expectedValue( globalIndex const node, localIndex const component, integer const step )
+  {
+    return 100.0 * node + 10.0 * component + step;
+  }
+
+  static constexpr char const * fieldName = "testSyncField";
+
+  GeosxState state;
+  MeshLevel * mesh;
+};
+
+constexpr char const * SynchronizeFieldsTest::fieldName;
+
+TEST_F( SynchronizeFieldsTest, resizeBetweenSynchronizations )
+{
+  // the first synchronization creates the plan of the field, the second one reuses it
+  fillField( 0 );
+  synchronizeAndCheck( 0 );
+  fillField( 1 );
+  synchronizeAndCheck( 1 );
+
+  // the field now exchanges three times more data, the plan is rebuilt once the resize is recorded
+  NodeManager & nodeManager = mesh->getNodeManager();
+  nodeManager.getReference< array2d< real64 > >( fieldName ).resizeDimension< 1 >( 3 );
+  integer const sizeModificationCount = mesh->sizeModificationCount();
+  mesh->modifiedSizes();
+  EXPECT_EQ( mesh->sizeModificationCount(), sizeModificationCount + 1 );
+
+  fillField( 2 );
+  synchronizeAndCheck( 2 );
+  fillField( 3 );
+  synchronizeAndCheck( 3 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -28,15 +28,23 @@
 // TPL includes
 #include <gtest/gtest.h>
 #include <conduit.hpp>
+#include <vtkCellData.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
+#include <vtkXMLUnstructuredGridWriter.h>
 
 using namespace geosx;
 using namespace geosx::testing;
 using namespace geosx::dataRepository;
 
 template< class V >
-void TestMeshImport( string const & meshFilePath, V const & validate )
+void TestMeshImport( string const & meshFilePath, V const & validate, string const & attributes = "" )
 {
-  string const meshNode = GEOSX_FMT( R"(<Mesh><VTKMesh name="mesh" file="{}" partitionRefinement="0"/></Mesh>)", meshFilePath );
+  string const meshNode = GEOSX_FMT( R"(<Mesh><VTKMesh name="mesh" file="{}" partitionRefinement="0" {}/></Mesh>)", meshFilePath, attributes );
   xmlWrapper::xmlDocument xmlDocument;
   xmlDocument.load_buffer( meshNode.c_str(), meshNode.size() );
   xmlWrapper::xmlNode xmlMeshNode = xmlDocument.child( "Mesh" );
@@ -168,6 +176,114 @@ TEST( VTKImport, cube )
   TestMeshImport( cubePVTS, validate );
 }
 
+/**
+ * @brief Import with parallelRead a copy of cube.vtu with raw appended data, providing only one kind of global ids.
+ * @param withPointIds true if the file provides the point global ids, false if it provides the cell global ids
+ *
+ * The ids provided by the file are the reversed file indices, the missing ones are the file indices.
+ */
+void testParallelReadGlobalIds( bool const withPointIds )
+{
+  vtkNew< vtkXMLUnstructuredGridReader > reader;
+  reader->SetFileName( ( testMeshDir + "/cube.vtu" ).c_str() );
+  reader->Update();
+  vtkUnstructuredGrid & mesh = *reader->GetOutput();
+  vtkIdType const numPoints = mesh.GetNumberOfPoints();
+  vtkIdType const numCells = mesh.GetNumberOfCells();
+
+  vtkNew< vtkIdTypeArray > globalIds;
+  globalIds->SetName( "GlobalIds" );
+  globalIds->SetNumberOfTuples( withPointIds ? numPoints : numCells );
+  for( vtkIdType i = 0; i < globalIds->GetNumberOfTuples(); ++i )
+  {
+    globalIds->SetValue( i, globalIds->GetNumberOfTuples() - 1 - i );
+  }
+  if( withPointIds )
+  {
+    mesh.GetPointData()->SetGlobalIds( globalIds );
+  }
+  else
+  {
+    mesh.GetCellData()->SetGlobalIds( globalIds );
+  }
+
+  string const fileName = GEOSX_FMT( "cube_{}_ids.vtu", withPointIds ? "point" : "cell" );
+  if( MpiWrapper::commRank() == 0 )
+  {
+    vtkNew< vtkXMLUnstructuredGridWriter > writer;
+    writer->SetFileName( fileName.c_str() );
+    writer->SetInputData( &mesh );
+    writer->SetDataModeToAppended();
+    writer->EncodeAppendedDataOff();
+    writer->SetCompressorTypeToNone();
+    writer->Write();
+  }
+  MpiWrapper::barrier();
+
+  // The expected global ids of the points, found by their positions, and of the cells, found by their sorted points
+  std::map< std::array< real64, 3 >, globalIndex > pointIds;
+  for( vtkIdType i = 0; i < numPoints; ++i )
+  {
+    double const * const x = mesh.GetPoint( i );
+    pointIds[{ x[0], x[1], x[2] }] = withPointIds ? numPoints - 1 - i : i;
+  }
+  std::map< std::vector< globalIndex >, globalIndex > cellIds;
+  for( vtkIdType c = 0; c < numCells; ++c )
+  {
+    vtkNew< vtkIdList > cellPoints;
+    mesh.GetCellPoints( c, cellPoints );
+    std::vector< globalIndex > cellPointIds;
+    for( vtkIdType i = 0; i < cellPoints->GetNumberOfIds(); ++i )
+    {
+      double const * const x = mesh.GetPoint( cellPoints->GetId( i ) );
+      cellPointIds.push_back( pointIds.at( { x[0], x[1], x[2] } ) );
+    }
+    std::sort( cellPointIds.begin(), cellPointIds.end() );
+    cellIds[cellPointIds] = withPointIds ? c : numCells - 1 - c;
+  }
+
+  auto validate = [&]( CellBlockManagerABC const & cellBlockManager ) -> void
+  {
+    array2d< real64, nodes::REFERENCE_POSITION_PERM > const positions = cellBlockManager.getNodePositions();
+    array1d< globalIndex > const nodeLocalToGlobal = cellBlockManager.getNodeLocalToGlobal();
+    for( localIndex n = 0; n < cellBlockManager.numNodes(); ++n )
+    {
+      std::array< real64, 3 > const x{ positions( n, 0 ), positions( n, 1 ), positions( n, 2 ) };
+      ASSERT_EQ( pointIds.count( x ), 1 );
+      EXPECT_EQ( nodeLocalToGlobal[n], pointIds.at( x ) );
+    }
+
+    cellBlockManager.getCellBlocks().forSubGroups< CellBlockABC >( [&]( CellBlockABC const & cellBlock )
+    {
+      array2d< localIndex, cells::NODE_MAP_PERMUTATION > const elemToNodes = cellBlock.getElemToNodes();
+      array1d< globalIndex > const localToGlobal = cellBlock.localToGlobalMap();
+      for( localIndex k = 0; k < cellBlock.numElements(); ++k )
+      {
+        std::vector< globalIndex > cellPointIds;
+        for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+        {
+          cellPointIds.push_back( nodeLocalToGlobal[elemToNodes( k, a )] );
+        }
+        std::sort( cellPointIds.begin(), cellPointIds.end() );
+        ASSERT_EQ( cellIds.count( cellPointIds ), 1 );
+        EXPECT_EQ( localToGlobal[k], cellIds.at( cellPointIds ) );
+      }
+    } );
+  };
+
+  TestMeshImport( fileName, validate, R"(parallelRead="1")" );
+}
+
+TEST( VTKImport, parallelReadPointGlobalIds )
+{
+  testParallelReadGlobalIds( true );
+}
+
+TEST( VTKImport, parallelReadCellGlobalIds )
+{
+  testParallelReadGlobalIds( false );
+}
+
 TEST( VTKImport, medley )
 {
   SKIP_TEST_IN_PARALLEL( "Neither relevant nor implemented in parallel" );
@@ -717,6 +833,89 @@ TEST( VTKImport, medley42 )
   TestMeshImport( medleyVTK, validate );
 }
 
+/**
+ * @brief Description of an imported mesh that does not depend on the local numbering.
+ */
+struct MeshByGlobalIds
+{
+  /// Position of each node
+  std::map< globalIndex, std::array< real64, 3 > > nodePositions;
+  /// Cell block of each cell (which carries the region attribute and the cell type), and its nodes in order
+  std::map< globalIndex, std::pair< string, std::vector< globalIndex > > > cells;
+  /// Global ids of the cells in local order, block after block
+  std::vector< globalIndex > cellOrder;
+};
+
+/**
+ * @brief Import a mesh and describe it by global ids.
+ * @param meshFilePath the mesh file
+ * @param localOrdering the ordering of the local cells and nodes
+ * @return the description of the local part of the mesh
+ */
+MeshByGlobalIds importByGlobalIds( string const & meshFilePath, string const & localOrdering )
+{
+  MeshByGlobalIds mesh;
+  auto describe = [&]( CellBlockManagerABC const & cellBlockManager ) -> void
+  {
+    array2d< real64, nodes::REFERENCE_POSITION_PERM > const positions = cellBlockManager.getNodePositions();
+    array1d< globalIndex > const nodeLocalToGlobal = cellBlockManager.getNodeLocalToGlobal();
+    for( localIndex n = 0; n < cellBlockManager.numNodes(); ++n )
+    {
+      mesh.nodePositions[nodeLocalToGlobal[n]] = { positions( n, 0 ), positions( n, 1 ), positions( n, 2 ) };
+    }
+
+    cellBlockManager.getCellBlocks().forSubGroups< CellBlockABC >( [&]( CellBlockABC const & cellBlock )
+    {
+      array2d< localIndex, cells::NODE_MAP_PERMUTATION > const elemToNodes = cellBlock.getElemToNodes();
+      array1d< globalIndex > const localToGlobal = cellBlock.localToGlobalMap();
+      for( localIndex k = 0; k < cellBlock.numElements(); ++k )
+      {
+        std::vector< globalIndex > cellNodes;
+        for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+        {
+          cellNodes.push_back( nodeLocalToGlobal[elemToNodes( k, a )] );
+        }
+        mesh.cells[localToGlobal[k]] = { cellBlock.getName(), cellNodes };
+        mesh.cellOrder.push_back( localToGlobal[k] );
+      }
+    } );
+  };
+  TestMeshImport( meshFilePath, describe, GEOSX_FMT( R"(localOrdering="{}")", localOrdering ) );
+  return mesh;
+}
+
+/**
+ * @brief Check that the Morton reordering only renumbers the local cells and nodes of a mesh.
+ * @param meshFilePath the mesh file
+ */
+void testMortonOrdering( string const & meshFilePath )
+{
+  MeshByGlobalIds const original = importByGlobalIds( meshFilePath, "none" );
+  MeshByGlobalIds const reordered = importByGlobalIds( meshFilePath, "morton" );
+
+  // same nodes at the same positions, and same cells in the same blocks with the same nodes
+  EXPECT_EQ( reordered.nodePositions, original.nodePositions );
+  EXPECT_EQ( reordered.cells, original.cells );
+  EXPECT_EQ( reordered.cellOrder.size(), original.cellOrder.size() );
+}
+
+TEST( VTKImport, mortonOrderingCube )
+{
+  string const cubeVTU = testMeshDir + "/cube.vtu";
+  testMortonOrdering( cubeVTU );
+
+  // the 3 x 3 x 3 cells of the cube are stored in lexicographic order in the file, which is not a Morton order
+  SKIP_TEST_IN_PARALLEL( "The local cells of a rank may already be in Morton order" );
+  EXPECT_NE( importByGlobalIds( cubeVTU, "morton" ).cellOrder, importByGlobalIds( cubeVTU, "none" ).cellOrder );
+}
+
+TEST( VTKImport, mortonOrderingPolyhedra )
+{
+  SKIP_TEST_IN_PARALLEL( "Neither relevant nor implemented in parallel" );
+
+  // the face streams of the polyhedra are renumbered as well
+  testMortonOrdering( testMeshDir + "/medley-42.vtk" );
+}
 
 
 int main( int argc, char * * argv )
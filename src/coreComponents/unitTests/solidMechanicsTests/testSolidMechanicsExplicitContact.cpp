@@ -0,0 +1,277 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsExplicitContact.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// A block of 2 x 2 x 1 elements, and a single element above it, both with elements of size 0.5
+char const * xmlInput =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SolidMechanicsLagrangianSSLE\n"
+  "      name=\"lagsolve\"\n"
+  "      timeIntegrationOption=\"ExplicitDynamic\"\n"
+  "      explicitContactPenalty=\"1.0e6\"\n"
+  "      discretization=\"FE1\"\n"
+  "      targetRegions=\"{ lowerMesh/lowerRegion, upperMesh/upperRegion }\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"lowerMesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 1 }\"\n"
+  "      yCoords=\"{ 0, 1 }\"\n"
+  "      zCoords=\"{ 0, 0.5 }\"\n"
+  "      nx=\"{ 2 }\"\n"
+  "      ny=\"{ 2 }\"\n"
+  "      nz=\"{ 1 }\"\n"
+  "      cellBlockNames=\"{ cb1 }\"/>\n"
+  "    <InternalMesh\n"
+  "      name=\"upperMesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0.25, 0.75 }\"\n"
+  "      yCoords=\"{ 0.25, 0.75 }\"\n"
+  "      zCoords=\"{ 0.6, 1.1 }\"\n"
+  "      nx=\"{ 1 }\"\n"
+  "      ny=\"{ 1 }\"\n"
+  "      nz=\"{ 1 }\"\n"
+  "      cellBlockNames=\"{ cb2 }\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace\n"
+  "        name=\"FE1\"\n"
+  "        order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"lowerRegion\"\n"
+  "      meshBody=\"lowerMesh\"\n"
+  "      cellBlocks=\"{ cb1 }\"\n"
+  "      materialList=\"{ shale }\"/>\n"
+  "    <CellElementRegion\n"
+  "      name=\"upperRegion\"\n"
+  "      meshBody=\"upperMesh\"\n"
+  "      cellBlocks=\"{ cb2 }\"\n"
+  "      materialList=\"{ shale }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <ElasticIsotropic\n"
+  "      name=\"shale\"\n"
+  "      defaultDensity=\"2700\"\n"
+  "      defaultBulkModulus=\"5.5556e9\"\n"
+  "      defaultShearModulus=\"4.16667e9\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>\n";
+
+/**
+ * @class SolidMechanicsExplicitContactTester
+ * Gives access to the spatial hash of the contact search.
+ */
+class SolidMechanicsExplicitContactTester : public SolidMechanicsExplicitContact
+{
+public:
+  using SolidMechanicsExplicitContact::faceGeometry;
+  using SolidMechanicsExplicitContact::insertFace;
+  using SolidMechanicsExplicitContact::removeFace;
+  using SolidMechanicsExplicitContact::updateSpatialHash;
+  using SolidMechanicsExplicitContact::candidateFaces;
+};
+
+class ExplicitContactTest : public ::testing::Test
+{
+public:
+
+  ExplicitContactTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    lowerMesh = &domain.getMeshBody( "lowerMesh" ).getBaseDiscretization();
+    upperMesh = &domain.getMeshBody( "upperMesh" ).getBaseDiscretization();
+
+    // the automatic cell size is twice the largest boundary face
+    contact.initialize( { lowerMesh, upperMesh }, penalty, 0.0 );
+  }
+
+  /**
+   * @brief Translate the upper mesh vertically from its initial position.
+   * @param dz the vertical displacement
+   */
+  void displaceUpperMesh( real64 const dz )
+  {
+    arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const u = upperMesh->getNodeManager().totalDisplacement();
+    for( localIndex a = 0; a < u.size( 0 ); ++a )
+    {
+      u( a, 2 ) = dz;
+    }
+    contact.updatePositions( 1, *upperMesh );
+  }
+
+  /**
+   * @param face a boundary face
+   * @return whether the face is registered in the cell of the spatial hash containing its center
+   */
+  bool isRegistered( localIndex const face ) const
+  {
+    real64 center[3], normal[3];
+    contact.faceGeometry( face, center, normal );
+    std::vector< localIndex > const & faces = contact.candidateFaces( center );
+    return std::find( faces.begin(), faces.end(), face ) != faces.end();
+  }
+
+  /**
+   * @brief Sum the contact forces on the nodes of a mesh.
+   * @param meshIndex the index of the mesh in the contact search
+   * @param mesh the mesh level
+   * @param totalForce the sum of the forces
+   */
+  void sumForces( localIndex const meshIndex,
+                  MeshLevel const & mesh,
+                  real64 ( & totalForce )[3] ) const
+  {
+    array2d< real64, nodes::ACCELERATION_PERM > force( mesh.getNodeManager().size(), 3 );
+    contact.addForces( meshIndex, mesh, force.toView() );
+    LvArray::tensorOps::fill< 3 >( totalForce, 0.0 );
+    for( localIndex a = 0; a < force.size( 0 ); ++a )
+    {
+      LvArray::tensorOps::add< 3 >( totalForce, force[a] );
+    }
+  }
+
+  static real64 constexpr penalty = 1.0e6;
+
+  GeosxState state;
+  SolidMechanicsLagrangianFEM * solver;
+  MeshLevel * lowerMesh;
+  MeshLevel * upperMesh;
+  SolidMechanicsExplicitContactTester contact;
+};
+
+real64 constexpr ExplicitContactTest::penalty;
+
+TEST_F( ExplicitContactTest, spatialHash )
+{
+  // 8 faces on the top and bottom of the lower mesh, 8 on its sides, and the 6 faces of the upper mesh
+  ASSERT_EQ( contact.numFaces(), 22 );
+  EXPECT_DOUBLE_EQ( contact.cellSize(), 1.0 );
+  for( localIndex kf = 0; kf < contact.numFaces(); ++kf )
+  {
+    EXPECT_TRUE( isRegistered( kf ) );
+  }
+
+  // a removed face is no longer found, until it is inserted again
+  contact.removeFace( 0 );
+  EXPECT_FALSE( isRegistered( 0 ) );
+  contact.insertFace( 0 );
+  EXPECT_TRUE( isRegistered( 0 ) );
+
+  // a motion within the margin keeps the registered boxes
+  displaceUpperMesh( -0.05 );
+  contact.updateSpatialHash();
+  EXPECT_EQ( contact.numFaceUpdates(), 0 );
+
+  // a larger one registers the faces of the upper mesh again, at their new position
+  displaceUpperMesh( -0.5 );
+  contact.updateSpatialHash();
+  EXPECT_EQ( contact.numFaceUpdates(), 6 );
+  for( localIndex kf = 0; kf < contact.numFaces(); ++kf )
+  {
+    EXPECT_TRUE( isRegistered( kf ) );
+  }
+}
+
+TEST_F( ExplicitContactTest, penaltyForces )
+{
+  // the meshes are apart
+  EXPECT_EQ( contact.computeForces(), 0 );
+
+  // the bottom of the upper mesh goes 0.1 into the lower mesh: its 4 nodes penetrate the top faces
+  // of the lower mesh, and the node at the center of the top of the lower mesh penetrates its bottom face
+  displaceUpperMesh( -0.2 );
+  EXPECT_EQ( contact.computeForces(), 5 );
+
+  real64 lowerForce[3], upperForce[3];
+  sumForces( 0, *lowerMesh, lowerForce );
+  sumForces( 1, *upperMesh, upperForce );
+
+  // the upper mesh is pushed up by the 5 contacts, and the reactions balance the actions
+  real64 const contactForce = penalty * 0.1;
+  real64 const tolerance = 1.0e-10 * contactForce;
+  EXPECT_NEAR( upperForce[0], 0.0, tolerance );
+  EXPECT_NEAR( upperForce[1], 0.0, tolerance );
+  EXPECT_NEAR( upperForce[2], 5 * contactForce, 5 * tolerance );
+  for( int j = 0; j < 3; ++j )
+  {
+    EXPECT_NEAR( lowerForce[j] + upperForce[j], 0.0, tolerance );
+  }
+
+  // once the upper mesh is back above, there is no contact
+  displaceUpperMesh( 0.0 );
+  EXPECT_EQ( contact.computeForces(), 0 );
+  sumForces( 1, *upperMesh, upperForce );
+  EXPECT_EQ( LvArray::tensorOps::l2Norm< 3 >( upperForce ), 0.0 );
+}
+
+TEST_F( ExplicitContactTest, ghostDepth )
+{
+  DomainPartition const & domain = state.getProblemManager().getDomainPartition();
+
+  // the automatic cell size, twice the largest element, is covered by two layers of elements
+  EXPECT_EQ( solver->getGhostingRequirements( domain ).depth, 2 );
+
+  solver->getReference< real64 >( SolidMechanicsLagrangianFEM::viewKeyStruct::explicitContactCellSizeString() ) = 1.6;
+  EXPECT_EQ( solver->getGhostingRequirements( domain ).depth, 4 );
+
+  // without contact, the default single layer is kept
+  solver->getReference< real64 >( SolidMechanicsLagrangianFEM::viewKeyStruct::explicitContactPenaltyString() ) = 0.0;
+  EXPECT_EQ( solver->getGhostingRequirements( domain ).depth, 1 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,236 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsMatrixFreeOperator.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// A block of 2 x 2 x 2 elements of size 0.5 x 1 x 0.5
+char const * xmlInput =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SolidMechanicsLagrangianSSLE\n"
+  "      name=\"lagsolve\"\n"
+  "      timeIntegrationOption=\"QuasiStatic\"\n"
+  "      matrixFree=\"1\"\n"
+  "      discretization=\"FE1\"\n"
+  "      targetRegions=\"{ region }\">\n"
+  "      <LinearSolverParameters\n"
+  "        solverType=\"cg\"/>\n"
+  "    </SolidMechanicsLagrangianSSLE>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 1 }\"\n"
+  "      yCoords=\"{ 0, 2 }\"\n"
+  "      zCoords=\"{ 0, 1 }\"\n"
+  "      nx=\"{ 2 }\"\n"
+  "      ny=\"{ 2 }\"\n"
+  "      nz=\"{ 2 }\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace\n"
+  "        name=\"FE1\"\n"
+  "        order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ shale }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <ElasticIsotropic\n"
+  "      name=\"shale\"\n"
+  "      defaultDensity=\"2700\"\n"
+  "      defaultBulkModulus=\"5.5556e9\"\n"
+  "      defaultShearModulus=\"4.16667e9\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>\n";
+
+class MatrixFreeTest : public ::testing::Test
+{
+public:
+
+  MatrixFreeTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) ),
+    matrixFreeDofManager( "matrixFree" ),
+    assembledDofManager( "assembled" )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+    // the residual pass of the matrix-free kernel caches the constitutive tangent and assembles the diagonal
+    assemble( domain, matrixFreeDofManager, diagonal );
+
+    // the same jacobian, assembled in a sparse matrix
+    integer & matrixFree = solver->getReference< integer >( SolidMechanicsLagrangianFEM::viewKeyStruct::matrixFreeString() );
+    matrixFree = 0;
+    assemble( domain, assembledDofManager, localMatrix );
+    matrixFree = 1;
+
+    jacobian.create( localMatrix.toViewConst(), assembledDofManager.numLocalDofs(), MPI_COMM_GEOSX );
+  }
+
+  /**
+   * @brief Set up the linear system of the solver and assemble it at the initial state.
+   * @param domain the domain partition
+   * @param dofManager the degree-of-freedom manager
+   * @param matrix the local matrix
+   */
+  void assemble( DomainPartition & domain,
+                 DofManager & dofManager,
+                 CRSMatrix< real64, globalIndex > & matrix )
+  {
+    ParallelVector rhs;
+    ParallelVector solution;
+    solver->setupSystem( domain, dofManager, matrix, rhs, solution );
+    solver->assembleSystem( 0.0, 1.0, domain, dofManager, matrix.toViewConstSizes(), rhs.open() );
+    rhs.close();
+  }
+
+  /**
+   * @brief Apply the matrix-free operator to a random vector and compare with the assembled jacobian.
+   * @param constrainedRows the local rows constrained by the boundary conditions
+   */
+  void compareProducts( arrayView1d< localIndex const > const & constrainedRows )
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    SolidMechanicsMatrixFreeOperator const matrixFreeOperator( *solver,
+                                                               domain,
+                                                               matrixFreeDofManager,
+                                                               diagonal.toViewConstSizes(),
+                                                               constrainedRows );
+    ASSERT_EQ( matrixFreeOperator.numGlobalRows(), jacobian.numGlobalRows() );
+
+    localIndex const numLocalDofs = assembledDofManager.numLocalDofs();
+    ParallelVector src;
+    src.create( numLocalDofs, MPI_COMM_GEOSX );
+    src.rand( 1984 );
+
+    ParallelVector product;
+    product.create( numLocalDofs, MPI_COMM_GEOSX );
+    matrixFreeOperator.apply( src, product );
+
+    // the constrained columns are eliminated, and the constrained rows keep the diagonal
+    ParallelVector freeSrc( src );
+    arrayView1d< real64 > const freeSrcValues = freeSrc.open();
+    for( localIndex const row : constrainedRows )
+    {
+      freeSrcValues[row] = 0.0;
+    }
+    freeSrc.close();
+
+    ParallelVector expected;
+    expected.create( numLocalDofs, MPI_COMM_GEOSX );
+    jacobian.apply( freeSrc, expected );
+    arrayView1d< real64 > const expectedValues = expected.open();
+    arrayView1d< real64 const > const srcValues = src.values();
+    for( localIndex const row : constrainedRows )
+    {
+      expectedValues[row] = diagonal.getEntries( row )[0] * srcValues[row];
+    }
+    expected.close();
+
+    real64 const tolerance = 1.0e-12 * expected.norm2();
+    arrayView1d< real64 const > const productValues = product.values();
+    for( localIndex row = 0; row < numLocalDofs; ++row )
+    {
+      EXPECT_NEAR( productValues[row], expected.values()[row], tolerance ) << "row " << row;
+    }
+  }
+
+  GeosxState state;
+  SolidMechanicsLagrangianFEM * solver;
+  DofManager matrixFreeDofManager;
+  DofManager assembledDofManager;
+  CRSMatrix< real64, globalIndex > diagonal;
+  CRSMatrix< real64, globalIndex > localMatrix;
+  ParallelMatrix jacobian;
+};
+
+TEST_F( MatrixFreeTest, diagonal )
+{
+  ASSERT_EQ( diagonal.numRows(), localMatrix.numRows() );
+  globalIndex const rankOffset = assembledDofManager.rankOffset();
+  for( localIndex row = 0; row < diagonal.numRows(); ++row )
+  {
+    ASSERT_EQ( diagonal.numNonZeros( row ), 1 );
+    EXPECT_EQ( diagonal.getColumns( row )[0], rankOffset + row );
+
+    real64 assembledDiagonal = 0.0;
+    for( localIndex j = 0; j < localMatrix.numNonZeros( row ); ++j )
+    {
+      if( localMatrix.getColumns( row )[j] == rankOffset + row )
+      {
+        assembledDiagonal = localMatrix.getEntries( row )[j];
+      }
+    }
+    EXPECT_NEAR( diagonal.getEntries( row )[0], assembledDiagonal, 1.0e-12 * fabs( assembledDiagonal ) );
+  }
+}
+
+TEST_F( MatrixFreeTest, apply )
+{
+  compareProducts( array1d< localIndex >().toViewConst() );
+}
+
+TEST_F( MatrixFreeTest, applyWithConstrainedRows )
+{
+  // the three components of the first node, and a single component of another one
+  array1d< localIndex > constrainedRows;
+  constrainedRows.emplace_back( 0 );
+  constrainedRows.emplace_back( 1 );
+  constrainedRows.emplace_back( 2 );
+  constrainedRows.emplace_back( 7 );
+  compareProducts( constrainedRows.toViewConst() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
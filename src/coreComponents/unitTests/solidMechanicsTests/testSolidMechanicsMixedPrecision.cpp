@@ -0,0 +1,255 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// A small sedov problem: a pressurized corner of a block of 5 x 5 x 5 elements, with symmetry constraints.
+// The precision is inserted between the two parts.
+char const * xmlInputBegin =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <SolidMechanicsLagrangianSSLE\n"
+  "      name=\"lagsolve\"\n"
+  "      timeIntegrationOption=\"ExplicitDynamic\"\n"
+  "      explicitPrecision=\"";
+
+char const * xmlInputEnd =
+  "\"\n"
+  "      discretization=\"FE1\"\n"
+  "      targetRegions=\"{ region }\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 5 }\"\n"
+  "      yCoords=\"{ 0, 5 }\"\n"
+  "      zCoords=\"{ 0, 5 }\"\n"
+  "      nx=\"{ 5 }\"\n"
+  "      ny=\"{ 5 }\"\n"
+  "      nz=\"{ 5 }\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <Box\n"
+  "      name=\"source\"\n"
+  "      xMin=\"{ -1, -1, -1 }\"\n"
+  "      xMax=\"{ 1.1, 1.1, 1.1 }\"/>\n"
+  "  </Geometry>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace\n"
+  "        name=\"FE1\"\n"
+  "        order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ shale }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <ElasticIsotropic\n"
+  "      name=\"shale\"\n"
+  "      defaultDensity=\"2700\"\n"
+  "      defaultBulkModulus=\"5.5556e9\"\n"
+  "      defaultShearModulus=\"4.16667e9\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification\n"
+  "      name=\"source0\"\n"
+  "      initialCondition=\"1\"\n"
+  "      setNames=\"{ source }\"\n"
+  "      objectPath=\"ElementRegions\"\n"
+  "      fieldName=\"shale_stress\"\n"
+  "      component=\"0\"\n"
+  "      scale=\"-1.0e6\"/>\n"
+  "    <FieldSpecification\n"
+  "      name=\"source1\"\n"
+  "      initialCondition=\"1\"\n"
+  "      setNames=\"{ source }\"\n"
+  "      objectPath=\"ElementRegions\"\n"
+  "      fieldName=\"shale_stress\"\n"
+  "      component=\"1\"\n"
+  "      scale=\"-1.0e6\"/>\n"
+  "    <FieldSpecification\n"
+  "      name=\"source2\"\n"
+  "      initialCondition=\"1\"\n"
+  "      setNames=\"{ source }\"\n"
+  "      objectPath=\"ElementRegions\"\n"
+  "      fieldName=\"shale_stress\"\n"
+  "      component=\"2\"\n"
+  "      scale=\"-1.0e6\"/>\n"
+  "    <FieldSpecification\n"
+  "      name=\"xconstraint\"\n"
+  "      objectPath=\"nodeManager\"\n"
+  "      fieldName=\"Velocity\"\n"
+  "      component=\"0\"\n"
+  "      scale=\"0.0\"\n"
+  "      setNames=\"{ xneg }\"/>\n"
+  "    <FieldSpecification\n"
+  "      name=\"yconstraint\"\n"
+  "      objectPath=\"nodeManager\"\n"
+  "      fieldName=\"Velocity\"\n"
+  "      component=\"1\"\n"
+  "      scale=\"0.0\"\n"
+  "      setNames=\"{ yneg }\"/>\n"
+  "    <FieldSpecification\n"
+  "      name=\"zconstraint\"\n"
+  "      objectPath=\"nodeManager\"\n"
+  "      fieldName=\"Velocity\"\n"
+  "      component=\"2\"\n"
+  "      scale=\"0.0\"\n"
+  "      setNames=\"{ zneg }\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>\n";
+
+/**
+ * @brief Copy a nodal field ordered by global node index.
+ * @tparam T the type of the values of the field
+ * @tparam USD the unit stride dimension of the field
+ * @param localToGlobal the global index of the nodes
+ * @param field the nodal field
+ * @param copy the copy of the field
+ */
+template< typename T, int USD >
+void copyByGlobalIndex( arrayView1d< globalIndex const > const & localToGlobal,
+                        arrayView2d< T const, USD > const & field,
+                        array2d< real64 > & copy )
+{
+  copy.resize( localToGlobal.size(), 3 );
+  for( localIndex a = 0; a < localToGlobal.size(); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      copy( localToGlobal[a], i ) = field( a, i );
+    }
+  }
+}
+
+/**
+ * @brief Run the problem with a given precision of the nodal state.
+ * @param precision the explicitPrecision option of the solver
+ * @param displacement the final total displacement, by global node index
+ * @param velocity the final velocity, by global node index
+ */
+void runExplicit( string const & precision,
+                  array2d< real64 > & displacement,
+                  array2d< real64 > & velocity )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  string const xmlInput = xmlInputBegin + precision + xmlInputEnd;
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  SolidMechanicsLagrangianFEM & solver =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  integer const numSteps = 50;
+  real64 const dt = 1.0e-5;
+  for( integer cycle = 0; cycle < numSteps; ++cycle )
+  {
+    solver.solverStep( cycle * dt, dt, cycle, domain );
+  }
+
+  NodeManager const & nodeManager = domain.getMeshBody( 0 ).getBaseDiscretization().getNodeManager();
+  arrayView1d< globalIndex const > const localToGlobal = nodeManager.localToGlobalMap();
+  copyByGlobalIndex( localToGlobal, nodeManager.totalDisplacement().toViewConst(), displacement );
+  if( solver.getExplicitPrecisionOption() == SolidMechanicsLagrangianFEM::ExplicitPrecisionOption::Mixed )
+  {
+    copyByGlobalIndex( localToGlobal,
+                       nodeManager.getReference< array2d< real32, nodes::VELOCITY_PERM > >( dataRepository::keys::Velocity ).toViewConst(),
+                       velocity );
+  }
+  else
+  {
+    copyByGlobalIndex( localToGlobal,
+                       nodeManager.getReference< array2d< real64, nodes::VELOCITY_PERM > >( dataRepository::keys::Velocity ).toViewConst(),
+                       velocity );
+  }
+}
+
+/**
+ * @brief Compare two nodal fields, relatively to the largest value of the reference.
+ * @param reference the reference field
+ * @param field the compared field
+ * @param relativeTolerance the tolerance relative to the largest value of @p reference
+ */
+void compareFields( arrayView2d< real64 const > const & reference,
+                    arrayView2d< real64 const > const & field,
+                    real64 const relativeTolerance )
+{
+  ASSERT_EQ( field.size( 0 ), reference.size( 0 ) );
+
+  real64 maxValue = 0.0;
+  for( localIndex a = 0; a < reference.size( 0 ); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      maxValue = fmax( maxValue, fabs( reference( a, i ) ) );
+    }
+  }
+  // the wave must have reached the nodes for the comparison to be meaningful
+  ASSERT_GT( maxValue, 0.0 );
+
+  for( localIndex a = 0; a < reference.size( 0 ); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      EXPECT_NEAR( field( a, i ), reference( a, i ), relativeTolerance * maxValue ) << "node " << a << ", component " << i;
+    }
+  }
+}
+
+TEST( MixedPrecisionTest, sameFieldsAsDoublePrecision )
+{
+  array2d< real64 > doubleDisplacement, doubleVelocity;
+  runExplicit( "Double", doubleDisplacement, doubleVelocity );
+
+  array2d< real64 > mixedDisplacement, mixedVelocity;
+  runExplicit( "Mixed", mixedDisplacement, mixedVelocity );
+
+  // the element computations are in double precision, only the nodal velocity and forces are rounded
+  real64 const relativeTolerance = 1.0e-4;
+  compareFields( doubleDisplacement.toViewConst(), mixedDisplacement.toViewConst(), relativeTolerance );
+  compareFields( doubleVelocity.toViewConst(), mixedVelocity.toViewConst(), relativeTolerance );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,246 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2020-     GEOSX Contributors
+ * All right reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/wavePropagation/ElasticWaveEquationSEM.hpp"
+#include "physicsSolvers/wavePropagation/ElasticWaveEquationSEMKernel.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks that the sum-factorized stiffness kernel used with the collocated Q3 quadrature gives
+// the same stiffness vector as the assembly over all node pairs, on a distorted mesh and a non-uniform displacement.
+// It lives apart from testWavePropagation.cpp because the acoustic and elastic solvers define mesh data with the same names.
+char const * xmlInput =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <ElasticSEM\n"
+  "      name=\"elasticSolver\"\n"
+  "      cflFactor=\"0.25\"\n"
+  "      discretization=\"FE3\"\n"
+  "      targetRegions=\"{ Region }\"\n"
+  "      sourceCoordinates=\"{ { 50, 50, 50 } }\"\n"
+  "      timeSourceFrequency=\"2\"\n"
+  "      receiverCoordinates=\"{ { 50, 50, 50 } }\"\n"
+  "      outputSeismoTrace=\"0\"\n"
+  "      dtSeismoTrace=\"0.1\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 100 }\"\n"
+  "      yCoords=\"{ 0, 100 }\"\n"
+  "      zCoords=\"{ 0, 100 }\"\n"
+  "      nx=\"{ 2 }\"\n"
+  "      ny=\"{ 2 }\"\n"
+  "      nz=\"{ 2 }\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <Events\n"
+  "    maxTime=\"1\">\n"
+  "    <PeriodicEvent\n"
+  "      name=\"solverApplications\"\n"
+  "      forceDt=\"0.1\"\n"
+  "      target=\"/Solvers/elasticSolver\"/>\n"
+  "  </Events>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace\n"
+  "        name=\"FE3\"\n"
+  "        order=\"3\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"Region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ nullModel }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <NullModel\n"
+  "      name=\"nullModel\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification\n"
+  "      name=\"cellVelocityVp\"\n"
+  "      initialCondition=\"1\"\n"
+  "      objectPath=\"ElementRegions/Region/cb\"\n"
+  "      fieldName=\"mediumVelocityVp\"\n"
+  "      scale=\"3000\"\n"
+  "      setNames=\"{ all }\"/>\n"
+  "    <FieldSpecification\n"
+  "      name=\"cellVelocityVs\"\n"
+  "      initialCondition=\"1\"\n"
+  "      objectPath=\"ElementRegions/Region/cb\"\n"
+  "      fieldName=\"mediumVelocityVs\"\n"
+  "      scale=\"1000\"\n"
+  "      setNames=\"{ all }\"/>\n"
+  "    <FieldSpecification\n"
+  "      name=\"cellDensity\"\n"
+  "      initialCondition=\"1\"\n"
+  "      objectPath=\"ElementRegions/Region/cb\"\n"
+  "      fieldName=\"mediumDensity\"\n"
+  "      scale=\"2000\"\n"
+  "      setNames=\"{ all }\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>\n";
+
+/// The Q3 element, forced onto the node-pair path of the SEM stiffness kernels.
+class Q3_Hexahedron_Lagrange_GaussLobatto_NodePairs : public finiteElement::Q3_Hexahedron_Lagrange_GaussLobatto
+{
+public:
+  /// The quadrature is not exploited, so that every node pair is assembled.
+  constexpr static bool collocatedQuadrature = false;
+};
+
+/**
+ * @brief Compute the elastic stiffness vector of a subregion with a given finite element type.
+ * @tparam FE_TYPE the finite element type
+ * @param mesh the mesh level
+ * @param subRegion the subregion
+ * @param finiteElement the finite element
+ * @return the three components of the stiffness vector of the mesh level
+ */
+template< typename FE_TYPE >
+array2d< real32 > computeElasticStiffness( MeshLevel & mesh,
+                                           CellElementSubRegion & subRegion,
+                                           FE_TYPE const & finiteElement )
+{
+  using KernelType = elasticWaveEquationSEMKernels::ExplicitElasticSEM< CellElementSubRegion, constitutive::NullModel, FE_TYPE >;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView1d< real32 > const stiffnessVectorx = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVectorx >();
+  arrayView1d< real32 > const stiffnessVectory = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVectory >();
+  arrayView1d< real32 > const stiffnessVectorz = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVectorz >();
+  stiffnessVectorx.zero();
+  stiffnessVectory.zero();
+  stiffnessVectorz.zero();
+
+  constitutive::NullModel & nullModel = subRegion.registerGroup< constitutive::NullModel >( "nullModelGroup" );
+  KernelType const kernel( nodeManager, mesh.getEdgeManager(), mesh.getFaceManager(), 0, subRegion,
+                           finiteElement, nullModel, 0.1 );
+  KernelType::template kernelLaunch< serialPolicy, KernelType >( subRegion.size(), kernel );
+  subRegion.deregisterGroup( "nullModelGroup" );
+
+  array2d< real32 > result( nodeManager.size(), 3 );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    result[a][0] = stiffnessVectorx[a];
+    result[a][1] = stiffnessVectory[a];
+    result[a][2] = stiffnessVectorz[a];
+  }
+  return result;
+}
+
+class ElasticWaveEquationSEMQ3Test : public ::testing::Test
+{
+public:
+
+  ElasticWaveEquationSEMQ3Test():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+  }
+
+  GeosxState state;
+};
+
+TEST_F( ElasticWaveEquationSEMQ3Test, SumFactorizationMatchesNodePairs )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  ElasticWaveEquationSEM & propagator = state.getProblemManager().getPhysicsSolverManager().getGroup< ElasticWaveEquationSEM >( "elasticSolver" );
+
+  propagator.forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                                         MeshLevel & mesh,
+                                                                         arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+
+    // distort the mesh and use a non-uniform displacement, so that every coupling between the components matters
+    arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+    arrayView1d< real32 > const ux_n = nodeManager.getExtrinsicData< extrinsicMeshData::Displacementx_n >();
+    arrayView1d< real32 > const uy_n = nodeManager.getExtrinsicData< extrinsicMeshData::Displacementy_n >();
+    arrayView1d< real32 > const uz_n = nodeManager.getExtrinsicData< extrinsicMeshData::Displacementz_n >();
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      real64 const x = X[a][0];
+      real64 const y = X[a][1];
+      real64 const z = X[a][2];
+      X[a][0] += 0.05 * y * ( 100.0 - y ) / 100.0;
+      X[a][1] += 0.03 * z * ( 100.0 - z ) / 100.0;
+      X[a][2] += 0.04 * x * ( 100.0 - x ) / 100.0;
+      ux_n[a] = std::sin( 0.037 * y + 0.011 * z );
+      uy_n[a] = std::cos( 0.023 * z - 0.017 * x );
+      uz_n[a] = std::sin( 0.031 * x ) * std::cos( 0.019 * y );
+    }
+
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      finiteElement::Q3_Hexahedron_Lagrange_GaussLobatto const & q3 =
+        dynamicCast< finiteElement::Q3_Hexahedron_Lagrange_GaussLobatto const & >(
+          subRegion.getReference< finiteElement::FiniteElementBase >( propagator.getDiscretizationName() ) );
+      Q3_Hexahedron_Lagrange_GaussLobatto_NodePairs const q3NodePairs;
+
+      array2d< real32 > const sumFactorized = computeElasticStiffness( mesh, subRegion, q3 );
+      array2d< real32 > const nodePairs = computeElasticStiffness( mesh, subRegion, q3NodePairs );
+
+      real32 maxNorm = 0.0;
+      for( localIndex a = 0; a < nodePairs.size( 0 ); ++a )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          maxNorm = std::max( maxNorm, std::abs( nodePairs[a][i] ) );
+        }
+      }
+      ASSERT_GT( maxNorm, 0.0 );
+      for( localIndex a = 0; a < nodePairs.size( 0 ); ++a )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          EXPECT_NEAR( sumFactorized[a][i], nodePairs[a][i], 1.0e-4 * maxNorm );
+        }
+      }
+    } );
+  } );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -23,6 +23,8 @@
 #include "physicsSolvers/PhysicsSolverManager.hpp"
 #include "physicsSolvers/wavePropagation/WaveSolverBase.hpp"
 #include "physicsSolvers/wavePropagation/AcousticWaveEquationSEM.hpp"
+#include "physicsSolvers/wavePropagation/AcousticWaveEquationSEMKernel.hpp"
+#include "physicsSolvers/wavePropagation/WaveCheckpointStorage.hpp"
 
 #include <gtest/gtest.h>
 
@@ -220,6 +222,691 @@ TEST_F( AcousticWaveEquationSEMTest, SeismoTrace )
   }
 }
 
+// This unit test checks that the shots propagated together give the same traces as separate runs with their sources.
+std::string shotsXmlInput( std::string const & sourceCoordinates,
+                           integer const sourcesPerShot )
+{
+  return std::string(
+    "<?xml version=\"1.0\" ?>\n"
+    "<Problem>\n"
+    "  <Solvers>\n"
+    "    <AcousticSEM\n"
+    "      name=\"acousticSolver\"\n"
+    "      cflFactor=\"0.25\"\n"
+    "      discretization=\"FE1\"\n"
+    "      targetRegions=\"{ Region }\"\n"
+    "      sourceCoordinates=\"" ) + sourceCoordinates + std::string( "\"\n"
+    "      sourcesPerShot=\"" ) + std::to_string( sourcesPerShot ) + std::string( "\"\n"
+    "      timeSourceFrequency=\"100\"\n"
+    "      receiverCoordinates=\"{ { 25, 25, 25 }, { 5, 32, 15 }, { 33, 8, 21 } }\"\n"
+    "      outputSeismoTrace=\"0\"\n"
+    "      dtSeismoTrace=\"0.001\"/>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh\n"
+    "      name=\"mesh\"\n"
+    "      elementTypes=\"{ C3D8 }\"\n"
+    "      xCoords=\"{ 0, 40 }\"\n"
+    "      yCoords=\"{ 0, 40 }\"\n"
+    "      zCoords=\"{ 0, 40 }\"\n"
+    "      nx=\"{ 4 }\"\n"
+    "      ny=\"{ 4 }\"\n"
+    "      nz=\"{ 4 }\"\n"
+    "      cellBlockNames=\"{ cb }\"/>\n"
+    "  </Mesh>\n"
+    "  <Events\n"
+    "    maxTime=\"0.01\">\n"
+    "    <PeriodicEvent\n"
+    "      name=\"solverApplications\"\n"
+    "      forceDt=\"0.001\"\n"
+    "      target=\"/Solvers/acousticSolver\"/>\n"
+    "  </Events>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteElements>\n"
+    "      <FiniteElementSpace\n"
+    "        name=\"FE1\"\n"
+    "        order=\"1\"/>\n"
+    "    </FiniteElements>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion\n"
+    "      name=\"Region\"\n"
+    "      cellBlocks=\"{ cb }\"\n"
+    "      materialList=\"{ nullModel }\"/>\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <NullModel\n"
+    "      name=\"nullModel\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    "    <FieldSpecification\n"
+    "      name=\"cellVelocity\"\n"
+    "      initialCondition=\"1\"\n"
+    "      objectPath=\"ElementRegions/Region/cb\"\n"
+    "      fieldName=\"mediumVelocity\"\n"
+    "      scale=\"1500\"\n"
+    "      setNames=\"{ all }\"/>\n"
+    "  </FieldSpecifications>\n"
+    "</Problem>\n" );
+}
+
+/**
+ * @brief Run the shots problem and return the recorded traces.
+ * @param sourceCoordinates the coordinates of the sources, in the XML format
+ * @param sourcesPerShot the number of sources fired together in each shot, 0 for a single shot
+ * @return the traces, one column per receiver and per shot, the receivers of a shot being consecutive
+ */
+array2d< real32 > computeShotTraces( std::string const & sourceCoordinates,
+                                     integer const sourcesPerShot )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), shotsXmlInput( sourceCoordinates, sourcesPerShot ).c_str() );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator = state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  real64 const dt = 0.001;
+  integer const numSteps = 10;
+  real64 time_n = 0.0;
+  for( integer i = 0; i < numSteps; ++i )
+  {
+    propagator.solverStep( time_n, dt, i, domain );
+    time_n += dt;
+  }
+  propagator.cleanup( time_n, numSteps, 0, 0, domain );
+
+  array2d< real32 > & pReceivers = propagator.getReference< array2d< real32 > >( AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString() );
+  pReceivers.move( LvArray::MemorySpace::host, false );
+  return pReceivers;
+}
+
+TEST( AcousticWaveEquationSEMShotsTest, SameTracesAsSeparateRuns )
+{
+  // five shots of two sources, more than the shots processed by a single kernel launch
+  std::vector< std::string > const shotSources = { "{ 15, 15, 15 }, { 12, 27, 31 }",
+                                                   "{ 22, 18, 9 }, { 30, 30, 30 }",
+                                                   "{ 7, 33, 20 }, { 19, 21, 13 }",
+                                                   "{ 26, 11, 28 }, { 14, 6, 17 }",
+                                                   "{ 20, 20, 20 }, { 35, 24, 8 }" };
+  localIndex const numShots = LvArray::integerConversion< localIndex >( shotSources.size() );
+  localIndex const numReceivers = 3;
+
+  std::string allSources = "{ ";
+  for( localIndex ishot = 0; ishot < numShots; ++ishot )
+  {
+    allSources += ( ishot > 0 ? ", " : "" ) + shotSources[ishot];
+  }
+  allSources += " }";
+  array2d< real32 > const shotTraces = computeShotTraces( allSources, 2 );
+  ASSERT_EQ( shotTraces.size( 1 ), numReceivers * numShots );
+
+  for( localIndex ishot = 0; ishot < numShots; ++ishot )
+  {
+    array2d< real32 > const traces = computeShotTraces( "{ " + shotSources[ishot] + " }", 0 );
+    ASSERT_EQ( traces.size( 0 ), shotTraces.size( 0 ) );
+    ASSERT_EQ( traces.size( 1 ), numReceivers );
+
+    real32 maxNorm = 0.0;
+    for( localIndex iSample = 0; iSample < traces.size( 0 ); ++iSample )
+    {
+      for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+      {
+        maxNorm = std::max( maxNorm, std::abs( traces[iSample][ircv] ) );
+      }
+    }
+    ASSERT_GT( maxNorm, 0.0 );
+    for( localIndex iSample = 0; iSample < traces.size( 0 ); ++iSample )
+    {
+      for( localIndex ircv = 0; ircv < numReceivers; ++ircv )
+      {
+        EXPECT_NEAR( shotTraces[iSample][ishot * numReceivers + ircv], traces[iSample][ircv], 1.0e-5 * maxNorm );
+      }
+    }
+  }
+}
+
+// This unit test checks the local time stepping against the global time stepping. The right half of the mesh is
+// twice as fast as the left half: with the cflFactor of 0.5, the stable time step of its elements is 1/600 s and
+// the one of the elements of the left half is 1/300 s.
+std::string localTimeSteppingXmlInput( integer const numTimeSteppingLevels,
+                                       real64 const dt )
+{
+  return std::string(
+    "<?xml version=\"1.0\" ?>\n"
+    "<Problem>\n"
+    "  <Solvers>\n"
+    "    <AcousticSEM\n"
+    "      name=\"acousticSolver\"\n"
+    "      cflFactor=\"0.5\"\n"
+    "      discretization=\"FE1\"\n"
+    "      targetRegions=\"{ Region }\"\n"
+    "      sourceCoordinates=\"{ { 20, 20, 20 } }\"\n"
+    "      timeSourceFrequency=\"20\"\n"
+    "      receiverCoordinates=\"{ { 60, 20, 20 }, { 10, 30, 10 }, { 45, 15, 25 } }\"\n"
+    "      outputSeismoTrace=\"0\"\n"
+    "      dtSeismoTrace=\"0.0025\"\n"
+    "      numTimeSteppingLevels=\"" ) + std::to_string( numTimeSteppingLevels ) + std::string( "\"/>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh\n"
+    "      name=\"mesh\"\n"
+    "      elementTypes=\"{ C3D8 }\"\n"
+    "      xCoords=\"{ 0, 80 }\"\n"
+    "      yCoords=\"{ 0, 40 }\"\n"
+    "      zCoords=\"{ 0, 40 }\"\n"
+    "      nx=\"{ 8 }\"\n"
+    "      ny=\"{ 4 }\"\n"
+    "      nz=\"{ 4 }\"\n"
+    "      cellBlockNames=\"{ cb }\"/>\n"
+    "  </Mesh>\n"
+    "  <Geometry>\n"
+    "    <Box\n"
+    "      name=\"fast\"\n"
+    "      xMin=\"{ 39.99, -0.01, -0.01 }\"\n"
+    "      xMax=\"{ 80.01, 40.01, 40.01 }\"/>\n"
+    "  </Geometry>\n"
+    "  <Events\n"
+    "    maxTime=\"0.1\">\n"
+    "    <PeriodicEvent\n"
+    "      name=\"solverApplications\"\n"
+    "      forceDt=\"" ) + GEOSX_FMT( "{:.15g}", dt ) + std::string( "\"\n"
+    "      target=\"/Solvers/acousticSolver\"/>\n"
+    "  </Events>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteElements>\n"
+    "      <FiniteElementSpace\n"
+    "        name=\"FE1\"\n"
+    "        order=\"1\"/>\n"
+    "    </FiniteElements>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion\n"
+    "      name=\"Region\"\n"
+    "      cellBlocks=\"{ cb }\"\n"
+    "      materialList=\"{ nullModel }\"/>\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <NullModel\n"
+    "      name=\"nullModel\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    "    <FieldSpecification\n"
+    "      name=\"cellVelocity\"\n"
+    "      initialCondition=\"1\"\n"
+    "      objectPath=\"ElementRegions/Region/cb\"\n"
+    "      fieldName=\"mediumVelocity\"\n"
+    "      scale=\"1500\"\n"
+    "      setNames=\"{ all }\"/>\n"
+    "    <FieldSpecification\n"
+    "      name=\"fastCellVelocity\"\n"
+    "      initialCondition=\"1\"\n"
+    "      objectPath=\"ElementRegions/Region/cb\"\n"
+    "      fieldName=\"mediumVelocity\"\n"
+    "      scale=\"3000\"\n"
+    "      setNames=\"{ fast }\"/>\n"
+    "  </FieldSpecifications>\n"
+    "</Problem>\n" );
+}
+
+/**
+ * @brief Run the local time stepping problem and return the recorded traces.
+ * @param numTimeSteppingLevels the maximum number of time step levels
+ * @param dt the time step of the event
+ * @return the traces, sampled every 0.0025 s
+ */
+array2d< real32 > computeLocalTimeSteppingTraces( integer const numTimeSteppingLevels,
+                                                  real64 const dt )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), localTimeSteppingXmlInput( numTimeSteppingLevels, dt ).c_str() );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator = state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  integer const numSteps = LvArray::integerConversion< integer >( std::lround( 0.1 / dt ) );
+  real64 time_n = 0.0;
+  for( integer i = 0; i < numSteps; ++i )
+  {
+    propagator.solverStep( time_n, dt, i, domain );
+    time_n += dt;
+  }
+  propagator.cleanup( time_n, numSteps, 0, 0, domain );
+
+  array2d< real32 > & pReceivers = propagator.getReference< array2d< real32 > >( AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString() );
+  pReceivers.move( LvArray::MemorySpace::host, false );
+  return pReceivers;
+}
+
+// With a time step stable everywhere, all the elements are on the first level and the local time stepping
+// takes the same steps as the global time stepping.
+TEST( AcousticWaveEquationSEMLocalTimeSteppingTest, SingleLevelMatchesGlobalStep )
+{
+  array2d< real32 > const globalTraces = computeLocalTimeSteppingTraces( 1, 0.00125 );
+  array2d< real32 > const localTraces = computeLocalTimeSteppingTraces( 2, 0.00125 );
+
+  ASSERT_EQ( localTraces.size( 0 ), globalTraces.size( 0 ) );
+  ASSERT_EQ( localTraces.size( 1 ), globalTraces.size( 1 ) );
+  for( localIndex iSample = 0; iSample < globalTraces.size( 0 ); ++iSample )
+  {
+    for( localIndex ircv = 0; ircv < globalTraces.size( 1 ); ++ircv )
+    {
+      EXPECT_EQ( localTraces[iSample][ircv], globalTraces[iSample][ircv] );
+    }
+  }
+}
+
+// With a time step only stable in the left half, the right half is advanced with half of it, and the traces
+// stay close to the ones of the global time stepping with the time step of the right half everywhere.
+TEST( AcousticWaveEquationSEMLocalTimeSteppingTest, TwoLevelsCloseToRefinedGlobalStep )
+{
+  array2d< real32 > const refinedTraces = computeLocalTimeSteppingTraces( 1, 0.00125 );
+  array2d< real32 > const localTraces = computeLocalTimeSteppingTraces( 2, 0.0025 );
+
+  ASSERT_EQ( localTraces.size( 0 ), refinedTraces.size( 0 ) );
+  ASSERT_EQ( localTraces.size( 1 ), refinedTraces.size( 1 ) );
+  for( localIndex ircv = 0; ircv < refinedTraces.size( 1 ); ++ircv )
+  {
+    real32 maxNorm = 0.0;
+    for( localIndex iSample = 0; iSample < refinedTraces.size( 0 ); ++iSample )
+    {
+      maxNorm = std::max( maxNorm, std::abs( refinedTraces[iSample][ircv] ) );
+    }
+    ASSERT_GT( maxNorm, 0.0 );
+    for( localIndex iSample = 0; iSample < refinedTraces.size( 0 ); ++iSample )
+    {
+      EXPECT_NEAR( localTraces[iSample][ircv], refinedTraces[iSample][ircv], 0.1 * maxNorm );
+    }
+  }
+}
+
+// This unit test checks the derivative of the misfit with respect to the squared slowness of a cell against
+// centered finite differences. There are fewer checkpoints than forward steps, so that the backward run recomputes
+// forward steps, and the whole boundary is a free surface, so that the damping does not depend on the velocity.
+std::string gradientXmlInput( real64 const perturbedVelocity )
+{
+  return std::string(
+    "<?xml version=\"1.0\" ?>\n"
+    "<Problem>\n"
+    "  <Solvers>\n"
+    "    <AcousticSEM\n"
+    "      name=\"acousticSolver\"\n"
+    "      cflFactor=\"0.25\"\n"
+    "      discretization=\"FE1\"\n"
+    "      targetRegions=\"{ Region }\"\n"
+    "      sourceCoordinates=\"{ { 15, 15, 15 } }\"\n"
+    "      timeSourceFrequency=\"100\"\n"
+    "      receiverCoordinates=\"{ { 25, 25, 25 }, { 5, 32, 15 } }\"\n"
+    "      outputSeismoTrace=\"0\"\n"
+    "      dtSeismoTrace=\"0.001\"\n"
+    "      computeGradient=\"1\"\n"
+    "      numCheckpoints=\"3\"/>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh\n"
+    "      name=\"mesh\"\n"
+    "      elementTypes=\"{ C3D8 }\"\n"
+    "      xCoords=\"{ 0, 40 }\"\n"
+    "      yCoords=\"{ 0, 40 }\"\n"
+    "      zCoords=\"{ 0, 40 }\"\n"
+    "      nx=\"{ 4 }\"\n"
+    "      ny=\"{ 4 }\"\n"
+    "      nz=\"{ 4 }\"\n"
+    "      cellBlockNames=\"{ cb }\"/>\n"
+    "  </Mesh>\n"
+    "  <Geometry>\n"
+    "    <Box\n"
+    "      name=\"perturbation\"\n"
+    "      xMin=\"{ 9.99, 9.99, 9.99 }\"\n"
+    "      xMax=\"{ 20.01, 20.01, 20.01 }\"/>\n"
+    "  </Geometry>\n"
+    "  <Events\n"
+    "    maxTime=\"0.02\">\n"
+    "    <PeriodicEvent\n"
+    "      name=\"solverApplications\"\n"
+    "      forceDt=\"0.001\"\n"
+    "      target=\"/Solvers/acousticSolver\"/>\n"
+    "  </Events>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteElements>\n"
+    "      <FiniteElementSpace\n"
+    "        name=\"FE1\"\n"
+    "        order=\"1\"/>\n"
+    "    </FiniteElements>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion\n"
+    "      name=\"Region\"\n"
+    "      cellBlocks=\"{ cb }\"\n"
+    "      materialList=\"{ nullModel }\"/>\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <NullModel\n"
+    "      name=\"nullModel\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    "    <FieldSpecification\n"
+    "      name=\"cellVelocity\"\n"
+    "      initialCondition=\"1\"\n"
+    "      objectPath=\"ElementRegions/Region/cb\"\n"
+    "      fieldName=\"mediumVelocity\"\n"
+    "      scale=\"1500\"\n"
+    "      setNames=\"{ all }\"/>\n"
+    "    <FieldSpecification\n"
+    "      name=\"perturbedCellVelocity\"\n"
+    "      initialCondition=\"1\"\n"
+    "      objectPath=\"ElementRegions/Region/cb\"\n"
+    "      fieldName=\"mediumVelocity\"\n"
+    "      scale=\"" ) + GEOSX_FMT( "{:.15g}", perturbedVelocity ) + std::string( "\"\n"
+    "      setNames=\"{ perturbation }\"/>\n"
+    "    <FieldSpecification\n"
+    "      name=\"freeSurface\"\n"
+    "      objectPath=\"faceManager\"\n"
+    "      fieldName=\"FreeSurface\"\n"
+    "      scale=\"0.0\"\n"
+    "      setNames=\"{ xneg, xpos, yneg, ypos, zneg, zpos }\"/>\n"
+    "  </FieldSpecifications>\n"
+    "</Problem>\n" );
+}
+
+/**
+ * @brief Run the gradient problem, and return the misfit and the gradient in the perturbed cell.
+ * @param perturbedVelocity the velocity of the perturbed cell
+ * @param gradient the derivative of the misfit with respect to the squared slowness of the perturbed cell
+ * @return half the time integral of the squared recorded pressures, the observed pressures being zero
+ */
+real64 computeMisfitAndGradient( real64 const perturbedVelocity,
+                                 real64 & gradient )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), gradientXmlInput( perturbedVelocity ).c_str() );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator = state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  real64 const dt = 0.001;
+  integer const numSteps = 20;
+  real64 time_n = 0.0;
+  for( integer i = 0; i < numSteps; ++i )
+  {
+    propagator.solverStep( time_n, dt, i, domain );
+    time_n += dt;
+  }
+  // cleanup records the last samples and runs the backward problem
+  propagator.cleanup( time_n, numSteps, 0, 0, domain );
+
+  arrayView2d< real32 const > const pReceivers =
+    propagator.getReference< array2d< real32 > >( AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString() ).toViewConst();
+  pReceivers.move( LvArray::MemorySpace::host, false );
+  // the traces are sampled every time step
+  real64 misfit = 0.0;
+  for( localIndex iSample = 0; iSample < pReceivers.size( 0 ); ++iSample )
+  {
+    for( localIndex ircv = 0; ircv < pReceivers.size( 1 ); ++ircv )
+    {
+      misfit += 0.5 * dt * pReceivers[iSample][ircv] * pReceivers[iSample][ircv];
+    }
+  }
+
+  propagator.forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                                         MeshLevel & mesh,
+                                                                         arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      SortedArrayView< localIndex const > const perturbedCells =
+        subRegion.sets().getReference< SortedArray< localIndex > >( "perturbation" ).toViewConst();
+      ASSERT_EQ( perturbedCells.size(), 1 );
+
+      arrayView1d< real32 const > const partialGradient = subRegion.getExtrinsicData< extrinsicMeshData::PartialGradient >();
+      partialGradient.move( LvArray::MemorySpace::host, false );
+      gradient = partialGradient[perturbedCells[0]];
+    } );
+  } );
+
+  return misfit;
+}
+
+TEST( AcousticWaveEquationSEMGradientTest, FiniteDifferences )
+{
+  real64 const velocity = 1500.0;
+  real64 const slowness2 = 1.0 / ( velocity * velocity );
+  real64 const perturbation = 1.0e-2 * slowness2;
+
+  real64 gradient = 0.0;
+  real64 unused = 0.0;
+  computeMisfitAndGradient( velocity, gradient );
+  real64 const misfitPlus = computeMisfitAndGradient( 1.0 / std::sqrt( slowness2 + perturbation ), unused );
+  real64 const misfitMinus = computeMisfitAndGradient( 1.0 / std::sqrt( slowness2 - perturbation ), unused );
+
+  real64 const finiteDifference = ( misfitPlus - misfitMinus ) / ( 2.0 * perturbation );
+  ASSERT_GT( std::abs( finiteDifference ), 0.0 );
+  EXPECT_NEAR( gradient, finiteDifference, 2.0e-2 * std::abs( finiteDifference ) );
+}
+
+// This unit test checks that the sum-factorized stiffness kernel used with the collocated Q3 quadrature gives
+// the same stiffness vector as the assembly over all node pairs, on a distorted mesh and a non-uniform pressure.
+char const * xmlInputQ3 =
+  "<?xml version=\"1.0\" ?>\n"
+  "<Problem>\n"
+  "  <Solvers>\n"
+  "    <AcousticSEM\n"
+  "      name=\"acousticSolver\"\n"
+  "      cflFactor=\"0.25\"\n"
+  "      discretization=\"FE3\"\n"
+  "      targetRegions=\"{ Region }\"\n"
+  "      sourceCoordinates=\"{ { 50, 50, 50 } }\"\n"
+  "      timeSourceFrequency=\"2\"\n"
+  "      receiverCoordinates=\"{ { 50, 50, 50 } }\"\n"
+  "      outputSeismoTrace=\"0\"\n"
+  "      dtSeismoTrace=\"0.1\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh\n"
+  "      name=\"mesh\"\n"
+  "      elementTypes=\"{ C3D8 }\"\n"
+  "      xCoords=\"{ 0, 100 }\"\n"
+  "      yCoords=\"{ 0, 100 }\"\n"
+  "      zCoords=\"{ 0, 100 }\"\n"
+  "      nx=\"{ 2 }\"\n"
+  "      ny=\"{ 2 }\"\n"
+  "      nz=\"{ 2 }\"\n"
+  "      cellBlockNames=\"{ cb }\"/>\n"
+  "  </Mesh>\n"
+  "  <Events\n"
+  "    maxTime=\"1\">\n"
+  "    <PeriodicEvent\n"
+  "      name=\"solverApplications\"\n"
+  "      forceDt=\"0.1\"\n"
+  "      target=\"/Solvers/acousticSolver\"/>\n"
+  "  </Events>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace\n"
+  "        name=\"FE3\"\n"
+  "        order=\"3\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion\n"
+  "      name=\"Region\"\n"
+  "      cellBlocks=\"{ cb }\"\n"
+  "      materialList=\"{ nullModel }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <NullModel\n"
+  "      name=\"nullModel\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification\n"
+  "      name=\"cellVelocity\"\n"
+  "      initialCondition=\"1\"\n"
+  "      objectPath=\"ElementRegions/Region/cb\"\n"
+  "      fieldName=\"mediumVelocity\"\n"
+  "      scale=\"1500\"\n"
+  "      setNames=\"{ all }\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>\n";
+
+/// The Q3 element, forced onto the node-pair path of the SEM stiffness kernels.
+class Q3_Hexahedron_Lagrange_GaussLobatto_NodePairs : public finiteElement::Q3_Hexahedron_Lagrange_GaussLobatto
+{
+public:
+  /// The quadrature is not exploited, so that every node pair is assembled.
+  constexpr static bool collocatedQuadrature = false;
+};
+
+/**
+ * @brief Compute the acoustic stiffness vector of a subregion with a given finite element type.
+ * @tparam FE_TYPE the finite element type
+ * @param mesh the mesh level
+ * @param subRegion the subregion
+ * @param finiteElement the finite element
+ * @return the stiffness vector of the mesh level
+ */
+template< typename FE_TYPE >
+array1d< real32 > computeAcousticStiffness( MeshLevel & mesh,
+                                            CellElementSubRegion & subRegion,
+                                            FE_TYPE const & finiteElement )
+{
+  using KernelType = acousticWaveEquationSEMKernels::ExplicitAcousticSEM< CellElementSubRegion, constitutive::NullModel, FE_TYPE >;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView1d< real32 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >();
+  stiffnessVector.zero();
+
+  constitutive::NullModel & nullModel = subRegion.registerGroup< constitutive::NullModel >( "nullModelGroup" );
+  KernelType const kernel( nodeManager, mesh.getEdgeManager(), mesh.getFaceManager(), 0, subRegion,
+                           finiteElement, nullModel, 0.1, extrinsicMeshData::Pressure_n::key() );
+  KernelType::template kernelLaunch< serialPolicy, KernelType >( subRegion.size(), kernel );
+  subRegion.deregisterGroup( "nullModelGroup" );
+
+  array1d< real32 > result;
+  result.resize( stiffnessVector.size() );
+  for( localIndex a = 0; a < stiffnessVector.size(); ++a )
+  {
+    result[a] = stiffnessVector[a];
+  }
+  return result;
+}
+
+class AcousticWaveEquationSEMQ3Test : public ::testing::Test
+{
+public:
+
+  AcousticWaveEquationSEMQ3Test():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInputQ3 );
+  }
+
+  GeosxState state;
+};
+
+TEST_F( AcousticWaveEquationSEMQ3Test, SumFactorizationMatchesNodePairs )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator = state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  propagator.forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                                         MeshLevel & mesh,
+                                                                         arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+
+    // distort the mesh and use a non-uniform pressure, so that every term of the Jacobian and of the gradient matters
+    arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+    arrayView1d< real32 > const p_n = nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >();
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      real64 const x = X[a][0];
+      real64 const y = X[a][1];
+      real64 const z = X[a][2];
+      X[a][0] += 0.05 * y * ( 100.0 - y ) / 100.0;
+      X[a][1] += 0.03 * z * ( 100.0 - z ) / 100.0;
+      X[a][2] += 0.04 * x * ( 100.0 - x ) / 100.0;
+      p_n[a] = std::sin( 0.037 * x + 0.021 * y ) * std::cos( 0.029 * z );
+    }
+
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      finiteElement::Q3_Hexahedron_Lagrange_GaussLobatto const & q3 =
+        dynamicCast< finiteElement::Q3_Hexahedron_Lagrange_GaussLobatto const & >(
+          subRegion.getReference< finiteElement::FiniteElementBase >( propagator.getDiscretizationName() ) );
+      Q3_Hexahedron_Lagrange_GaussLobatto_NodePairs const q3NodePairs;
+
+      array1d< real32 > const sumFactorized = computeAcousticStiffness( mesh, subRegion, q3 );
+      array1d< real32 > const nodePairs = computeAcousticStiffness( mesh, subRegion, q3NodePairs );
+
+      real32 maxNorm = 0.0;
+      for( localIndex a = 0; a < nodePairs.size(); ++a )
+      {
+        maxNorm = std::max( maxNorm, std::abs( nodePairs[a] ) );
+      }
+      ASSERT_GT( maxNorm, 0.0 );
+      for( localIndex a = 0; a < nodePairs.size(); ++a )
+      {
+        EXPECT_NEAR( sumFactorized[a], nodePairs[a], 1.0e-4 * maxNorm );
+      }
+    } );
+  } );
+}
+
+// The stored snapshots come back unchanged without compression, within the quantization step with it,
+// and the same whether they stayed in memory or were written to disk.
+TEST( WaveCheckpointStorageTest, StoreRestore )
+{
+  for( WaveCheckpointStorage::Compression const compression : { WaveCheckpointStorage::Compression::None,
+                                                                 WaveCheckpointStorage::Compression::Quantize16 } )
+  {
+    WaveCheckpointStorage checkpoints( 1, compression, "testWaveCheckpointStorage" );
+
+    array1d< real32 > field( 100 );
+    for( localIndex slot = 0; slot < 3; ++slot )
+    {
+      for( localIndex i = 0; i < field.size(); ++i )
+      {
+        field[i] = std::sin( 0.1 * i + slot );
+      }
+      checkpoints.store( LvArray::integerConversion< integer >( slot ), { field.toViewConst() } );
+    }
+
+    real32 const tolerance = ( compression == WaveCheckpointStorage::Compression::None ) ? 0.0 : 2.0 / 65535.0;
+    for( localIndex slot = 2; slot >= 0; --slot )
+    {
+      field.zero();
+      checkpoints.restore( LvArray::integerConversion< integer >( slot ), { field.toView() } );
+      for( localIndex i = 0; i < field.size(); ++i )
+      {
+        ASSERT_LE( std::abs( field[i] - std::sin( 0.1 * i + slot ) ), tolerance );
+      }
+      checkpoints.release( LvArray::integerConversion< integer >( slot ) );
+    }
+  }
+}
+
+// The binomial schedule always places the next checkpoint strictly inside the range of steps.
+TEST( WaveCheckpointStorageTest, RevolveSplit )
+{
+  for( localIndex numSteps = 2; numSteps < 200; ++numSteps )
+  {
+    for( integer numFreeSlots = 1; numFreeSlots < 10; ++numFreeSlots )
+    {
+      localIndex const split = WaveCheckpointStorage::revolveSplit( 10, 10 + numSteps, numFreeSlots );
+      ASSERT_GT( split, 10 );
+      ASSERT_LT( split, 10 + numSteps );
+    }
+  }
+  // with as many checkpoints as steps, the next one is taken after a single step
+  ASSERT_EQ( WaveCheckpointStorage::revolveSplit( 0, 5, 5 ), 1 );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );